@@ -0,0 +1,525 @@
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Arena.h"
+#include "GreedyStrategy.h"
+#include "HeuristicStrategy.h"
+#include "Playout.h"
+#include "RandomStrategy.h"
+#include "StrategyRegistry.h"
+
+/* *********************************************************************
+Function Name: Arena
+Purpose: Default constructor. No strategies have been entered.
+Parameters: None
+Return Value: None
+Algorithm: Start with empty lists at the first pairing.
+Reference: None
+********************************************************************* */
+Arena::Arena()
+    : m_nextPairing(0), m_maxPips(StandardSet::MAX_PIPS)
+{
+}
+
+/* *********************************************************************
+Function Name: getPairing
+Purpose: Retrieves the result of one pairing.
+Parameters:
+        pairing, an index below getPairingCount().
+        outFirst, outSecond, integers passed by reference. Receive the
+            entrants.
+        outWins, outDraws, outLosses, long longs passed by reference.
+            Receive the games the first entrant won, drew and lost.
+Return Value: UNDECIDED, FIRST_STRONGER, SECOND_STRONGER or EQUAL.
+Algorithm: Copy out the stored counts.
+Reference: None
+********************************************************************* */
+int Arena::getPairing(int pairing, int& outFirst, int& outSecond, long long& outWins, long long& outDraws,
+    long long& outLosses) const {
+    const Pairing& result = m_pairings[pairing];
+    outFirst = result.first;
+    outSecond = result.second;
+    outWins = result.wins;
+    outDraws = result.draws;
+    outLosses = result.losses;
+    return result.decision;
+}
+
+/* *********************************************************************
+Function Name: setMaxPips
+Purpose: Chooses the set the games are dealt from.
+Parameters:
+        maxPips, an integer. 6, 9, 12 or 15, the sets BasicPlayout is
+            built for.
+Return Value: Boolean true if the set was chosen; false, with an
+        error message, for any other set, or for a set other than
+        double-six once a strategy that plays only the real game has
+        been entered.
+Algorithm: Check the set and the entrants, then store it.
+Reference: None
+********************************************************************* */
+bool Arena::setMaxPips(int maxPips) {
+    if (maxPips != 6 && maxPips != 9 && maxPips != 12 && maxPips != 15) {
+        std::cerr << "Error: The arena deals double-6, 9, 12 or 15, not double-" << maxPips << "." << std::endl;
+        return false;
+    }
+
+    for (const Entrant& entrant : m_entrants) {
+        if (entrant.policy == POLICY_REGISTERED && maxPips != StandardSet::MAX_PIPS) {
+            std::cerr << "Error: " << entrant.name << " plays only double-" << StandardSet::MAX_PIPS << "." << std::endl;
+            return false;
+        }
+    }
+
+    m_maxPips = maxPips;
+    return true;
+}
+
+/* *********************************************************************
+Function Name: addEntrant
+Purpose: Enters a strategy by its specification.
+Parameters:
+        name, a string. Any specification StrategyRegistry accepts,
+            such as "greedy", "weighted:file=tuned.txt" or
+            "mcts:ms=20".
+Return Value: Boolean true if the strategy was entered; false, with an
+        error message, if the registry could not make it, or if it
+        is not one of the fixed rules and the games are not dealt
+        from double-six.
+Algorithm: Make the strategy once, to check the specification. If it
+        is one of the fixed rules of HeuristicStrategy, the entrant
+        plays that rule directly as a policy; otherwise each worker
+        makes its own copy of the strategy from the specification.
+Reference: None
+********************************************************************* */
+bool Arena::addEntrant(const std::string& name) {
+    Entrant entrant = {};
+    entrant.name = name;
+
+    std::unique_ptr<ComputerStrategy> strategy = StrategyRegistry::create(name);
+    if (!strategy) {
+        return false;
+    }
+
+    // The fixed rules are played as policies, without a virtual call per move
+    WeightedStrategy weighted;
+    const HeuristicStrategy* heuristic = dynamic_cast<const HeuristicStrategy*>(strategy.get());
+    if (heuristic == nullptr) {
+        if (m_maxPips != StandardSet::MAX_PIPS) {
+            std::cerr << "Error: " << name << " plays only double-" << StandardSet::MAX_PIPS << "." << std::endl;
+            return false;
+        }
+        entrant.policy = POLICY_REGISTERED;
+    }
+    else if (heuristic->getRule() == HeuristicStrategy::RULE_RANDOM) {
+        entrant.policy = POLICY_RANDOM;
+    }
+    else if (heuristic->getRule() == HeuristicStrategy::RULE_WEIGHTED) {
+        entrant.policy = POLICY_WEIGHTED;
+        weighted = heuristic->getWeighted();
+    }
+    else {
+        entrant.policy = POLICY_GREEDY;
+    }
+
+    for (int i = 0; i < WeightedStrategy::WEIGHT_COUNT; ++i) {
+        entrant.weights[i] = weighted.getWeight(i);
+    }
+    m_entrants.push_back(entrant);
+    return true;
+}
+
+/* *********************************************************************
+Function Name: run
+Purpose: Plays the round robin and rates the entrants.
+Parameters:
+        maxGames, an integer. The most games any pairing plays.
+        threadCount, an integer. The number of worker threads, or 0 for
+            one per hardware thread.
+        seed, an unsigned integer. Numbers the deals.
+Return Value: None
+Algorithm:
+        1. List every pair of entrants as a pairing.
+        2. Start the workers on work() and wait for every pairing to
+            be decided or capped.
+        3. Fit the ratings with fitRatings().
+Reference: None
+********************************************************************* */
+void Arena::run(int maxGames, int threadCount, unsigned int seed) {
+    // 1. The pairings
+    m_pairings.clear();
+    m_nextPairing = 0;
+    for (int first = 0; first < getEntrantCount(); ++first) {
+        for (int second = first + 1; second < getEntrantCount(); ++second) {
+            m_pairings.push_back({ first, second, 0, 0, 0, 0, UNDECIDED });
+        }
+    }
+
+    // 2. The games
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::thread::hardware_concurrency());
+        if (threadCount <= 0) { threadCount = 1; }
+    }
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threadCount; ++t) {
+        workers.emplace_back(&Arena::work, this, maxGames, seed);
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    // 3. The ratings
+    fitRatings();
+}
+
+/* *********************************************************************
+Function Name: getLogLikelihoodRatio
+Purpose: Computes the sequential test's statistic for a set of results.
+Parameters:
+        wins, draws, losses, long longs. The games of one side.
+        elo0, elo1, doubles. The Elo differences of the null and the
+            alternative hypothesis.
+Return Value: The approximate log-likelihood ratio of the alternative
+        to the null, or 0 before any game.
+Algorithm: Turn both hypotheses into expected scores, then compare
+        them with the mean and variance of the scores observed, as the
+        generalized SPRT does. The variance counts one more win and
+        one more loss, so that two strategies that have drawn every
+        game, as identical ones do, are still found equal.
+Reference: Van den Bergh, M. (2016), "A practical introduction to the
+        GSPRT"
+********************************************************************* */
+double Arena::getLogLikelihoodRatio(long long wins, long long draws, long long losses, double elo0, double elo1) {
+    double games = static_cast<double>(wins + draws + losses);
+    if (games == 0.0) {
+        return 0.0;
+    }
+
+    double mean = (wins + 0.5 * draws) / games;
+    double variance = ((wins + 1) * (1.0 - mean) * (1.0 - mean) + draws * (0.5 - mean) * (0.5 - mean)
+        + (losses + 1) * mean * mean) / (games + 2.0);
+
+    double score0 = 1.0 / (1.0 + std::pow(10.0, -elo0 / 400.0));
+    double score1 = 1.0 / (1.0 + std::pow(10.0, -elo1 / 400.0));
+    return games * (score1 - score0) * (2.0 * mean - score0 - score1) / (2.0 * variance);
+}
+
+/* *********************************************************************
+Function Name: work
+Purpose: The body of a worker thread.
+Parameters:
+        maxGames, seed. As for run().
+Return Value: None
+Algorithm:
+        1. Under the lock, claim a block of games from the next pairing
+            in turn that is neither decided nor capped; stop if none is.
+        2. Play each game with the playGame() of the chosen set: deal
+            it from the seed, the pairing and the game number, and play
+            it with each entrant as the Human.
+            The worker makes its own copy of each registered strategy
+            the first time it plays one.
+        3. Under the lock, add the results and decide the pairing once
+            both tests cross a bound.
+Reference: None
+********************************************************************* */
+void Arena::work(int maxGames, unsigned int seed) {
+    // Wald's bounds for equal error rates of both kinds
+    const double upper = std::log((1.0 - ERROR_RATE) / ERROR_RATE);
+    const double lower = -upper;
+
+    // This worker's copies of the registered strategies, since a search keeps state between moves
+    std::vector<std::unique_ptr<ComputerStrategy>> copies(m_entrants.size());
+
+    while (true) {
+        // 1. A block of games, taken from the pairings in turn so they all progress
+        int index = -1;
+        int firstGame = 0;
+        int gameCount = 0;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (size_t tried = 0; tried < m_pairings.size() && index < 0; ++tried) {
+                Pairing& pairing = m_pairings[m_nextPairing];
+                if (pairing.decision == UNDECIDED && pairing.claimed < maxGames) {
+                    index = static_cast<int>(m_nextPairing);
+                    firstGame = pairing.claimed;
+                    gameCount = (maxGames - pairing.claimed < BLOCK_SIZE) ? maxGames - pairing.claimed : BLOCK_SIZE;
+                    pairing.claimed += gameCount;
+                }
+                m_nextPairing = (m_nextPairing + 1) % m_pairings.size();
+            }
+        }
+        if (index < 0) {
+            return;
+        }
+
+        // 2. The games, outside the lock
+        const Entrant& first = m_entrants[m_pairings[index].first];
+        const Entrant& second = m_entrants[m_pairings[index].second];
+        ComputerStrategy* strategies[2] = { nullptr, nullptr };
+        long long results[3] = { 0, 0, 0 };
+
+        int entrants[2] = { m_pairings[index].first, m_pairings[index].second };
+        for (int side = 0; side < 2; ++side) {
+            if (m_entrants[entrants[side]].policy != POLICY_REGISTERED) {
+                continue;
+            }
+            if (!copies[entrants[side]]) {
+                copies[entrants[side]] = StrategyRegistry::create(m_entrants[entrants[side]].name);
+                if (!copies[entrants[side]]) {
+                    return;
+                }
+            }
+            strategies[side] = copies[entrants[side]].get();
+        }
+
+        for (int game = firstGame; game < firstGame + gameCount; ++game) {
+            unsigned int dealSeed = seed + static_cast<unsigned int>(index) * 2654435761U
+                + static_cast<unsigned int>(game) * 2246822519U;
+            int roundNumber = 1 + game % (m_maxPips + 1);
+            int margin = 0;
+
+            switch (m_maxPips) {
+            case 9: margin = playGame<9>(first, second, strategies, roundNumber, dealSeed); break;
+            case 12: margin = playGame<12>(first, second, strategies, roundNumber, dealSeed); break;
+            case 15: margin = playGame<15>(first, second, strategies, roundNumber, dealSeed); break;
+            default: margin = playGame<StandardSet::MAX_PIPS>(first, second, strategies, roundNumber, dealSeed); break;
+            }
+            ++results[(margin > 0) ? 0 : (margin == 0) ? 1 : 2];
+        }
+
+        // 3. The tally and the tests
+        std::lock_guard<std::mutex> lock(m_mutex);
+        Pairing& pairing = m_pairings[index];
+        pairing.wins += results[0];
+        pairing.draws += results[1];
+        pairing.losses += results[2];
+
+        if (pairing.decision == UNDECIDED) {
+            double ratioFirst = getLogLikelihoodRatio(pairing.wins, pairing.draws, pairing.losses, 0.0, ELO_MARGIN);
+            double ratioSecond = getLogLikelihoodRatio(pairing.wins, pairing.draws, pairing.losses, 0.0, -ELO_MARGIN);
+
+            if (ratioFirst >= upper) {
+                pairing.decision = FIRST_STRONGER;
+            }
+            else if (ratioSecond >= upper) {
+                pairing.decision = SECOND_STRONGER;
+            }
+            else if (ratioFirst <= lower && ratioSecond <= lower) {
+                pairing.decision = EQUAL;
+            }
+        }
+    }
+}
+
+/* *********************************************************************
+Function Name: playGame
+Purpose: Plays one game of a pairing.
+Parameters:
+        first, second, entrants passed by const reference.
+        strategies, an array of two ComputerStrategy pointers. The
+            worker's copies of the entrants' strategies, null for
+            those played as a policy; always null for sets other than
+            double-six.
+        roundNumber, an integer. Chooses the engine.
+        seed, an unsigned integer. Chooses the deal and the random
+            strategy's moves.
+Return Value: The first entrant's points minus the second's over both
+        rounds.
+Algorithm: Deal once from a double-MaxPips set, then play the deal
+        with the first entrant as the Human and again as the Computer.
+Reference: None
+********************************************************************* */
+template <int MaxPips>
+int Arena::playGame(const Entrant& first, const Entrant& second, ComputerStrategy* const* strategies,
+    int roundNumber, unsigned int seed) {
+    typedef BasicPlayout<MaxPips> Table;
+
+    Table start;
+    start.dealRound(roundNumber, seed);
+
+    std::mt19937 generator(seed);
+    GreedyStrategy greedy;
+    RandomStrategy random(generator);
+    WeightedStrategy weighted[2] = { WeightedStrategy(first.weights), WeightedStrategy(second.weights) };
+
+    // Each entrant's policy as the template argument of the round, chosen once per round
+    auto play = [&](Table& round, const Entrant& human, int humanSide, const Entrant& computer, int computerSide) {
+        auto withPolicy = [&](const Entrant& entrant, int side, auto&& next) {
+            switch (entrant.policy) {
+            case POLICY_GREEDY: next(greedy); break;
+            case POLICY_RANDOM: next(random); break;
+            case POLICY_WEIGHTED: next(weighted[side]); break;
+            default:
+                // Registered strategies play only the real game's set
+                if constexpr (MaxPips == StandardSet::MAX_PIPS) {
+                    next(*strategies[side]);
+                }
+                break;
+            }
+        };
+        withPolicy(human, humanSide, [&](auto& humanPolicy) {
+            withPolicy(computer, computerSide, [&](auto& computerPolicy) {
+                round.playRound(humanPolicy, computerPolicy);
+            });
+        });
+    };
+
+    int margin = 0;
+    Table round = start;
+    play(round, first, 0, second, 1);
+    margin += round.getPoints(Table::HUMAN) - round.getPoints(Table::COMPUTER);
+
+    round = start;
+    play(round, second, 1, first, 0);
+    margin += round.getPoints(Table::COMPUTER) - round.getPoints(Table::HUMAN);
+    return margin;
+}
+
+/* *********************************************************************
+Function Name: fitRatings
+Purpose: Fits a rating to every entrant from all the pairings.
+Parameters: None
+Return Value: None
+Algorithm:
+        1. Add one drawn game to each pairing, so an entrant that won
+            every game still has a finite rating.
+        2. Maximize the likelihood of the logistic model with Newton's
+            method, with the last entrant's rating held at 0.
+        3. Invert the information matrix for the covariance of the
+            ratings, then shift the ratings and their covariance so
+            the mean is 0.
+Reference: Bradley, R. A. and Terry, M. E. (1952), "Rank analysis of
+        incomplete block designs"
+********************************************************************* */
+void Arena::fitRatings() {
+    int count = getEntrantCount();
+    if (count == 0) {
+        return;
+    }
+
+    // The slope of the logistic curve per Elo point
+    const double scale = std::log(10.0) / 400.0;
+    int freeCount = count - 1;
+    std::vector<double> ratings(count, 0.0);
+    std::vector<double> information(static_cast<size_t>(freeCount) * freeCount, 0.0);
+    std::vector<double> covariance(static_cast<size_t>(freeCount) * freeCount, 0.0);
+
+    for (int iteration = 0; iteration < 50; ++iteration) {
+        // 1. and 2. The gradient and information matrix of the freeCount ratings
+        std::vector<double> gradient(freeCount, 0.0);
+        std::fill(information.begin(), information.end(), 0.0);
+
+        for (const Pairing& pairing : m_pairings) {
+            double games = pairing.wins + pairing.draws + pairing.losses + 1.0;
+            double score = pairing.wins + 0.5 * pairing.draws + 0.5;
+            double expected = 1.0 / (1.0 + std::exp(-scale * (ratings[pairing.first] - ratings[pairing.second])));
+            double weight = scale * scale * games * expected * (1.0 - expected);
+            double slope = scale * (score - games * expected);
+
+            int a = pairing.first;
+            int b = pairing.second;
+            if (a < freeCount) {
+                gradient[a] += slope;
+                information[a * freeCount + a] += weight;
+            }
+            if (b < freeCount) {
+                gradient[b] -= slope;
+                information[b * freeCount + b] += weight;
+            }
+            if (a < freeCount && b < freeCount) {
+                information[a * freeCount + b] -= weight;
+                information[b * freeCount + a] -= weight;
+            }
+        }
+
+        // 3. Invert by Gauss-Jordan elimination; the matrix is positive definite
+        std::vector<double> reduced = information;
+        for (int i = 0; i < freeCount; ++i) {
+            for (int j = 0; j < freeCount; ++j) {
+                covariance[i * freeCount + j] = (i == j) ? 1.0 : 0.0;
+            }
+        }
+        for (int pivot = 0; pivot < freeCount; ++pivot) {
+            double divisor = reduced[pivot * freeCount + pivot];
+            for (int j = 0; j < freeCount; ++j) {
+                reduced[pivot * freeCount + j] /= divisor;
+                covariance[pivot * freeCount + j] /= divisor;
+            }
+            for (int row = 0; row < freeCount; ++row) {
+                double factor = reduced[row * freeCount + pivot];
+                if (row == pivot || factor == 0.0) {
+                    continue;
+                }
+                for (int j = 0; j < freeCount; ++j) {
+                    reduced[row * freeCount + j] -= factor * reduced[pivot * freeCount + j];
+                    covariance[row * freeCount + j] -= factor * covariance[pivot * freeCount + j];
+                }
+            }
+        }
+
+        // The Newton step
+        double largest = 0.0;
+        for (int i = 0; i < freeCount; ++i) {
+            double change = 0.0;
+            for (int j = 0; j < freeCount; ++j) {
+                change += covariance[i * freeCount + j] * gradient[j];
+            }
+            ratings[i] += change;
+            largest = std::max(largest, std::fabs(change));
+        }
+        if (largest < 1e-6) {
+            break;
+        }
+    }
+
+    // The ratings and their errors about the mean: subtract the mean of each column of the covariance, then of each row
+    double mean = 0.0;
+    for (int i = 0; i < count; ++i) {
+        mean += ratings[i] / count;
+    }
+
+    std::vector<double> full(static_cast<size_t>(count) * count, 0.0);
+    for (int i = 0; i < freeCount; ++i) {
+        for (int j = 0; j < freeCount; ++j) {
+            full[i * count + j] = covariance[i * freeCount + j];
+        }
+    }
+    for (int pass = 0; pass < 2; ++pass) {
+        for (int j = 0; j < count; ++j) {
+            double columnMean = 0.0;
+            for (int i = 0; i < count; ++i) {
+                columnMean += full[i * count + j] / count;
+            }
+            for (int i = 0; i < count; ++i) {
+                full[i * count + j] -= columnMean;
+            }
+        }
+        // The matrix is symmetric, so transposing it turns rows into columns
+        for (int i = 0; i < count; ++i) {
+            for (int j = i + 1; j < count; ++j) {
+                std::swap(full[i * count + j], full[j * count + i]);
+            }
+        }
+    }
+
+    for (int i = 0; i < count; ++i) {
+        m_entrants[i].rating = ratings[i] - mean;
+        m_entrants[i].ratingError = std::sqrt(std::max(0.0, full[i * count + i]));
+    }
+}
\ No newline at end of file
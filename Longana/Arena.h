@@ -0,0 +1,309 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "ComputerStrategy.h"
+#include "WeightedStrategy.h"
+
+/* *********************************************************************
+Class Name: Arena
+Purpose: Plays every pair of a set of strategies against each other and
+        rates them. A game is one deal played twice with the seats
+        swapped, won by whoever took more points over the two rounds, so
+        the luck of the deal mostly cancels. Entrants are named as
+        StrategyRegistry names them. Each pairing is a pair of
+        sequential probability ratio tests, one for each side being
+        ELO_MARGIN stronger, and stops as soon as both are decided, or
+        after a cap on its games. The pairings are shared out to worker
+        threads a block of games at a time. Ratings are then fitted to
+        every result at once, with a standard error for each. The games
+        may be dealt from a larger set than double-six when every entrant
+        is one of the fixed rules, which play any set.
+********************************************************************* */
+class Arena {
+public:
+
+    // How a pairing's tests ended
+    static const int UNDECIDED = 0;
+    static const int FIRST_STRONGER = 1;
+    static const int SECOND_STRONGER = 2;
+    static const int EQUAL = 3;
+
+    // The difference in Elo each test looks for, and the error rates of both kinds
+    static constexpr double ELO_MARGIN = 10.0;
+    static constexpr double ERROR_RATE = 0.05;
+
+    /* --- Constructor --- */
+
+    /* *********************************************************************
+    Function Name: Arena
+    Purpose: Default constructor. No strategies have been entered.
+    Parameters: None
+    Return Value: None
+    Algorithm: Start with empty lists at the first pairing.
+    Reference: None
+    ********************************************************************* */
+    Arena();
+
+    /* --- Destructor --- */
+
+    /* *********************************************************************
+    Function Name: ~Arena
+    Purpose: Destructor. The lists release their own storage.
+    Parameters: None
+    Return Value: None
+    Algorithm: Standard object destruction.
+    Reference: None
+    ********************************************************************* */
+    ~Arena() = default;
+
+    /* --- Selectors --- */
+
+    /* *********************************************************************
+    Function Name: getEntrantCount / getEntrantName
+    Purpose: Retrieve the number of strategies entered and the name of one.
+    Parameters:
+            entrant, an index below getEntrantCount().
+    Return Value: An integer count. / The name it was entered under.
+    Algorithm: Read the entrant list.
+    Reference: None
+    ********************************************************************* */
+    inline int getEntrantCount() const { return static_cast<int>(m_entrants.size()); }
+    inline const std::string& getEntrantName(int entrant) const { return m_entrants[entrant].name; }
+
+    /* *********************************************************************
+    Function Name: getRating / getRatingError
+    Purpose: Retrieve an entrant's fitted rating and its standard error.
+    Parameters:
+            entrant, an index below getEntrantCount().
+    Return Value: Elo relative to the mean of all entrants. / The standard
+            error of that rating.
+    Algorithm: Return the values stored by run().
+    Reference: None
+    ********************************************************************* */
+    inline double getRating(int entrant) const { return m_entrants[entrant].rating; }
+    inline double getRatingError(int entrant) const { return m_entrants[entrant].ratingError; }
+
+    /* *********************************************************************
+    Function Name: getMaxPips
+    Purpose: Retrieves the set the games are dealt from.
+    Parameters: None
+    Return Value: The pips of the set's highest double.
+    Algorithm: Return m_maxPips.
+    Reference: None
+    ********************************************************************* */
+    inline int getMaxPips() const { return m_maxPips; }
+
+    /* *********************************************************************
+    Function Name: getPairingCount
+    Purpose: Retrieves the number of pairings, one per pair of entrants.
+    Parameters: None
+    Return Value: An integer count.
+    Algorithm: Return the size of the pairing list.
+    Reference: None
+    ********************************************************************* */
+    inline int getPairingCount() const { return static_cast<int>(m_pairings.size()); }
+
+    /* *********************************************************************
+    Function Name: getPairing
+    Purpose: Retrieves the result of one pairing.
+    Parameters:
+            pairing, an index below getPairingCount().
+            outFirst, outSecond, integers passed by reference. Receive the
+                entrants.
+            outWins, outDraws, outLosses, long longs passed by reference.
+                Receive the games the first entrant won, drew and lost.
+    Return Value: UNDECIDED, FIRST_STRONGER, SECOND_STRONGER or EQUAL.
+    Algorithm: Copy out the stored counts.
+    Reference: None
+    ********************************************************************* */
+    int getPairing(int pairing, int& outFirst, int& outSecond, long long& outWins, long long& outDraws,
+        long long& outLosses) const;
+
+    /* --- Mutators --- */
+
+    /* *********************************************************************
+    Function Name: setMaxPips
+    Purpose: Chooses the set the games are dealt from.
+    Parameters:
+            maxPips, an integer. 6, 9, 12 or 15, the sets BasicPlayout is
+                built for.
+    Return Value: Boolean true if the set was chosen; false, with an
+            error message, for any other set, or for a set other than
+            double-six once a strategy that plays only the real game has
+            been entered.
+    Algorithm: Check the set and the entrants, then store it.
+    Reference: None
+    ********************************************************************* */
+    bool setMaxPips(int maxPips);
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: addEntrant
+    Purpose: Enters a strategy by its specification.
+    Parameters:
+            name, a string. Any specification StrategyRegistry accepts,
+                such as "greedy", "weighted:file=tuned.txt" or
+                "mcts:ms=20".
+    Return Value: Boolean true if the strategy was entered; false, with an
+            error message, if the registry could not make it, or if it
+            is not one of the fixed rules and the games are not dealt
+            from double-six.
+    Algorithm: Make the strategy once, to check the specification. If it
+            is one of the fixed rules of HeuristicStrategy, the entrant
+            plays that rule directly as a policy; otherwise each worker
+            makes its own copy of the strategy from the specification.
+    Reference: None
+    ********************************************************************* */
+    bool addEntrant(const std::string& name);
+
+    /* *********************************************************************
+    Function Name: run
+    Purpose: Plays the round robin and rates the entrants.
+    Parameters:
+            maxGames, an integer. The most games any pairing plays.
+            threadCount, an integer. The number of worker threads, or 0 for
+                one per hardware thread.
+            seed, an unsigned integer. Numbers the deals.
+    Return Value: None
+    Algorithm:
+            1. List every pair of entrants as a pairing.
+            2. Start the workers on work() and wait for every pairing to
+                be decided or capped.
+            3. Fit the ratings with fitRatings().
+    Reference: None
+    ********************************************************************* */
+    void run(int maxGames, int threadCount, unsigned int seed);
+
+    /* *********************************************************************
+    Function Name: getLogLikelihoodRatio
+    Purpose: Computes the sequential test's statistic for a set of results.
+    Parameters:
+            wins, draws, losses, long longs. The games of one side.
+            elo0, elo1, doubles. The Elo differences of the null and the
+                alternative hypothesis.
+    Return Value: The approximate log-likelihood ratio of the alternative
+            to the null, or 0 before any game.
+    Algorithm: Turn both hypotheses into expected scores, then compare
+            them with the mean and variance of the scores observed, as the
+            generalized SPRT does. The variance counts one more win and
+            one more loss, so that two strategies that have drawn every
+            game, as identical ones do, are still found equal.
+    Reference: Van den Bergh, M. (2016), "A practical introduction to the
+            GSPRT"
+    ********************************************************************* */
+    static double getLogLikelihoodRatio(long long wins, long long draws, long long losses, double elo0, double elo1);
+
+private:
+
+    // The kinds of strategy an entrant can be; the first three are played without the interface
+    static const int POLICY_GREEDY = 0;
+    static const int POLICY_RANDOM = 1;
+    static const int POLICY_WEIGHTED = 2;
+    static const int POLICY_REGISTERED = 3;
+
+    // Games a worker claims from a pairing at a time
+    static const int BLOCK_SIZE = 32;
+
+    struct Entrant {
+        std::string name;
+        int policy;
+        double weights[WeightedStrategy::WEIGHT_COUNT];
+        double rating;
+        double ratingError;
+    };
+
+    struct Pairing {
+        int first;
+        int second;
+        long long wins;
+        long long draws;
+        long long losses;
+        int claimed;        // games handed to workers, finished or not
+        int decision;
+    };
+
+    std::vector<Entrant> m_entrants;
+    std::vector<Pairing> m_pairings;
+
+    // Guards the pairings while the workers run
+    std::mutex m_mutex;
+    size_t m_nextPairing;
+
+    // The set the games are dealt from
+    int m_maxPips;
+
+    /* *********************************************************************
+    Function Name: work
+    Purpose: The body of a worker thread.
+    Parameters:
+            maxGames, seed. As for run().
+    Return Value: None
+    Algorithm:
+            1. Under the lock, claim a block of games from the next pairing
+                in turn that is neither decided nor capped; stop if none is.
+            2. Play each game with the playGame() of the chosen set: deal
+                it from the seed, the pairing and the game number, and play
+                it with each entrant as the Human.
+                The worker makes its own copy of each registered strategy
+                the first time it plays one.
+            3. Under the lock, add the results and decide the pairing once
+                both tests cross a bound.
+    Reference: None
+    ********************************************************************* */
+    void work(int maxGames, unsigned int seed);
+
+    /* *********************************************************************
+    Function Name: playGame
+    Purpose: Plays one game of a pairing.
+    Parameters:
+            first, second, entrants passed by const reference.
+            strategies, an array of two ComputerStrategy pointers. The
+                worker's copies of the entrants' strategies, null for
+                those played as a policy; always null for sets other than
+                double-six.
+            roundNumber, an integer. Chooses the engine.
+            seed, an unsigned integer. Chooses the deal and the random
+                strategy's moves.
+    Return Value: The first entrant's points minus the second's over both
+            rounds.
+    Algorithm: Deal once from a double-MaxPips set, then play the deal
+            with the first entrant as the Human and again as the Computer.
+    Reference: None
+    ********************************************************************* */
+    template <int MaxPips>
+    static int playGame(const Entrant& first, const Entrant& second, ComputerStrategy* const* strategies,
+        int roundNumber, unsigned int seed);
+
+    /* *********************************************************************
+    Function Name: fitRatings
+    Purpose: Fits a rating to every entrant from all the pairings.
+    Parameters: None
+    Return Value: None
+    Algorithm:
+            1. Add one drawn game to each pairing, so an entrant that won
+                every game still has a finite rating.
+            2. Maximize the likelihood of the logistic model with Newton's
+                method, with the last entrant's rating held at 0.
+            3. Invert the information matrix for the covariance of the
+                ratings, then shift the ratings and their covariance so
+                the mean is 0.
+    Reference: Bradley, R. A. and Terry, M. E. (1952), "Rank analysis of
+            incomplete block designs"
+    ********************************************************************* */
+    void fitRatings();
+};
+
+#endif
\ No newline at end of file
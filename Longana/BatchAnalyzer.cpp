@@ -0,0 +1,336 @@
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "BatchAnalyzer.h"
+#include "GameLog.h"
+#include "Playout.h"
+#include "Replay.h"
+#include "Serializer.h"
+#include "StrategyRegistry.h"
+#include "Tile.h"
+#include "Tournament.h"
+
+/* *********************************************************************
+Function Name: BatchAnalyzer
+Purpose: Constructor. Prepares an analyzer that writes to a stream.
+Parameters:
+        output, a std::ostream passed by reference. Receives one line
+            of comma-separated results per save. The stream must
+            outlive the analyzer.
+        strategy, a string. The specification of the strategy to
+            evaluate with, as StrategyRegistry accepts it.
+Return Value: None
+Algorithm: Store the stream and the specification and zero the
+        counters.
+Reference: None
+********************************************************************* */
+BatchAnalyzer::BatchAnalyzer(std::ostream& output, const std::string& strategy)
+    : m_output(output), m_strategy(strategy), m_next(), m_fileCount(0), m_failureCount(0), m_comparedCount(0), m_agreementCount(0)
+{
+}
+
+/* *********************************************************************
+Function Name: analyzeDirectory
+Purpose: Analyzes every save in a directory.
+Parameters:
+        directory, a string representing the directory path.
+        threadCount, an integer. The number of worker threads, or 0 for
+            one per hardware thread.
+Return Value: Boolean true if the directory could be listed and the
+        strategy made; false, with an error message, otherwise.
+Algorithm:
+        1. Make each worker its own copy of the strategy, since a
+            search keeps state between moves.
+        2. Open the directory listing and write the header line.
+        3. Start the worker threads; each repeatedly takes the next
+            entry from the listing and analyzes it.
+        4. Wait for every worker to finish.
+Reference: C++ Standard Library Documentation for std::thread
+********************************************************************* */
+bool BatchAnalyzer::analyzeDirectory(const std::string& directory, int threadCount) {
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::thread::hardware_concurrency());
+        if (threadCount <= 0) { threadCount = 1; }
+    }
+
+    // 1. The strategies
+    std::vector<std::unique_ptr<ComputerStrategy>> strategies;
+    for (int i = 0; i < threadCount; ++i) {
+        strategies.push_back(StrategyRegistry::create(m_strategy));
+        if (!strategies.back()) {
+            return false;
+        }
+    }
+
+    // 2. The listing
+    std::error_code error;
+    m_next = std::filesystem::directory_iterator(directory, error);
+    if (error) {
+        std::cerr << "Error: Could not read the directory " << directory << "." << std::endl;
+        return false;
+    }
+
+    m_fileCount = 0;
+    m_failureCount = 0;
+    m_comparedCount = 0;
+    m_agreementCount = 0;
+
+    m_output << "File,Next Player,Best Move,Score,Actual Move,Agrees\n";
+
+    // 3. and 4. The workers
+    std::vector<std::thread> workers;
+    for (int i = 0; i < threadCount; ++i) {
+        workers.emplace_back(&BatchAnalyzer::work, this, strategies[i].get());
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    m_output.flush();
+    return true;
+}
+
+/* *********************************************************************
+Function Name: work
+Purpose: The body of a worker thread.
+Parameters:
+        strategy, a ComputerStrategy passed by reference. The
+            worker's own copy.
+Return Value: None
+Algorithm:
+        1. Take the next save from the listing under the input lock,
+            skipping anything that is not a save.
+        2. Analyze it without holding any lock.
+        3. Write its result line under the output lock.
+        4. Stop when the listing is exhausted.
+Reference: None
+********************************************************************* */
+void BatchAnalyzer::work(ComputerStrategy* strategy) {
+    while (true) {
+        std::filesystem::path path;
+
+        {
+            std::lock_guard<std::mutex> lock(m_inputMutex);
+            std::error_code error;
+
+            while (m_next != std::filesystem::directory_iterator()) {
+                std::filesystem::path candidate = m_next->path();
+                bool isFile = m_next->is_regular_file(error);
+                m_next.increment(error);
+                if (error) {
+                    m_next = std::filesystem::directory_iterator();
+                }
+
+                std::string extension = candidate.extension().string();
+                if (isFile && (extension == ".txt" || extension == ".bin")) {
+                    path = candidate;
+                    break;
+                }
+            }
+        }
+
+        if (path.empty()) {
+            return;
+        }
+
+        std::string line = analyzeFile(path, *strategy);
+
+        std::lock_guard<std::mutex> lock(m_outputMutex);
+        m_output << line << '\n';
+    }
+}
+
+/* *********************************************************************
+Function Name: analyzeFile
+Purpose: Analyzes a single save.
+Parameters:
+        path, a std::filesystem::path to the save.
+        strategy, a ComputerStrategy passed by reference. Evaluates
+            the position.
+Return Value: The result line, without a trailing newline.
+Algorithm:
+        1. Load the save, placing the engine if it has not been played.
+        2. Copy the round into a Playout and choose the mover's move
+            with the strategy.
+        3. Score it from the mover's point of view: take the
+            strategy's estimate, or else play the move and finish the
+            round with the strategy on both sides.
+        4. Look up the move actually played in the matching log.
+Reference: None
+********************************************************************* */
+std::string BatchAnalyzer::analyzeFile(const std::filesystem::path& path, ComputerStrategy& strategy) {
+    ++m_fileCount;
+
+    Tournament game;
+    std::string buffer;
+    std::string line = path.filename().string() + ",";
+
+    if (!Serializer::loadGame(path.string(), game, buffer)) {
+        ++m_failureCount;
+        return line + "error,,,,";
+    }
+
+    Round& round = game.getCurrentRound();
+    if (round.getLayout().isEmpty()) {
+        round.placeEngine();
+    }
+
+    // --- Evaluate with the strategy ---
+    Playout playout;
+    playout.loadRound(round);
+
+    int mover = playout.getMover();
+    std::string bestMove = "none";
+    std::string score;
+    int index = 0;
+    int arm = mover;
+    double value = 0.0;
+
+    if (!playout.isOver()) {
+        if (strategy.chooseMove(playout, index, arm)) {
+            bestMove = describeMove(playout.getHandTile(mover, index), arm == Playout::HUMAN ? 'L' : 'R');
+            if (strategy.getValue(value)) {
+                char text[16];
+                std::snprintf(text, sizeof(text), "%+.1f", value);
+                score = text;
+            }
+            else {
+                playout.playTile(index, arm);
+            }
+        }
+        else {
+            bestMove = (playout.getBoneyardSize() > 0) ? "draw" : "pass";
+        }
+    }
+
+    // Without an estimate, the strategy plays the round out against itself
+    if (score.empty()) {
+        playout.playRound(strategy, strategy);
+        int points = playout.getPoints(mover) - playout.getPoints(1 - mover);
+        score = (points > 0 ? "+" : "") + std::to_string(points);
+    }
+
+    line += (mover == Playout::HUMAN) ? "Human," : "Computer,";
+    line += bestMove + "," + score + ",";
+
+    // --- Compare with the game log, if there is one ---
+    std::filesystem::path logPath = path;
+    logPath.replace_extension(".log");
+
+    std::string actualMove;
+    std::error_code error;
+    if (std::filesystem::exists(logPath, error) && findActualMove(logPath, game, actualMove)) {
+        bool agrees = (actualMove == bestMove);
+
+        ++m_comparedCount;
+        if (agrees) { ++m_agreementCount; }
+
+        line += actualMove + (agrees ? ",Yes" : ",No");
+    }
+    else {
+        line += ",";
+    }
+
+    return line;
+}
+
+/* *********************************************************************
+Function Name: findActualMove
+Purpose: Finds the move that was played from a position in a game log.
+Parameters:
+        logPath, a std::filesystem::path to the log.
+        position, a Tournament passed by const reference. The position
+            to look for.
+        outMove, a string passed by reference. Receives the move.
+Return Value: Boolean true if the position was found in the log.
+Algorithm:
+        1. Replay the log one event at a time, stepping the same game
+            forward rather than seeking to each position.
+        2. Compare each position with the target: turn flags, round
+            number and every tile in order.
+        3. At the first match, describe the event that follows it.
+Reference: None
+********************************************************************* */
+bool BatchAnalyzer::findActualMove(const std::filesystem::path& logPath, const Tournament& position, std::string& outMove) {
+    Replay replay;
+    if (!replay.load(logPath.string())) {
+        return false;
+    }
+
+    // Byte 5 holds the turn flags, 6-7 the round, and 24-59 the counts and tiles
+    unsigned char target[Serializer::BINARY_SIZE];
+    unsigned char current[Serializer::BINARY_SIZE];
+    Serializer::encodeBinary(position, target);
+
+    Tournament replayed;
+    for (int k = 1; k < replay.getEventCount(); ++k) {
+        // The position after k events, one on from the last
+        if (!replay.step(k - 1, replayed)) {
+            return false;
+        }
+        Serializer::encodeBinary(replayed, current);
+
+        // Only the pass flag of the player who just moved is kept in a text save
+        int flagMask = (target[5] & 4) ? 4 | 2 : 4 | 1;
+        if ((target[5] & flagMask) != (current[5] & flagMask) || std::memcmp(target + 6, current + 6, 2) != 0
+            || std::memcmp(target + 24, current + 24, 36) != 0) {
+            continue;
+        }
+
+        int type = 0;
+        bool isHuman = false;
+        int operand = 0;
+        replay.getEvent(k, type, isHuman, operand);
+
+        if (type == GameLog::EVENT_DRAW) {
+            outMove = "draw";
+        }
+        else if (type == GameLog::EVENT_CONTROL) {
+            // A deal here means the position ended a round, so no move was made from it
+            if (operand != GameLog::CONTROL_PASS) {
+                continue;
+            }
+            outMove = "pass";
+        }
+        else {
+            outMove = describeMove(Tile::fromIndex(operand), type == GameLog::EVENT_PLAY_LEFT ? 'L' : 'R');
+        }
+        return true;
+    }
+
+    return false;
+}
+
+/* *********************************************************************
+Function Name: describeMove
+Purpose: Formats a move for the results, such as "3-4 L".
+Parameters:
+        tile, a Tile. The tile played.
+        side, a character, 'L' or 'R'.
+Return Value: A string, with the smaller half of the tile first.
+Algorithm: Normalize the tile and join its halves and the side.
+Reference: None
+********************************************************************* */
+std::string BatchAnalyzer::describeMove(const Tile& tile, char side) {
+    int low = tile.getLeftPips();
+    int high = tile.getRightPips();
+    if (low > high) { std::swap(low, high); }
+
+    return std::to_string(low) + "-" + std::to_string(high) + " " + side;
+}
\ No newline at end of file
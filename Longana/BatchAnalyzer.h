@@ -0,0 +1,190 @@
+#ifndef BATCHANALYZER_H
+#define BATCHANALYZER_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <atomic>
+#include <filesystem>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+#include "ComputerStrategy.h"
+#include "Tile.h"
+#include "Tournament.h"
+
+/* *********************************************************************
+Class Name: BatchAnalyzer
+Purpose: Analyzes every saved game in a directory. Each save (".txt" or
+        ".bin") is loaded and the player to move is given the move a
+        registered strategy would make, together with its score: the
+        strategy's own estimate if it searches, or else the result of the
+        round when both players follow the strategy to the end. When a
+        game log with the same name (".log") sits beside the save, the
+        move actually played from that position is looked up and compared.
+        Files are shared out to one worker thread per core straight from
+        the directory listing, and each result is written as soon as it is
+        ready, so memory use does not grow with the number of files.
+********************************************************************* */
+class BatchAnalyzer {
+public:
+
+    /* --- Constructor --- */
+
+    /* *********************************************************************
+    Function Name: BatchAnalyzer
+    Purpose: Constructor. Prepares an analyzer that writes to a stream.
+    Parameters:
+            output, a std::ostream passed by reference. Receives one line
+                of comma-separated results per save. The stream must
+                outlive the analyzer.
+            strategy, a string. The specification of the strategy to
+                evaluate with, as StrategyRegistry accepts it.
+    Return Value: None
+    Algorithm: Store the stream and the specification and zero the
+            counters.
+    Reference: None
+    ********************************************************************* */
+    BatchAnalyzer(std::ostream& output, const std::string& strategy);
+
+    /* --- Destructor --- */
+
+    /* *********************************************************************
+    Function Name: ~BatchAnalyzer
+    Purpose: Destructor. The output stream is not owned.
+    Parameters: None
+    Return Value: None
+    Algorithm: Standard object destruction.
+    Reference: None
+    ********************************************************************* */
+    ~BatchAnalyzer() = default;
+
+    /* --- Selectors --- */
+
+    /* *********************************************************************
+    Function Name: getFileCount / getFailureCount / getComparedCount /
+            getAgreementCount
+    Purpose: Retrieve the totals of the last analysis: saves analyzed, saves
+            that could not be loaded, positions found in a log, and positions
+            where the strategy agreed with the move actually played.
+    Parameters: None
+    Return Value: An integer count.
+    Algorithm: Return the matching counter.
+    Reference: None
+    ********************************************************************* */
+    inline int getFileCount() const { return m_fileCount; }
+    inline int getFailureCount() const { return m_failureCount; }
+    inline int getComparedCount() const { return m_comparedCount; }
+    inline int getAgreementCount() const { return m_agreementCount; }
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: analyzeDirectory
+    Purpose: Analyzes every save in a directory.
+    Parameters:
+            directory, a string representing the directory path.
+            threadCount, an integer. The number of worker threads, or 0 for
+                one per hardware thread.
+    Return Value: Boolean true if the directory could be listed and the
+            strategy made; false, with an error message, otherwise.
+    Algorithm:
+            1. Make each worker its own copy of the strategy, since a
+                search keeps state between moves.
+            2. Open the directory listing and write the header line.
+            3. Start the worker threads; each repeatedly takes the next
+                entry from the listing and analyzes it.
+            4. Wait for every worker to finish.
+    Reference: None
+    ********************************************************************* */
+    bool analyzeDirectory(const std::string& directory, int threadCount);
+
+private:
+    std::ostream& m_output;
+    std::string m_strategy;
+
+    // The shared directory listing and the locks around it and the output
+    std::filesystem::directory_iterator m_next;
+    std::mutex m_inputMutex;
+    std::mutex m_outputMutex;
+
+    std::atomic<int> m_fileCount;
+    std::atomic<int> m_failureCount;
+    std::atomic<int> m_comparedCount;
+    std::atomic<int> m_agreementCount;
+
+    /* *********************************************************************
+    Function Name: work
+    Purpose: The body of a worker thread.
+    Parameters:
+            strategy, a ComputerStrategy passed by reference. The
+                worker's own copy.
+    Return Value: None
+    Algorithm:
+            1. Take the next save from the listing under the input lock,
+                skipping anything that is not a save.
+            2. Analyze it without holding any lock.
+            3. Write its result line under the output lock.
+            4. Stop when the listing is exhausted.
+    Reference: None
+    ********************************************************************* */
+    void work(ComputerStrategy* strategy);
+
+    /* *********************************************************************
+    Function Name: analyzeFile
+    Purpose: Analyzes a single save.
+    Parameters:
+            path, a std::filesystem::path to the save.
+            strategy, a ComputerStrategy passed by reference. Evaluates
+                the position.
+    Return Value: The result line, without a trailing newline.
+    Algorithm:
+            1. Load the save, placing the engine if it has not been played.
+            2. Copy the round into a Playout and choose the mover's move
+                with the strategy.
+            3. Score it from the mover's point of view: take the
+                strategy's estimate, or else play the move and finish the
+                round with the strategy on both sides.
+            4. Look up the move actually played in the matching log.
+    Reference: None
+    ********************************************************************* */
+    std::string analyzeFile(const std::filesystem::path& path, ComputerStrategy& strategy);
+
+    /* *********************************************************************
+    Function Name: findActualMove
+    Purpose: Finds the move that was played from a position in a game log.
+    Parameters:
+            logPath, a std::filesystem::path to the log.
+            position, a Tournament passed by const reference. The position
+                to look for.
+            outMove, a string passed by reference. Receives the move.
+    Return Value: Boolean true if the position was found in the log.
+    Algorithm:
+            1. Replay the log one event at a time, stepping the same game
+                forward rather than seeking to each position.
+            2. Compare each position with the target: turn flags, round
+                number and every tile in order.
+            3. At the first match, describe the event that follows it.
+    Reference: None
+    ********************************************************************* */
+    static bool findActualMove(const std::filesystem::path& logPath, const Tournament& position, std::string& outMove);
+
+    /* *********************************************************************
+    Function Name: describeMove
+    Purpose: Formats a move for the results, such as "3-4 L".
+    Parameters:
+            tile, a Tile. The tile played.
+            side, a character, 'L' or 'R'.
+    Return Value: A string, with the smaller half of the tile first.
+    Algorithm: Normalize the tile and join its halves and the side.
+    Reference: None
+    ********************************************************************* */
+    static std::string describeMove(const Tile& tile, char side);
+};
+
+#endif
\ No newline at end of file
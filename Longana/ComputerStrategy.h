@@ -0,0 +1,130 @@
+#ifndef COMPUTERSTRATEGY_H
+#define COMPUTERSTRATEGY_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <atomic>
+#include <string>
+
+#include "Playout.h"
+
+/* *********************************************************************
+Class Name: ComputerStrategy
+Purpose: The interface of a strategy the Computer can be given in place
+        of its built-in first-fit rule. A strategy sees the round as a
+        Playout with the Computer to move, and only chooses which tile to
+        place and where; Round draws and passes as the rules require and
+        asks again after a draw. Strategies are made by name with
+        StrategyRegistry. Since chooseMove() has the signature of a
+        playout policy (see GreedyStrategy), a strategy can also play
+        whole rounds with Playout::playTurn, as the Arena does.
+********************************************************************* */
+class ComputerStrategy {
+public:
+
+    /* --- Destructor --- */
+
+    /* *********************************************************************
+    Function Name: ~ComputerStrategy
+    Purpose: Virtual destructor, so a strategy is released through the
+            interface.
+    Parameters: None
+    Return Value: None
+    Algorithm: Standard object destruction.
+    Reference: None
+    ********************************************************************* */
+    virtual ~ComputerStrategy() = default;
+
+    /* --- Mutators --- */
+
+    /* *********************************************************************
+    Function Name: setMilliseconds
+    Purpose: Changes the time the strategy may spend on a move. Strategies
+            that answer at once ignore it.
+    Parameters:
+            milliseconds, an integer time budget, more than 0.
+    Return Value: None
+    Algorithm: Defined by each strategy that searches.
+    Reference: None
+    ********************************************************************* */
+    virtual void setMilliseconds(int) {}
+
+    /* *********************************************************************
+    Function Name: setStopSignal
+    Purpose: Attaches a flag that ends a move's search early when set from
+            another thread; the best move found so far is returned.
+            Strategies that answer at once ignore it.
+    Parameters:
+            stop, a pointer to a std::atomic<bool>, or nullptr to search
+                for the whole budget. The strategy does not take
+                ownership.
+    Return Value: None
+    Algorithm: Defined by each strategy that searches.
+    Reference: None
+    ********************************************************************* */
+    virtual void setStopSignal(const std::atomic<bool>*) {}
+
+    /* --- Selectors --- */
+
+    /* *********************************************************************
+    Function Name: getValue
+    Purpose: Retrieves what the last move chosen is worth, for strategies
+            that estimate it.
+    Parameters:
+            outValue, a double passed by reference. Receives the points
+                the mover expects to win minus the opponent's.
+    Return Value: Boolean true if the strategy estimated the move; false
+            for strategies that answer by a fixed rule, and when there was
+            only one move to weigh.
+    Algorithm: Defined by each strategy that searches.
+    Reference: None
+    ********************************************************************* */
+    virtual bool getValue(double&) const { return false; }
+
+    /* *********************************************************************
+    Function Name: getMilliseconds
+    Purpose: Retrieves the time the strategy may spend on a move, so a
+            caller that changes it for one move can put it back.
+    Parameters: None
+    Return Value: The budget in milliseconds, or 0 for strategies that
+            answer at once.
+    Algorithm: Defined by each strategy that searches.
+    Reference: None
+    ********************************************************************* */
+    virtual int getMilliseconds() const { return 0; }
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: chooseMove
+    Purpose: Chooses the mover's move.
+    Parameters:
+            position, a Playout passed by const reference. If the mover
+                has just drawn, only the drawn tile can fit.
+            outIndex, an integer passed by reference. Receives the position
+                of the chosen tile in the mover's hand.
+            outArm, an integer passed by reference. Receives the player
+                number of the arm to play on.
+    Return Value: Boolean true if any tile can be played.
+    Algorithm: Defined by each strategy.
+    Reference: None
+    ********************************************************************* */
+    virtual bool chooseMove(const Playout& position, int& outIndex, int& outArm) = 0;
+
+    /* *********************************************************************
+    Function Name: getReason
+    Purpose: Explains the last move chosen, for the player to read.
+    Parameters: None
+    Return Value: A sentence, which may continue on indented lines.
+    Algorithm: Defined by each strategy.
+    Reference: None
+    ********************************************************************* */
+    virtual std::string getReason() const = 0;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,249 @@
+#ifndef DOMINOSET_H
+#define DOMINOSET_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+/* *********************************************************************
+Class Name: WideTileMask
+Purpose: A set of tiles too large for one machine word, kept as a fixed
+        number of 64-bit words. It supports the same operators as the
+        built-in integers used as masks for the smaller sets, so code
+        written against DominoSet::Mask works unchanged for every size.
+********************************************************************* */
+template <int Words>
+class WideTileMask {
+public:
+
+    /* --- Constructor --- */
+
+    /* *********************************************************************
+    Function Name: WideTileMask
+    Purpose: Constructs a mask, empty or with only bit 0 set, mirroring an
+            integer mask built from 0 or 1.
+    Parameters:
+            value, an integer passed by value. 0 or 1.
+    Return Value: None
+    Algorithm: Zero every word, then store the value in the lowest.
+    Reference: None
+    ********************************************************************* */
+    constexpr WideTileMask(int value = 0) : m_words() { m_words[0] = static_cast<uint64_t>(value); }
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: getBit
+    Purpose: Builds the mask holding a single tile.
+    Parameters:
+            index, an integer passed by value. The tile's index.
+    Return Value: The mask.
+    Algorithm: Set bit index % 64 of word index / 64.
+    Reference: None
+    ********************************************************************* */
+    static constexpr WideTileMask getBit(int index) {
+        WideTileMask mask;
+        mask.m_words[index / 64] = uint64_t(1) << (index % 64);
+        return mask;
+    }
+
+    /* *********************************************************************
+    Function Name: operator& / operator| / operator~ / operator&= /
+            operator|= / operator bool
+    Purpose: Set intersection, union, complement, and a test for any tile.
+    Parameters:
+            other, a constant WideTileMask reference.
+    Return Value: The combined mask, or true if any bit is set.
+    Algorithm: Apply the operator word by word.
+    Reference: None
+    ********************************************************************* */
+    constexpr WideTileMask operator&(const WideTileMask& other) const {
+        WideTileMask result;
+        for (int i = 0; i < Words; ++i) { result.m_words[i] = m_words[i] & other.m_words[i]; }
+        return result;
+    }
+
+    constexpr WideTileMask operator|(const WideTileMask& other) const {
+        WideTileMask result;
+        for (int i = 0; i < Words; ++i) { result.m_words[i] = m_words[i] | other.m_words[i]; }
+        return result;
+    }
+
+    constexpr WideTileMask operator~() const {
+        WideTileMask result;
+        for (int i = 0; i < Words; ++i) { result.m_words[i] = ~m_words[i]; }
+        return result;
+    }
+
+    constexpr WideTileMask& operator&=(const WideTileMask& other) { return *this = *this & other; }
+    constexpr WideTileMask& operator|=(const WideTileMask& other) { return *this = *this | other; }
+
+    constexpr explicit operator bool() const {
+        uint64_t any = 0;
+        for (int i = 0; i < Words; ++i) { any |= m_words[i]; }
+        return any != 0;
+    }
+
+private:
+    uint64_t m_words[Words];
+};
+
+/* *********************************************************************
+Class Name: DominoSet
+Purpose: Compile-time description of a double-N domino set: its size,
+        the hand dealt to each of the two players, the engine for each
+        round, and the bit masks used to test a whole hand at once. Tiles
+        are numbered as Tile::getIndex() numbers them, which does not
+        depend on the size of the set. The mask is a 32-bit integer for
+        double-six (28 tiles), a 64-bit integer for double-nine (55), and
+        a WideTileMask for double-twelve (91) and double-fifteen (136).
+********************************************************************* */
+template <int MaxPips>
+class DominoSet {
+public:
+
+    // Packed tiles keep four bits per half
+    static_assert(MaxPips >= 1 && MaxPips <= 15, "Sets from double-one to double-fifteen are supported");
+
+    /* --- Constants --- */
+
+    static constexpr int MAX_PIPS = MaxPips;
+
+    // The number of distinct tiles, from 0-0 to N-N
+    static constexpr int TILE_COUNT = (MaxPips + 1) * (MaxPips + 2) / 2;
+
+    // Tiles dealt to each of two players; 8 of 28 for double-six, the same share of larger sets
+    static constexpr int HAND_SIZE = TILE_COUNT * 2 / 7;
+
+    typedef std::conditional_t<(TILE_COUNT <= 32), uint32_t,
+        std::conditional_t<(TILE_COUNT <= 64), uint64_t, WideTileMask<(TILE_COUNT + 63) / 64>>> Mask;
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: getIndex
+    Purpose: Maps a tile to its position in the set, as Tile::getIndex()
+            does.
+    Parameters:
+            low, high, integers. The halves of the tile, low <= high.
+    Return Value: An integer between 0 and TILE_COUNT - 1.
+    Algorithm: Return high * (high + 1) / 2 + low.
+    Reference: None
+    ********************************************************************* */
+    static constexpr int getIndex(int low, int high) { return high * (high + 1) / 2 + low; }
+
+    /* *********************************************************************
+    Function Name: getHandSize
+    Purpose: Finds the number of tiles dealt to each player at a table.
+            Four sevenths of the set is dealt whatever the number of
+            players, as with two players and double-six.
+    Parameters:
+            playerCount, an integer. The number of players.
+    Return Value: An integer count of tiles; HAND_SIZE for two players.
+    Algorithm: Return TILE_COUNT * 4 / (7 * playerCount).
+    Reference: None
+    ********************************************************************* */
+    static constexpr int getHandSize(int playerCount) { return TILE_COUNT * 4 / (7 * playerCount); }
+
+    /* *********************************************************************
+    Function Name: getEngine
+    Purpose: Finds the pips of the double that opens a round. Round 1 opens
+            with N-N, each later round with the next lower double, and the
+            cycle restarts after 0-0.
+    Parameters:
+            roundNumber, an integer, starting at 1.
+    Return Value: An integer pip value between 0 and MAX_PIPS.
+    Algorithm: Return MAX_PIPS - ((roundNumber - 1) % (MAX_PIPS + 1)).
+    Reference: None
+    ********************************************************************* */
+    static constexpr int getEngine(int roundNumber) { return MaxPips - ((roundNumber - 1) % (MaxPips + 1)); }
+
+    /* *********************************************************************
+    Function Name: getBit
+    Purpose: Builds the mask holding a single tile.
+    Parameters:
+            index, an integer. The tile's index.
+    Return Value: The mask.
+    Algorithm: Shift a one into place, word by word for the wide masks.
+    Reference: None
+    ********************************************************************* */
+    static constexpr Mask getBit(int index) {
+        if constexpr (std::is_integral_v<Mask>) {
+            return Mask(1) << index;
+        }
+        else {
+            return Mask::getBit(index);
+        }
+    }
+
+    /* *********************************************************************
+    Function Name: getPipMask
+    Purpose: Retrieves the mask of every tile with a given pip value on
+            either half, so that hand & getPipMask(end) is the set of
+            tiles in the hand that match an open end.
+    Parameters:
+            pips, an integer between 0 and MAX_PIPS.
+    Return Value: The mask.
+    Algorithm: Look the mask up in a table built at compile time.
+    Reference: None
+    ********************************************************************* */
+    static Mask getPipMask(int pips) {
+        static constexpr std::array<Mask, MaxPips + 1> masks = buildPipMasks();
+        return masks[pips];
+    }
+
+    /* *********************************************************************
+    Function Name: getDoublesMask
+    Purpose: Retrieves the mask of every double in the set.
+    Parameters: None
+    Return Value: The mask.
+    Algorithm: Return a mask built at compile time.
+    Reference: None
+    ********************************************************************* */
+    static Mask getDoublesMask() {
+        static constexpr Mask doubles = buildDoublesMask();
+        return doubles;
+    }
+
+private:
+
+    /* *********************************************************************
+    Function Name: buildPipMasks / buildDoublesMask
+    Purpose: Build the tables behind getPipMask() and getDoublesMask().
+    Parameters: None
+    Return Value: The table of masks, one per pip value. / The mask.
+    Algorithm: Walk every tile low-high and set its bit in the mask of
+            each of its halves, or in the doubles mask if low == high.
+    Reference: None
+    ********************************************************************* */
+    static constexpr std::array<Mask, MaxPips + 1> buildPipMasks() {
+        std::array<Mask, MaxPips + 1> masks{};
+        for (int high = 0; high <= MaxPips; ++high) {
+            for (int low = 0; low <= high; ++low) {
+                masks[low] |= getBit(getIndex(low, high));
+                masks[high] |= getBit(getIndex(low, high));
+            }
+        }
+        return masks;
+    }
+
+    static constexpr Mask buildDoublesMask() {
+        Mask doubles = 0;
+        for (int pips = 0; pips <= MaxPips; ++pips) {
+            doubles |= getBit(getIndex(pips, pips));
+        }
+        return doubles;
+    }
+};
+
+// The set the interactive game, its saves and its logs are played with
+typedef DominoSet<6> StandardSet;
+
+#endif
\ No newline at end of file
@@ -0,0 +1,493 @@
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "DominoSet.h"
+#include "EndgameTablebase.h"
+#include "MappedFile.h"
+#include "Playout.h"
+
+/* *********************************************************************
+Function Name: EndgameTablebase
+Purpose: Default constructor. No table is open.
+Parameters: None
+Return Value: None
+Algorithm: Null the values and zero the counts.
+Reference: None
+********************************************************************* */
+EndgameTablebase::EndgameTablebase()
+    : m_file(), m_buffer(), m_values(nullptr), m_maxTiles(0), m_entryCount(0), m_offsets()
+{
+}
+
+/* *********************************************************************
+Function Name: contains
+Purpose: Checks whether a position is in the table.
+Parameters:
+        position, a Playout passed by const reference.
+Return Value: Boolean true if a table is open and the position is a
+        two-player round in progress with an empty boneyard and
+        between 1 and getMaxTiles() tiles in each hand.
+Algorithm: Test the player count, the boneyard and the hand sizes.
+Reference: None
+********************************************************************* */
+bool EndgameTablebase::contains(const Playout& position) const {
+    if (m_values == nullptr || position.getPlayerCount() != 2 || position.isOver() || position.getBoneyardSize() != 0) {
+        return false;
+    }
+
+    for (int player = Playout::HUMAN; player <= Playout::COMPUTER; ++player) {
+        int size = position.getHandSize(player);
+        if (size < 1 || size > m_maxTiles) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* *********************************************************************
+Function Name: probe
+Purpose: Looks up the value of a position.
+Parameters:
+        position, a Playout passed by const reference.
+        outValue, an integer passed by reference. Receives the mover's
+            points minus the opponent's under perfect play.
+Return Value: Boolean true if the position is in the table.
+Algorithm:
+        1. Check contains().
+        2. Build the mask of each hand and read the entry at
+            getIndex(); the work is a few operations per tile in hand.
+Reference: None
+********************************************************************* */
+bool EndgameTablebase::probe(const Playout& position, int& outValue) const {
+    // 1. Covered at all
+    if (!contains(position)) {
+        return false;
+    }
+
+    // 2. The hands as masks, from the mover's side
+    int mover = position.getMover();
+    int other = 1 - mover;
+    Mask hands[2] = { 0, 0 };
+
+    for (int player = Playout::HUMAN; player <= Playout::COMPUTER; ++player) {
+        for (int i = 0; i < position.getHandSize(player); ++i) {
+            unsigned char packed = position.getHandPacked(player, i);
+            hands[player] |= StandardSet::getBit(StandardSet::getIndex(packed & 0x0F, packed >> 4));
+        }
+    }
+
+    outValue = m_values[getIndex(hands[mover], hands[other], position.getArmEnd(mover), position.getArmEnd(other),
+        position.hasPassed(other))];
+    return true;
+}
+
+/* *********************************************************************
+Function Name: open
+Purpose: Maps a table written by generate().
+Parameters:
+        filename, a string representing the table path.
+Return Value: Boolean true if the file was mapped and is a whole
+        table; false, with an error message, otherwise.
+Algorithm:
+        1. Map the file.
+        2. Check the magic bytes, the version and the tiles per hand.
+        3. Lay out the groups and check the size matches.
+Reference: None
+********************************************************************* */
+bool EndgameTablebase::open(const std::string& filename) {
+    m_values = nullptr;
+
+    // 1. The file
+    if (!m_file.open(filename)) {
+        std::cerr << "Error: Could not open tablebase: " << filename << std::endl;
+        return false;
+    }
+
+    // 2. The header
+    const unsigned char* data = m_file.getData();
+    if (m_file.getSize() < static_cast<size_t>(HEADER_SIZE) || std::memcmp(data, "LGTB", 4) != 0
+        || data[4] != FILE_VERSION || data[5] < 1 || data[5] > MAX_TILES) {
+        std::cerr << "Error: " << filename << " is not a Longana tablebase." << std::endl;
+        m_file.close();
+        return false;
+    }
+
+    // 3. The values
+    layOut(data[5]);
+    if (m_file.getSize() != static_cast<size_t>(HEADER_SIZE + m_entryCount)) {
+        std::cerr << "Error: The tablebase " << filename << " is truncated." << std::endl;
+        m_file.close();
+        return false;
+    }
+
+    m_values = reinterpret_cast<const signed char*>(data + HEADER_SIZE);
+    return true;
+}
+
+/* *********************************************************************
+Function Name: generate
+Purpose: Solves every position with up to maxTiles tiles per hand and
+        writes the table to a file.
+Parameters:
+        filename, a string representing the output path.
+        maxTiles, an integer between 1 and MAX_TILES.
+        threadCount, an integer. The number of worker threads, or 0 for
+            one per hardware thread.
+Return Value: Boolean true if the table was written; false, with an
+        error message, otherwise.
+Algorithm:
+        1. Lay out the groups and allocate the whole table.
+        2. For 2, 3, ... 2 * maxTiles tiles in hand, solve every group
+            of that layer, splitting each group's hands evenly between
+            the threads and waiting for all of them before moving on.
+        3. Write the header and the values.
+Reference: Thompson, K. (1986), "Retrograde analysis of certain
+        endgames"
+********************************************************************* */
+bool EndgameTablebase::generate(const std::string& filename, int maxTiles, int threadCount) {
+    if (maxTiles < 1 || maxTiles > MAX_TILES) {
+        std::cerr << "Error: A tablebase holds from 1 to " << MAX_TILES << " tiles per hand." << std::endl;
+        return false;
+    }
+
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::thread::hardware_concurrency());
+        if (threadCount <= 0) { threadCount = 1; }
+    }
+
+    // 1. The whole table is built in memory
+    EndgameTablebase table;
+    table.layOut(maxTiles);
+    table.m_buffer.assign(static_cast<size_t>(table.m_entryCount), 0);
+    table.m_values = table.m_buffer.data();
+
+    // 2. Each layer reads only the layers below it
+    for (int layer = 2; layer <= maxTiles * 2; ++layer) {
+        for (int moverSize = 1; moverSize <= maxTiles; ++moverSize) {
+            int otherSize = layer - moverSize;
+            if (otherSize < 1 || otherSize > maxTiles) {
+                continue;
+            }
+
+            long long hands = getChoose(StandardSet::TILE_COUNT, moverSize)
+                * getChoose(StandardSet::TILE_COUNT - moverSize, otherSize);
+
+            std::vector<std::thread> workers;
+            for (int t = 0; t < threadCount; ++t) {
+                workers.emplace_back(&EndgameTablebase::solveRange, &table, moverSize, otherSize,
+                    hands * t / threadCount, hands * (t + 1) / threadCount);
+            }
+            for (std::thread& worker : workers) {
+                worker.join();
+            }
+        }
+    }
+
+    // 3. The file
+    std::ofstream outFile(filename, std::ios::binary);
+    if (!outFile.is_open()) {
+        std::cerr << "Error: Could not open file for writing: " << filename << std::endl;
+        return false;
+    }
+
+    unsigned char header[HEADER_SIZE] = { 'L', 'G', 'T', 'B', FILE_VERSION, static_cast<unsigned char>(maxTiles) };
+    outFile.write(reinterpret_cast<const char*>(header), HEADER_SIZE);
+    outFile.write(reinterpret_cast<const char*>(table.m_buffer.data()), static_cast<std::streamsize>(table.m_entryCount));
+    return static_cast<bool>(outFile);
+}
+
+/* *********************************************************************
+Function Name: layOut
+Purpose: Places the groups of a table one after another.
+Parameters:
+        maxTiles, an integer between 1 and MAX_TILES.
+Return Value: None
+Algorithm: Give each pair of hand sizes C(28, a) * C(28 - a, b) *
+        ARM_STATES entries, and total them.
+Reference: None
+********************************************************************* */
+void EndgameTablebase::layOut(int maxTiles) {
+    m_maxTiles = maxTiles;
+    m_entryCount = 0;
+
+    for (int moverSize = 1; moverSize <= maxTiles; ++moverSize) {
+        for (int otherSize = 1; otherSize <= maxTiles; ++otherSize) {
+            m_offsets[moverSize][otherSize] = m_entryCount;
+            m_entryCount += getChoose(StandardSet::TILE_COUNT, moverSize)
+                * getChoose(StandardSet::TILE_COUNT - moverSize, otherSize) * ARM_STATES;
+        }
+    }
+}
+
+/* *********************************************************************
+Function Name: getIndex
+Purpose: Finds a position's entry.
+Parameters:
+        moverHand, otherHand, masks. The mover's and the opponent's
+            hands, each of 1 to m_maxTiles tiles.
+        moverEnd, otherEnd, integers. The open pips of each arm.
+        otherPassed, a boolean. True if the opponent passed last turn.
+Return Value: The entry's position among the values.
+Algorithm:
+        1. Number the mover's hand among the subsets of the set.
+        2. Remove the mover's tiles from the opponent's hand's mask,
+            closing the gaps, and number it among the subsets of the
+            rest.
+        3. Add the arms' entry to the group's offset.
+Reference: Knuth, D. E., The Art of Computer Programming, Volume 4A,
+        7.2.1.3 (the combinatorial number system)
+********************************************************************* */
+long long EndgameTablebase::getIndex(Mask moverHand, Mask otherHand, int moverEnd, int otherEnd, bool otherPassed) const {
+    int moverSize = std::popcount(moverHand);
+    int otherSize = std::popcount(otherHand);
+
+    // 1-2. The hands
+    long long hands = getRank(moverHand) * getChoose(StandardSet::TILE_COUNT - moverSize, otherSize)
+        + getRank(compress(otherHand, moverHand));
+
+    // 3. The arms
+    int arms = (moverEnd * (StandardSet::MAX_PIPS + 1) + otherEnd) * 2 + (otherPassed ? 1 : 0);
+    return m_offsets[moverSize][otherSize] + hands * ARM_STATES + arms;
+}
+
+/* *********************************************************************
+Function Name: solve
+Purpose: Finds the value of a position from the solved layer below it.
+Parameters:
+        moverHand, otherHand, moverEnd, otherEnd, otherPassed. As for
+            getIndex().
+Return Value: The mover's points minus the opponent's under perfect
+        play.
+Algorithm:
+        1. List the tiles fitting the mover's arm, and those fitting
+            the opponent's, which needs a double unless they passed.
+        2. If none fits, pass: after the opponent's pass the round is
+            blocked and the lower pip total wins the other; otherwise
+            the value is minus the opponent's, solved the same way.
+        3. Otherwise take the best play: going out wins the opponent's
+            pips; any other play is worth minus the opponent's value
+            in the table.
+Reference: None
+********************************************************************* */
+int EndgameTablebase::solve(Mask moverHand, Mask otherHand, int moverEnd, int otherEnd, bool otherPassed) const {
+    // 1. The moves
+    Mask ownFits = moverHand & StandardSet::getPipMask(moverEnd);
+    Mask otherFits = moverHand & StandardSet::getPipMask(otherEnd);
+    if (!otherPassed) {
+        otherFits &= StandardSet::getDoublesMask();
+    }
+
+    // 2. A pass; the opponent's answer ends the recursion, since a second pass blocks the round
+    if (ownFits == 0 && otherFits == 0) {
+        if (!otherPassed) {
+            return -solve(otherHand, moverHand, otherEnd, moverEnd, true);
+        }
+
+        int own = getPips(moverHand);
+        int theirs = getPips(otherHand);
+        return (own < theirs) ? theirs : (theirs < own) ? -own : 0;
+    }
+
+    // 3. The best play, on either arm
+    int best = -StandardSet::TILE_COUNT * StandardSet::MAX_PIPS;
+
+    for (int arm = 0; arm < 2; ++arm) {
+        Mask fits = (arm == 0) ? ownFits : otherFits;
+
+        for (; fits != 0; fits &= fits - 1) {
+            int index = std::countr_zero(fits);
+            Mask rest = moverHand & ~StandardSet::getBit(index);
+            int value = 0;
+
+            if (rest == 0) {
+                value = getPips(otherHand);
+            }
+            else {
+                int newMoverEnd = (arm == 0) ? getOtherHalf(index, moverEnd) : moverEnd;
+                int newOtherEnd = (arm == 1) ? getOtherHalf(index, otherEnd) : otherEnd;
+
+                // The opponent moves next, and the mover has just played rather than passed
+                value = -m_values[getIndex(otherHand, rest, newOtherEnd, newMoverEnd, false)];
+            }
+            best = std::max(best, value);
+        }
+    }
+
+    return best;
+}
+
+/* *********************************************************************
+Function Name: solveRange
+Purpose: The body of a worker thread: solves a run of the hands of one
+        group.
+Parameters:
+        moverSize, otherSize, integers. The group.
+        first, last, integers. The hands to solve, numbered as in
+            getIndex() with the mover's hand first, from first up to
+            but not including last.
+Return Value: None
+Algorithm: Rebuild each pair of hands from its number and store the
+        value of every state of the arms.
+Reference: None
+********************************************************************* */
+void EndgameTablebase::solveRange(int moverSize, int otherSize, long long first, long long last) {
+    long long otherCount = getChoose(StandardSet::TILE_COUNT - moverSize, otherSize);
+
+    for (long long hands = first; hands < last; ++hands) {
+        Mask moverHand = getSubset(hands / otherCount, moverSize);
+        Mask otherHand = expand(getSubset(hands % otherCount, otherSize), moverHand);
+        signed char* out = m_buffer.data() + m_offsets[moverSize][otherSize] + hands * ARM_STATES;
+
+        // In the order getIndex() numbers the arms
+        for (int moverEnd = 0; moverEnd <= StandardSet::MAX_PIPS; ++moverEnd) {
+            for (int otherEnd = 0; otherEnd <= StandardSet::MAX_PIPS; ++otherEnd) {
+                *out++ = static_cast<signed char>(solve(moverHand, otherHand, moverEnd, otherEnd, false));
+                *out++ = static_cast<signed char>(solve(moverHand, otherHand, moverEnd, otherEnd, true));
+            }
+        }
+    }
+}
+
+/* *********************************************************************
+Function Name: getChoose
+Purpose: Retrieves a binomial coefficient.
+Parameters:
+        n, an integer between 0 and the tiles in the set.
+        k, an integer between 0 and MAX_TILES.
+Return Value: C(n, k), or 0 if k > n.
+Algorithm: Look it up in a table built at compile time.
+Reference: None
+********************************************************************* */
+long long EndgameTablebase::getChoose(int n, int k) {
+    static constexpr std::array<std::array<long long, MAX_TILES + 1>, StandardSet::TILE_COUNT + 1> table = [] {
+        std::array<std::array<long long, MAX_TILES + 1>, StandardSet::TILE_COUNT + 1> rows{};
+        for (int row = 0; row <= StandardSet::TILE_COUNT; ++row) {
+            rows[row][0] = 1;
+            for (int column = 1; column <= MAX_TILES && row > 0; ++column) {
+                rows[row][column] = rows[row - 1][column - 1] + rows[row - 1][column];
+            }
+        }
+        return rows;
+    }();
+
+    return table[n][k];
+}
+
+/* *********************************************************************
+Function Name: getRank / getSubset
+Purpose: Convert between a set of tiles and its number among the sets
+        of the same size.
+Parameters:
+        mask, a mask. / rank, its number, and size, the tiles in it.
+Return Value: The number. / The mask.
+Algorithm: The j-th lowest bit c contributes C(c, j); unranking takes
+        the highest bit first, as the largest c with C(c, j) <= rank.
+Reference: None
+********************************************************************* */
+long long EndgameTablebase::getRank(Mask mask) {
+    long long rank = 0;
+    for (int j = 1; mask != 0; ++j, mask &= mask - 1) {
+        rank += getChoose(std::countr_zero(mask), j);
+    }
+    return rank;
+}
+
+EndgameTablebase::Mask EndgameTablebase::getSubset(long long rank, int size) {
+    Mask mask = 0;
+    int bit = StandardSet::TILE_COUNT;
+
+    for (int j = size; j >= 1; --j) {
+        do {
+            --bit;
+        } while (getChoose(bit, j) > rank);
+
+        mask |= StandardSet::getBit(bit);
+        rank -= getChoose(bit, j);
+    }
+    return mask;
+}
+
+/* *********************************************************************
+Function Name: compress / expand
+Purpose: Renumber a set of tiles with some tiles taken out of the set,
+        and back.
+Parameters:
+        mask, a mask disjoint from removed.
+        removed, a mask of the tiles taken out.
+Return Value: The renumbered mask.
+Algorithm: Move each bit down by the number of removed bits below it;
+        expanding moves each bit to the matching bit not removed.
+Reference: None
+********************************************************************* */
+EndgameTablebase::Mask EndgameTablebase::compress(Mask mask, Mask removed) {
+    Mask result = 0;
+    for (; mask != 0; mask &= mask - 1) {
+        Mask bit = mask & (~mask + 1);
+        result |= bit >> std::popcount(removed & (bit - 1));
+    }
+    return result;
+}
+
+EndgameTablebase::Mask EndgameTablebase::expand(Mask mask, Mask removed) {
+    Mask result = 0;
+    int bit = 0;
+
+    // Walk the bits not removed, taking those the mask selects
+    for (int kept = 0; mask >> kept != 0; ++bit) {
+        if (removed & StandardSet::getBit(bit)) {
+            continue;
+        }
+        if (mask & StandardSet::getBit(kept)) {
+            result |= StandardSet::getBit(bit);
+        }
+        ++kept;
+    }
+    return result;
+}
+
+/* *********************************************************************
+Function Name: getPips / getOtherHalf
+Purpose: Total the pips of a set of tiles, and find the half of a tile
+        left open when it is matched on one half.
+Parameters:
+        mask, a mask. / index, a tile's index, and pips, the half
+            matched.
+Return Value: The pip total. / The other half's pips.
+Algorithm: Recover each tile's halves from its index.
+Reference: None
+********************************************************************* */
+int EndgameTablebase::getPips(Mask mask) {
+    int total = 0;
+    for (; mask != 0; mask &= mask - 1) {
+        int index = std::countr_zero(mask);
+        int high = 0;
+        while (StandardSet::getIndex(0, high + 1) <= index) {
+            ++high;
+        }
+        total += high + (index - StandardSet::getIndex(0, high));
+    }
+    return total;
+}
+
+int EndgameTablebase::getOtherHalf(int index, int pips) {
+    int high = 0;
+    while (StandardSet::getIndex(0, high + 1) <= index) {
+        ++high;
+    }
+    int low = index - StandardSet::getIndex(0, high);
+    return (high == pips) ? low : high;
+}
\ No newline at end of file
@@ -0,0 +1,319 @@
+#ifndef ENDGAMETABLEBASE_H
+#define ENDGAMETABLEBASE_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <string>
+#include <vector>
+
+#include "DominoSet.h"
+#include "MappedFile.h"
+#include "Playout.h"
+
+/* *********************************************************************
+Class Name: EndgameTablebase
+Purpose: The solved values of every two-player double-six endgame with an
+        empty boneyard and at most a few tiles in each hand, kept in a
+        file that is memory-mapped and probed in constant time.
+
+        With the boneyard empty, nothing is hidden, so each position has
+        an exact value under perfect play: the mover's points minus the
+        opponent's. The rules treat the two players alike, so positions
+        are stored from the mover's side: the mover's hand, the opponent's
+        hand, the open pips of the mover's arm and of the opponent's, and
+        whether the opponent passed last turn. Nothing else matters: the
+        layout's other tiles are out of play, and the mover's own pass
+        flag is cleared or set by this turn either way.
+
+        The table is solved backwards from the end of the round, one layer
+        of tiles in hand at a time. Every play removes a tile, so each
+        position of a layer depends only on the layer below, or on a pass
+        that the other player answers with a play or a block; the
+        positions of a layer are shared out between threads.
+
+        The file is a HEADER_SIZE byte header (the bytes "LGTB", the
+        version and the tiles per hand) followed by one signed byte per
+        position. Positions are grouped by the sizes of the two hands; in
+        a group, the mover's hand is numbered among the subsets of the set
+        and the opponent's among the subsets of the remaining tiles, both
+        in the combinatorial number system, followed by ARM_STATES entries
+        for the arms. With up to two tiles per hand the table holds about
+        fourteen million positions; each tile more multiplies it by about
+        seventy.
+********************************************************************* */
+class EndgameTablebase {
+public:
+
+    typedef StandardSet::Mask Mask;
+
+    // The most tiles per hand a table can be built for
+    static const int MAX_TILES = 3;
+
+    // The entries for each pair of hands: both arms' pips and the opponent's pass flag
+    static const int ARM_STATES = (StandardSet::MAX_PIPS + 1) * (StandardSet::MAX_PIPS + 1) * 2;
+
+    static const int HEADER_SIZE = 16;
+    static const int FILE_VERSION = 1;
+
+    /* --- Constructor --- */
+
+    /* *********************************************************************
+    Function Name: EndgameTablebase
+    Purpose: Default constructor. No table is open.
+    Parameters: None
+    Return Value: None
+    Algorithm: Null the values and zero the counts.
+    Reference: None
+    ********************************************************************* */
+    EndgameTablebase();
+
+    /* --- Destructor --- */
+
+    /* *********************************************************************
+    Function Name: ~EndgameTablebase
+    Purpose: Destructor. The mapped file unmaps itself.
+    Parameters: None
+    Return Value: None
+    Algorithm: Standard object destruction.
+    Reference: None
+    ********************************************************************* */
+    ~EndgameTablebase() = default;
+
+    /* --- Selectors --- */
+
+    /* *********************************************************************
+    Function Name: isOpen
+    Purpose: Checks whether a table is open.
+    Parameters: None
+    Return Value: Boolean true if open() succeeded.
+    Algorithm: Test the values pointer.
+    Reference: None
+    ********************************************************************* */
+    inline bool isOpen() const { return m_values != nullptr; }
+
+    /* *********************************************************************
+    Function Name: getMaxTiles / getEntryCount
+    Purpose: Retrieve the most tiles per hand the open table covers, and
+            the number of positions it holds.
+    Parameters: None
+    Return Value: An integer count of tiles. / A count of positions.
+    Algorithm: Return the stored counts.
+    Reference: None
+    ********************************************************************* */
+    inline int getMaxTiles() const { return m_maxTiles; }
+    inline long long getEntryCount() const { return m_entryCount; }
+
+    /* *********************************************************************
+    Function Name: contains
+    Purpose: Checks whether a position is in the table.
+    Parameters:
+            position, a Playout passed by const reference.
+    Return Value: Boolean true if a table is open and the position is a
+            two-player round in progress with an empty boneyard and
+            between 1 and getMaxTiles() tiles in each hand.
+    Algorithm: Test the player count, the boneyard and the hand sizes.
+    Reference: None
+    ********************************************************************* */
+    bool contains(const Playout& position) const;
+
+    /* *********************************************************************
+    Function Name: probe
+    Purpose: Looks up the value of a position.
+    Parameters:
+            position, a Playout passed by const reference.
+            outValue, an integer passed by reference. Receives the mover's
+                points minus the opponent's under perfect play.
+    Return Value: Boolean true if the position is in the table.
+    Algorithm:
+            1. Check contains().
+            2. Build the mask of each hand and read the entry at
+                getIndex(); the work is a few operations per tile in hand.
+    Reference: None
+    ********************************************************************* */
+    bool probe(const Playout& position, int& outValue) const;
+
+    /* --- Mutators --- */
+
+    /* *********************************************************************
+    Function Name: open
+    Purpose: Maps a table written by generate().
+    Parameters:
+            filename, a string representing the table path.
+    Return Value: Boolean true if the file was mapped and is a whole
+            table; false, with an error message, otherwise.
+    Algorithm:
+            1. Map the file.
+            2. Check the magic bytes, the version and the tiles per hand.
+            3. Lay out the groups and check the size matches.
+    Reference: None
+    ********************************************************************* */
+    bool open(const std::string& filename);
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: generate
+    Purpose: Solves every position with up to maxTiles tiles per hand and
+            writes the table to a file.
+    Parameters:
+            filename, a string representing the output path.
+            maxTiles, an integer between 1 and MAX_TILES.
+            threadCount, an integer. The number of worker threads, or 0 for
+                one per hardware thread.
+    Return Value: Boolean true if the table was written; false, with an
+            error message, otherwise.
+    Algorithm:
+            1. Lay out the groups and allocate the whole table.
+            2. For 2, 3, ... 2 * maxTiles tiles in hand, solve every group
+                of that layer, splitting each group's hands evenly between
+                the threads and waiting for all of them before moving on.
+            3. Write the header and the values.
+    Reference: Thompson, K. (1986), "Retrograde analysis of certain
+            endgames"
+    ********************************************************************* */
+    static bool generate(const std::string& filename, int maxTiles, int threadCount);
+
+private:
+    MappedFile m_file;
+
+    // The values while generating; an open table reads them from m_file
+    std::vector<signed char> m_buffer;
+    const signed char* m_values;
+
+    int m_maxTiles;
+    long long m_entryCount;
+
+    // The first entry of each group, by the sizes of the mover's and the opponent's hands
+    long long m_offsets[MAX_TILES + 1][MAX_TILES + 1];
+
+    /* *********************************************************************
+    Function Name: layOut
+    Purpose: Places the groups of a table one after another.
+    Parameters:
+            maxTiles, an integer between 1 and MAX_TILES.
+    Return Value: None
+    Algorithm: Give each pair of hand sizes C(28, a) * C(28 - a, b) *
+            ARM_STATES entries, and total them.
+    Reference: None
+    ********************************************************************* */
+    void layOut(int maxTiles);
+
+    /* *********************************************************************
+    Function Name: getIndex
+    Purpose: Finds a position's entry.
+    Parameters:
+            moverHand, otherHand, masks. The mover's and the opponent's
+                hands, each of 1 to m_maxTiles tiles.
+            moverEnd, otherEnd, integers. The open pips of each arm.
+            otherPassed, a boolean. True if the opponent passed last turn.
+    Return Value: The entry's position among the values.
+    Algorithm:
+            1. Number the mover's hand among the subsets of the set.
+            2. Remove the mover's tiles from the opponent's hand's mask,
+                closing the gaps, and number it among the subsets of the
+                rest.
+            3. Add the arms' entry to the group's offset.
+    Reference: Knuth, D. E., The Art of Computer Programming, Volume 4A,
+            7.2.1.3 (the combinatorial number system)
+    ********************************************************************* */
+    long long getIndex(Mask moverHand, Mask otherHand, int moverEnd, int otherEnd, bool otherPassed) const;
+
+    /* *********************************************************************
+    Function Name: solve
+    Purpose: Finds the value of a position from the solved layer below it.
+    Parameters:
+            moverHand, otherHand, moverEnd, otherEnd, otherPassed. As for
+                getIndex().
+    Return Value: The mover's points minus the opponent's under perfect
+            play.
+    Algorithm:
+            1. List the tiles fitting the mover's arm, and those fitting
+                the opponent's, which needs a double unless they passed.
+            2. If none fits, pass: after the opponent's pass the round is
+                blocked and the lower pip total wins the other; otherwise
+                the value is minus the opponent's, solved the same way.
+            3. Otherwise take the best play: going out wins the opponent's
+                pips; any other play is worth minus the opponent's value
+                in the table.
+    Reference: None
+    ********************************************************************* */
+    int solve(Mask moverHand, Mask otherHand, int moverEnd, int otherEnd, bool otherPassed) const;
+
+    /* *********************************************************************
+    Function Name: solveRange
+    Purpose: The body of a worker thread: solves a run of the hands of one
+            group.
+    Parameters:
+            moverSize, otherSize, integers. The group.
+            first, last, integers. The hands to solve, numbered as in
+                getIndex() with the mover's hand first, from first up to
+                but not including last.
+    Return Value: None
+    Algorithm: Rebuild each pair of hands from its number and store the
+            value of every state of the arms.
+    Reference: None
+    ********************************************************************* */
+    void solveRange(int moverSize, int otherSize, long long first, long long last);
+
+    /* *********************************************************************
+    Function Name: getChoose
+    Purpose: Retrieves a binomial coefficient.
+    Parameters:
+            n, an integer between 0 and the tiles in the set.
+            k, an integer between 0 and MAX_TILES.
+    Return Value: C(n, k), or 0 if k > n.
+    Algorithm: Look it up in a table built at compile time.
+    Reference: None
+    ********************************************************************* */
+    static long long getChoose(int n, int k);
+
+    /* *********************************************************************
+    Function Name: getRank / getSubset
+    Purpose: Convert between a set of tiles and its number among the sets
+            of the same size.
+    Parameters:
+            mask, a mask. / rank, its number, and size, the tiles in it.
+    Return Value: The number. / The mask.
+    Algorithm: The j-th lowest bit c contributes C(c, j); unranking takes
+            the highest bit first, as the largest c with C(c, j) <= rank.
+    Reference: None
+    ********************************************************************* */
+    static long long getRank(Mask mask);
+    static Mask getSubset(long long rank, int size);
+
+    /* *********************************************************************
+    Function Name: compress / expand
+    Purpose: Renumber a set of tiles with some tiles taken out of the set,
+            and back.
+    Parameters:
+            mask, a mask disjoint from removed.
+            removed, a mask of the tiles taken out.
+    Return Value: The renumbered mask.
+    Algorithm: Move each bit down by the number of removed bits below it;
+            expanding moves each bit to the matching bit not removed.
+    Reference: None
+    ********************************************************************* */
+    static Mask compress(Mask mask, Mask removed);
+    static Mask expand(Mask mask, Mask removed);
+
+    /* *********************************************************************
+    Function Name: getPips / getOtherHalf
+    Purpose: Total the pips of a set of tiles, and find the half of a tile
+            left open when it is matched on one half.
+    Parameters:
+            mask, a mask. / index, a tile's index, and pips, the half
+                matched.
+    Return Value: The pip total. / The other half's pips.
+    Algorithm: Recover each tile's halves from its index.
+    Reference: None
+    ********************************************************************* */
+    static int getPips(Mask mask);
+    static int getOtherHalf(int index, int pips);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,328 @@
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <cerrno>
+#include <csignal>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include "EngineProcess.h"
+
+/* *********************************************************************
+Function Name: EngineProcess
+Purpose: Default constructor. No process is running.
+Parameters: None
+Return Value: None
+Algorithm: Mark the pipes and the process as closed.
+Reference: None
+********************************************************************* */
+EngineProcess::EngineProcess()
+    : m_input(CLOSED), m_output(CLOSED), m_process(CLOSED), m_buffer()
+{
+}
+
+/* *********************************************************************
+Function Name: ~EngineProcess
+Purpose: Destructor. Ends the process if it is running.
+Parameters: None
+Return Value: None
+Algorithm: Call stop().
+Reference: None
+********************************************************************* */
+EngineProcess::~EngineProcess() {
+    stop();
+}
+
+/* *********************************************************************
+Function Name: start
+Purpose: Starts a command with its standard input and output piped to
+        this object. Its standard error is left as this process's.
+Parameters:
+        command, a string. The command line, run by the shell.
+Return Value: Boolean true if the process was started.
+Algorithm:
+        1. Stop any process already running.
+        2. Create a pipe for each direction.
+        3. Start the child with its ends of the pipes as its standard
+            input and output, and close them in this process.
+Reference: Microsoft Learn, "Creating a Child Process with Redirected
+        Input and Output"; POSIX fork(2), exec(3)
+********************************************************************* */
+bool EngineProcess::start(const std::string& command) {
+    // 1. One process at a time
+    stop();
+
+#ifdef _WIN32
+    // 2. The pipes; only the child's ends are inherited
+    SECURITY_ATTRIBUTES security = { sizeof(SECURITY_ATTRIBUTES), nullptr, TRUE };
+    HANDLE childInput = nullptr;
+    HANDLE input = nullptr;
+    HANDLE output = nullptr;
+    HANDLE childOutput = nullptr;
+    if (!CreatePipe(&childInput, &input, &security, 0)) {
+        return false;
+    }
+    if (!CreatePipe(&output, &childOutput, &security, 0)) {
+        CloseHandle(childInput);
+        CloseHandle(input);
+        return false;
+    }
+    SetHandleInformation(input, HANDLE_FLAG_INHERIT, 0);
+    SetHandleInformation(output, HANDLE_FLAG_INHERIT, 0);
+
+    // 3. The child, run by the command interpreter
+    STARTUPINFOA startup = {};
+    startup.cb = sizeof(startup);
+    startup.dwFlags = STARTF_USESTDHANDLES;
+    startup.hStdInput = childInput;
+    startup.hStdOutput = childOutput;
+    startup.hStdError = GetStdHandle(STD_ERROR_HANDLE);
+
+    PROCESS_INFORMATION process = {};
+    std::string commandLine = "cmd.exe /c " + command;
+    BOOL isStarted = CreateProcessA(nullptr, commandLine.data(), nullptr, nullptr, TRUE, 0, nullptr, nullptr,
+        &startup, &process);
+
+    CloseHandle(childInput);
+    CloseHandle(childOutput);
+    if (!isStarted) {
+        CloseHandle(input);
+        CloseHandle(output);
+        return false;
+    }
+    CloseHandle(process.hThread);
+
+    m_input = reinterpret_cast<intptr_t>(input);
+    m_output = reinterpret_cast<intptr_t>(output);
+    m_process = reinterpret_cast<intptr_t>(process.hProcess);
+#else
+    // 2. The pipes, closed on exec so other children do not inherit them
+    int toChild[2];
+    int fromChild[2];
+    if (pipe(toChild) != 0) {
+        return false;
+    }
+    if (pipe(fromChild) != 0) {
+        ::close(toChild[0]);
+        ::close(toChild[1]);
+        return false;
+    }
+    for (int descriptor : { toChild[0], toChild[1], fromChild[0], fromChild[1] }) {
+        fcntl(descriptor, F_SETFD, FD_CLOEXEC);
+    }
+
+    // A write to an engine that has exited fails instead of ending this process
+    std::signal(SIGPIPE, SIG_IGN);
+
+    // 3. The child, run by the shell; dup2 clears close-on-exec on its copies
+    pid_t child = fork();
+    if (child == 0) {
+        dup2(toChild[0], STDIN_FILENO);
+        dup2(fromChild[1], STDOUT_FILENO);
+        execl("/bin/sh", "sh", "-c", command.c_str(), static_cast<char*>(nullptr));
+        _exit(127);
+    }
+
+    ::close(toChild[0]);
+    ::close(fromChild[1]);
+    if (child < 0) {
+        ::close(toChild[1]);
+        ::close(fromChild[0]);
+        return false;
+    }
+
+    m_input = toChild[1];
+    m_output = fromChild[0];
+    m_process = child;
+#endif
+
+    return true;
+}
+
+/* *********************************************************************
+Function Name: write
+Purpose: Sends text to the process's standard input.
+Parameters:
+        text, a std::string_view. Usually whole lines.
+Return Value: Boolean true if all of it was written; false if the
+        process has closed its input.
+Algorithm: Write until every byte is taken.
+Reference: None
+********************************************************************* */
+bool EngineProcess::write(std::string_view text) {
+    while (!text.empty() && m_input != CLOSED) {
+#ifdef _WIN32
+        DWORD written = 0;
+        if (!WriteFile(reinterpret_cast<HANDLE>(m_input), text.data(), static_cast<DWORD>(text.size()), &written,
+            nullptr)) {
+            return false;
+        }
+#else
+        ssize_t written = ::write(static_cast<int>(m_input), text.data(), text.size());
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            return false;
+        }
+#endif
+        text.remove_prefix(static_cast<size_t>(written));
+    }
+
+    return text.empty();
+}
+
+/* *********************************************************************
+Function Name: readLine
+Purpose: Reads the next line the process writes, waiting a limited
+        time for it.
+Parameters:
+        outLine, a string passed by reference. Receives the line,
+            without its line ending.
+        milliseconds, an integer. The longest to wait.
+Return Value: Boolean true if a line was read; false if the time ran
+        out or the process closed its output.
+Algorithm:
+        1. Return a line already in the buffer.
+        2. Otherwise wait for output until the time left runs out,
+            append what arrives to the buffer and try again.
+Reference: None
+********************************************************************* */
+bool EngineProcess::readLine(std::string& outLine, int milliseconds) {
+    std::chrono::steady_clock::time_point deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(milliseconds);
+
+    while (true) {
+        // 1. A whole line
+        size_t newline = m_buffer.find('\n');
+        if (newline != std::string::npos) {
+            size_t length = (newline > 0 && m_buffer[newline - 1] == '\r') ? newline - 1 : newline;
+            outLine.assign(m_buffer, 0, length);
+            m_buffer.erase(0, newline + 1);
+            return true;
+        }
+        if (m_output == CLOSED) {
+            return false;
+        }
+
+        // 2. More output, waiting no later than the deadline
+        long long left = std::max<long long>(0, std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now()).count());
+        char chunk[4096];
+
+#ifdef _WIN32
+        DWORD available = 0;
+        if (!PeekNamedPipe(reinterpret_cast<HANDLE>(m_output), nullptr, 0, nullptr, &available, nullptr)) {
+            return false;
+        }
+        if (available == 0) {
+            if (left == 0) {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+
+        DWORD count = 0;
+        if (!ReadFile(reinterpret_cast<HANDLE>(m_output), chunk, std::min<DWORD>(available, sizeof(chunk)), &count,
+            nullptr) || count == 0) {
+            return false;
+        }
+#else
+        pollfd waiting = { static_cast<int>(m_output), POLLIN, 0 };
+        int ready = poll(&waiting, 1, static_cast<int>(left));
+        if (ready < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ready <= 0) {
+            return false;
+        }
+
+        ssize_t count = ::read(static_cast<int>(m_output), chunk, sizeof(chunk));
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count <= 0) {
+            return false;
+        }
+#endif
+        m_buffer.append(chunk, static_cast<size_t>(count));
+    }
+}
+
+/* *********************************************************************
+Function Name: stop
+Purpose: Ends the process. Does nothing if none is running.
+Parameters: None
+Return Value: None
+Algorithm:
+        1. Close the pipe to the process, which an engine reads as the
+            end of its commands.
+        2. Give it STOP_MILLISECONDS to exit, then kill it.
+        3. Close the other pipe and empty the buffer.
+Reference: None
+********************************************************************* */
+void EngineProcess::stop() {
+    if (m_input == CLOSED) {
+        return;
+    }
+
+#ifdef _WIN32
+    // 1. End of input
+    CloseHandle(reinterpret_cast<HANDLE>(m_input));
+
+    // 2. Exit, or be ended
+    HANDLE process = reinterpret_cast<HANDLE>(m_process);
+    if (WaitForSingleObject(process, STOP_MILLISECONDS) == WAIT_TIMEOUT) {
+        TerminateProcess(process, 1);
+        WaitForSingleObject(process, INFINITE);
+    }
+    CloseHandle(process);
+
+    // 3. The output
+    CloseHandle(reinterpret_cast<HANDLE>(m_output));
+#else
+    // 1. End of input
+    ::close(static_cast<int>(m_input));
+
+    // 2. Exit, or be ended
+    pid_t child = static_cast<pid_t>(m_process);
+    int status = 0;
+    bool hasExited = false;
+    for (int waited = 0; waited < STOP_MILLISECONDS && !hasExited; ++waited) {
+        hasExited = (waitpid(child, &status, WNOHANG) == child);
+        if (!hasExited) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    if (!hasExited) {
+        kill(child, SIGKILL);
+        waitpid(child, &status, 0);
+    }
+
+    // 3. The output
+    ::close(static_cast<int>(m_output));
+#endif
+
+    m_input = CLOSED;
+    m_output = CLOSED;
+    m_process = CLOSED;
+    m_buffer.clear();
+}
\ No newline at end of file
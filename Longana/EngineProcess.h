@@ -0,0 +1,148 @@
+#ifndef ENGINEPROCESS_H
+#define ENGINEPROCESS_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/* *********************************************************************
+Class Name: EngineProcess
+Purpose: Runs another program as a child process connected by two pipes,
+        one to its standard input and one from its standard output, for
+        talking to an engine line by line. Reads wait no longer than a
+        given time, so an engine that hangs cannot stall the caller; the
+        lines read are buffered, so a reply may arrive in any number of
+        pieces. The process uses CreateProcess on Windows and fork and
+        exec elsewhere, with the command run by the system's shell. The
+        object owns the process and its pipes, and cannot be copied.
+********************************************************************* */
+class EngineProcess {
+public:
+
+    /* --- Constructor --- */
+
+    /* *********************************************************************
+    Function Name: EngineProcess
+    Purpose: Default constructor. No process is running.
+    Parameters: None
+    Return Value: None
+    Algorithm: Mark the pipes and the process as closed.
+    Reference: None
+    ********************************************************************* */
+    EngineProcess();
+
+    EngineProcess(const EngineProcess&) = delete;
+    EngineProcess& operator=(const EngineProcess&) = delete;
+
+    /* --- Destructor --- */
+
+    /* *********************************************************************
+    Function Name: ~EngineProcess
+    Purpose: Destructor. Ends the process if it is running.
+    Parameters: None
+    Return Value: None
+    Algorithm: Call stop().
+    Reference: None
+    ********************************************************************* */
+    ~EngineProcess();
+
+    /* --- Selectors --- */
+
+    /* *********************************************************************
+    Function Name: isRunning
+    Purpose: Checks whether a process was started and not yet stopped.
+    Parameters: None
+    Return Value: Boolean true if the pipes are open.
+    Algorithm: Check the pipe to the process.
+    Reference: None
+    ********************************************************************* */
+    inline bool isRunning() const { return m_input != CLOSED; }
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: start
+    Purpose: Starts a command with its standard input and output piped to
+            this object. Its standard error is left as this process's.
+    Parameters:
+            command, a string. The command line, run by the shell.
+    Return Value: Boolean true if the process was started.
+    Algorithm:
+            1. Stop any process already running.
+            2. Create a pipe for each direction.
+            3. Start the child with its ends of the pipes as its standard
+                input and output, and close them in this process.
+    Reference: Microsoft Learn, "Creating a Child Process with Redirected
+            Input and Output"; POSIX fork(2), exec(3)
+    ********************************************************************* */
+    bool start(const std::string& command);
+
+    /* *********************************************************************
+    Function Name: write
+    Purpose: Sends text to the process's standard input.
+    Parameters:
+            text, a std::string_view. Usually whole lines.
+    Return Value: Boolean true if all of it was written; false if the
+            process has closed its input.
+    Algorithm: Write until every byte is taken.
+    Reference: None
+    ********************************************************************* */
+    bool write(std::string_view text);
+
+    /* *********************************************************************
+    Function Name: readLine
+    Purpose: Reads the next line the process writes, waiting a limited
+            time for it.
+    Parameters:
+            outLine, a string passed by reference. Receives the line,
+                without its line ending.
+            milliseconds, an integer. The longest to wait.
+    Return Value: Boolean true if a line was read; false if the time ran
+            out or the process closed its output.
+    Algorithm:
+            1. Return a line already in the buffer.
+            2. Otherwise wait for output until the time left runs out,
+                append what arrives to the buffer and try again.
+    Reference: None
+    ********************************************************************* */
+    bool readLine(std::string& outLine, int milliseconds);
+
+    /* *********************************************************************
+    Function Name: stop
+    Purpose: Ends the process. Does nothing if none is running.
+    Parameters: None
+    Return Value: None
+    Algorithm:
+            1. Close the pipe to the process, which an engine reads as the
+                end of its commands.
+            2. Give it STOP_MILLISECONDS to exit, then kill it.
+            3. Close the other pipe and empty the buffer.
+    Reference: None
+    ********************************************************************* */
+    void stop();
+
+private:
+
+    // Marks a pipe or process that is not open
+    static const intptr_t CLOSED = -1;
+
+    // How long a process may take to exit once its input is closed
+    static const int STOP_MILLISECONDS = 1000;
+
+    // Pipe handles or descriptors, and the process handle or id
+    intptr_t m_input;
+    intptr_t m_output;
+    intptr_t m_process;
+
+    // Output read but not yet returned as lines
+    std::string m_buffer;
+};
+
+#endif
\ No newline at end of file
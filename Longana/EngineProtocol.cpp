@@ -0,0 +1,506 @@
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+#include "EngineProtocol.h"
+#include "Round.h"
+#include "SaveParser.h"
+#include "Serializer.h"
+#include "StrategyRegistry.h"
+#include "Tile.h"
+
+/* *********************************************************************
+Function Name: EngineProtocol
+Purpose: Constructor. Prepares a session on the given streams.
+Parameters:
+        in, an istream passed by reference. The controller's commands.
+        out, an ostream passed by reference. The engine's replies.
+Return Value: None
+Algorithm:
+        1. Store the streams and make the default strategy, attaching
+            the stop signal to it.
+        2. Start the worker thread, which waits for a search.
+Reference: None
+********************************************************************* */
+EngineProtocol::EngineProtocol(std::istream& in, std::ostream& out)
+    : m_in(in), m_out(out), m_game(), m_hasPosition(false), m_hasDrawn(false), m_strategy(StrategyRegistry::create(DEFAULT_STRATEGY)),
+    m_strategyName(DEFAULT_STRATEGY), m_stop(false), m_jobHasDrawn(false), m_jobMilliseconds(0), m_hasJob(false),
+    m_isQuitting(false)
+{
+    m_strategy->setStopSignal(&m_stop);
+    m_worker = std::thread(&EngineProtocol::work, this);
+}
+
+/* *********************************************************************
+Function Name: ~EngineProtocol
+Purpose: Destructor. Ends any search and the worker thread.
+Parameters: None
+Return Value: None
+Algorithm: Set the stop signal and the quitting flag, wake the worker
+        and join it.
+Reference: None
+********************************************************************* */
+EngineProtocol::~EngineProtocol() {
+    m_stop = true;
+    {
+        std::lock_guard<std::mutex> lock(m_jobMutex);
+        m_isQuitting = true;
+    }
+    m_jobChanged.notify_all();
+    m_worker.join();
+}
+
+/* *********************************************************************
+Function Name: setStrategy
+Purpose: Chooses the strategy searches play with, as "setoption
+        strategy" does.
+Parameters:
+        spec, a string. A StrategyRegistry spec.
+Return Value: Boolean true if the spec named a strategy; otherwise the
+        strategy is unchanged and the registry has reported why.
+Algorithm: Make the strategy, attach the stop signal and keep it with
+        its spec.
+Reference: None
+********************************************************************* */
+bool EngineProtocol::setStrategy(const std::string& spec) {
+    std::unique_ptr<ComputerStrategy> strategy = StrategyRegistry::create(spec);
+    if (strategy == nullptr) {
+        return false;
+    }
+
+    m_strategy = std::move(strategy);
+    m_strategy->setStopSignal(&m_stop);
+    m_strategyName = spec;
+    return true;
+}
+
+/* *********************************************************************
+Function Name: run
+Purpose: Answers commands until "quit" or the end of the input.
+Parameters: None
+Return Value: 0, for the process exit code.
+Algorithm: Read each line and pass it to handleCommand() until it
+        returns false or the input ends; then wait for any search
+        to reply.
+Reference: None
+********************************************************************* */
+int EngineProtocol::run() {
+    std::string line;
+    while (std::getline(m_in, line)) {
+        if (!handleCommand(line)) {
+            break;
+        }
+    }
+
+    waitForSearch();
+    return 0;
+}
+
+/* *********************************************************************
+Function Name: handleCommand
+Purpose: Carries out one command.
+Parameters:
+        line, a std::string_view. The command and its arguments.
+Return Value: Boolean false for "quit"; true otherwise.
+Algorithm:
+        1. Split off the first word.
+        2. Answer "longana", "isready" and "stop" at once; wait for
+            any search to reply before every other command.
+        3. Report an unknown command or a bad argument on std::cerr
+            and carry on.
+Reference: None
+********************************************************************* */
+bool EngineProtocol::handleCommand(std::string_view line) {
+    // 1. The command, without a carriage return from a Windows controller
+    if (!line.empty() && line.back() == '\r') {
+        line.remove_suffix(1);
+    }
+    size_t space = line.find(' ');
+    std::string_view command = line.substr(0, space);
+    std::string_view arguments = (space == std::string_view::npos) ? std::string_view() : line.substr(space + 1);
+
+    // 2. Commands answered at once
+    if (command.empty()) {
+        return true;
+    }
+    if (command == "longana") {
+        reply("id name Longana " + m_strategyName + "\nid author Race Partin\noption strategy " + m_strategyName + "\nlonganaok\n");
+        return true;
+    }
+    if (command == "isready") {
+        reply("readyok\n");
+        return true;
+    }
+    if (command == "stop") {
+        m_stop = true;
+        waitForSearch();
+        return true;
+    }
+
+    waitForSearch();
+    if (command == "quit") {
+        return false;
+    }
+
+    bool isDone = false;
+    if (command == "position") {
+        isDone = setPosition(arguments);
+    }
+    else if (command == "play" || command == "draw" || command == "pass") {
+        applyMove(command, arguments);
+        isDone = true;
+    }
+    else if (command == "go") {
+        isDone = startSearch(arguments);
+    }
+    else if (command == "setoption" && arguments.substr(0, 9) == "strategy ") {
+        isDone = setStrategy(std::string(arguments.substr(9)));
+    }
+    else {
+        std::cerr << "Error: Unknown command: " << line << std::endl;
+        return true;
+    }
+
+    // 3. A command that could not be carried out
+    if (!isDone) {
+        std::cerr << "Error: Could not carry out: " << line << std::endl;
+    }
+    return true;
+}
+
+/* *********************************************************************
+Function Name: setPosition
+Purpose: Replaces the position with one from a file, a snapshot or
+        the save-file lines that follow.
+Parameters:
+        arguments, a std::string_view. The words after "position".
+Return Value: Boolean true if the position was read and dealt.
+Algorithm:
+        1. Clear the drawn flag and read the position with
+            readPosition().
+        2. Place the engine if the save was made before it was played,
+            as a round resumed on the console does; a position with no
+            engine to place is rejected.
+Reference: None
+********************************************************************* */
+bool EngineProtocol::setPosition(std::string_view arguments) {
+    // 1. The position
+    m_hasDrawn = false;
+    m_hasPosition = false;
+    if (!readPosition(arguments)) {
+        return false;
+    }
+
+    // 2. The engine, for a save made at the start of a round
+    Round& round = m_game.getCurrentRound();
+    if (round.getLayout().isEmpty()) {
+        round.placeEngine();
+    }
+    m_hasPosition = !round.getLayout().isEmpty();
+    return m_hasPosition;
+}
+
+/* *********************************************************************
+Function Name: readPosition
+Purpose: Reads a position from a file, a snapshot or the save-file
+        lines that follow.
+Parameters:
+        arguments, a std::string_view. The words after "position".
+Return Value: Boolean true if the position was read.
+Algorithm: Load the file with Serializer::loadGame, decode the
+        hexadecimal snapshot with Serializer::decodeBinary, or collect
+        lines up to "end" and parse them with a SaveParser.
+Reference: None
+********************************************************************* */
+bool EngineProtocol::readPosition(std::string_view arguments) {
+    if (arguments.substr(0, 5) == "file ") {
+        return Serializer::loadGame(std::string(arguments.substr(5)), m_game, m_buffer);
+    }
+
+    if (arguments.substr(0, 9) == "snapshot ") {
+        std::string_view hex = arguments.substr(9);
+        if (hex.size() != 2 * Serializer::BINARY_SIZE) {
+            return false;
+        }
+
+        unsigned char data[Serializer::BINARY_SIZE];
+        for (int i = 0; i < Serializer::BINARY_SIZE; ++i) {
+            std::from_chars_result result = std::from_chars(hex.data() + 2 * i, hex.data() + 2 * i + 2, data[i], 16);
+            if (result.ec != std::errc() || result.ptr != hex.data() + 2 * i + 2) {
+                return false;
+            }
+        }
+        return Serializer::decodeBinary(data, sizeof(data), m_game);
+    }
+
+    if (arguments == "save") {
+        m_buffer.clear();
+
+        std::string line;
+        while (std::getline(m_in, line) && line != "end" && line != "end\r") {
+            m_buffer += line;
+            m_buffer += '\n';
+        }
+
+        SaveParser parser(m_buffer);
+        if (!parser.parse(m_game)) {
+            std::cerr << "Error: Line " << parser.getErrorLine() << ", column " << parser.getErrorColumn() << ": "
+                << parser.getErrorMessage() << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    return false;
+}
+
+/* *********************************************************************
+Function Name: applyMove
+Purpose: Plays a tile, a draw or a pass for the player to move.
+Parameters:
+        command, a std::string_view: "play", "draw" or "pass".
+        arguments, a std::string_view. For "play", the tile as a-b and
+            the side, L or R.
+Return Value: None
+Algorithm:
+        1. With no position set, answer "error no position".
+        2. Check the move as GameSession checks the Human's, with the
+            Round's canHumanPlay() and hasHumanPlay(), or their mirrors
+            for the Computer: a play must fit an end the mover may use,
+            and be the drawn tile after a draw; a draw needs no tile to
+            fit and a boneyard; a pass needs no tile to fit and either
+            a draw or an empty boneyard. Answer an error line for any
+            other move.
+        3. Pass the move to the round's applyPlay(), applyDraw() or
+            applyPass(), and track whether the player to move has
+            drawn.
+Reference: None
+********************************************************************* */
+void EngineProtocol::applyMove(std::string_view command, std::string_view arguments) {
+    // 1. Nothing dealt to move in
+    if (!m_hasPosition) {
+        reply("error no position\n");
+        return;
+    }
+
+    Round& round = m_game.getCurrentRound();
+    bool isHuman = round.isHumanTurn();
+    const Hand& hand = isHuman ? round.getHumanHand() : round.getComputerHand();
+    bool hasPlay = isHuman ? round.hasHumanPlay() : round.hasComputerPlay();
+
+    // 2. and 3. A draw, which leaves the turn with the mover
+    if (command == "draw") {
+        if (m_hasDrawn || hasPlay || round.getStock().isEmpty()) {
+            reply(m_hasDrawn ? "error already drawn\n" : hasPlay ? "error a tile fits\n" : "error boneyard empty\n");
+            return;
+        }
+
+        Tile drawn;
+        m_hasDrawn = round.applyDraw(isHuman, drawn);
+        return;
+    }
+
+    // A pass
+    if (command == "pass") {
+        if (hasPlay || (!m_hasDrawn && !round.getStock().isEmpty())) {
+            reply(hasPlay ? "error a tile fits\n" : "error draw first\n");
+            return;
+        }
+
+        m_hasDrawn = false;
+        round.applyPass(isHuman);
+        return;
+    }
+
+    // A play, "a-b L"
+    Tile tile;
+    if (arguments.size() < 3 || arguments[arguments.size() - 2] != ' '
+        || !Tile::fromString(arguments.substr(0, arguments.size() - 2), tile)
+        || (arguments.back() != 'L' && arguments.back() != 'R')) {
+        reply("error bad move\n");
+        return;
+    }
+
+    char side = arguments.back();
+    if (m_hasDrawn && !(hand.getTileAtIndex(hand.getSize() - 1) == tile)) {
+        reply("error play the drawn tile\n");
+        return;
+    }
+
+    bool isLegal = isHuman ? round.canHumanPlay(tile, side) : round.canComputerPlay(tile, side);
+    if (!isLegal || !round.applyPlay(isHuman, tile, side)) {
+        reply("error illegal move\n");
+        return;
+    }
+    m_hasDrawn = false;
+}
+
+/* *********************************************************************
+Function Name: startSearch
+Purpose: Hands the worker a search of the position.
+Parameters:
+        arguments, a std::string_view. Empty, or "movetime" and a
+            budget in milliseconds.
+Return Value: Boolean true if the search was started or refused with
+        an error line; false for a bad budget.
+Algorithm:
+        1. Parse the budget.
+        2. With no position set, answer "error no position" instead of
+            searching.
+        3. Load the current round into a Playout, clear the stop signal
+            and wake the worker with the job.
+Reference: None
+********************************************************************* */
+bool EngineProtocol::startSearch(std::string_view arguments) {
+    // 1. The budget
+    int milliseconds = 0;
+    if (arguments.substr(0, 9) == "movetime ") {
+        std::string_view budget = arguments.substr(9);
+        std::from_chars_result result = std::from_chars(budget.data(), budget.data() + budget.size(), milliseconds);
+        if (result.ec != std::errc() || result.ptr != budget.data() + budget.size() || milliseconds <= 0) {
+            return false;
+        }
+    }
+    else if (!arguments.empty()) {
+        return false;
+    }
+
+    // 2. Nothing dealt to search
+    if (!m_hasPosition) {
+        reply("error no position\n");
+        return true;
+    }
+
+    // 3. The job
+    {
+        std::lock_guard<std::mutex> lock(m_jobMutex);
+        m_job.loadRound(m_game.getCurrentRound());
+        m_jobHasDrawn = m_hasDrawn;
+        m_jobMilliseconds = milliseconds;
+        m_stop = false;
+        m_hasJob = true;
+    }
+    m_jobChanged.notify_all();
+    return true;
+}
+
+/* *********************************************************************
+Function Name: waitForSearch
+Purpose: Blocks until the worker has replied to the last search.
+Parameters: None
+Return Value: None
+Algorithm: Wait on the job condition until m_hasJob is false.
+Reference: None
+********************************************************************* */
+void EngineProtocol::waitForSearch() {
+    std::unique_lock<std::mutex> lock(m_jobMutex);
+    m_jobChanged.wait(lock, [this]() { return !m_hasJob; });
+}
+
+/* *********************************************************************
+Function Name: work
+Purpose: The worker thread: searches each job it is handed and
+        replies.
+Parameters: None
+Return Value: None
+Algorithm:
+        1. Wait for a job or for the session to end.
+        2. Apply the job's budget, if any, for this search alone, and
+            time the strategy's choice. With no tile to play, reply draw, or pass if the
+            player has drawn or the boneyard is empty.
+        3. Write the info and bestmove lines together and flush, then
+            clear the job and wake anyone waiting.
+Reference: None
+********************************************************************* */
+void EngineProtocol::work() {
+    while (true) {
+        // 1. The next job
+        std::unique_lock<std::mutex> lock(m_jobMutex);
+        m_jobChanged.wait(lock, [this]() { return m_hasJob || m_isQuitting; });
+        if (!m_hasJob) {
+            return;
+        }
+        lock.unlock();
+
+        // 2. The search
+        std::string text;
+        if (m_job.isOver()) {
+            text = "bestmove none\n";
+        }
+        else {
+            // A movetime holds for this search only; a plain "go" keeps the strategy's own budget
+            int budget = m_strategy->getMilliseconds();
+            if (m_jobMilliseconds > 0) {
+                m_strategy->setMilliseconds(m_jobMilliseconds);
+            }
+
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            int index = 0;
+            int arm = 0;
+            bool hasMove = m_strategy->chooseMove(m_job, index, arm);
+            long long elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start).count();
+
+            if (m_jobMilliseconds > 0 && budget > 0) {
+                m_strategy->setMilliseconds(budget);
+            }
+
+            text = "info time " + std::to_string(elapsed);
+            if (hasMove) {
+                // The reason on one line
+                text += " string ";
+                for (char c : m_strategy->getReason()) {
+                    if (c != '\n') {
+                        text += (c == '\t') ? ' ' : c;
+                    }
+                }
+
+                Tile tile = m_job.getHandTile(m_job.getMover(), index);
+                text += "\nbestmove " + std::to_string(tile.getLeftPips()) + "-" + std::to_string(tile.getRightPips())
+                    + ((arm == Playout::HUMAN) ? " L\n" : " R\n");
+            }
+            else {
+                text += (m_jobHasDrawn || m_job.getBoneyardSize() == 0) ? "\nbestmove pass\n" : "\nbestmove draw\n";
+            }
+        }
+
+        // 3. The reply, then the job is done
+        reply(text);
+
+        lock.lock();
+        m_hasJob = false;
+        lock.unlock();
+        m_jobChanged.notify_all();
+    }
+}
+
+/* *********************************************************************
+Function Name: reply
+Purpose: Writes lines to the controller and flushes them.
+Parameters:
+        text, a std::string_view ending in a newline.
+Return Value: None
+Algorithm: Lock the output, write the text and flush.
+Reference: None
+********************************************************************* */
+void EngineProtocol::reply(std::string_view text) {
+    std::lock_guard<std::mutex> lock(m_outputMutex);
+    m_out << text << std::flush;
+}
\ No newline at end of file
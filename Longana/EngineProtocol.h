@@ -0,0 +1,296 @@
+#ifndef ENGINEPROTOCOL_H
+#define ENGINEPROTOCOL_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <atomic>
+#include <condition_variable>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "ComputerStrategy.h"
+#include "Playout.h"
+#include "Tournament.h"
+
+/* *********************************************************************
+Class Name: EngineProtocol
+Purpose: Lets another program use a Longana engine through a line-based
+        text protocol on its input and output, in the spirit of UCI for
+        chess. The controller sends commands; the engine answers only
+        where noted:
+            longana                 answers "id name", "id author",
+                                    "option strategy" and "longanaok"
+            isready                 answers "readyok", even while
+                                    searching
+            setoption strategy <spec>
+                                    plays with a StrategyRegistry spec
+            position file <path>    a save file, text or binary
+            position snapshot <hex> a binary snapshot (see
+                                    Serializer::encodeBinary) as 128
+                                    hexadecimal digits
+            position save           the lines of a save file follow,
+                                    ended by a line "end"
+            play <a-b> <L|R>        the player to move plays a tile
+            draw                    the player to move draws the top of
+                                    the boneyard
+            pass                    the player to move passes
+                                    The moves follow the console's rules
+                                    and answer "error <reason>" if they
+                                    break them, leaving the position as
+                                    it was
+            go [movetime <ms>]      searches for the player to move;
+                                    answers "info time <ms>", with
+                                    "string <reason>" if a tile is
+                                    chosen, and then "bestmove <a-b>
+                                    <L|R>", "bestmove draw", "bestmove
+                                    pass" or "bestmove none" if the
+                                    round is over, or "error no
+                                    position" before any position
+            stop                    ends the search early
+            quit                    ends the session
+        The moves keep the position up to date between searches, so a
+        controller sends a whole position only once a round. Searches run
+        on a worker thread started once, which keeps reading commands
+        possible while it thinks and costs no thread per move; output is
+        flushed only after each reply.
+********************************************************************* */
+class EngineProtocol {
+public:
+
+    // The strategy played until the controller chooses one
+    static constexpr const char* DEFAULT_STRATEGY = "solver";
+
+    /* --- Constructor --- */
+
+    /* *********************************************************************
+    Function Name: EngineProtocol
+    Purpose: Constructor. Prepares a session on the given streams.
+    Parameters:
+            in, an istream passed by reference. The controller's commands.
+            out, an ostream passed by reference. The engine's replies.
+    Return Value: None
+    Algorithm:
+            1. Store the streams and make the default strategy, attaching
+                the stop signal to it.
+            2. Start the worker thread, which waits for a search.
+    Reference: None
+    ********************************************************************* */
+    EngineProtocol(std::istream& in, std::ostream& out);
+
+    /* --- Destructor --- */
+
+    /* *********************************************************************
+    Function Name: ~EngineProtocol
+    Purpose: Destructor. Ends any search and the worker thread.
+    Parameters: None
+    Return Value: None
+    Algorithm: Set the stop signal and the quitting flag, wake the worker
+            and join it.
+    Reference: None
+    ********************************************************************* */
+    ~EngineProtocol();
+
+    /* --- Mutators --- */
+
+    /* *********************************************************************
+    Function Name: setStrategy
+    Purpose: Chooses the strategy searches play with, as "setoption
+            strategy" does.
+    Parameters:
+            spec, a string. A StrategyRegistry spec.
+    Return Value: Boolean true if the spec named a strategy; otherwise the
+            strategy is unchanged and the registry has reported why.
+    Algorithm: Make the strategy, attach the stop signal and keep it with
+            its spec.
+    Reference: None
+    ********************************************************************* */
+    bool setStrategy(const std::string& spec);
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: run
+    Purpose: Answers commands until "quit" or the end of the input.
+    Parameters: None
+    Return Value: 0, for the process exit code.
+    Algorithm: Read each line and pass it to handleCommand() until it
+            returns false or the input ends; then wait for any search
+            to reply.
+    Reference: None
+    ********************************************************************* */
+    int run();
+
+private:
+
+    std::istream& m_in;
+    std::ostream& m_out;
+
+    // Guards m_out, written by both threads
+    std::mutex m_outputMutex;
+
+    // The position, kept as a game so save files load as they do for play
+    Tournament m_game;
+    std::string m_buffer;
+
+    // Whether a position has been read and its engine placed
+    bool m_hasPosition;
+
+    // Whether the player to move has drawn this turn
+    bool m_hasDrawn;
+
+    std::unique_ptr<ComputerStrategy> m_strategy;
+    std::string m_strategyName;
+
+    // Set by "stop" and read by the strategy while it searches
+    std::atomic<bool> m_stop;
+
+    // The search handed to the worker; m_hasJob is cleared once it replies
+    std::mutex m_jobMutex;
+    std::condition_variable m_jobChanged;
+    Playout m_job;
+    bool m_jobHasDrawn;
+    int m_jobMilliseconds;
+    bool m_hasJob;
+    bool m_isQuitting;
+
+    std::thread m_worker;
+
+    /* *********************************************************************
+    Function Name: handleCommand
+    Purpose: Carries out one command.
+    Parameters:
+            line, a std::string_view. The command and its arguments.
+    Return Value: Boolean false for "quit"; true otherwise.
+    Algorithm:
+            1. Split off the first word.
+            2. Answer "longana", "isready" and "stop" at once; wait for
+                any search to reply before every other command.
+            3. Report an unknown command or a bad argument on std::cerr
+                and carry on.
+    Reference: None
+    ********************************************************************* */
+    bool handleCommand(std::string_view line);
+
+    /* *********************************************************************
+    Function Name: setPosition
+    Purpose: Replaces the position with one from a file, a snapshot or
+            the save-file lines that follow.
+    Parameters:
+            arguments, a std::string_view. The words after "position".
+    Return Value: Boolean true if the position was read and dealt.
+    Algorithm:
+            1. Clear the drawn flag and read the position with
+                readPosition().
+            2. Place the engine if the save was made before it was played,
+                as a round resumed on the console does; a position with no
+                engine to place is rejected.
+    Reference: None
+    ********************************************************************* */
+    bool setPosition(std::string_view arguments);
+
+    /* *********************************************************************
+    Function Name: readPosition
+    Purpose: Reads a position from a file, a snapshot or the save-file
+            lines that follow.
+    Parameters:
+            arguments, a std::string_view. The words after "position".
+    Return Value: Boolean true if the position was read.
+    Algorithm: Load the file with Serializer::loadGame, decode the
+            hexadecimal snapshot with Serializer::decodeBinary, or collect
+            lines up to "end" and parse them with a SaveParser.
+    Reference: None
+    ********************************************************************* */
+    bool readPosition(std::string_view arguments);
+
+    /* *********************************************************************
+    Function Name: applyMove
+    Purpose: Plays a tile, a draw or a pass for the player to move.
+    Parameters:
+            command, a std::string_view: "play", "draw" or "pass".
+            arguments, a std::string_view. For "play", the tile as a-b and
+                the side, L or R.
+    Return Value: None
+    Algorithm:
+            1. With no position set, answer "error no position".
+            2. Check the move as GameSession checks the Human's, with the
+                Round's canHumanPlay() and hasHumanPlay(), or their mirrors
+                for the Computer: a play must fit an end the mover may use,
+                and be the drawn tile after a draw; a draw needs no tile to
+                fit and a boneyard; a pass needs no tile to fit and either
+                a draw or an empty boneyard. Answer an error line for any
+                other move.
+            3. Pass the move to the round's applyPlay(), applyDraw() or
+                applyPass(), and track whether the player to move has
+                drawn.
+    Reference: None
+    ********************************************************************* */
+    void applyMove(std::string_view command, std::string_view arguments);
+
+    /* *********************************************************************
+    Function Name: startSearch
+    Purpose: Hands the worker a search of the position.
+    Parameters:
+            arguments, a std::string_view. Empty, or "movetime" and a
+                budget in milliseconds.
+    Return Value: Boolean true if the search was started or refused with
+            an error line; false for a bad budget.
+    Algorithm:
+            1. Parse the budget.
+            2. With no position set, answer "error no position" instead of
+                searching.
+            3. Load the current round into a Playout, clear the stop signal
+                and wake the worker with the job.
+    Reference: None
+    ********************************************************************* */
+    bool startSearch(std::string_view arguments);
+
+    /* *********************************************************************
+    Function Name: waitForSearch
+    Purpose: Blocks until the worker has replied to the last search.
+    Parameters: None
+    Return Value: None
+    Algorithm: Wait on the job condition until m_hasJob is false.
+    Reference: None
+    ********************************************************************* */
+    void waitForSearch();
+
+    /* *********************************************************************
+    Function Name: work
+    Purpose: The worker thread: searches each job it is handed and
+            replies.
+    Parameters: None
+    Return Value: None
+    Algorithm:
+            1. Wait for a job or for the session to end.
+            2. Apply the job's budget, if any, for this search alone, and
+                time the strategy's choice. With no tile to play, reply draw, or pass if the
+                player has drawn or the boneyard is empty.
+            3. Write the info and bestmove lines together and flush, then
+                clear the job and wake anyone waiting.
+    Reference: None
+    ********************************************************************* */
+    void work();
+
+    /* *********************************************************************
+    Function Name: reply
+    Purpose: Writes lines to the controller and flushes them.
+    Parameters:
+            text, a std::string_view ending in a newline.
+    Return Value: None
+    Algorithm: Lock the output, write the text and flush.
+    Reference: None
+    ********************************************************************* */
+    void reply(std::string_view text);
+};
+
+#endif
\ No newline at end of file
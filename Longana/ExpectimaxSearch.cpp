@@ -0,0 +1,427 @@
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+
+#include "EndgameTablebase.h"
+#include "ExpectimaxSearch.h"
+#include "LinearEvaluator.h"
+#include "PipSymmetry.h"
+#include "Playout.h"
+
+/* *********************************************************************
+Function Name: ExpectimaxSearch
+Purpose: Default constructor. No search has been run.
+Parameters: None
+Return Value: None
+Algorithm: Zero every member and allocate the transposition table.
+Reference: None
+********************************************************************* */
+ExpectimaxSearch::ExpectimaxSearch()
+    : m_position(), m_stack(), m_player(0), m_deadline(), m_isTimeUp(false), m_stopSignal(nullptr), m_isCutoff(false), m_nodeCount(0),
+    m_tablebase(nullptr), m_tablebaseHits(0), m_evaluator(nullptr), m_table(TABLE_SIZE), m_tableHits(0), m_bestIndex(0), m_bestArm(0), m_value(0.0), m_isExact(false), m_depth(0)
+{
+}
+
+/* *********************************************************************
+Function Name: search
+Purpose: Chooses the mover's move in a position.
+Parameters:
+        position, a two-player Playout passed by const reference. If
+            the mover has just drawn, only the drawn tile can fit, so
+            the search chooses where to play it.
+        milliseconds, an integer time budget.
+Return Value: Boolean true if the mover has a tile to play; false if
+        they must draw or pass, and nothing was searched.
+Algorithm:
+        1. List the mover's moves; stop if there are none. Empty the
+            transposition table.
+        2. For depths 1, 2, 4 and so on, search every move and keep
+            the best of each iteration that finishes in time. Doubling
+            the depth keeps the repeated shallow work to a fraction of
+            the last iteration.
+        3. Stop once an iteration reaches the end of every line, the
+            time is up or the stop signal set, or MAX_DEPTH is reached.
+Reference: None
+********************************************************************* */
+bool ExpectimaxSearch::search(const Playout& position, int milliseconds) {
+    m_position = position;
+    m_stack.clear();
+    m_player = position.getMover();
+    m_deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(milliseconds);
+    m_isTimeUp = false;
+    m_nodeCount = 0;
+    m_tablebaseHits = 0;
+    m_value = 0.0;
+    m_isExact = false;
+    m_depth = 0;
+
+    // 1. Nothing to choose
+    int indices[Playout::MAX_MOVES];
+    int arms[Playout::MAX_MOVES];
+    int count = position.isOver() ? 0 : listOrderedMoves(indices, arms);
+    if (count == 0) {
+        return false;
+    }
+
+    std::fill(m_table.begin(), m_table.end(), TableEntry());
+    m_tableHits = 0;
+
+    int order[Playout::MAX_MOVES];
+    double values[Playout::MAX_MOVES];
+    for (int i = 0; i < count; ++i) {
+        order[i] = i;
+    }
+    m_bestIndex = indices[0];
+    m_bestArm = arms[0];
+
+    // 2. Deepen, doubling the depth each time
+    for (int depth = 1; depth <= MAX_DEPTH; depth *= 2) {
+        m_isCutoff = false;
+        double alpha = -MAX_VALUE;
+        int best = order[0];
+
+        for (int i = 0; i < count && !m_isTimeUp; ++i) {
+            int move = order[i];
+
+            m_position.makePlay(indices[move], arms[move], m_stack);
+            values[move] = searchTurn(depth - 1, alpha, MAX_VALUE, false, false);
+            m_position.unmake(m_stack);
+
+            if (i == 0 || values[move] > alpha) {
+                alpha = values[move];
+                best = move;
+            }
+        }
+
+        // An unfinished iteration is discarded
+        if (m_isTimeUp) {
+            break;
+        }
+
+        m_bestIndex = indices[best];
+        m_bestArm = arms[best];
+        m_value = alpha;
+        m_depth = depth;
+        m_isExact = !m_isCutoff;
+
+        // 3. Solved
+        if (m_isExact) {
+            break;
+        }
+
+        // The next iteration tries this one's best move first
+        std::stable_sort(order, order + count, [&values](int first, int second) { return values[first] > values[second]; });
+    }
+
+    return true;
+}
+
+/* *********************************************************************
+Function Name: searchTurn
+Purpose: Finds the value of the position for the mover's turn.
+Parameters:
+        depth, an integer number of turns left to search.
+        alpha, beta, doubles. The search window.
+        hasDrawn, a boolean. True if the mover has drawn this turn.
+        isProbe, a boolean. True to search only the first move, which
+            bounds the value from the mover's side.
+Return Value: The value, fail-soft: at most alpha if the position is
+        worth no more than alpha, at least beta if it is worth at least
+        beta.
+Algorithm:
+        1. A finished round is worth its points, and a position in the
+            tablebase its stored value; at depth 0, estimate.
+        2. If the mover has moves, use the transposition table's entry
+            if it was searched as deep and settles the window. Otherwise
+            take the best move for the mover with alpha-beta pruning, and
+            store the value with the bound it gives and whether any line
+            was cut off.
+        3. Otherwise search the draw as a chance node, or the pass.
+Reference: Knuth, D. E. and Moore, R. W. (1975), "An analysis of
+        alpha-beta pruning"
+********************************************************************* */
+double ExpectimaxSearch::searchTurn(int depth, double alpha, double beta, bool hasDrawn, bool isProbe) {
+    // The clock and the stop signal are read once every 1024 positions
+    if ((++m_nodeCount & 1023) == 0 && (std::chrono::steady_clock::now() >= m_deadline
+        || (m_stopSignal != nullptr && m_stopSignal->load(std::memory_order_relaxed)))) {
+        m_isTimeUp = true;
+    }
+    if (m_isTimeUp) {
+        return 0.0;
+    }
+
+    // 1. Leaves
+    if (m_position.isOver()) {
+        return evaluate();
+    }
+
+    // The table holds the mover's value
+    int stored = 0;
+    if (m_tablebase != nullptr && m_tablebase->probe(m_position, stored)) {
+        ++m_tablebaseHits;
+        return (m_position.getMover() == m_player) ? stored : -stored;
+    }
+
+    if (depth == 0) {
+        m_isCutoff = true;
+        return evaluate();
+    }
+
+    int indices[Playout::MAX_MOVES];
+    int arms[Playout::MAX_MOVES];
+    int count = listOrderedMoves(indices, arms);
+
+    // 3. No tile to play
+    if (count == 0) {
+        if (!hasDrawn && m_position.getBoneyardSize() > 0) {
+            return searchChance(depth, alpha, beta);
+        }
+
+        m_position.makePass(m_stack);
+        double value = searchTurn(depth - 1, alpha, beta, false, false);
+        m_position.unmake(m_stack);
+        return value;
+    }
+
+    // 2. The mover's choice
+    bool isMax = (m_position.getMover() == m_player);
+    double best = isMax ? -MAX_VALUE : MAX_VALUE;
+
+    if (isProbe) {
+        count = 1;
+    }
+
+    // A decision met before; a probe is only a bound, so it neither reads nor stores
+    bool isStored = !isProbe && depth >= TABLE_MIN_DEPTH;
+    uint64_t key = 0;
+
+    if (isStored) {
+        key = PipSymmetry::getKey(m_position);
+        const TableEntry& entry = m_table[key & (TABLE_SIZE - 1)];
+
+        if (entry.depth > 0 && entry.key == key && (entry.isSolved || entry.depth >= depth)
+            && (entry.bound == BOUND_EXACT || (entry.bound == BOUND_LOWER && entry.value >= beta)
+                || (entry.bound == BOUND_UPPER && entry.value <= alpha))) {
+            ++m_tableHits;
+            m_isCutoff = m_isCutoff || !entry.isSolved;
+            return entry.value;
+        }
+    }
+
+    // Cutoffs are tracked below this decision alone, so the entry knows whether it is solved
+    double originalAlpha = alpha;
+    double originalBeta = beta;
+    bool wasCutoff = m_isCutoff;
+    m_isCutoff = false;
+
+    for (int i = 0; i < count; ++i) {
+        m_position.makePlay(indices[i], arms[i], m_stack);
+        double value = searchTurn(depth - 1, alpha, beta, false, false);
+        m_position.unmake(m_stack);
+
+        if (m_isTimeUp) {
+            return 0.0;
+        }
+
+        if (isMax) {
+            best = std::max(best, value);
+            alpha = std::max(alpha, value);
+        }
+        else {
+            best = std::min(best, value);
+            beta = std::min(beta, value);
+        }
+
+        if (alpha >= beta) {
+            break;
+        }
+    }
+
+    if (isStored) {
+        TableEntry& entry = m_table[key & (TABLE_SIZE - 1)];
+        entry.key = key;
+        entry.value = best;
+        entry.depth = static_cast<signed char>(depth);
+        entry.bound = (best <= originalAlpha) ? BOUND_UPPER : (best >= originalBeta) ? BOUND_LOWER : BOUND_EXACT;
+        entry.isSolved = !m_isCutoff;
+    }
+    m_isCutoff = m_isCutoff || wasCutoff;
+
+    return best;
+}
+
+/* *********************************************************************
+Function Name: searchChance
+Purpose: Finds the value of a draw: the average over the boneyard tiles
+        of the position after drawing each one.
+Parameters:
+        depth, alpha, beta. As for searchTurn().
+Return Value: The value, fail-soft as for searchTurn().
+Algorithm:
+        1. Start every outcome's bounds at -MAX_VALUE and MAX_VALUE.
+        2. Probe each outcome with its first move (Star2); a probe of
+            a maximizing mover raises the outcome's lower bound, one of
+            a minimizing mover lowers its upper bound.
+        3. Search the outcomes not yet known in the order their probes
+            rank them, each with the window that could still move the
+            average inside alpha and beta (Star1).
+        4. After every update, stop if the bounds on the average are
+            at least beta or at most alpha.
+Reference: Ballard, B. W. (1983), "The *-minimax search procedure for
+        trees containing chance nodes"
+********************************************************************* */
+double ExpectimaxSearch::searchChance(int depth, double alpha, double beta) {
+    int count = m_position.getBoneyardSize();
+    bool isMax = (m_position.getMover() == m_player);
+
+    // The window and bounds are kept as sums, so each outcome weighs 1 / count
+    double sumAlpha = alpha * count;
+    double sumBeta = beta * count;
+
+    // 1. Nothing is known yet
+    double lower[StandardSet::TILE_COUNT];
+    double upper[StandardSet::TILE_COUNT];
+    double sumLower = -MAX_VALUE * count;
+    double sumUpper = MAX_VALUE * count;
+
+    for (int i = 0; i < count; ++i) {
+        lower[i] = -MAX_VALUE;
+        upper[i] = MAX_VALUE;
+    }
+
+    // 2-3. One probing pass, then one full pass
+    int order[StandardSet::TILE_COUNT];
+    for (int i = 0; i < count; ++i) {
+        order[i] = i;
+    }
+
+    for (int pass = 0; pass < 2; ++pass) {
+        for (int i = 0; i < count; ++i) {
+            int outcome = order[i];
+            if (lower[outcome] == upper[outcome]) {
+                continue;
+            }
+
+            // The window in which this outcome can still decide the average
+            double childAlpha = sumAlpha - (sumUpper - upper[outcome]);
+            double childBeta = sumBeta - (sumLower - lower[outcome]);
+
+            m_position.makeDraw(m_stack, outcome);
+
+            // The drawn tile is the only one that can fit, so a probe of a forced reply is a full search
+            int indices[Playout::MAX_MOVES];
+            int arms[Playout::MAX_MOVES];
+            bool isProbe = (pass == 0) && m_position.listMoves(indices, arms) > 1;
+            double value = searchTurn(depth, childAlpha, childBeta, true, isProbe);
+
+            m_position.unmake(m_stack);
+            if (m_isTimeUp) {
+                return 0.0;
+            }
+
+            // A probe bounds the outcome from the mover's side only
+            if (isProbe) {
+                if (isMax && value > childAlpha) {
+                    lower[outcome] = std::max(lower[outcome], value);
+                }
+                else if (!isMax && value < childBeta) {
+                    upper[outcome] = std::min(upper[outcome], value);
+                }
+            }
+            else if (value <= childAlpha) {
+                upper[outcome] = std::min(upper[outcome], value);
+            }
+            else if (value >= childBeta) {
+                lower[outcome] = std::max(lower[outcome], value);
+            }
+            else {
+                lower[outcome] = value;
+                upper[outcome] = value;
+            }
+
+            // 4. Recompute the sums and stop once the average is outside the window
+            sumLower = 0.0;
+            sumUpper = 0.0;
+            for (int j = 0; j < count; ++j) {
+                sumLower += lower[j];
+                sumUpper += upper[j];
+            }
+            if (sumLower >= sumBeta) {
+                return sumLower / count;
+            }
+            if (sumUpper <= sumAlpha) {
+                return sumUpper / count;
+            }
+        }
+
+        // Search the outcomes the probes rate best for the mover first
+        if (isMax) {
+            std::stable_sort(order, order + count, [&lower](int first, int second) { return lower[first] > lower[second]; });
+        }
+        else {
+            std::stable_sort(order, order + count, [&upper](int first, int second) { return upper[first] < upper[second]; });
+        }
+    }
+
+    return sumLower / count;
+}
+
+/* *********************************************************************
+Function Name: evaluate
+Purpose: Scores the position for the searching player.
+Parameters: None
+Return Value: Their points minus the opponent's if the round is over;
+        otherwise the evaluator's score turned to their side, or the
+        opponent's pips in hand minus their own without one.
+Algorithm: Read the points, ask the evaluator or total the hands.
+Reference: None
+********************************************************************* */
+double ExpectimaxSearch::evaluate() const {
+    int opponent = 1 - m_player;
+
+    if (m_position.isOver()) {
+        return m_position.getPoints(m_player) - m_position.getPoints(opponent);
+    }
+    if (m_evaluator != nullptr) {
+        double value = m_evaluator->evaluate(m_position);
+        return (m_position.getMover() == m_player) ? value : -value;
+    }
+    return m_position.getHandPips(opponent) - m_position.getHandPips(m_player);
+}
+
+/* *********************************************************************
+Function Name: listOrderedMoves
+Purpose: Lists the mover's moves, heaviest tile first.
+Parameters:
+        outIndices, outArms. As for Playout::listMoves().
+Return Value: The number of moves.
+Algorithm: List the moves, then insertion sort them by pips,
+        keeping hand order among equal tiles.
+Reference: None
+********************************************************************* */
+int ExpectimaxSearch::listOrderedMoves(int* outIndices, int* outArms) const {
+    int count = m_position.listMoves(outIndices, outArms);
+    int mover = m_position.getMover();
+    int pips[Playout::MAX_MOVES];
+
+    for (int i = 0; i < count; ++i) {
+        unsigned char packed = m_position.getHandPacked(mover, outIndices[i]);
+        pips[i] = (packed >> 4) + (packed & 0x0F);
+
+        // Slide the move back past every lighter tile
+        for (int j = i; j > 0 && pips[j - 1] < pips[j]; --j) {
+            std::swap(pips[j - 1], pips[j]);
+            std::swap(outIndices[j - 1], outIndices[j]);
+            std::swap(outArms[j - 1], outArms[j]);
+        }
+    }
+
+    return count;
+}
\ No newline at end of file
@@ -0,0 +1,358 @@
+#ifndef EXPECTIMAXSEARCH_H
+#define EXPECTIMAXSEARCH_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "DominoSet.h"
+#include "Playout.h"
+
+class EndgameTablebase;
+class LinearEvaluator;
+
+/* *********************************************************************
+Class Name: ExpectimaxSearch
+Purpose: Chooses a move for the player whose turn it is in a two-player
+        double-six round by searching the rest of the round. Both hands
+        are known, as they are on screen; only the order of the boneyard
+        is hidden, so a draw is a chance node whose outcomes are the
+        boneyard tiles, each equally likely. At the other nodes the
+        searching player maximizes, and the opponent minimizes, the
+        searching player's points minus the opponent's.
+
+        Chance nodes are pruned with the Star1 and Star2 bounds of Ballard:
+        every value lies between -MAX_VALUE and MAX_VALUE, so once some
+        outcomes are known the average is bounded, and the search of an
+        outcome can stop as soon as it cannot move the average back inside
+        the alpha-beta window. Star2 first probes each outcome with only
+        its first move, which bounds the outcome from one side, then
+        searches the outcomes fully in the order the probes rank them.
+
+        Positions covered by an endgame tablebase, if one is attached, are
+        looked up instead of searched, and count as solved. Decisions
+        searched before, by another order of moves or as a renaming of the
+        pips that keeps every value (see PipSymmetry), are found in a
+        transposition table.
+
+        The search deepens, doubling the depth, until the time budget runs
+        out or an iteration reaches the end of every line, in which case
+        the value is exact. Moves are ordered by the previous iteration at
+        the root and heaviest tile first below it. Positions are explored
+        in place with Playout's make and unmake functions. Lines cut off
+        by depth are scored by the pips left in the hands, or by a learned
+        LinearEvaluator if one is attached.
+********************************************************************* */
+class ExpectimaxSearch {
+public:
+
+    // The deepest search tried, in turns
+    static const int MAX_DEPTH = 64;
+
+    // No round moves more points than the pips of the whole set
+    static constexpr double MAX_VALUE = StandardSet::TILE_COUNT * StandardSet::MAX_PIPS;
+
+    // Entries in the transposition table, a power of two
+    static const int TABLE_SIZE = 1 << 18;
+
+    // Turns a decision must have left to be worth a table lookup
+    static const int TABLE_MIN_DEPTH = 2;
+
+    /* --- Constructor --- */
+
+    /* *********************************************************************
+    Function Name: ExpectimaxSearch
+    Purpose: Default constructor. No search has been run.
+    Parameters: None
+    Return Value: None
+    Algorithm: Zero every member and allocate the transposition table.
+    Reference: None
+    ********************************************************************* */
+    ExpectimaxSearch();
+
+    /* --- Destructor --- */
+
+    /* *********************************************************************
+    Function Name: ~ExpectimaxSearch
+    Purpose: Destructor. The table releases its own storage.
+    Parameters: None
+    Return Value: None
+    Algorithm: Standard object destruction.
+    Reference: None
+    ********************************************************************* */
+    ~ExpectimaxSearch() = default;
+
+    /* --- Selectors --- */
+
+    /* *********************************************************************
+    Function Name: getBestIndex / getBestArm
+    Purpose: Retrieve the move chosen by the last search.
+    Parameters: None
+    Return Value: The tile's position in the mover's hand. / The player
+            number of the arm to play it on.
+    Algorithm: Return the stored move.
+    Reference: None
+    ********************************************************************* */
+    inline int getBestIndex() const { return m_bestIndex; }
+    inline int getBestArm() const { return m_bestArm; }
+
+    /* *********************************************************************
+    Function Name: getValue
+    Purpose: Retrieves the value of the chosen move.
+    Parameters: None
+    Return Value: The expected points of the mover minus the opponent's,
+            exact if isExact() is true and estimated from the pips left
+            in the hands otherwise.
+    Algorithm: Return the stored value.
+    Reference: None
+    ********************************************************************* */
+    inline double getValue() const { return m_value; }
+
+    /* *********************************************************************
+    Function Name: isExact
+    Purpose: Checks whether the last search solved the round.
+    Parameters: None
+    Return Value: Boolean true if every line was searched to the end.
+    Algorithm: Return the stored flag.
+    Reference: None
+    ********************************************************************* */
+    inline bool isExact() const { return m_isExact; }
+
+    /* *********************************************************************
+    Function Name: getDepth / getNodeCount
+    Purpose: Retrieve the depth of the last completed iteration, in turns,
+            and the number of positions visited.
+    Parameters: None
+    Return Value: An integer depth. / A count of positions.
+    Algorithm: Return the stored counts.
+    Reference: None
+    ********************************************************************* */
+    inline int getDepth() const { return m_depth; }
+    inline long long getNodeCount() const { return m_nodeCount; }
+
+    /* *********************************************************************
+    Function Name: getTablebaseHits
+    Purpose: Retrieves how many of the positions visited were found in the
+            tablebase.
+    Parameters: None
+    Return Value: A count of positions.
+    Algorithm: Return the stored count.
+    Reference: None
+    ********************************************************************* */
+    inline long long getTablebaseHits() const { return m_tablebaseHits; }
+
+    /* *********************************************************************
+    Function Name: getTableHits
+    Purpose: Retrieves how many decisions were answered by the
+            transposition table.
+    Parameters: None
+    Return Value: A count of positions.
+    Algorithm: Return the stored count.
+    Reference: None
+    ********************************************************************* */
+    inline long long getTableHits() const { return m_tableHits; }
+
+    /* --- Mutators --- */
+
+    /* *********************************************************************
+    Function Name: setTablebase
+    Purpose: Attaches an endgame tablebase to look positions up in.
+    Parameters:
+            tablebase, a pointer to an open EndgameTablebase, or nullptr
+                to search every position. The search does not take
+                ownership.
+    Return Value: None
+    Algorithm: Assigns the tablebase parameter to the m_tablebase member
+            variable.
+    Reference: None
+    ********************************************************************* */
+    inline void setTablebase(const EndgameTablebase* tablebase) { m_tablebase = tablebase; }
+
+    /* *********************************************************************
+    Function Name: setEvaluator
+    Purpose: Attaches a learned evaluator to score the positions where the
+            search stops.
+    Parameters:
+            evaluator, a pointer to a trained LinearEvaluator, or nullptr
+                to count the pips in the hands. The search does not take
+                ownership.
+    Return Value: None
+    Algorithm: Assigns the evaluator parameter to the m_evaluator member
+            variable.
+    Reference: None
+    ********************************************************************* */
+    inline void setEvaluator(const LinearEvaluator* evaluator) { m_evaluator = evaluator; }
+
+    /* *********************************************************************
+    Function Name: setStopSignal
+    Purpose: Attaches a flag that ends the search early, as running out of
+            time does, when another thread sets it.
+    Parameters:
+            stop, a pointer to a std::atomic<bool>, or nullptr to search
+                for the whole budget. The search does not take ownership.
+    Return Value: None
+    Algorithm: Assigns the stop parameter to the m_stopSignal member
+            variable.
+    Reference: None
+    ********************************************************************* */
+    inline void setStopSignal(const std::atomic<bool>* stop) { m_stopSignal = stop; }
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: search
+    Purpose: Chooses the mover's move in a position.
+    Parameters:
+            position, a two-player Playout passed by const reference. If
+                the mover has just drawn, only the drawn tile can fit, so
+                the search chooses where to play it.
+            milliseconds, an integer time budget.
+    Return Value: Boolean true if the mover has a tile to play; false if
+            they must draw or pass, and nothing was searched.
+    Algorithm:
+            1. List the mover's moves; stop if there are none. Empty the
+                transposition table.
+            2. For depths 1, 2, 4 and so on, search every move and keep
+                the best of each iteration that finishes in time. Doubling
+                the depth keeps the repeated shallow work to a fraction of
+                the last iteration.
+            3. Stop once an iteration reaches the end of every line, the
+                time is up or the stop signal set, or MAX_DEPTH is reached.
+    Reference: None
+    ********************************************************************* */
+    bool search(const Playout& position, int milliseconds);
+
+private:
+
+    // How a stored value bounds the position's value
+    static const int BOUND_EXACT = 0;
+    static const int BOUND_LOWER = 1;
+    static const int BOUND_UPPER = 2;
+
+    // A decision already searched; depth 0 marks an empty entry
+    struct TableEntry {
+        uint64_t key;
+        double value;
+        signed char depth;
+        unsigned char bound;
+        bool isSolved;      // no line below it was cut off by depth
+    };
+
+    // The position searched, explored in place
+    Playout m_position;
+    Playout::UndoStack m_stack;
+
+    // The player the values are for
+    int m_player;
+
+    std::chrono::steady_clock::time_point m_deadline;
+    bool m_isTimeUp;
+
+    // Ends the search early when set (not owned)
+    const std::atomic<bool>* m_stopSignal;
+
+    // Whether the current iteration stopped any line before the end of the round
+    bool m_isCutoff;
+
+    long long m_nodeCount;
+
+    // Optional table of solved endgames (not owned)
+    const EndgameTablebase* m_tablebase;
+    long long m_tablebaseHits;
+
+    // Optional learned evaluation of unfinished positions (not owned)
+    const LinearEvaluator* m_evaluator;
+
+    // Decisions searched, indexed by the low bits of PipSymmetry::getKey()
+    std::vector<TableEntry> m_table;
+    long long m_tableHits;
+
+    // The result of the last completed iteration
+    int m_bestIndex;
+    int m_bestArm;
+    double m_value;
+    bool m_isExact;
+    int m_depth;
+
+    /* *********************************************************************
+    Function Name: searchTurn
+    Purpose: Finds the value of the position for the mover's turn.
+    Parameters:
+            depth, an integer number of turns left to search.
+            alpha, beta, doubles. The search window.
+            hasDrawn, a boolean. True if the mover has drawn this turn.
+            isProbe, a boolean. True to search only the first move, which
+                bounds the value from the mover's side.
+    Return Value: The value, fail-soft: at most alpha if the position is
+            worth no more than alpha, at least beta if it is worth at least
+            beta.
+    Algorithm:
+            1. A finished round is worth its points, and a position in the
+                tablebase its stored value; at depth 0, estimate.
+            2. If the mover has moves, use the transposition table's entry
+                if it was searched as deep and settles the window. Otherwise
+                take the best move for the mover with alpha-beta pruning, and
+                store the value with the bound it gives and whether any line
+                was cut off.
+            3. Otherwise search the draw as a chance node, or the pass.
+    Reference: Knuth, D. E. and Moore, R. W. (1975), "An analysis of
+            alpha-beta pruning"
+    ********************************************************************* */
+    double searchTurn(int depth, double alpha, double beta, bool hasDrawn, bool isProbe);
+
+    /* *********************************************************************
+    Function Name: searchChance
+    Purpose: Finds the value of a draw: the average over the boneyard tiles
+            of the position after drawing each one.
+    Parameters:
+            depth, alpha, beta. As for searchTurn().
+    Return Value: The value, fail-soft as for searchTurn().
+    Algorithm:
+            1. Start every outcome's bounds at -MAX_VALUE and MAX_VALUE.
+            2. Probe each outcome with its first move (Star2); a probe of
+                a maximizing mover raises the outcome's lower bound, one of
+                a minimizing mover lowers its upper bound.
+            3. Search the outcomes not yet known in the order their probes
+                rank them, each with the window that could still move the
+                average inside alpha and beta (Star1).
+            4. After every update, stop if the bounds on the average are
+                at least beta or at most alpha.
+    Reference: Ballard, B. W. (1983), "The *-minimax search procedure for
+            trees containing chance nodes"
+    ********************************************************************* */
+    double searchChance(int depth, double alpha, double beta);
+
+    /* *********************************************************************
+    Function Name: evaluate
+    Purpose: Scores the position for the searching player.
+    Parameters: None
+    Return Value: Their points minus the opponent's if the round is over;
+            otherwise the evaluator's score turned to their side, or the
+            opponent's pips in hand minus their own without one.
+    Algorithm: Read the points, ask the evaluator or total the hands.
+    Reference: None
+    ********************************************************************* */
+    double evaluate() const;
+
+    /* *********************************************************************
+    Function Name: listOrderedMoves
+    Purpose: Lists the mover's moves, heaviest tile first.
+    Parameters:
+            outIndices, outArms. As for Playout::listMoves().
+    Return Value: The number of moves.
+    Algorithm: List the moves, then insertion sort them by pips,
+            keeping hand order among equal tiles.
+    Reference: None
+    ********************************************************************* */
+    int listOrderedMoves(int* outIndices, int* outArms) const;
+};
+
+#endif
\ No newline at end of file
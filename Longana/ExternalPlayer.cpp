@@ -0,0 +1,369 @@
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <charconv>
+#include <chrono>
+#include <string>
+#include <string_view>
+
+#include "ExternalPlayer.h"
+#include "Round.h"
+#include "Serializer.h"
+
+/* *********************************************************************
+Function Name: ExternalPlayer
+Purpose: Default constructor. No program is running.
+Parameters: None
+Return Value: None
+Algorithm: Sit in the Computer's seat with no opponent, no budget
+        and no faults.
+Reference: None
+********************************************************************* */
+ExternalPlayer::ExternalPlayer()
+    : m_process(), m_command(), m_name(), m_isHumanSeat(false), m_opponent(nullptr), m_milliseconds(0),
+    m_requestCount(0), m_faultCount(0), m_position()
+{
+}
+
+/* *********************************************************************
+Function Name: ~ExternalPlayer
+Purpose: Destructor. Asks the program to quit, then ends it.
+Parameters: None
+Return Value: None
+Algorithm: Send "quit" if it is running; the process is stopped by
+        its own destructor.
+Reference: None
+********************************************************************* */
+ExternalPlayer::~ExternalPlayer() {
+    if (m_process.isRunning()) {
+        m_process.write("quit\n");
+    }
+}
+
+/* *********************************************************************
+Function Name: start
+Purpose: Starts the program and waits until it is ready.
+Parameters:
+        command, a string. The command line to run.
+Return Value: Boolean true if it started and answered "readyok".
+Algorithm:
+        1. Start the process and keep the command for restarts.
+        2. Send "longana" and "isready" together, keep the "id name"
+            from the replies and wait for "readyok".
+Reference: None
+********************************************************************* */
+bool ExternalPlayer::start(const std::string& command) {
+    m_command = command;
+    m_name = command;
+    return m_process.start(command) && handshake();
+}
+
+/* *********************************************************************
+Function Name: handshake
+Purpose: Greets a newly started program and waits until it is ready.
+Parameters: None
+Return Value: Boolean true if it answered "readyok" in time.
+Algorithm: As step 2 of start().
+Reference: None
+********************************************************************* */
+bool ExternalPlayer::handshake() {
+    if (!m_process.write("longana\nisready\n")) {
+        return false;
+    }
+
+    std::chrono::steady_clock::time_point deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(START_MILLISECONDS);
+    std::string line;
+    while (true) {
+        long long left = std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now()).count();
+        if (left < 0 || !m_process.readLine(line, static_cast<int>(left))) {
+            return false;
+        }
+
+        if (line.compare(0, 8, "id name ") == 0) {
+            m_name = line.substr(8);
+        }
+        else if (line == "readyok") {
+            return true;
+        }
+    }
+}
+
+/* *********************************************************************
+Function Name: playTurn
+Purpose: Plays a turn as the program chooses, within the rules.
+Parameters:
+        layout, a Layout object passed by reference. The current board.
+        stock, a Stock object passed by reference. The boneyard.
+        opponentPassed, a bool passed by value. Indicates if the
+            opponent passed.
+Return Value: Boolean true if a tile was placed, false if the player
+        passed.
+Algorithm:
+        1. Encode the position as a snapshot, with this player to move,
+            and request a move together with it.
+        2. If the program draws, draw the top tile and request again.
+        3. Play the tile or pass as it answered, if that is legal.
+        4. On a fault, count it and finish the turn first-fit.
+Reference: None
+********************************************************************* */
+bool ExternalPlayer::playTurn(Layout& layout, Stock& stock, bool opponentPassed) {
+    // 1. The position, as the seats stand
+    Round& round = m_position.getCurrentRound();
+    round.getHumanHand() = m_isHumanSeat ? m_hand : m_opponent->getHand();
+    round.getComputerHand() = m_isHumanSeat ? m_opponent->getHand() : m_hand;
+    round.getLayout() = layout;
+    round.getStock() = stock;
+    round.setHumanTurn(m_isHumanSeat);
+    round.setHumanPassed(!m_isHumanSeat && opponentPassed);
+    round.setComputerPassed(m_isHumanSeat && opponentPassed);
+
+    unsigned char snapshot[Serializer::BINARY_SIZE];
+    Serializer::encodeBinary(m_position, snapshot);
+
+    const char* digits = "0123456789abcdef";
+    std::string commands = "position snapshot ";
+    for (unsigned char byte : snapshot) {
+        commands += digits[byte >> 4];
+        commands += digits[byte & 0x0F];
+    }
+    std::string go = (m_milliseconds > 0) ? "go movetime " + std::to_string(m_milliseconds) + "\n" : "go\n";
+    commands += "\n" + go;
+
+    std::string move;
+    bool hasDrawn = false;
+    bool isPlaced = false;
+    if (!request(commands, move)) {
+        ++m_faultCount;
+        return playFirstFit(layout, stock, opponentPassed, hasDrawn);
+    }
+
+    // 2. A draw, then the drawn tile
+    if (move == "draw") {
+        bool isAllowed = !stock.isEmpty();
+        for (int i = 0; isAllowed && i < m_hand.getSize(); ++i) {
+            isAllowed = !canPlay(m_hand.getTileAtIndex(i), 'L', layout, opponentPassed)
+                && !canPlay(m_hand.getTileAtIndex(i), 'R', layout, opponentPassed);
+        }
+        if (!isAllowed) {
+            ++m_faultCount;
+            return playFirstFit(layout, stock, opponentPassed, hasDrawn);
+        }
+
+        Tile drawn;
+        stock.drawTile(drawn);
+        m_hand.addTile(drawn);
+        hasDrawn = true;
+
+        if (!request("draw\n" + go, move)) {
+            ++m_faultCount;
+            return playFirstFit(layout, stock, opponentPassed, hasDrawn);
+        }
+    }
+
+    // 3. The move, if legal; 4. otherwise first-fit
+    if (!applyMove(move, layout, stock, opponentPassed, hasDrawn, isPlaced)) {
+        ++m_faultCount;
+        return playFirstFit(layout, stock, opponentPassed, hasDrawn);
+    }
+    return isPlaced;
+}
+
+/* *********************************************************************
+Function Name: request
+Purpose: Sends commands ending in "go" and reads the move chosen.
+Parameters:
+        commands, a std::string_view. Whole lines, sent in one write.
+        outMove, a string passed by reference. Receives the words
+            after "bestmove".
+Return Value: Boolean true if a move arrived in time.
+Algorithm:
+        1. Write the commands, restarting the program first if it is
+            not running.
+        2. Read lines, skipping "info", until "bestmove" or the budget
+            and GRACE_MILLISECONDS have passed.
+        3. If late, send "stop" and wait GRACE_MILLISECONDS more for the
+            stale reply, so it cannot answer a later request; restart
+            the program if none comes.
+Reference: None
+********************************************************************* */
+bool ExternalPlayer::request(std::string_view commands, std::string& outMove) {
+    // 1. The request
+    if (!m_process.isRunning() && !(m_process.start(m_command) && handshake())) {
+        return false;
+    }
+    ++m_requestCount;
+    if (!m_process.write(commands)) {
+        m_process.stop();
+        return false;
+    }
+
+    // 2. The reply
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now()
+        + std::chrono::milliseconds(m_milliseconds + GRACE_MILLISECONDS);
+    std::string line;
+    while (true) {
+        long long left = std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now()).count();
+        if (left < 0 || !m_process.readLine(line, static_cast<int>(left))) {
+            break;
+        }
+        if (line.compare(0, 9, "bestmove ") == 0) {
+            outMove = line.substr(9);
+            return true;
+        }
+    }
+
+    // 3. Late: the reply is discarded once it comes
+    if (m_process.isRunning() && m_process.write("stop\n")) {
+        while (m_process.readLine(line, GRACE_MILLISECONDS)) {
+            if (line.compare(0, 9, "bestmove ") == 0) {
+                return false;
+            }
+        }
+    }
+    m_process.stop();
+    return false;
+}
+
+/* *********************************************************************
+Function Name: applyMove
+Purpose: Plays a move the program chose, if it is legal.
+Parameters:
+        move, a std::string_view: "a-b L", "a-b R" or "pass".
+        layout, stock, opponentPassed. As for playTurn().
+        hasDrawn, a boolean. True if the player drew this turn, so
+            only the last tile in hand may be played.
+        outPlaced, a boolean passed by reference. Receives true if a
+            tile was placed, false for a pass.
+Return Value: Boolean true if the move was legal and made.
+Algorithm:
+        1. Parse the tile and side, find the tile in hand, and place
+            it if it may go on that side and fits.
+        2. Allow a pass only when no tile that may be played fits.
+Reference: None
+********************************************************************* */
+bool ExternalPlayer::applyMove(std::string_view move, Layout& layout, Stock& stock, bool opponentPassed, bool hasDrawn,
+    bool& outPlaced) {
+    int first = hasDrawn ? m_hand.getSize() - 1 : 0;
+
+    // 2. A pass
+    if (move == "pass") {
+        if (!hasDrawn && !stock.isEmpty()) {
+            return false;
+        }
+        for (int i = first; i < m_hand.getSize(); ++i) {
+            if (canPlay(m_hand.getTileAtIndex(i), 'L', layout, opponentPassed)
+                || canPlay(m_hand.getTileAtIndex(i), 'R', layout, opponentPassed)) {
+                return false;
+            }
+        }
+
+        outPlaced = false;
+        return true;
+    }
+
+    // 1. "a-b S"
+    int left = 0;
+    int right = 0;
+    const char* end = move.data() + move.size();
+    std::from_chars_result leftResult = std::from_chars(move.data(), end, left);
+    if (leftResult.ec != std::errc() || leftResult.ptr == end || *leftResult.ptr != '-') {
+        return false;
+    }
+    std::from_chars_result rightResult = std::from_chars(leftResult.ptr + 1, end, right);
+    if (rightResult.ec != std::errc() || end - rightResult.ptr != 2 || rightResult.ptr[0] != ' ') {
+        return false;
+    }
+    char side = rightResult.ptr[1];
+    Tile tile(left, right);
+
+    for (int i = first; i < m_hand.getSize(); ++i) {
+        if (m_hand.getTileAtIndex(i) == tile) {
+            if ((side != 'L' && side != 'R') || !canPlay(tile, side, layout, opponentPassed)) {
+                return false;
+            }
+
+            Tile played;
+            m_hand.playTile(i, played);
+            if (side == 'L') {
+                layout.addLeftTile(played);
+            }
+            else {
+                layout.addRightTile(played);
+            }
+            outPlaced = true;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* *********************************************************************
+Function Name: playFirstFit
+Purpose: Finishes a turn with the first tile that fits, drawing if
+        none does, as the Computer plays.
+Parameters:
+        layout, stock, opponentPassed, hasDrawn. As for applyMove().
+Return Value: Boolean true if a tile was placed, false for a pass.
+Algorithm:
+        1. Play the first tile allowed and fitting, own side first.
+        2. Otherwise draw once if the player has not drawn, and play
+            the drawn tile if it fits; else pass.
+Reference: None
+********************************************************************* */
+bool ExternalPlayer::playFirstFit(Layout& layout, Stock& stock, bool opponentPassed, bool hasDrawn) {
+    char sides[2] = { m_isHumanSeat ? 'L' : 'R', m_isHumanSeat ? 'R' : 'L' };
+
+    // 1. The first fit, own side first
+    for (int i = hasDrawn ? m_hand.getSize() - 1 : 0; i < m_hand.getSize(); ++i) {
+        for (char side : sides) {
+            if (canPlay(m_hand.getTileAtIndex(i), side, layout, opponentPassed)) {
+                Tile played;
+                m_hand.playTile(i, played);
+                if (side == 'L') {
+                    layout.addLeftTile(played);
+                }
+                else {
+                    layout.addRightTile(played);
+                }
+                return true;
+            }
+        }
+    }
+
+    // 2. One draw a turn
+    if (hasDrawn || stock.isEmpty()) {
+        return false;
+    }
+
+    Tile drawn;
+    stock.drawTile(drawn);
+    m_hand.addTile(drawn);
+    return playFirstFit(layout, stock, opponentPassed, true);
+}
+
+/* *********************************************************************
+Function Name: canPlay
+Purpose: Checks that a tile may go on a side and fits there.
+Parameters:
+        tile, a Tile object passed by const reference.
+        side, a char: 'L' or 'R'.
+        layout, a Layout object passed by const reference.
+        opponentPassed, a bool passed by value.
+Return Value: Boolean true if the move is legal.
+Algorithm: A player may play on its own side, or on the other side
+        with a double or after the opponent passed; the tile must
+        also match the open end.
+Reference: None
+********************************************************************* */
+bool ExternalPlayer::canPlay(const Tile& tile, char side, const Layout& layout, bool opponentPassed) const {
+    bool isOwnSide = (side == (m_isHumanSeat ? 'L' : 'R'));
+    return (isOwnSide || tile.isDouble() || opponentPassed) && layout.isLegalMove(tile, side);
+}
\ No newline at end of file
@@ -0,0 +1,261 @@
+#ifndef EXTERNALPLAYER_H
+#define EXTERNALPLAYER_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <string>
+#include <string_view>
+
+#include "EngineProcess.h"
+#include "Layout.h"
+#include "Player.h"
+#include "Stock.h"
+#include "Tile.h"
+#include "Tournament.h"
+
+/* *********************************************************************
+Class Name: ExternalPlayer
+Purpose: A player whose moves are chosen by another program speaking the
+        engine protocol (see EngineProtocol) over pipes. The program is
+        started once and kept for every turn of every round, so the cost
+        of starting it is paid once per match. Each turn sends the
+        position and the search request in one write and reads until the
+        reply; a draw is followed by one more request for the drawn tile.
+
+        Since a turn needs the whole position, the player is told which
+        seat it sits in and who its opponent is. It checks every reply
+        against the rules. A reply that is late, illegal or missing is a
+        fault: the engine is told to stop, and restarted if it does not
+        answer, and the turn is played first-fit instead. Turns make no
+        output, so matches can run in bulk.
+********************************************************************* */
+class ExternalPlayer : public Player {
+public:
+
+    // Time allowed past the search budget before a reply is late
+    static constexpr int GRACE_MILLISECONDS = 1000;
+
+    // Time allowed for the program to start and answer "isready"
+    static constexpr int START_MILLISECONDS = 10000;
+
+    /* --- Constructor --- */
+
+    /* *********************************************************************
+    Function Name: ExternalPlayer
+    Purpose: Default constructor. No program is running.
+    Parameters: None
+    Return Value: None
+    Algorithm: Sit in the Computer's seat with no opponent, no budget
+            and no faults.
+    Reference: None
+    ********************************************************************* */
+    ExternalPlayer();
+
+    /* --- Destructor --- */
+
+    /* *********************************************************************
+    Function Name: ~ExternalPlayer
+    Purpose: Destructor. Asks the program to quit, then ends it.
+    Parameters: None
+    Return Value: None
+    Algorithm: Send "quit" if it is running; the process is stopped by
+            its own destructor.
+    Reference: None
+    ********************************************************************* */
+    ~ExternalPlayer() override;
+
+    /* --- Selectors --- */
+
+    /* *********************************************************************
+    Function Name: getName
+    Purpose: Retrieves the name the program gave for itself.
+    Parameters: None
+    Return Value: The "id name" it answered with, or its command if it
+            gave none.
+    Algorithm: Return the stored name.
+    Reference: None
+    ********************************************************************* */
+    inline const std::string& getName() const { return m_name; }
+
+    /* *********************************************************************
+    Function Name: getRequestCount / getFaultCount
+    Purpose: Retrieve how many searches the program was asked for, and
+            how many turns were played first-fit because of a fault.
+    Parameters: None
+    Return Value: A count.
+    Algorithm: Return the stored count.
+    Reference: None
+    ********************************************************************* */
+    inline long long getRequestCount() const { return m_requestCount; }
+    inline long long getFaultCount() const { return m_faultCount; }
+
+    /* --- Mutators --- */
+
+    /* *********************************************************************
+    Function Name: setSeat
+    Purpose: Sets the seat the player sits in for the round, and the
+            opponent whose hand completes the position.
+    Parameters:
+            isHumanSeat, a boolean. True for the Human's seat, whose own
+                side is the left; false for the Computer's.
+            opponent, a pointer to the other Player. Not owned.
+    Return Value: None
+    Algorithm: Store both parameters.
+    Reference: None
+    ********************************************************************* */
+    inline void setSeat(bool isHumanSeat, const Player* opponent) {
+        m_isHumanSeat = isHumanSeat;
+        m_opponent = opponent;
+    }
+
+    /* *********************************************************************
+    Function Name: setMilliseconds
+    Purpose: Sets the search budget sent with each request.
+    Parameters:
+            milliseconds, an integer. The budget, or 0 to let the program
+                use its own.
+    Return Value: None
+    Algorithm: Assign the parameter to m_milliseconds.
+    Reference: None
+    ********************************************************************* */
+    inline void setMilliseconds(int milliseconds) { m_milliseconds = milliseconds; }
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: start
+    Purpose: Starts the program and waits until it is ready.
+    Parameters:
+            command, a string. The command line to run.
+    Return Value: Boolean true if it started and answered "readyok".
+    Algorithm:
+            1. Start the process and keep the command for restarts.
+            2. Send "longana" and "isready" together, keep the "id name"
+                from the replies and wait for "readyok".
+    Reference: None
+    ********************************************************************* */
+    bool start(const std::string& command);
+
+    /* *********************************************************************
+    Function Name: playTurn
+    Purpose: Plays a turn as the program chooses, within the rules.
+    Parameters:
+            layout, a Layout object passed by reference. The current board.
+            stock, a Stock object passed by reference. The boneyard.
+            opponentPassed, a bool passed by value. Indicates if the
+                opponent passed.
+    Return Value: Boolean true if a tile was placed, false if the player
+            passed.
+    Algorithm:
+            1. Encode the position as a snapshot, with this player to move,
+                and request a move together with it.
+            2. If the program draws, draw the top tile and request again.
+            3. Play the tile or pass as it answered, if that is legal.
+            4. On a fault, count it and finish the turn first-fit.
+    Reference: None
+    ********************************************************************* */
+    bool playTurn(Layout& layout, Stock& stock, bool opponentPassed);
+
+private:
+    EngineProcess m_process;
+    std::string m_command;
+    std::string m_name;
+
+    bool m_isHumanSeat;
+    const Player* m_opponent;
+    int m_milliseconds;
+
+    long long m_requestCount;
+    long long m_faultCount;
+
+    // Scratch game the position is assembled in for encoding
+    Tournament m_position;
+
+    /* *********************************************************************
+    Function Name: handshake
+    Purpose: Greets a newly started program and waits until it is ready.
+    Parameters: None
+    Return Value: Boolean true if it answered "readyok" in time.
+    Algorithm: As step 2 of start().
+    Reference: None
+    ********************************************************************* */
+    bool handshake();
+
+    /* *********************************************************************
+    Function Name: request
+    Purpose: Sends commands ending in "go" and reads the move chosen.
+    Parameters:
+            commands, a std::string_view. Whole lines, sent in one write.
+            outMove, a string passed by reference. Receives the words
+                after "bestmove".
+    Return Value: Boolean true if a move arrived in time.
+    Algorithm:
+            1. Write the commands, restarting the program first if it is
+                not running.
+            2. Read lines, skipping "info", until "bestmove" or the budget
+                and GRACE_MILLISECONDS have passed.
+            3. If late, send "stop" and wait GRACE_MILLISECONDS more for the
+                stale reply, so it cannot answer a later request; restart
+                the program if none comes.
+    Reference: None
+    ********************************************************************* */
+    bool request(std::string_view commands, std::string& outMove);
+
+    /* *********************************************************************
+    Function Name: applyMove
+    Purpose: Plays a move the program chose, if it is legal.
+    Parameters:
+            move, a std::string_view: "a-b L", "a-b R" or "pass".
+            layout, stock, opponentPassed. As for playTurn().
+            hasDrawn, a boolean. True if the player drew this turn, so
+                only the last tile in hand may be played.
+            outPlaced, a boolean passed by reference. Receives true if a
+                tile was placed, false for a pass.
+    Return Value: Boolean true if the move was legal and made.
+    Algorithm:
+            1. Parse the tile and side, find the tile in hand, and place
+                it if it may go on that side and fits.
+            2. Allow a pass only when no tile that may be played fits.
+    Reference: None
+    ********************************************************************* */
+    bool applyMove(std::string_view move, Layout& layout, Stock& stock, bool opponentPassed, bool hasDrawn,
+        bool& outPlaced);
+
+    /* *********************************************************************
+    Function Name: playFirstFit
+    Purpose: Finishes a turn with the first tile that fits, drawing if
+            none does, as the Computer plays.
+    Parameters:
+            layout, stock, opponentPassed, hasDrawn. As for applyMove().
+    Return Value: Boolean true if a tile was placed, false for a pass.
+    Algorithm:
+            1. Play the first tile allowed and fitting, own side first.
+            2. Otherwise draw once if the player has not drawn, and play
+                the drawn tile if it fits; else pass.
+    Reference: None
+    ********************************************************************* */
+    bool playFirstFit(Layout& layout, Stock& stock, bool opponentPassed, bool hasDrawn);
+
+    /* *********************************************************************
+    Function Name: canPlay
+    Purpose: Checks that a tile may go on a side and fits there.
+    Parameters:
+            tile, a Tile object passed by const reference.
+            side, a char: 'L' or 'R'.
+            layout, a Layout object passed by const reference.
+            opponentPassed, a bool passed by value.
+    Return Value: Boolean true if the move is legal.
+    Algorithm: A player may play on its own side, or on the other side
+            with a double or after the opponent passed; the tile must
+            also match the open end.
+    Reference: None
+    ********************************************************************* */
+    bool canPlay(const Tile& tile, char side, const Layout& layout, bool opponentPassed) const;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,89 @@
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "FramePool.h"
+
+/* *********************************************************************
+Function Name: FramePool
+Purpose: Default constructor. Nothing is allocated.
+Parameters: None
+Return Value: None
+Algorithm: Empty every free list, with no chunk.
+Reference: None
+********************************************************************* */
+FramePool::FramePool()
+    : m_freeLists(), m_chunks(), m_chunkUsed(CHUNK_SIZE)
+{
+}
+
+/* *********************************************************************
+Function Name: allocate
+Purpose: Provides memory for a frame.
+Parameters:
+        size, a size_t. The bytes needed.
+Return Value: A pointer to at least size bytes, aligned for any type.
+Algorithm:
+        1. Above MAX_BLOCKS blocks, use the heap.
+        2. Otherwise take a freed frame of the same size class, or
+            carve one from the current chunk, starting a new chunk
+            if it is full.
+Reference: None
+********************************************************************* */
+void* FramePool::allocate(size_t size) {
+    // 1. Too large to pool
+    size_t blocks = (size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    if (blocks == 0 || blocks > MAX_BLOCKS) {
+        return ::operator new(size);
+    }
+
+    // 2. A frame of this size freed before
+    FreeFrame*& freeList = m_freeLists[blocks - 1];
+    if (freeList != nullptr) {
+        FreeFrame* frame = freeList;
+        freeList = frame->next;
+        return frame;
+    }
+
+    // Or a new one from the chunk
+    size_t bytes = blocks * BLOCK_SIZE;
+    if (m_chunkUsed + bytes > CHUNK_SIZE) {
+        m_chunks.push_back(std::make_unique<unsigned char[]>(CHUNK_SIZE));
+        m_chunkUsed = 0;
+    }
+
+    void* frame = m_chunks.back().get() + m_chunkUsed;
+    m_chunkUsed += bytes;
+    return frame;
+}
+
+/* *********************************************************************
+Function Name: release
+Purpose: Takes back a frame from allocate().
+Parameters:
+        frame, a pointer from allocate().
+        size, a size_t. The size it was allocated with.
+Return Value: None
+Algorithm: Return a large frame to the heap; push any other onto the
+        free list of its size class.
+Reference: None
+********************************************************************* */
+void FramePool::release(void* frame, size_t size) {
+    size_t blocks = (size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    if (blocks == 0 || blocks > MAX_BLOCKS) {
+        ::operator delete(frame);
+        return;
+    }
+
+    FreeFrame* freed = static_cast<FreeFrame*>(frame);
+    freed->next = m_freeLists[blocks - 1];
+    m_freeLists[blocks - 1] = freed;
+}
\ No newline at end of file
@@ -0,0 +1,125 @@
+#ifndef FRAMEPOOL_H
+#define FRAMEPOOL_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/* *********************************************************************
+Class Name: FramePool
+Purpose: Allocates the coroutine frames of one session (see Task), so
+        a round's turns reuse the memory of the turns before them
+        instead of going to the heap each time. Frames are rounded up to
+        whole blocks and carved from chunks the pool owns; a freed frame
+        goes on a list for its size, and the next frame of that size
+        takes it back. Frames larger than the biggest size class come
+        from the heap. Everything is released with the pool, which must
+        outlive its frames. One thread uses a pool at a time, so it
+        takes no locks, and it cannot be copied.
+********************************************************************* */
+class FramePool {
+public:
+
+    // Frames are rounded up to whole blocks, which keeps them aligned
+    static const int BLOCK_SIZE = 64;
+
+    // The largest frame pooled, in blocks
+    static const int MAX_BLOCKS = 64;
+
+    // Bytes taken from the heap at a time
+    static const int CHUNK_SIZE = 16384;
+
+    /* --- Constructor --- */
+
+    /* *********************************************************************
+    Function Name: FramePool
+    Purpose: Default constructor. Nothing is allocated.
+    Parameters: None
+    Return Value: None
+    Algorithm: Empty every free list, with no chunk.
+    Reference: None
+    ********************************************************************* */
+    FramePool();
+
+    FramePool(const FramePool&) = delete;
+    FramePool& operator=(const FramePool&) = delete;
+
+    /* --- Destructor --- */
+
+    /* *********************************************************************
+    Function Name: ~FramePool
+    Purpose: Destructor. The chunks release their own storage.
+    Parameters: None
+    Return Value: None
+    Algorithm: Standard object destruction.
+    Reference: None
+    ********************************************************************* */
+    ~FramePool() = default;
+
+    /* --- Selectors --- */
+
+    /* *********************************************************************
+    Function Name: getChunkCount
+    Purpose: Retrieves how many chunks the pool has taken from the heap.
+    Parameters: None
+    Return Value: A count of chunks, which stops growing once the session
+            has seen its deepest chain of frames.
+    Algorithm: Return the size of the chunk list.
+    Reference: None
+    ********************************************************************* */
+    inline int getChunkCount() const { return static_cast<int>(m_chunks.size()); }
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: allocate
+    Purpose: Provides memory for a frame.
+    Parameters:
+            size, a size_t. The bytes needed.
+    Return Value: A pointer to at least size bytes, aligned for any type.
+    Algorithm:
+            1. Above MAX_BLOCKS blocks, use the heap.
+            2. Otherwise take a freed frame of the same size class, or
+                carve one from the current chunk, starting a new chunk
+                if it is full.
+    Reference: None
+    ********************************************************************* */
+    void* allocate(size_t size);
+
+    /* *********************************************************************
+    Function Name: release
+    Purpose: Takes back a frame from allocate().
+    Parameters:
+            frame, a pointer from allocate().
+            size, a size_t. The size it was allocated with.
+    Return Value: None
+    Algorithm: Return a large frame to the heap; push any other onto the
+            free list of its size class.
+    Reference: None
+    ********************************************************************* */
+    void release(void* frame, size_t size);
+
+private:
+
+    // A freed frame, linked through its own first bytes
+    struct FreeFrame {
+        FreeFrame* next;
+    };
+
+    // Freed frames by size in blocks, less one
+    FreeFrame* m_freeLists[MAX_BLOCKS];
+
+    std::vector<std::unique_ptr<unsigned char[]>> m_chunks;
+
+    // Bytes of the newest chunk handed out
+    size_t m_chunkUsed;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,179 @@
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "GameLog.h"
+#include "Serializer.h"
+#include "Tile.h"
+
+/* *********************************************************************
+Function Name: open
+Purpose: Opens a log file for appending, creating it if necessary.
+Parameters:
+        filename, a string representing the log file path.
+Return Value: Boolean true if the file is ready for writing.
+Algorithm:
+        1. Open the file in binary append mode.
+        2. If the file is empty, write the header.
+        3. Otherwise check that it already starts with a valid header.
+Reference: None
+********************************************************************* */
+bool GameLog::open(const std::string& filename) {
+    // Check the header of an existing log before appending to it
+    std::ifstream existing(filename, std::ios::binary);
+    char header[HEADER_SIZE] = {};
+    bool isEmpty = !existing.is_open() || existing.peek() == std::ifstream::traits_type::eof();
+
+    if (!isEmpty) {
+        existing.read(header, HEADER_SIZE);
+        if (existing.gcount() != HEADER_SIZE || std::memcmp(header, "LGNL", 4) != 0 || header[4] != VERSION) {
+            std::cerr << "Error: " << filename << " is not a game log." << std::endl;
+            return false;
+        }
+    }
+    existing.close();
+
+    m_file.open(filename, std::ios::binary | std::ios::app);
+    if (!m_file.is_open()) {
+        std::cerr << "Error: Could not open " << filename << " for writing." << std::endl;
+        return false;
+    }
+
+    if (isEmpty) {
+        header[0] = 'L'; header[1] = 'G'; header[2] = 'N'; header[3] = 'L';
+        header[4] = static_cast<char>(VERSION);
+        m_file.write(header, HEADER_SIZE);
+        m_file.flush();
+    }
+
+    return true;
+}
+
+/* *********************************************************************
+Function Name: recordDeal
+Purpose: Marks the start of a freshly dealt round.
+Parameters:
+        roundNumber, an integer. The round being dealt.
+        seed, an unsigned integer. The seed the boneyard was shuffled with.
+        targetScore, humanScore, computerScore, integers. The tournament
+            state at the start of the round.
+Return Value: None
+Algorithm:
+        1. Write the deal control byte.
+        2. Write the round number and the four 32-bit values in
+            little-endian order.
+Reference: None
+********************************************************************* */
+void GameLog::recordDeal(int roundNumber, unsigned int seed, int targetScore, int humanScore, int computerScore) {
+    if (!m_file.is_open()) { return; }
+
+    unsigned char record[1 + DEAL_SIZE];
+    unsigned int values[4] = { seed, static_cast<unsigned int>(targetScore),
+        static_cast<unsigned int>(humanScore), static_cast<unsigned int>(computerScore) };
+
+    record[0] = encodeEvent(EVENT_CONTROL, false, CONTROL_DEAL);
+    record[1] = static_cast<unsigned char>(roundNumber & 0xFF);
+    record[2] = static_cast<unsigned char>((roundNumber >> 8) & 0xFF);
+
+    for (int i = 0; i < 4; ++i) {
+        for (int b = 0; b < 4; ++b) {
+            record[3 + i * 4 + b] = static_cast<unsigned char>((values[i] >> (8 * b)) & 0xFF);
+        }
+    }
+
+    m_file.write(reinterpret_cast<const char*>(record), sizeof(record));
+}
+
+/* *********************************************************************
+Function Name: recordSnapshot
+Purpose: Marks the start of a round resumed from a saved game, which
+        cannot be reproduced from a seed.
+Parameters:
+        snapshot, a pointer to Serializer::BINARY_SIZE bytes produced
+            by Serializer::encodeBinary.
+Return Value: None
+Algorithm: Write the snapshot control byte followed by the snapshot.
+Reference: None
+********************************************************************* */
+void GameLog::recordSnapshot(const unsigned char* snapshot) {
+    if (!m_file.is_open()) { return; }
+
+    writeEvent(EVENT_CONTROL, false, CONTROL_SNAPSHOT);
+    m_file.write(reinterpret_cast<const char*>(snapshot), Serializer::BINARY_SIZE);
+}
+
+/* *********************************************************************
+Function Name: recordPlay / recordDraw / recordPass
+Purpose: Append a single move to the log.
+Parameters:
+        isHuman, a boolean. True if the Human made the move.
+        tile, a Tile. The tile played or drawn.
+        side, a character. 'L' or 'R', the end the tile was played on.
+Return Value: None
+Algorithm: Pack the event kind, player and tile into one byte and write it.
+Reference: None
+********************************************************************* */
+void GameLog::recordPlay(bool isHuman, const Tile& tile, char side) {
+    writeEvent(side == 'L' ? EVENT_PLAY_LEFT : EVENT_PLAY_RIGHT, isHuman, tile.getIndex());
+}
+
+void GameLog::recordDraw(bool isHuman, const Tile& tile) {
+    writeEvent(EVENT_DRAW, isHuman, tile.getIndex());
+}
+
+void GameLog::recordPass(bool isHuman) {
+    writeEvent(EVENT_CONTROL, isHuman, CONTROL_PASS);
+}
+
+/* *********************************************************************
+Function Name: flush
+Purpose: Pushes buffered events to disk, so the log survives a crash
+        at the end of every turn.
+Parameters: None
+Return Value: None
+Algorithm: Flush the file stream.
+Reference: None
+********************************************************************* */
+void GameLog::flush() {
+    if (m_file.is_open()) {
+        m_file.flush();
+    }
+}
+
+/* *********************************************************************
+Function Name: encodeEvent
+Purpose: Packs a move or control record into its record byte.
+Parameters:
+        type, an integer. One of the EVENT_ constants.
+        isHuman, a boolean. True for the Human.
+        operand, an integer. The tile index, or a CONTROL_ constant.
+Return Value: The record byte.
+Algorithm: Shift each field into place and combine them.
+Reference: None
+********************************************************************* */
+unsigned char GameLog::encodeEvent(int type, bool isHuman, int operand) {
+    return static_cast<unsigned char>((type << 6) | (isHuman ? 0 : 0x20) | (operand & 0x1F));
+}
+
+/* *********************************************************************
+Function Name: writeEvent
+Purpose: Writes a single record byte.
+Parameters:
+        type, isHuman, operand. As for encodeEvent.
+Return Value: None
+Algorithm: Encode the byte and write it if the log is open.
+Reference: None
+********************************************************************* */
+void GameLog::writeEvent(int type, bool isHuman, int operand) {
+    if (!m_file.is_open()) { return; }
+
+    m_file.put(static_cast<char>(encodeEvent(type, isHuman, operand)));
+}
\ No newline at end of file
@@ -0,0 +1,186 @@
+#ifndef GAMELOG_H
+#define GAMELOG_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <fstream>
+#include <string>
+
+#include "Tile.h"
+
+/* *********************************************************************
+Class Name: GameLog
+Purpose: Writes the history of a game as an append-only binary stream.
+        The file starts with a short header and then holds one record
+        per event. Moves fit in a single byte: the top two bits give the
+        kind of event (play on the left, play on the right, draw, or a
+        control record), the next bit gives the player, and the low five
+        bits give the tile index. Control records mark a pass, the deal
+        of a new round (round number, seed and scores, from which the deal
+        is reproduced exactly), or a round resumed from a save (followed by
+        the Serializer's binary snapshot). The Replay class reads the
+        stream back.
+********************************************************************* */
+class GameLog {
+public:
+
+    // Size of the file header: the magic "LGNL" and a version byte
+    static const int HEADER_SIZE = 5;
+    static const int VERSION = 1;
+
+    // Kinds of event, stored in the top two bits of the record byte
+    static const int EVENT_PLAY_LEFT = 0;
+    static const int EVENT_PLAY_RIGHT = 1;
+    static const int EVENT_DRAW = 2;
+    static const int EVENT_CONTROL = 3;
+
+    // Kinds of control record, stored in the low five bits
+    static const int CONTROL_PASS = 0;
+    static const int CONTROL_DEAL = 1;
+    static const int CONTROL_SNAPSHOT = 2;
+
+    // Bytes following a deal record: round (2), seed, target and scores (4 each)
+    static const int DEAL_SIZE = 18;
+
+    /* --- Constructor --- */
+
+    /* *********************************************************************
+    Function Name: GameLog
+    Purpose: Default constructor. The log is closed until open() is called.
+    Parameters: None
+    Return Value: None
+    Algorithm: Default initialize the file stream.
+    Reference: None
+    ********************************************************************* */
+    GameLog() = default;
+
+    /* --- Destructor --- */
+
+    /* *********************************************************************
+    Function Name: ~GameLog
+    Purpose: Destructor. Closes the log file, flushing any buffered events.
+    Parameters: None
+    Return Value: None
+    Algorithm: Standard object destruction.
+    Reference: None
+    ********************************************************************* */
+    ~GameLog() = default;
+
+    /* --- Selectors --- */
+
+    /* *********************************************************************
+    Function Name: isOpen
+    Purpose: Checks whether events are currently being recorded.
+    Parameters: None
+    Return Value: Boolean true if the log file is open.
+    Algorithm: Return m_file.is_open().
+    Reference: None
+    ********************************************************************* */
+    inline bool isOpen() const { return m_file.is_open(); }
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: open
+    Purpose: Opens a log file for appending, creating it if necessary.
+    Parameters:
+            filename, a string representing the log file path.
+    Return Value: Boolean true if the file is ready for writing.
+    Algorithm:
+            1. Open the file in binary append mode.
+            2. If the file is empty, write the header.
+            3. Otherwise check that it already starts with a valid header.
+    Reference: None
+    ********************************************************************* */
+    bool open(const std::string& filename);
+
+    /* *********************************************************************
+    Function Name: recordDeal
+    Purpose: Marks the start of a freshly dealt round.
+    Parameters:
+            roundNumber, an integer. The round being dealt.
+            seed, an unsigned integer. The seed the boneyard was shuffled with.
+            targetScore, humanScore, computerScore, integers. The tournament
+                state at the start of the round.
+    Return Value: None
+    Algorithm:
+            1. Write the deal control byte.
+            2. Write the round number and the four 32-bit values in
+                little-endian order.
+    Reference: None
+    ********************************************************************* */
+    void recordDeal(int roundNumber, unsigned int seed, int targetScore, int humanScore, int computerScore);
+
+    /* *********************************************************************
+    Function Name: recordSnapshot
+    Purpose: Marks the start of a round resumed from a saved game, which
+            cannot be reproduced from a seed.
+    Parameters:
+            snapshot, a pointer to Serializer::BINARY_SIZE bytes produced
+                by Serializer::encodeBinary.
+    Return Value: None
+    Algorithm: Write the snapshot control byte followed by the snapshot.
+    Reference: None
+    ********************************************************************* */
+    void recordSnapshot(const unsigned char* snapshot);
+
+    /* *********************************************************************
+    Function Name: recordPlay / recordDraw / recordPass
+    Purpose: Append a single move to the log.
+    Parameters:
+            isHuman, a boolean. True if the Human made the move.
+            tile, a Tile. The tile played or drawn.
+            side, a character. 'L' or 'R', the end the tile was played on.
+    Return Value: None
+    Algorithm: Pack the event kind, player and tile into one byte and write it.
+    Reference: None
+    ********************************************************************* */
+    void recordPlay(bool isHuman, const Tile& tile, char side);
+    void recordDraw(bool isHuman, const Tile& tile);
+    void recordPass(bool isHuman);
+
+    /* *********************************************************************
+    Function Name: flush
+    Purpose: Pushes buffered events to disk, so the log survives a crash
+            at the end of every turn.
+    Parameters: None
+    Return Value: None
+    Algorithm: Flush the file stream.
+    Reference: None
+    ********************************************************************* */
+    void flush();
+
+    /* *********************************************************************
+    Function Name: encodeEvent
+    Purpose: Packs a move or control record into its record byte.
+    Parameters:
+            type, an integer. One of the EVENT_ constants.
+            isHuman, a boolean. True for the Human.
+            operand, an integer. The tile index, or a CONTROL_ constant.
+    Return Value: The record byte.
+    Algorithm: Shift each field into place and combine them.
+    Reference: None
+    ********************************************************************* */
+    static unsigned char encodeEvent(int type, bool isHuman, int operand);
+
+private:
+    std::ofstream m_file;
+
+    /* *********************************************************************
+    Function Name: writeEvent
+    Purpose: Writes a single record byte.
+    Parameters:
+            type, isHuman, operand. As for encodeEvent.
+    Return Value: None
+    Algorithm: Encode the byte and write it if the log is open.
+    Reference: None
+    ********************************************************************* */
+    void writeEvent(int type, bool isHuman, int operand);
+};
+
+#endif
\ No newline at end of file
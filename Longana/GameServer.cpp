@@ -0,0 +1,813 @@
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <cerrno>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#include "GameServer.h"
+#include "SessionStore.h"
+#include "StrategyRegistry.h"
+
+/* *********************************************************************
+Function Name: GameServer
+Purpose: Default constructor. Nothing is listening.
+Parameters: None
+Return Value: None
+Algorithm: Choose DEFAULT_STRATEGY, with no socket.
+Reference: None
+********************************************************************* */
+GameServer::GameServer()
+    : m_strategyName(DEFAULT_STRATEGY), m_socket(-1), m_isUnixSocket(false), m_address(), m_loops(),
+    m_jobMutex(), m_jobReady(), m_jobs(), m_store()
+{
+}
+
+/* *********************************************************************
+Function Name: ~GameServer
+Purpose: Destructor. Closes the listening socket.
+Parameters: None
+Return Value: None
+Algorithm: Close the socket and remove a Unix socket's file.
+Reference: None
+********************************************************************* */
+GameServer::~GameServer() {
+#ifdef __linux__
+    if (m_socket >= 0) {
+        ::close(m_socket);
+        if (m_isUnixSocket) {
+            ::unlink(m_address.c_str());
+        }
+    }
+#endif
+}
+
+/* *********************************************************************
+Function Name: setStrategy
+Purpose: Chooses the Computer's strategy in every session.
+Parameters:
+        spec, a string. A StrategyRegistry spec, or empty for the
+            first-fit rule.
+Return Value: Boolean true if the spec named a strategy; otherwise the
+        strategy is unchanged and the registry has reported why.
+Algorithm: Make the strategy once to check the spec, then keep the
+        spec; each worker makes its own.
+Reference: None
+********************************************************************* */
+bool GameServer::setStrategy(const std::string& spec) {
+    if (!spec.empty() && StrategyRegistry::create(spec) == nullptr) {
+        return false;
+    }
+
+    m_strategyName = spec;
+    return true;
+}
+
+#ifdef __linux__
+
+/* *********************************************************************
+Function Name: listen
+Purpose: Opens the socket clients connect to.
+Parameters:
+        address, a string. A path containing a '/' for a Unix
+            socket, "host:port" for TCP, or a port alone for TCP on
+            the loopback address.
+Return Value: Boolean true if the socket is listening; false, with an
+        error message, otherwise.
+Algorithm:
+        1. For a Unix socket, remove a stale file at the path.
+        2. Otherwise resolve the host and port.
+        3. Bind a non-blocking socket and listen on it.
+Reference: POSIX socket(2), bind(2), listen(2); getaddrinfo(3)
+********************************************************************* */
+bool GameServer::listen(const std::string& address) {
+    m_address = address;
+    m_isUnixSocket = address.find('/') != std::string::npos;
+
+    // 1. A Unix socket
+    if (m_isUnixSocket) {
+        sockaddr_un local = {};
+        local.sun_family = AF_UNIX;
+        if (address.size() >= sizeof(local.sun_path)) {
+            std::cerr << "Error: Socket path is too long: " << address << std::endl;
+            return false;
+        }
+        std::memcpy(local.sun_path, address.c_str(), address.size() + 1);
+
+        // A socket left by a server that was killed
+        struct stat status;
+        if (::stat(address.c_str(), &status) == 0 && S_ISSOCK(status.st_mode)) {
+            ::unlink(address.c_str());
+        }
+
+        m_socket = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (m_socket >= 0 && ::bind(m_socket, reinterpret_cast<sockaddr*>(&local), sizeof(local)) == 0
+            && ::listen(m_socket, SOMAXCONN) == 0) {
+            return true;
+        }
+    }
+    // 2. A TCP port, on the loopback address unless a host is given
+    else {
+        size_t colon = address.rfind(':');
+        std::string host = (colon == std::string::npos) ? "127.0.0.1" : address.substr(0, colon);
+        std::string port = (colon == std::string::npos) ? address : address.substr(colon + 1);
+
+        addrinfo hints = {};
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+        hints.ai_flags = AI_PASSIVE;
+        addrinfo* found = nullptr;
+        if (::getaddrinfo(host.empty() ? nullptr : host.c_str(), port.c_str(), &hints, &found) != 0) {
+            std::cerr << "Error: Could not resolve " << address << std::endl;
+            return false;
+        }
+
+        // 3. The first address that can be bound
+        for (addrinfo* entry = found; entry != nullptr; entry = entry->ai_next) {
+            m_socket = ::socket(entry->ai_family, entry->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, entry->ai_protocol);
+            if (m_socket < 0) {
+                continue;
+            }
+
+            int on = 1;
+            ::setsockopt(m_socket, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+            if (::bind(m_socket, entry->ai_addr, entry->ai_addrlen) == 0 && ::listen(m_socket, SOMAXCONN) == 0) {
+                ::freeaddrinfo(found);
+                return true;
+            }
+            ::close(m_socket);
+            m_socket = -1;
+        }
+        ::freeaddrinfo(found);
+    }
+
+    std::cerr << "Error: Could not listen on " << address << ": " << std::strerror(errno) << std::endl;
+    if (m_socket >= 0) {
+        ::close(m_socket);
+        m_socket = -1;
+    }
+    return false;
+}
+
+/* *********************************************************************
+Function Name: run
+Purpose: Serves clients until the process ends.
+Parameters:
+        loopCount, an integer. The number of event loops, or 0 for
+            one per hardware thread.
+        workerCount, an integer. The number of threads choosing the
+            Computer's moves, or 0 for one per hardware thread.
+Return Value: Integer 1 if the server could not start.
+Algorithm:
+        1. Make an epoll set and an eventfd for each loop, and watch
+            the listening socket from every loop, waking only one
+            loop for each new connection.
+        2. Start the workers and the loops, and wait for them.
+Reference: Linux epoll(7), eventfd(2)
+********************************************************************* */
+int GameServer::run(int loopCount, int workerCount) {
+    int cores = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    loopCount = (loopCount > 0) ? loopCount : cores;
+    workerCount = (workerCount > 0) ? workerCount : cores;
+
+    if (m_socket < 0) {
+        std::cerr << "Error: The server is not listening." << std::endl;
+        return 1;
+    }
+
+    // 1. The loops
+    for (int i = 0; i < loopCount; ++i) {
+        std::unique_ptr<EventLoop> loop = std::make_unique<EventLoop>();
+        loop->epoll = ::epoll_create1(EPOLL_CLOEXEC);
+        loop->wake = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        loop->nextId = FIRST_CONNECTION;
+        loop->nextSweep = std::chrono::steady_clock::now();
+
+        epoll_event listenEvent = {};
+        listenEvent.events = EPOLLIN | EPOLLEXCLUSIVE;
+        listenEvent.data.u64 = LISTEN_EVENT;
+        epoll_event wakeEvent = {};
+        wakeEvent.events = EPOLLIN;
+        wakeEvent.data.u64 = WAKE_EVENT;
+
+        if (loop->epoll < 0 || loop->wake < 0 || ::epoll_ctl(loop->epoll, EPOLL_CTL_ADD, m_socket, &listenEvent) != 0
+            || ::epoll_ctl(loop->epoll, EPOLL_CTL_ADD, loop->wake, &wakeEvent) != 0) {
+            std::cerr << "Error: Could not start an event loop: " << std::strerror(errno) << std::endl;
+            return 1;
+        }
+        m_loops.push_back(std::move(loop));
+    }
+
+    // 2. The threads, which run until the process ends
+    std::vector<std::thread> threads;
+    for (int i = 0; i < workerCount; ++i) {
+        threads.emplace_back(&GameServer::work, this);
+    }
+    for (int i = 0; i < loopCount; ++i) {
+        threads.emplace_back(&GameServer::runLoop, this, i);
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    return 0;
+}
+
+/* *********************************************************************
+Function Name: runLoop
+Purpose: The body of an event loop's thread.
+Parameters:
+        loop, an integer. The loop's index.
+Return Value: None
+Algorithm: Wait for events; accept new connections, apply the moves
+        the workers have chosen, read from readable sockets and
+        write to writable ones. With a store, wake at least every
+        SWEEP_MILLISECONDS to park idle sessions.
+Reference: Linux epoll(7)
+********************************************************************* */
+void GameServer::runLoop(int loop) {
+    EventLoop& self = *m_loops[loop];
+    epoll_event events[MAX_EVENTS];
+    int timeout = m_store.isOpen() ? SWEEP_MILLISECONDS : -1;
+
+    while (true) {
+        int count = ::epoll_wait(self.epoll, events, MAX_EVENTS, timeout);
+        for (int i = 0; i < count; ++i) {
+            uint64_t id = events[i].data.u64;
+            if (id == LISTEN_EVENT) {
+                acceptConnections(self);
+                continue;
+            }
+            if (id == WAKE_EVENT) {
+                applyResults(loop);
+                continue;
+            }
+
+            // A connection closed earlier in this batch has no entry
+            std::unordered_map<uint64_t, std::unique_ptr<Connection>>::iterator found = self.connections.find(id);
+            if (found == self.connections.end()) {
+                continue;
+            }
+
+            Connection& connection = *found->second;
+            if (events[i].events & EPOLLOUT) {
+                flush(self, connection);
+            }
+            else {
+                readConnection(loop, connection);
+            }
+        }
+
+        // Idle sessions, looked for at most once a sweep interval
+        if (m_store.isOpen() && std::chrono::steady_clock::now() >= self.nextSweep) {
+            sweep(self);
+            self.nextSweep = std::chrono::steady_clock::now() + std::chrono::milliseconds(SWEEP_MILLISECONDS);
+        }
+    }
+}
+
+/* *********************************************************************
+Function Name: work
+Purpose: The body of a worker thread.
+Parameters: None
+Return Value: None
+Algorithm: Make the strategy, then take jobs from the queue, choose
+        each Computer turn and hand it to the job's loop, waking the
+        loop if its results were empty.
+Reference: None
+********************************************************************* */
+void GameServer::work() {
+    std::unique_ptr<ComputerStrategy> strategy;
+    if (!m_strategyName.empty()) {
+        strategy = StrategyRegistry::create(m_strategyName);
+    }
+
+    while (true) {
+        // The next job
+        std::unique_lock<std::mutex> lock(m_jobMutex);
+        m_jobReady.wait(lock, [this]() { return !m_jobs.empty(); });
+        Job job = m_jobs.front();
+        m_jobs.pop_front();
+        lock.unlock();
+
+        Result result;
+        result.connection = job.connection;
+        GameSession::chooseComputerMove(strategy.get(), job.position, result.move);
+
+        // Back to the loop, which needs waking only once per batch
+        EventLoop& loop = *m_loops[job.loop];
+        bool isFirst = false;
+        {
+            std::lock_guard<std::mutex> resultLock(loop.resultMutex);
+            isFirst = loop.results.empty();
+            loop.results.push_back(result);
+        }
+        if (isFirst) {
+            uint64_t one = 1;
+            ssize_t written = ::write(loop.wake, &one, sizeof(one));
+            (void)written;
+        }
+    }
+}
+
+/* *********************************************************************
+Function Name: acceptConnections
+Purpose: Takes every connection waiting on the listening socket.
+Parameters:
+        loop, an EventLoop passed by reference. The loop that takes
+            them.
+Return Value: None
+Algorithm: Accept non-blocking sockets until none are left, turn off
+        Nagle's algorithm for TCP, and watch each for input.
+Reference: Linux accept4(2)
+********************************************************************* */
+void GameServer::acceptConnections(EventLoop& loop) {
+    while (true) {
+        int client = ::accept4(m_socket, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (client < 0) {
+            return;
+        }
+
+        if (!m_isUnixSocket) {
+            int on = 1;
+            ::setsockopt(client, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+        }
+
+        std::unique_ptr<Connection> connection = std::make_unique<Connection>();
+        connection->id = loop.nextId++;
+        connection->socket = client;
+        connection->session = std::make_unique<GameSession>();
+        connection->sessionId = 0;
+        connection->isWaiting = false;
+        connection->isClosing = false;
+        connection->isWatchingOutput = false;
+
+        epoll_event event = {};
+        event.events = EPOLLIN | EPOLLRDHUP;
+        event.data.u64 = connection->id;
+        if (::epoll_ctl(loop.epoll, EPOLL_CTL_ADD, client, &event) != 0) {
+            ::close(client);
+            continue;
+        }
+
+        // Greet the client with what the session waits for
+        Connection& added = *connection;
+        loop.connections.emplace(added.id, std::move(connection));
+        added.residentEntry = loop.resident.insert(loop.resident.end(), &added);
+        added.session->handleMessage("state", added.output);
+        touch(loop, added);
+        flush(loop, added);
+    }
+}
+
+/* *********************************************************************
+Function Name: readConnection
+Purpose: Reads what a client has sent and answers it.
+Parameters:
+        loop, an integer. The connection's loop.
+        connection, a Connection passed by reference.
+Return Value: None
+Algorithm: Read until the socket is empty, then pass the input to
+        handleInput(). Close the connection when the client has.
+Reference: None
+********************************************************************* */
+void GameServer::readConnection(int loop, Connection& connection) {
+    char buffer[READ_SIZE];
+    bool isEnded = false;
+
+    while (true) {
+        ssize_t count = ::recv(connection.socket, buffer, sizeof(buffer), 0);
+        if (count > 0) {
+            connection.input.append(buffer, static_cast<size_t>(count));
+            if (count < static_cast<ssize_t>(sizeof(buffer))) {
+                break;
+            }
+        }
+        else if (count < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            break;
+        }
+        else if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        else {
+            isEnded = true;
+            break;
+        }
+    }
+
+    // A client that has gone needs no replies
+    if (isEnded) {
+        close(*m_loops[loop], connection);
+        return;
+    }
+    handleInput(loop, connection);
+}
+
+/* *********************************************************************
+Function Name: applyResults
+Purpose: Applies the Computer moves the workers have chosen for a
+        loop's sessions.
+Parameters:
+        loop, an integer. The loop's index.
+Return Value: None
+Algorithm: Clear the eventfd, take the results, and apply each to
+        its session if the connection is still open; then go on with
+        the lines that waited for it.
+Reference: None
+********************************************************************* */
+void GameServer::applyResults(int loop) {
+    EventLoop& self = *m_loops[loop];
+
+    uint64_t count = 0;
+    ssize_t drained = ::read(self.wake, &count, sizeof(count));
+    (void)drained;
+
+    std::vector<Result> results;
+    {
+        std::lock_guard<std::mutex> lock(self.resultMutex);
+        results.swap(self.results);
+    }
+
+    for (const Result& result : results) {
+        std::unordered_map<uint64_t, std::unique_ptr<Connection>>::iterator found = self.connections.find(result.connection);
+        if (found == self.connections.end()) {
+            continue;
+        }
+
+        Connection& connection = *found->second;
+        connection.isWaiting = false;
+        connection.session->applyComputerMove(result.move, connection.output);
+        handleInput(loop, connection);
+    }
+}
+
+/* *********************************************************************
+Function Name: handleInput
+Purpose: Feeds a connection's complete lines to its session.
+Parameters:
+        loop, an integer. The connection's loop.
+        connection, a Connection passed by reference.
+Return Value: None
+Algorithm:
+        1. Until the session waits for the Computer or is closing,
+            pass each complete line to handleMessage(), restoring a
+            parked session first. Answer "resume" here, and name
+            the session before its first "new" if there is a
+            store. Queue a job once it waits for the Computer.
+        2. Drop the lines used. A partial line longer than MAX_LINE
+            closes the connection.
+        3. Mark the session used, parking others past MAX_RESIDENT,
+            and send the replies with flush().
+Reference: None
+********************************************************************* */
+void GameServer::handleInput(int loop, Connection& connection) {
+    EventLoop& self = *m_loops[loop];
+
+    // 1. The lines, in order
+    size_t start = 0;
+    while (!connection.isClosing) {
+        // A parked session stays on disk until it has a line to answer
+        if (connection.session == nullptr) {
+            if (connection.input.find('\n', start) == std::string::npos) {
+                break;
+            }
+            restore(self, connection);
+        }
+
+        if (connection.session->getState() == GameSession::AWAITING_COMPUTER) {
+            if (!connection.isWaiting) {
+                Job job;
+                job.loop = loop;
+                job.connection = connection.id;
+                connection.session->loadComputerTurn(job.position);
+                {
+                    std::lock_guard<std::mutex> lock(m_jobMutex);
+                    m_jobs.push_back(job);
+                }
+                m_jobReady.notify_one();
+                connection.isWaiting = true;
+            }
+            break;
+        }
+
+        size_t end = connection.input.find('\n', start);
+        if (end == std::string::npos) {
+            break;
+        }
+
+        std::string_view line(connection.input.data() + start, end - start);
+        start = end + 1;
+
+        // Sessions kept in the store are named, and can be swapped
+        if (m_store.isOpen() && line.starts_with("resume ")) {
+            resume(self, connection, line.substr(7));
+            continue;
+        }
+        if (m_store.isOpen() && connection.sessionId == 0 && line.substr(0, line.find(' ')) == "new") {
+            connection.sessionId = m_store.create();
+            connection.output += "session " + SessionStore::formatId(connection.sessionId) + "\n";
+        }
+
+        if (!connection.session->handleMessage(line, connection.output)) {
+            // "quit" ends the session for good
+            if (connection.sessionId != 0) {
+                m_store.release(connection.sessionId);
+                connection.sessionId = 0;
+            }
+            connection.isClosing = true;
+        }
+    }
+
+    // 2. What is left
+    connection.input.erase(0, start);
+    if (connection.input.size() > static_cast<size_t>(MAX_LINE) && connection.input.find('\n') == std::string::npos) {
+        connection.output += "error Line too long.\n";
+        connection.input.clear();
+        connection.isClosing = true;
+    }
+
+    // 3. The replies
+    if (connection.session != nullptr) {
+        touch(self, connection);
+    }
+    flush(self, connection);
+}
+
+/* *********************************************************************
+Function Name: resume
+Purpose: Answers "resume <id>": swaps the connection's session for
+        one parked in the store.
+Parameters:
+        loop, an EventLoop passed by reference. The connection's loop.
+        connection, a Connection passed by reference.
+        arguments, a std::string_view. The session id.
+Return Value: None
+Algorithm: Take the session from the store, or reply "error" and
+        keep the current one. Park the current session, adopt the
+        resumed one and describe it after a "session" line.
+Reference: None
+********************************************************************* */
+void GameServer::resume(EventLoop& loop, Connection& connection, std::string_view arguments) {
+    if (!arguments.empty() && arguments.back() == '\r') {
+        arguments.remove_suffix(1);
+    }
+
+    // The session asked for, unless it is this one
+    uint64_t id = 0;
+    std::unique_ptr<GameSession> session = std::make_unique<GameSession>();
+    if (!SessionStore::parseId(arguments, id)) {
+        connection.output += "error Resume a session by its id: resume <id>.\n";
+        connection.session->handleMessage("state", connection.output);
+        return;
+    }
+    if (id != connection.sessionId && !m_store.resume(id, *session)) {
+        connection.output += "error No parked session ";
+        connection.output += arguments;
+        connection.output += ".\n";
+        connection.session->handleMessage("state", connection.output);
+        return;
+    }
+
+    // Set the current one aside
+    if (id != connection.sessionId) {
+        park(loop, connection);
+        connection.session = std::move(session);
+        connection.sessionId = id;
+        connection.residentEntry = loop.resident.insert(loop.resident.end(), &connection);
+    }
+
+    connection.output += "session " + SessionStore::formatId(id) + "\n";
+    connection.session->handleMessage("state", connection.output);
+}
+
+/* *********************************************************************
+Function Name: restore / park
+Purpose: Bring a connection's parked session back into memory, and
+        set it aside again.
+Parameters:
+        loop, an EventLoop passed by reference. The connection's loop.
+        connection, a Connection passed by reference.
+Return Value: None
+Algorithm:
+        1. To restore, read the session back from the store, or start
+            a fresh one, with an "error" line, if it has been resumed
+            elsewhere; a session never named starts fresh. Add it to
+            the resident list.
+        2. To park, write a named session to the store, drop it from
+            memory and the resident list, and give back the memory
+            of empty buffers. A session never named is only dropped,
+            as it has not begun.
+Reference: None
+********************************************************************* */
+void GameServer::restore(EventLoop& loop, Connection& connection) {
+    // 1. The session as it was parked
+    connection.session = std::make_unique<GameSession>();
+    if (connection.sessionId != 0 && !m_store.resume(connection.sessionId, *connection.session)) {
+        connection.output += "error Session " + SessionStore::formatId(connection.sessionId)
+            + " was resumed elsewhere.\n";
+        connection.sessionId = 0;
+    }
+    connection.residentEntry = loop.resident.insert(loop.resident.end(), &connection);
+}
+
+void GameServer::park(EventLoop& loop, Connection& connection) {
+    // 2. Out of memory, and onto disk if it has begun
+    if (connection.session == nullptr) {
+        return;
+    }
+    if (connection.sessionId != 0) {
+        m_store.park(connection.sessionId, *connection.session);
+    }
+
+    connection.session.reset();
+    loop.resident.erase(connection.residentEntry);
+
+    if (connection.input.empty()) {
+        connection.input.shrink_to_fit();
+    }
+    if (connection.output.empty()) {
+        connection.output.shrink_to_fit();
+    }
+}
+
+/* *********************************************************************
+Function Name: touch
+Purpose: Marks a connection's session as just used.
+Parameters:
+        loop, an EventLoop passed by reference. The connection's loop.
+        connection, a Connection passed by reference. Its session is
+            resident.
+Return Value: None
+Algorithm: Move it to the back of the resident list with the time,
+        then park from the front, skipping sessions waiting for the
+        Computer, while the loop holds more than MAX_RESIDENT.
+Reference: None
+********************************************************************* */
+void GameServer::touch(EventLoop& loop, Connection& connection) {
+    connection.lastUsed = std::chrono::steady_clock::now();
+    loop.resident.splice(loop.resident.end(), loop.resident, connection.residentEntry);
+
+    if (!m_store.isOpen()) {
+        return;
+    }
+
+    std::list<Connection*>::iterator next = loop.resident.begin();
+    while (static_cast<int>(loop.resident.size()) > MAX_RESIDENT && *next != &connection) {
+        Connection& oldest = **next;
+        ++next;
+        if (!oldest.isWaiting) {
+            park(loop, oldest);
+        }
+    }
+}
+
+/* *********************************************************************
+Function Name: sweep
+Purpose: Parks the sessions that have waited too long for their
+        Humans.
+Parameters:
+        loop, an EventLoop passed by reference.
+Return Value: None
+Algorithm: From the front of the resident list, park each session
+        unused for IDLE_SECONDS, stopping at the first used since;
+        one waiting for the Computer is only marked used.
+Reference: None
+********************************************************************* */
+void GameServer::sweep(EventLoop& loop) {
+    std::chrono::steady_clock::time_point cutoff = std::chrono::steady_clock::now() - std::chrono::seconds(IDLE_SECONDS);
+
+    while (!loop.resident.empty() && loop.resident.front()->lastUsed <= cutoff) {
+        Connection& oldest = *loop.resident.front();
+        if (oldest.isWaiting) {
+            touch(loop, oldest);
+        }
+        else {
+            park(loop, oldest);
+        }
+    }
+}
+
+/* *********************************************************************
+Function Name: flush
+Purpose: Sends a connection's replies.
+Parameters:
+        loop, an EventLoop passed by reference. The connection's loop.
+        connection, a Connection passed by reference. Closed, and no
+            longer valid, if sending fails or it is closing and has
+            nothing left to send.
+Return Value: None
+Algorithm: Send until the output is empty or the socket is full.
+        Watch for the socket becoming writable only while output is
+        left.
+Reference: None
+********************************************************************* */
+void GameServer::flush(EventLoop& loop, Connection& connection) {
+    size_t sent = 0;
+    while (sent < connection.output.size()) {
+        ssize_t count = ::send(connection.socket, connection.output.data() + sent, connection.output.size() - sent,
+            MSG_NOSIGNAL);
+        if (count > 0) {
+            sent += static_cast<size_t>(count);
+        }
+        else if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        else if (count < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            break;
+        }
+        else {
+            close(loop, connection);
+            return;
+        }
+    }
+    connection.output.erase(0, sent);
+
+    // Watch for room in the socket only while there is something to send
+    bool isPending = !connection.output.empty();
+    if (isPending != connection.isWatchingOutput) {
+        epoll_event event = {};
+        event.events = EPOLLIN | EPOLLRDHUP | (isPending ? static_cast<uint32_t>(EPOLLOUT) : 0u);
+        event.data.u64 = connection.id;
+        ::epoll_ctl(loop.epoll, EPOLL_CTL_MOD, connection.socket, &event);
+        connection.isWatchingOutput = isPending;
+    }
+
+    if (!isPending && connection.isClosing) {
+        close(loop, connection);
+    }
+}
+
+/* *********************************************************************
+Function Name: close
+Purpose: Ends a connection and its session.
+Parameters:
+        loop, an EventLoop passed by reference. The connection's loop.
+        connection, a Connection passed by reference. No longer valid
+            afterwards.
+Return Value: None
+Algorithm: Stop watching the socket, close it and drop the
+        connection, parking a named session so it can be resumed. A
+        move still being chosen for it is dropped when it arrives,
+        and chosen again once the session is resumed.
+Reference: None
+********************************************************************* */
+void GameServer::close(EventLoop& loop, Connection& connection) {
+    park(loop, connection);
+    ::epoll_ctl(loop.epoll, EPOLL_CTL_DEL, connection.socket, nullptr);
+    ::close(connection.socket);
+    loop.connections.erase(connection.id);
+}
+
+#else
+
+/* *********************************************************************
+Function Name: listen / run
+Purpose: Report that the server needs epoll, which only Linux has.
+Parameters: As above.
+Return Value: Boolean false. / Integer 1.
+Algorithm: Print an error.
+Reference: None
+********************************************************************* */
+bool GameServer::listen(const std::string& address) {
+    m_address = address;
+    std::cerr << "Error: The game server uses epoll and runs only on Linux." << std::endl;
+    return false;
+}
+
+int GameServer::run(int, int) {
+    std::cerr << "Error: The game server uses epoll and runs only on Linux." << std::endl;
+    return 1;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,425 @@
+#ifndef GAMESERVER_H
+#define GAMESERVER_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "ComputerStrategy.h"
+#include "GameSession.h"
+#include "Playout.h"
+#include "SessionStore.h"
+
+/* *********************************************************************
+Class Name: GameServer
+Purpose: Hosts many tournaments at once, one GameSession per connection,
+        over a local TCP port or a Unix socket. Clients speak the
+        session's line protocol (see GameSession).
+
+        Connections are spread over event loops, one thread each and one
+        per core by default. Each loop waits on its own epoll set, reads
+        whatever has arrived, feeds complete lines to the sessions and
+        writes their replies in one send per batch; a reply the socket
+        cannot take yet is finished when epoll says it is writable. No
+        loop ever blocks on a client or on the Computer: when a session
+        waits for the Computer, its position goes to a queue served by a
+        pool of worker threads, each with its own strategy, and the move
+        comes back to the session's loop through an eventfd. Lines a
+        client sends meanwhile wait until the move is applied, so every
+        client sees its replies in order.
+
+        With a SessionStore, a session outlives its connection. The first
+        "new" names it with a "session <id>" line, and "resume <id>" on
+        any connection takes up a session parked under that id. A
+        session that has waited IDLE_SECONDS for its Human, or is the
+        least recently used when a loop holds more than MAX_RESIDENT, is
+        parked: written to the store and dropped from memory, to be read
+        back before its next line is answered. A session whose client
+        disconnects is parked too; "quit" ends it for good. Memory so
+        grows with the sessions in play, not with those parked.
+
+        The event loops use epoll, so the server runs only on Linux.
+********************************************************************* */
+class GameServer {
+public:
+
+    // The Computer's strategy unless another is chosen
+    static constexpr const char* DEFAULT_STRATEGY = "greedy";
+
+    // The longest line a client may send
+    static const int MAX_LINE = 1024;
+
+    // Bytes read from a socket at a time, and events taken per wait
+    static const int READ_SIZE = 4096;
+    static const int MAX_EVENTS = 256;
+
+    // Seconds a session may wait for its Human before it is parked
+    static constexpr int IDLE_SECONDS = 30;
+
+    // Sessions each loop keeps in memory before parking the least recently used
+    static const int MAX_RESIDENT = 1024;
+
+    // How often the loops look for idle sessions, in milliseconds
+    static constexpr int SWEEP_MILLISECONDS = 1000;
+
+    /* --- Constructor --- */
+
+    /* *********************************************************************
+    Function Name: GameServer
+    Purpose: Default constructor. Nothing is listening.
+    Parameters: None
+    Return Value: None
+    Algorithm: Choose DEFAULT_STRATEGY, with no socket.
+    Reference: None
+    ********************************************************************* */
+    GameServer();
+
+    /* --- Destructor --- */
+
+    /* *********************************************************************
+    Function Name: ~GameServer
+    Purpose: Destructor. Closes the listening socket.
+    Parameters: None
+    Return Value: None
+    Algorithm: Close the socket and remove a Unix socket's file.
+    Reference: None
+    ********************************************************************* */
+    ~GameServer();
+
+    /* --- Mutators --- */
+
+    /* *********************************************************************
+    Function Name: setStrategy
+    Purpose: Chooses the Computer's strategy in every session.
+    Parameters:
+            spec, a string. A StrategyRegistry spec, or empty for the
+                first-fit rule.
+    Return Value: Boolean true if the spec named a strategy; otherwise the
+            strategy is unchanged and the registry has reported why.
+    Algorithm: Make the strategy once to check the spec, then keep the
+            spec; each worker makes its own.
+    Reference: None
+    ********************************************************************* */
+    bool setStrategy(const std::string& spec);
+
+    /* *********************************************************************
+    Function Name: setStore
+    Purpose: Keeps sessions in a SessionStore, so they can be parked
+            and resumed.
+    Parameters:
+            filename, a string. The store's file, created if missing.
+    Return Value: Boolean true if the store is open; false, with an
+            error message, otherwise.
+    Algorithm: Open m_store on the file.
+    Reference: None
+    ********************************************************************* */
+    inline bool setStore(const std::string& filename) { return m_store.open(filename); }
+
+    /* *********************************************************************
+    Function Name: listen
+    Purpose: Opens the socket clients connect to.
+    Parameters:
+            address, a string. A path containing a '/' for a Unix
+                socket, "host:port" for TCP, or a port alone for TCP on
+                the loopback address.
+    Return Value: Boolean true if the socket is listening; false, with an
+            error message, otherwise.
+    Algorithm:
+            1. For a Unix socket, remove a stale file at the path.
+            2. Otherwise resolve the host and port.
+            3. Bind a non-blocking socket and listen on it.
+    Reference: POSIX socket(2), bind(2), listen(2); getaddrinfo(3)
+    ********************************************************************* */
+    bool listen(const std::string& address);
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: run
+    Purpose: Serves clients until the process ends.
+    Parameters:
+            loopCount, an integer. The number of event loops, or 0 for
+                one per hardware thread.
+            workerCount, an integer. The number of threads choosing the
+                Computer's moves, or 0 for one per hardware thread.
+    Return Value: Integer 1 if the server could not start.
+    Algorithm:
+            1. Make an epoll set and an eventfd for each loop, and watch
+                the listening socket from every loop, waking only one
+                loop for each new connection.
+            2. Start the workers and the loops, and wait for them.
+    Reference: Linux epoll(7), eventfd(2)
+    ********************************************************************* */
+    int run(int loopCount, int workerCount);
+
+private:
+
+    // Event data for the two descriptors every loop watches; connections count up from FIRST_CONNECTION
+    static const uint64_t LISTEN_EVENT = 0;
+    static const uint64_t WAKE_EVENT = 1;
+    static const uint64_t FIRST_CONNECTION = 2;
+
+    // One client and its tournament
+    struct Connection {
+        uint64_t id;
+        int socket;
+        std::string input;
+        std::string output;
+        std::unique_ptr<GameSession> session;   // nullptr while parked
+        uint64_t sessionId;     // the session's name in the store, or 0
+        bool isWaiting;         // the Computer's move is being chosen
+        bool isClosing;         // close once the output is sent
+        bool isWatchingOutput;  // epoll reports when the socket is writable
+
+        // When the session last had a line, and its place in the loop's resident list
+        std::chrono::steady_clock::time_point lastUsed;
+        std::list<Connection*>::iterator residentEntry;
+    };
+
+    // A Computer turn to choose, and the loop and connection it is for
+    struct Job {
+        int loop;
+        uint64_t connection;
+        Playout position;
+    };
+
+    struct Result {
+        uint64_t connection;
+        GameSession::ComputerMove move;
+    };
+
+    // One thread's share of the connections
+    struct EventLoop {
+        int epoll;
+        int wake;
+        uint64_t nextId;
+        std::unordered_map<uint64_t, std::unique_ptr<Connection>> connections;
+
+        // The connections with a session in memory, least recently used first
+        std::list<Connection*> resident;
+        std::chrono::steady_clock::time_point nextSweep;
+
+        // Moves chosen by the workers, guarded by resultMutex
+        std::mutex resultMutex;
+        std::vector<Result> results;
+    };
+
+    std::string m_strategyName;
+
+    int m_socket;
+    bool m_isUnixSocket;
+    std::string m_address;
+
+    std::vector<std::unique_ptr<EventLoop>> m_loops;
+
+    // The Computer turns waiting for a worker
+    std::mutex m_jobMutex;
+    std::condition_variable m_jobReady;
+    std::deque<Job> m_jobs;
+
+    // Where sessions are parked, if open
+    SessionStore m_store;
+
+    /* *********************************************************************
+    Function Name: runLoop
+    Purpose: The body of an event loop's thread.
+    Parameters:
+            loop, an integer. The loop's index.
+    Return Value: None
+    Algorithm: Wait for events; accept new connections, apply the moves
+            the workers have chosen, read from readable sockets and
+            write to writable ones. With a store, wake at least every
+            SWEEP_MILLISECONDS to park idle sessions.
+    Reference: Linux epoll(7)
+    ********************************************************************* */
+    void runLoop(int loop);
+
+    /* *********************************************************************
+    Function Name: work
+    Purpose: The body of a worker thread.
+    Parameters: None
+    Return Value: None
+    Algorithm: Make the strategy, then take jobs from the queue, choose
+            each Computer turn and hand it to the job's loop, waking the
+            loop if its results were empty.
+    Reference: None
+    ********************************************************************* */
+    void work();
+
+    /* *********************************************************************
+    Function Name: acceptConnections
+    Purpose: Takes every connection waiting on the listening socket.
+    Parameters:
+            loop, an EventLoop passed by reference. The loop that takes
+                them.
+    Return Value: None
+    Algorithm: Accept non-blocking sockets until none are left, turn off
+            Nagle's algorithm for TCP, and watch each for input.
+    Reference: Linux accept4(2)
+    ********************************************************************* */
+    void acceptConnections(EventLoop& loop);
+
+    /* *********************************************************************
+    Function Name: readConnection
+    Purpose: Reads what a client has sent and answers it.
+    Parameters:
+            loop, an integer. The connection's loop.
+            connection, a Connection passed by reference.
+    Return Value: None
+    Algorithm: Read until the socket is empty, then pass the input to
+            handleInput(). Close the connection when the client has.
+    Reference: None
+    ********************************************************************* */
+    void readConnection(int loop, Connection& connection);
+
+    /* *********************************************************************
+    Function Name: applyResults
+    Purpose: Applies the Computer moves the workers have chosen for a
+            loop's sessions.
+    Parameters:
+            loop, an integer. The loop's index.
+    Return Value: None
+    Algorithm: Clear the eventfd, take the results, and apply each to
+            its session if the connection is still open; then go on with
+            the lines that waited for it.
+    Reference: None
+    ********************************************************************* */
+    void applyResults(int loop);
+
+    /* *********************************************************************
+    Function Name: handleInput
+    Purpose: Feeds a connection's complete lines to its session.
+    Parameters:
+            loop, an integer. The connection's loop.
+            connection, a Connection passed by reference.
+    Return Value: None
+    Algorithm:
+            1. Until the session waits for the Computer or is closing,
+                pass each complete line to handleMessage(), restoring a
+                parked session first. Answer "resume" here, and name
+                the session before its first "new" if there is a
+                store. Queue a job once it waits for the Computer.
+            2. Drop the lines used. A partial line longer than MAX_LINE
+                closes the connection.
+            3. Mark the session used, parking others past MAX_RESIDENT,
+                and send the replies with flush().
+    Reference: None
+    ********************************************************************* */
+    void handleInput(int loop, Connection& connection);
+
+    /* *********************************************************************
+    Function Name: resume
+    Purpose: Answers "resume <id>": swaps the connection's session for
+            one parked in the store.
+    Parameters:
+            loop, an EventLoop passed by reference. The connection's loop.
+            connection, a Connection passed by reference.
+            arguments, a std::string_view. The session id.
+    Return Value: None
+    Algorithm: Take the session from the store, or reply "error" and
+            keep the current one. Park the current session, adopt the
+            resumed one and describe it after a "session" line.
+    Reference: None
+    ********************************************************************* */
+    void resume(EventLoop& loop, Connection& connection, std::string_view arguments);
+
+    /* *********************************************************************
+    Function Name: restore / park
+    Purpose: Bring a connection's parked session back into memory, and
+            set it aside again.
+    Parameters:
+            loop, an EventLoop passed by reference. The connection's loop.
+            connection, a Connection passed by reference.
+    Return Value: None
+    Algorithm:
+            1. To restore, read the session back from the store, or start
+                a fresh one, with an "error" line, if it has been resumed
+                elsewhere; a session never named starts fresh. Add it to
+                the resident list.
+            2. To park, write a named session to the store, drop it from
+                memory and the resident list, and give back the memory
+                of empty buffers. A session never named is only dropped,
+                as it has not begun.
+    Reference: None
+    ********************************************************************* */
+    void restore(EventLoop& loop, Connection& connection);
+    void park(EventLoop& loop, Connection& connection);
+
+    /* *********************************************************************
+    Function Name: touch
+    Purpose: Marks a connection's session as just used.
+    Parameters:
+            loop, an EventLoop passed by reference. The connection's loop.
+            connection, a Connection passed by reference. Its session is
+                resident.
+    Return Value: None
+    Algorithm: Move it to the back of the resident list with the time,
+            then park from the front, skipping sessions waiting for the
+            Computer, while the loop holds more than MAX_RESIDENT.
+    Reference: None
+    ********************************************************************* */
+    void touch(EventLoop& loop, Connection& connection);
+
+    /* *********************************************************************
+    Function Name: sweep
+    Purpose: Parks the sessions that have waited too long for their
+            Humans.
+    Parameters:
+            loop, an EventLoop passed by reference.
+    Return Value: None
+    Algorithm: From the front of the resident list, park each session
+            unused for IDLE_SECONDS, stopping at the first used since;
+            one waiting for the Computer is only marked used.
+    Reference: None
+    ********************************************************************* */
+    void sweep(EventLoop& loop);
+
+    /* *********************************************************************
+    Function Name: flush
+    Purpose: Sends a connection's replies.
+    Parameters:
+            loop, an EventLoop passed by reference. The connection's loop.
+            connection, a Connection passed by reference. Closed, and no
+                longer valid, if sending fails or it is closing and has
+                nothing left to send.
+    Return Value: None
+    Algorithm: Send until the output is empty or the socket is full.
+            Watch for the socket becoming writable only while output is
+            left.
+    Reference: None
+    ********************************************************************* */
+    void flush(EventLoop& loop, Connection& connection);
+
+    /* *********************************************************************
+    Function Name: close
+    Purpose: Ends a connection and its session.
+    Parameters:
+            loop, an EventLoop passed by reference. The connection's loop.
+            connection, a Connection passed by reference. No longer valid
+                afterwards.
+    Return Value: None
+    Algorithm: Stop watching the socket, close it and drop the
+            connection, parking a named session so it can be resumed. A
+            move still being chosen for it is dropped when it arrives,
+            and chosen again once the session is resumed.
+    Reference: None
+    ********************************************************************* */
+    void close(EventLoop& loop, Connection& connection);
+};
+
+#endif
\ No newline at end of file
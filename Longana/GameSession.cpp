@@ -0,0 +1,444 @@
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <charconv>
+#include <cstring>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include "GameSession.h"
+#include "Round.h"
+#include "Serializer.h"
+
+/* *********************************************************************
+Function Name: GameSession
+Purpose: Default constructor. No tournament has started.
+Parameters: None
+Return Value: None
+Algorithm: Wait for "new", with nothing drawn.
+Reference: None
+********************************************************************* */
+GameSession::GameSession()
+    : m_game(), m_state(AWAITING_NEW), m_hasDrawn(false)
+{
+}
+
+/* *********************************************************************
+Function Name: encode
+Purpose: Encodes the whole session into SNAPSHOT_SIZE bytes, so that it
+        can be set aside and restored with decode().
+Parameters:
+        out, a pointer to at least SNAPSHOT_SIZE bytes of storage.
+Return Value: None
+Algorithm: Write the state and flags, then the tournament's binary
+        snapshot.
+Reference: None
+********************************************************************* */
+void GameSession::encode(unsigned char* out) const {
+    std::memset(out, 0, 4);
+    out[0] = static_cast<unsigned char>(m_state);
+    out[1] = static_cast<unsigned char>(m_hasDrawn ? 1 : 0);
+    Serializer::encodeBinary(m_game, out + 4);
+}
+
+/* *********************************************************************
+Function Name: handleMessage
+Purpose: Carries out one message from the Human.
+Parameters:
+        line, a std::string_view. The message, without its newline.
+        outReply, a string passed by reference. The reply is
+            appended to it.
+Return Value: Boolean false for "quit"; true otherwise.
+Algorithm:
+        1. Split off the first word.
+        2. Answer "state" and "quit" at any time and "new" whenever
+            no Computer turn is pending; accept the Human's moves
+            only on the Human's turn and "next" only between rounds.
+        3. Reply "error" to anything else, then describe the
+            position.
+Reference: None
+********************************************************************* */
+bool GameSession::handleMessage(std::string_view line, std::string& outReply) {
+    // 1. The command, without a carriage return from a Windows client
+    if (!line.empty() && line.back() == '\r') {
+        line.remove_suffix(1);
+    }
+    size_t space = line.find(' ');
+    std::string_view command = line.substr(0, space);
+    std::string_view arguments = (space == std::string_view::npos) ? std::string_view() : line.substr(space + 1);
+
+    // 2. The commands each state accepts
+    if (command == "quit") {
+        return false;
+    }
+    if (command == "state") {
+        describe(outReply);
+        return true;
+    }
+
+    if (command == "new" && m_state != AWAITING_COMPUTER) {
+        int target = 0;
+        std::from_chars_result result = std::from_chars(arguments.data(), arguments.data() + arguments.size(), target);
+        if (result.ec == std::errc() && result.ptr == arguments.data() + arguments.size() && target > 0) {
+            m_game.setTargetScore(target);
+            m_game.setRoundNumber(1);
+            m_game.setHumanScore(0);
+            m_game.setComputerScore(0);
+            startRound(outReply);
+            return true;
+        }
+        outReply += "error The target must be a positive integer.\n";
+    }
+    else if ((command == "play" || command == "draw" || command == "pass") && m_state == AWAITING_HUMAN) {
+        if (applyHumanMove(command, arguments, outReply)) {
+            return true;
+        }
+    }
+    else if (command == "next" && m_state == AWAITING_NEXT) {
+        m_game.setRoundNumber(m_game.getRoundNumber() + 1);
+        startRound(outReply);
+        return true;
+    }
+    // 3. Anything else
+    else {
+        outReply += "error Unexpected message: ";
+        outReply += line;
+        outReply += '\n';
+    }
+
+    describe(outReply);
+    return true;
+}
+
+/* *********************************************************************
+Function Name: decode
+Purpose: Restores a session from a snapshot made by encode().
+Parameters:
+        data, a pointer to SNAPSHOT_SIZE bytes.
+Return Value: Boolean true if the snapshot was valid; otherwise the
+        session is unchanged.
+Algorithm:
+        1. Check the state. A session waiting for "new" needs no
+            tournament.
+        2. Otherwise decode the tournament, and carry its target and
+            scores into the round, as startRound() does.
+Reference: None
+********************************************************************* */
+bool GameSession::decode(const unsigned char* data) {
+    // 1. The state
+    int state = data[0];
+    if (state < AWAITING_NEW || state > AWAITING_NEXT || data[1] > 1) {
+        return false;
+    }
+    if (state == AWAITING_NEW) {
+        m_state = AWAITING_NEW;
+        m_hasDrawn = false;
+        return true;
+    }
+
+    // 2. The tournament, which decodeBinary() leaves alone if the snapshot is bad
+    if (!Serializer::decodeBinary(data + 4, Serializer::BINARY_SIZE, m_game)) {
+        return false;
+    }
+
+    Round& round = m_game.getCurrentRound();
+    round.setTargetScore(m_game.getTargetScore());
+    round.setScores(m_game.getHumanScore(), m_game.getComputerScore());
+
+    m_state = state;
+    m_hasDrawn = data[1] != 0;
+    return true;
+}
+
+/* *********************************************************************
+Function Name: applyComputerMove
+Purpose: Makes the Computer's turn once it has been chosen.
+Parameters:
+        move, a ComputerMove passed by const reference. The turn,
+            chosen in the position from loadComputerTurn().
+        outReply, a string passed by reference. The reply is
+            appended to it.
+Return Value: None
+Algorithm: Draw if the move did, then play the tile or pass, and
+        finish the turn as for the Human's moves.
+Reference: None
+********************************************************************* */
+void GameSession::applyComputerMove(const ComputerMove& move, std::string& outReply) {
+    Round& round = m_game.getCurrentRound();
+
+    if (move.hasDrawn) {
+        Tile drawn;
+        round.applyDraw(false, drawn);
+        outReply += "draw computer\n";
+    }
+
+    if (move.hasMove && round.applyPlay(false, move.tile, move.side)) {
+        outReply += "play computer " + move.tile.toString() + " " + move.side + "\n";
+    }
+    else {
+        round.applyPass(false);
+        outReply += "pass computer\n";
+    }
+
+    finishTurn(outReply);
+    describe(outReply);
+}
+
+/* *********************************************************************
+Function Name: chooseComputerMove
+Purpose: Chooses the Computer's whole turn in a position, as
+        Round::playStrategyTurn() does, without touching a session.
+        Safe to call on any thread with its own strategy.
+Parameters:
+        strategy, a pointer to a ComputerStrategy, or nullptr for the
+            first-fit rule.
+        position, a Playout passed by const reference. The position
+            from loadComputerTurn().
+        outMove, a ComputerMove passed by reference. Receives the
+            turn.
+Return Value: None
+Algorithm:
+        1. Ask the strategy for a move.
+        2. If no tile fits and the boneyard is not empty, draw the
+            top tile in a copy of the position and ask again.
+        3. Record the tile and the end of the layout its arm is on.
+Reference: None
+********************************************************************* */
+void GameSession::chooseComputerMove(ComputerStrategy* strategy, const Playout& position, ComputerMove& outMove) {
+    auto choose = [strategy](const Playout& from, int& index, int& arm) {
+        return (strategy != nullptr) ? strategy->chooseMove(from, index, arm) : from.chooseMove(index, arm);
+    };
+
+    // 1. A tile from the hand
+    int index = 0;
+    int arm = Playout::COMPUTER;
+    outMove.hasDrawn = false;
+    outMove.hasMove = choose(position, index, arm);
+    if (outMove.hasMove) {
+        outMove.tile = position.getHandTile(Playout::COMPUTER, index);
+        outMove.side = (arm == Playout::COMPUTER) ? 'R' : 'L';
+        return;
+    }
+
+    // 2. The drawn tile, if there is one
+    if (position.getBoneyardSize() > 0) {
+        Playout drawn = position;
+        Playout::UndoStack stack;
+        drawn.makeDraw(stack);
+
+        outMove.hasDrawn = true;
+        outMove.hasMove = choose(drawn, index, arm);
+        if (outMove.hasMove) {
+            // 3. Where it goes
+            outMove.tile = drawn.getHandTile(Playout::COMPUTER, index);
+            outMove.side = (arm == Playout::COMPUTER) ? 'R' : 'L';
+        }
+    }
+}
+
+/* *********************************************************************
+Function Name: startRound
+Purpose: Deals the tournament's current round from a fresh seed.
+Parameters:
+        outReply, a string passed by reference. The reply is
+            appended to it.
+Return Value: None
+Algorithm: Carry the target and scores into the round, deal it with
+        Round::dealRound(), announce it and finish the turn, in case
+        the round is already decided.
+Reference: None
+********************************************************************* */
+void GameSession::startRound(std::string& outReply) {
+    Round& round = m_game.getCurrentRound();
+    round.setTargetScore(m_game.getTargetScore());
+    round.setScores(m_game.getHumanScore(), m_game.getComputerScore());
+    round.dealRound(m_game.getRoundNumber(), std::random_device{}());
+    m_hasDrawn = false;
+
+    int engine = round.getEngineValue();
+    outReply += "round " + std::to_string(m_game.getRoundNumber()) + " engine " + std::to_string(engine) + "-"
+        + std::to_string(engine) + " target " + std::to_string(m_game.getTargetScore()) + " score "
+        + std::to_string(m_game.getHumanScore()) + " " + std::to_string(m_game.getComputerScore()) + "\n";
+
+    finishTurn(outReply);
+    describe(outReply);
+}
+
+/* *********************************************************************
+Function Name: applyHumanMove
+Purpose: Checks and makes a play, draw or pass for the Human.
+Parameters:
+        command, a std::string_view: "play", "draw" or "pass".
+        arguments, a std::string_view. For "play", the tile as a-b and
+            the side, L or R.
+        outReply, a string passed by reference. The reply is
+            appended to it.
+Return Value: Boolean true if the move was legal and made.
+Algorithm:
+        1. A play must be of a held tile (the drawn one, after a
+            draw) that Round::canHumanPlay() allows on that end.
+        2. A draw needs Round::hasHumanPlay() to find no tile and a
+            boneyard to draw from; if the drawn tile does not fit
+            either, the Human passes.
+        3. A pass needs no tile to fit and an empty boneyard.
+        4. Echo the move and finish the turn.
+Reference: None
+********************************************************************* */
+bool GameSession::applyHumanMove(std::string_view command, std::string_view arguments, std::string& outReply) {
+    Round& round = m_game.getCurrentRound();
+    const Hand& hand = round.getHumanHand();
+
+    // 1. A play, "a-b L"
+    if (command == "play") {
+        Tile tile;
+        if (arguments.size() < 3 || arguments[arguments.size() - 2] != ' '
+            || !Tile::fromString(arguments.substr(0, arguments.size() - 2), tile)) {
+            outReply += "error Play a tile as a-b L or a-b R.\n";
+            return false;
+        }
+
+        char side = arguments.back();
+        if (m_hasDrawn && !(hand.getTileAtIndex(hand.getSize() - 1) == tile)) {
+            outReply += "error You must play the tile you drew.\n";
+            return false;
+        }
+        if (side != 'L' && side != 'R') {
+            outReply += "error The side must be L or R.\n";
+            return false;
+        }
+        if (!round.canHumanPlay(tile, side) || !round.applyPlay(true, tile, side)) {
+            outReply += "error That tile cannot be played there.\n";
+            return false;
+        }
+
+        outReply += "play human " + tile.toString() + " " + side + "\n";
+    }
+    // 2. A draw, and the pass if the drawn tile does not fit
+    else if (command == "draw") {
+        if (m_hasDrawn || round.hasHumanPlay() || round.getStock().isEmpty()) {
+            outReply += m_hasDrawn ? "error You have already drawn.\n"
+                : round.hasHumanPlay() ? "error You have a tile that fits.\n" : "error The boneyard is empty.\n";
+            return false;
+        }
+
+        Tile drawn;
+        round.applyDraw(true, drawn);
+        outReply += "draw human " + drawn.toString() + "\n";
+
+        if (round.canHumanPlay(drawn, 'L') || round.canHumanPlay(drawn, 'R')) {
+            m_hasDrawn = true;
+            describe(outReply);
+            return true;
+        }
+        round.applyPass(true);
+        outReply += "pass human\n";
+    }
+    // 3. A pass
+    else {
+        if (round.hasHumanPlay() || !round.getStock().isEmpty()) {
+            outReply += round.hasHumanPlay() ? "error You have a tile that fits.\n" : "error Draw from the boneyard first.\n";
+            return false;
+        }
+
+        round.applyPass(true);
+        outReply += "pass human\n";
+    }
+
+    // 4. The turn is over
+    m_hasDrawn = false;
+    finishTurn(outReply);
+    describe(outReply);
+    return true;
+}
+
+/* *********************************************************************
+Function Name: finishTurn
+Purpose: Works out what the session waits for after a move.
+Parameters:
+        outReply, a string passed by reference. The reply is
+            appended to it.
+Return Value: None
+Algorithm:
+        1. Score the round with Round::scoreRound(). If it is over,
+            carry the scores to the tournament and announce them,
+            and the winner if the target has been reached.
+        2. Otherwise wait for whoever's turn it is.
+Reference: None
+********************************************************************* */
+void GameSession::finishTurn(std::string& outReply) {
+    Round& round = m_game.getCurrentRound();
+
+    // 1. The end of the round
+    int humanPoints = 0;
+    int computerPoints = 0;
+    if (round.scoreRound(humanPoints, computerPoints)) {
+        m_game.setHumanScore(round.getHumanScore());
+        m_game.setComputerScore(round.getComputerScore());
+
+        int human = m_game.getHumanScore();
+        int computer = m_game.getComputerScore();
+        int target = m_game.getTargetScore();
+        outReply += std::string("roundover ") + ((humanPoints > 0) ? "human " : (computerPoints > 0) ? "computer " : "tie ")
+            + std::to_string(humanPoints + computerPoints) + " score " + std::to_string(human) + " "
+            + std::to_string(computer) + "\n";
+
+        if (human >= target || computer >= target) {
+            outReply += std::string("gameover ") + ((human > computer) ? "human" : (computer > human) ? "computer" : "draw")
+                + " score " + std::to_string(human) + " " + std::to_string(computer) + "\n";
+            m_state = AWAITING_NEW;
+        }
+        else {
+            m_state = AWAITING_NEXT;
+        }
+        return;
+    }
+
+    // 2. The next turn
+    m_state = round.isHumanTurn() ? AWAITING_HUMAN : AWAITING_COMPUTER;
+}
+
+/* *********************************************************************
+Function Name: describe
+Purpose: Appends what the Human needs to see and the line saying
+        what the session waits for.
+Parameters:
+        outReply, a string passed by reference. The reply is
+            appended to it.
+Return Value: None
+Algorithm: On the Human's turn, list their hand, the layout, the
+        boneyard's size, the Computer's hand size and whether it
+        passed. Then append "await" and the state, or nothing while
+        the Computer is to move.
+Reference: None
+********************************************************************* */
+void GameSession::describe(std::string& outReply) const {
+    const Round& round = m_game.getCurrentRound();
+
+    switch (m_state) {
+    case AWAITING_HUMAN: {
+        std::string hand = round.getHumanHand().toString();
+        if (!hand.empty() && hand.back() == ' ') {
+            hand.pop_back();
+        }
+
+        outReply += "hand " + hand + "\nlayout " + round.getLayout().toString() + "\nboneyard "
+            + std::to_string(round.getStock().getSize()) + " computer "
+            + std::to_string(round.getComputerHand().getSize()) + " passed "
+            + (round.getComputerPassed() ? "yes" : "no") + "\nawait move\n";
+        break;
+    }
+    case AWAITING_NEXT:
+        outReply += "await next\n";
+        break;
+    case AWAITING_NEW:
+        outReply += "await new\n";
+        break;
+    default:
+        break;
+    }
+}
\ No newline at end of file
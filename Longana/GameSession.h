@@ -0,0 +1,298 @@
+#ifndef GAMESESSION_H
+#define GAMESESSION_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <string>
+#include <string_view>
+
+#include "ComputerStrategy.h"
+#include "Playout.h"
+#include "Serializer.h"
+#include "Tile.h"
+#include "Tournament.h"
+
+/* *********************************************************************
+Class Name: GameSession
+Purpose: One tournament between a remote Human and the Computer, played
+        by messages instead of the console. Nothing blocks: each message
+        advances the session and appends its reply to a string, and the
+        session says what it waits for next. The Computer's turns are
+        handed out as positions, so whoever drives the session can choose
+        them on another thread and apply the result later.
+
+        The Human sends one line at a time:
+            new <target>            starts a tournament to that score
+            play <a-b> <L|R>        plays a tile on an end of the layout
+            draw                    draws, when no tile fits
+            pass                    passes, when no tile fits and the
+                                    boneyard is empty
+            next                    starts the next round
+            state                   describes the position again
+            quit                    ends the session
+        The replies are lines that begin with a keyword: "round", "hand",
+        "layout", "boneyard", "play", "draw", "pass", "roundover",
+        "gameover" and "error". Every reply ends with "await move",
+        "await next" or "await new", except while the Computer is to
+        move; its turn ends with the same line once it is applied. The
+        rules are the console's, checked by the same Human::canPlay() and
+        Human::hasPlayableTile(): the Human plays on the left unless the
+        tile is a double or the Computer passed, and a drawn tile that
+        fits must be played.
+********************************************************************* */
+class GameSession {
+public:
+
+    // What the session waits for
+    static const int AWAITING_NEW = 0;
+    static const int AWAITING_HUMAN = 1;
+    static const int AWAITING_COMPUTER = 2;
+    static const int AWAITING_NEXT = 3;
+
+    // Size in bytes of a session snapshot: the state, then the tournament's binary snapshot
+    static const int SNAPSHOT_SIZE = 4 + Serializer::BINARY_SIZE;
+
+    // The Computer's whole turn, chosen away from the session
+    struct ComputerMove {
+        bool hasDrawn;      // the top of the boneyard was drawn first
+        bool hasMove;       // a tile was played; otherwise the Computer passed
+        Tile tile;
+        char side;          // 'L' or 'R'
+    };
+
+    /* --- Constructor --- */
+
+    /* *********************************************************************
+    Function Name: GameSession
+    Purpose: Default constructor. No tournament has started.
+    Parameters: None
+    Return Value: None
+    Algorithm: Wait for "new", with nothing drawn.
+    Reference: None
+    ********************************************************************* */
+    GameSession();
+
+    /* --- Destructor --- */
+
+    /* *********************************************************************
+    Function Name: ~GameSession
+    Purpose: Destructor. The tournament cleans up after itself.
+    Parameters: None
+    Return Value: None
+    Algorithm: Standard object destruction.
+    Reference: None
+    ********************************************************************* */
+    ~GameSession() = default;
+
+    /* --- Selectors --- */
+
+    /* *********************************************************************
+    Function Name: getState
+    Purpose: Retrieves what the session waits for.
+    Parameters: None
+    Return Value: AWAITING_NEW, AWAITING_HUMAN, AWAITING_COMPUTER or
+            AWAITING_NEXT.
+    Algorithm: Return the stored state.
+    Reference: None
+    ********************************************************************* */
+    inline int getState() const { return m_state; }
+
+    /* *********************************************************************
+    Function Name: getTournament
+    Purpose: Retrieves the tournament being played.
+    Parameters: None
+    Return Value: A const reference to the Tournament.
+    Algorithm: Return the member.
+    Reference: None
+    ********************************************************************* */
+    inline const Tournament& getTournament() const { return m_game; }
+
+    /* *********************************************************************
+    Function Name: loadComputerTurn
+    Purpose: Copies the position the Computer must move in.
+    Parameters:
+            outPosition, a Playout passed by reference. Receives the
+                current round.
+    Return Value: None
+    Algorithm: Load the current round into the Playout.
+    Reference: None
+    ********************************************************************* */
+    inline void loadComputerTurn(Playout& outPosition) const { outPosition.loadRound(m_game.getCurrentRound()); }
+
+    /* *********************************************************************
+    Function Name: encode
+    Purpose: Encodes the whole session into SNAPSHOT_SIZE bytes, so that it
+            can be set aside and restored with decode().
+            Layout of the snapshot:
+                0  state (AWAITING_NEW to AWAITING_NEXT)
+                1  flags (1 = the Human has drawn this turn)
+                2  zero (16 bits)
+                4  the tournament (see Serializer::encodeBinary)
+    Parameters:
+            out, a pointer to at least SNAPSHOT_SIZE bytes of storage.
+    Return Value: None
+    Algorithm: Write the state and flags, then the tournament's binary
+            snapshot.
+    Reference: None
+    ********************************************************************* */
+    void encode(unsigned char* out) const;
+
+    /* --- Mutators --- */
+
+    /* *********************************************************************
+    Function Name: handleMessage
+    Purpose: Carries out one message from the Human.
+    Parameters:
+            line, a std::string_view. The message, without its newline.
+            outReply, a string passed by reference. The reply is
+                appended to it.
+    Return Value: Boolean false for "quit"; true otherwise.
+    Algorithm:
+            1. Split off the first word.
+            2. Answer "state" and "quit" at any time and "new" whenever
+                no Computer turn is pending; accept the Human's moves
+                only on the Human's turn and "next" only between rounds.
+            3. Reply "error" to anything else, then describe the
+                position.
+    Reference: None
+    ********************************************************************* */
+    bool handleMessage(std::string_view line, std::string& outReply);
+
+    /* *********************************************************************
+    Function Name: decode
+    Purpose: Restores a session from a snapshot made by encode().
+    Parameters:
+            data, a pointer to SNAPSHOT_SIZE bytes.
+    Return Value: Boolean true if the snapshot was valid; otherwise the
+            session is unchanged.
+    Algorithm:
+            1. Check the state. A session waiting for "new" needs no
+                tournament.
+            2. Otherwise decode the tournament, and carry its target and
+                scores into the round, as startRound() does.
+    Reference: None
+    ********************************************************************* */
+    bool decode(const unsigned char* data);
+
+    /* *********************************************************************
+    Function Name: applyComputerMove
+    Purpose: Makes the Computer's turn once it has been chosen.
+    Parameters:
+            move, a ComputerMove passed by const reference. The turn,
+                chosen in the position from loadComputerTurn().
+            outReply, a string passed by reference. The reply is
+                appended to it.
+    Return Value: None
+    Algorithm: Draw if the move did, then play the tile or pass, and
+            finish the turn as for the Human's moves.
+    Reference: None
+    ********************************************************************* */
+    void applyComputerMove(const ComputerMove& move, std::string& outReply);
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: chooseComputerMove
+    Purpose: Chooses the Computer's whole turn in a position, as
+            Round::playStrategyTurn() does, without touching a session.
+            Safe to call on any thread with its own strategy.
+    Parameters:
+            strategy, a pointer to a ComputerStrategy, or nullptr for the
+                first-fit rule.
+            position, a Playout passed by const reference. The position
+                from loadComputerTurn().
+            outMove, a ComputerMove passed by reference. Receives the
+                turn.
+    Return Value: None
+    Algorithm:
+            1. Ask the strategy for a move.
+            2. If no tile fits and the boneyard is not empty, draw the
+                top tile in a copy of the position and ask again.
+            3. Record the tile and the end of the layout its arm is on.
+    Reference: None
+    ********************************************************************* */
+    static void chooseComputerMove(ComputerStrategy* strategy, const Playout& position, ComputerMove& outMove);
+
+private:
+
+    Tournament m_game;
+    int m_state;
+
+    // Whether the Human has drawn this turn, and must play the drawn tile
+    bool m_hasDrawn;
+
+    /* *********************************************************************
+    Function Name: startRound
+    Purpose: Deals the tournament's current round from a fresh seed.
+    Parameters:
+            outReply, a string passed by reference. The reply is
+                appended to it.
+    Return Value: None
+    Algorithm: Carry the target and scores into the round, deal it with
+            Round::dealRound(), announce it and finish the turn, in case
+            the round is already decided.
+    Reference: None
+    ********************************************************************* */
+    void startRound(std::string& outReply);
+
+    /* *********************************************************************
+    Function Name: applyHumanMove
+    Purpose: Checks and makes a play, draw or pass for the Human.
+    Parameters:
+            command, a std::string_view: "play", "draw" or "pass".
+            arguments, a std::string_view. For "play", the tile as a-b and
+                the side, L or R.
+            outReply, a string passed by reference. The reply is
+                appended to it.
+    Return Value: Boolean true if the move was legal and made.
+    Algorithm:
+            1. A play must be of a held tile (the drawn one, after a
+                draw) that Round::canHumanPlay() allows on that end.
+            2. A draw needs Round::hasHumanPlay() to find no tile and a
+                boneyard to draw from; if the drawn tile does not fit
+                either, the Human passes.
+            3. A pass needs no tile to fit and an empty boneyard.
+            4. Echo the move and finish the turn.
+    Reference: None
+    ********************************************************************* */
+    bool applyHumanMove(std::string_view command, std::string_view arguments, std::string& outReply);
+
+    /* *********************************************************************
+    Function Name: finishTurn
+    Purpose: Works out what the session waits for after a move.
+    Parameters:
+            outReply, a string passed by reference. The reply is
+                appended to it.
+    Return Value: None
+    Algorithm:
+            1. Score the round with Round::scoreRound(). If it is over,
+                carry the scores to the tournament and announce them,
+                and the winner if the target has been reached.
+            2. Otherwise wait for whoever's turn it is.
+    Reference: None
+    ********************************************************************* */
+    void finishTurn(std::string& outReply);
+
+    /* *********************************************************************
+    Function Name: describe
+    Purpose: Appends what the Human needs to see and the line saying
+            what the session waits for.
+    Parameters:
+            outReply, a string passed by reference. The reply is
+                appended to it.
+    Return Value: None
+    Algorithm: On the Human's turn, list their hand, the layout, the
+            boneyard's size, the Computer's hand size and whether it
+            passed. Then append "await" and the state, or nothing while
+            the Computer is to move.
+    Reference: None
+    ********************************************************************* */
+    void describe(std::string& outReply) const;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,49 @@
+#ifndef GREEDYSTRATEGY_H
+#define GREEDYSTRATEGY_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+template <int MaxPips>
+class BasicPlayout;
+
+/* *********************************************************************
+Class Name: GreedyStrategy
+Purpose: The Computer's first-fit strategy as a playout policy: the first
+        tile in hand order that fits the mover's own arm, otherwise the
+        first that fits an arm the mover is allowed on. A policy is any
+        class with a chooseMove(table, outIndex, outArm) member, which
+        BasicPlayout::playTurn calls directly, so the choice is compiled
+        into the turn rather than dispatched through a virtual call like
+        ComputerStrategy::chooseMove. A policy must return true whenever the mover has
+        a legal move, since the rules do not allow passing then.
+********************************************************************* */
+class GreedyStrategy {
+public:
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: chooseMove
+    Purpose: Chooses the mover's move.
+    Parameters:
+            table, a BasicPlayout passed by const reference. The position.
+            outIndex, an integer passed by reference. Receives the position
+                of the chosen tile in the mover's hand.
+            outArm, an integer passed by reference. Receives the player
+                number of the arm to play on.
+    Return Value: Boolean true if any tile can be played.
+    Algorithm: Return the table's own first-fit choice.
+    Reference: None
+    ********************************************************************* */
+    template <int MaxPips>
+    inline bool chooseMove(const BasicPlayout<MaxPips>& table, int& outIndex, int& outArm) const {
+        return table.chooseMove(outIndex, outArm);
+    }
+};
+
+#endif
\ No newline at end of file
@@ -6,8 +6,8 @@
  ************************************************************/
 
 #include <iostream>
-#include <sstream>
 #include <string>
+#include <string_view>
 
 #include "Hand.h"
 #include "Tile.h"
@@ -116,47 +116,25 @@ Function Name: loadFromString
 Purpose: Populates the hand by parsing a space-delimited string of tiles.
         Used primarily when loading a saved game state.
 Parameters:
-        data, a const std::string passed by reference. The raw string
+        data, a std::string_view passed by value. The raw characters
             containing tile data (e.g., "6-6 1-0 4-2").
-Return Value: None (void)
-Algorithm:
-        1. Clear any existing tiles from the m_tiles vector.
-        2. Wrap the input string in a std::stringstream for easy tokenization.
-        3. While there are tokens (individual tiles) in the stream:
-            a. Locate the position of the dash ('-') within the token.
-            b. If found, extract the substring before the dash as the 'left' value.
-            c. Extract the substring after the dash as the 'right' value.
-            d. Convert these substrings to integers using std::stoi.
-            e. Construct a new Tile object and push it into the m_tiles vector.
+        errorOffset, a size_t passed by reference. Receives the offset
+            within data of the first malformed token, if any.
+Return Value: Boolean true if every token was a valid tile, false otherwise.
+Algorithm: Parse the view into the m_tiles vector with
+        Tile::listFromString, which clears it first.
 Reference: None
 ********************************************************************* */
-void Hand::loadFromString(const std::string& data) {
-    // Empty the hand to prepare for new data from the save file
-    m_tiles.clear();
-
-    // Use stringstream to split the string into individual "6-6" tokens
-    std::stringstream ss(data);
-    std::string token;
-
-    while (ss >> token) {
-        size_t dashPos = token.find("-");
-
-        // If there exists a dashPos, execute
-        if (dashPos != std::string::npos) {
-            // Extract substrings and convert to integers
-            int left = std::stoi(token.substr(0, dashPos));
-            int right = std::stoi(token.substr(dashPos + 1));
-
-            // Create the Tile and store it in the hand
-            m_tiles.push_back(Tile(left, right));
-        }
-    }
+bool Hand::loadFromString(std::string_view data, size_t& errorOffset) {
+    // Replace the hand with the tiles from the save file
+    return Tile::listFromString(data, false, m_tiles, errorOffset);
 }
 
 /* *********************************************************************
 Function Name: displayHand
-Purpose: Prints the contents of the hand to the standard output.
-Parameters: None
+Purpose: Prints the contents of the hand to a stream.
+Parameters:
+        out, an ostream passed by reference. Usually std::cout.
 Return Value: None (void)
 Algorithm:
         1. Iterate through each tile in the hand.
@@ -164,12 +142,12 @@ Algorithm:
         3. Print a newline at the end of the list.
 Reference: None
 ********************************************************************* */
-void Hand::displayHand() const {
+void Hand::displayHand(std::ostream& out) const {
     // Display each tile in the hand separated by spaces
     for (const Tile& tile : m_tiles) {
-        std::cout << tile.getLeftPips() << "-" << tile.getRightPips() << " ";
+        out << tile.getLeftPips() << "-" << tile.getRightPips() << " ";
     }
 
     // End the line after all tiles are displayed
-    std::cout << std::endl;
+    out << std::endl;
 }
\ No newline at end of file
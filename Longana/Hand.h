@@ -8,7 +8,9 @@
  * Date:  02/12/2026                                        *
  ************************************************************/
 
+#include <ostream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "Tile.h"
@@ -165,26 +167,22 @@ public:
     Purpose: Populates the hand by parsing a space-delimited string of tiles.
             Used primarily when loading a saved game state.
     Parameters:
-            data, a const std::string passed by reference. The raw string
+            data, a std::string_view passed by value. The raw characters
                 containing tile data (e.g., "6-6 1-0 4-2").
-    Return Value: None (void)
-    Algorithm:
-            1. Clear any existing tiles from the m_tiles vector.
-            2. Wrap the input string in a std::stringstream for easy tokenization.
-            3. While there are tokens (individual tiles) in the stream:
-                a. Locate the position of the dash ('-') within the token.
-                b. If found, extract the substring before the dash as the 'left' value.
-                c. Extract the substring after the dash as the 'right' value.
-                d. Convert these substrings to integers using std::stoi.
-                e. Construct a new Tile object and push it into the m_tiles vector.
+            errorOffset, a size_t passed by reference. Receives the offset
+                within data of the first malformed token, if any.
+    Return Value: Boolean true if every token was a valid tile, false otherwise.
+    Algorithm: Parse the view into the m_tiles vector with
+            Tile::listFromString, which clears it first.
     Reference: None
     ********************************************************************* */
-    void loadFromString(const std::string& data);
+    bool loadFromString(std::string_view data, size_t& errorOffset);
 
     /* *********************************************************************
     Function Name: displayHand
-    Purpose: Prints the contents of the hand to the standard output.
-    Parameters: None
+    Purpose: Prints the contents of the hand to a stream.
+    Parameters:
+            out, an ostream passed by reference. Usually std::cout.
     Return Value: None (void)
     Algorithm:
             1. Iterate through each tile in the hand.
@@ -192,7 +190,7 @@ public:
             3. Print a newline at the end of the list.
     Reference: None
     ********************************************************************* */
-    void displayHand() const;
+    void displayHand(std::ostream& out) const;
 
 private:
     // A dynamic array (vector) storing the collection of Tile objects
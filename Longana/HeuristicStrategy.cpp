@@ -0,0 +1,111 @@
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <random>
+#include <string>
+
+#include "HeuristicStrategy.h"
+#include "RandomStrategy.h"
+
+/* *********************************************************************
+Function Name: HeuristicStrategy
+Purpose: Default constructor. Plays first-fit.
+Parameters: None
+Return Value: None
+Algorithm: Set the rule and clear the last move.
+Reference: None
+********************************************************************* */
+HeuristicStrategy::HeuristicStrategy()
+    : m_rule(RULE_FIRST_FIT), m_weighted(), m_generator(), m_isOwnArm(false), m_pips(0), m_isDouble(false)
+{
+}
+
+/* *********************************************************************
+Function Name: HeuristicStrategy
+Purpose: Constructor. Plays by weighted features.
+Parameters:
+        weighted, a WeightedStrategy passed by const reference. The
+            weights to play by.
+Return Value: None
+Algorithm: Copy the strategy, set the rule and clear the last move.
+Reference: None
+********************************************************************* */
+HeuristicStrategy::HeuristicStrategy(const WeightedStrategy& weighted)
+    : m_rule(RULE_WEIGHTED), m_weighted(weighted), m_generator(), m_isOwnArm(false), m_pips(0), m_isDouble(false)
+{
+}
+
+/* *********************************************************************
+Function Name: HeuristicStrategy
+Purpose: Constructor. Plays a random legal move.
+Parameters:
+        seed, an unsigned integer. Seeds the strategy's generator.
+Return Value: None
+Algorithm: Seed the generator, set the rule and clear the last move.
+Reference: None
+********************************************************************* */
+HeuristicStrategy::HeuristicStrategy(unsigned int seed)
+    : m_rule(RULE_RANDOM), m_weighted(), m_generator(seed), m_isOwnArm(false), m_pips(0), m_isDouble(false)
+{
+}
+
+/* *********************************************************************
+Function Name: chooseMove
+Purpose: Chooses the mover's move by the rule.
+Parameters:
+        position, outIndex, outArm. As for ComputerStrategy.
+Return Value: Boolean true if any tile can be played.
+Algorithm: Ask the WeightedStrategy, a RandomStrategy or the position's
+        own first-fit choice, and remember the tile and arm for
+        getReason().
+Reference: None
+********************************************************************* */
+bool HeuristicStrategy::chooseMove(const Playout& position, int& outIndex, int& outArm) {
+    bool hasMove = false;
+    if (m_rule == RULE_WEIGHTED) {
+        hasMove = m_weighted.chooseMove(position, outIndex, outArm);
+    }
+    else if (m_rule == RULE_RANDOM) {
+        RandomStrategy random(m_generator);
+        hasMove = random.chooseMove(position, outIndex, outArm);
+    }
+    else {
+        hasMove = position.chooseMove(outIndex, outArm);
+    }
+
+    if (hasMove) {
+        unsigned char packed = position.getHandPacked(position.getMover(), outIndex);
+        m_isOwnArm = (outArm == position.getMover());
+        m_pips = (packed & 0x0F) + (packed >> 4);
+        m_isDouble = (packed & 0x0F) == (packed >> 4);
+    }
+    return hasMove;
+}
+
+/* *********************************************************************
+Function Name: getReason
+Purpose: Explains the last move chosen.
+Parameters: None
+Return Value: For first-fit, whether the tile went on the Computer's
+        own side, which it prefers; for weighted features, the pips
+        the tile sheds; for a random move, that it was random.
+Algorithm: Describe the remembered move.
+Reference: None
+********************************************************************* */
+std::string HeuristicStrategy::getReason() const {
+    if (m_rule == RULE_RANDOM) {
+        return "The Computer plays a legal move chosen at random.";
+    }
+    if (m_rule == RULE_FIRST_FIT) {
+        return m_isOwnArm ? "Computer prioritizes its own side."
+            : "No moves are available on its own side, however they are available on\n"
+            "\tthe Human's side. And a move is better than no move.";
+    }
+
+    return "Of its moves, this one scores highest on the weighted heuristic; it sheds "
+        + std::to_string(m_pips) + " pips" + (m_isDouble ? " and is a double." : ".");
+}
\ No newline at end of file
@@ -0,0 +1,122 @@
+#ifndef HEURISTICSTRATEGY_H
+#define HEURISTICSTRATEGY_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <random>
+#include <string>
+
+#include "ComputerStrategy.h"
+#include "WeightedStrategy.h"
+
+/* *********************************************************************
+Class Name: HeuristicStrategy
+Purpose: A ComputerStrategy that decides at once by a fixed rule: the
+        first-fit rule of the Computer (registered as "greedy"), the
+        highest score of a WeightedStrategy ("heaviest" with its default
+        weights, "weighted" with tuned ones), or a random legal move
+        ("random"). Since each rule is also a playout policy, programs that
+        play many rounds can ask for the rule and play it directly.
+********************************************************************* */
+class HeuristicStrategy : public ComputerStrategy {
+public:
+
+    // The rules
+    static const int RULE_FIRST_FIT = 0;
+    static const int RULE_WEIGHTED = 1;
+    static const int RULE_RANDOM = 2;
+
+    /* --- Constructor --- */
+
+    /* *********************************************************************
+    Function Name: HeuristicStrategy
+    Purpose: Default constructor. Plays first-fit.
+    Parameters: None
+    Return Value: None
+    Algorithm: Set the rule and clear the last move.
+    Reference: None
+    ********************************************************************* */
+    HeuristicStrategy();
+
+    /* *********************************************************************
+    Function Name: HeuristicStrategy
+    Purpose: Constructor. Plays by weighted features.
+    Parameters:
+            weighted, a WeightedStrategy passed by const reference. The
+                weights to play by.
+    Return Value: None
+    Algorithm: Copy the strategy, set the rule and clear the last move.
+    Reference: None
+    ********************************************************************* */
+    explicit HeuristicStrategy(const WeightedStrategy& weighted);
+
+    /* *********************************************************************
+    Function Name: HeuristicStrategy
+    Purpose: Constructor. Plays a random legal move.
+    Parameters:
+            seed, an unsigned integer. Seeds the strategy's generator.
+    Return Value: None
+    Algorithm: Seed the generator, set the rule and clear the last move.
+    Reference: None
+    ********************************************************************* */
+    explicit HeuristicStrategy(unsigned int seed);
+
+    /* --- Selectors --- */
+
+    /* *********************************************************************
+    Function Name: getRule / getWeighted
+    Purpose: Retrieve the rule, and the weights it plays by if it is
+            RULE_WEIGHTED.
+    Parameters: None
+    Return Value: RULE_FIRST_FIT, RULE_WEIGHTED or RULE_RANDOM. / The
+            WeightedStrategy.
+    Algorithm: Return the stored values.
+    Reference: None
+    ********************************************************************* */
+    inline int getRule() const { return m_rule; }
+    inline const WeightedStrategy& getWeighted() const { return m_weighted; }
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: chooseMove
+    Purpose: Chooses the mover's move by the rule.
+    Parameters:
+            position, outIndex, outArm. As for ComputerStrategy.
+    Return Value: Boolean true if any tile can be played.
+    Algorithm: Ask the WeightedStrategy, a RandomStrategy or the position's
+            own first-fit choice, and remember the tile and arm for
+            getReason().
+    Reference: None
+    ********************************************************************* */
+    bool chooseMove(const Playout& position, int& outIndex, int& outArm) override;
+
+    /* *********************************************************************
+    Function Name: getReason
+    Purpose: Explains the last move chosen.
+    Parameters: None
+    Return Value: For first-fit, whether the tile went on the Computer's
+            own side, which it prefers; for weighted features, the pips
+            the tile sheds; for a random move, that it was random.
+    Algorithm: Describe the remembered move.
+    Reference: None
+    ********************************************************************* */
+    std::string getReason() const override;
+
+private:
+    int m_rule;
+    WeightedStrategy m_weighted;
+    std::mt19937 m_generator;
+
+    // The last move chosen
+    bool m_isOwnArm;
+    int m_pips;
+    bool m_isDouble;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,268 @@
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "GreedyStrategy.h"
+#include "HeuristicTuner.h"
+#include "Playout.h"
+
+/* *********************************************************************
+Function Name: HeuristicTuner
+Purpose: Default constructor. Starts from the heaviest-tile weights.
+Parameters: None
+Return Value: None
+Algorithm: Copy WeightedStrategy's default weights and zero the
+        iteration, seed and score.
+Reference: None
+********************************************************************* */
+HeuristicTuner::HeuristicTuner()
+    : m_weights(), m_iteration(0), m_seed(0), m_score(0.0)
+{
+    WeightedStrategy defaults;
+    for (int i = 0; i < WeightedStrategy::WEIGHT_COUNT; ++i) {
+        m_weights[i] = defaults.getWeight(i);
+    }
+}
+
+/* *********************************************************************
+Function Name: load / save
+Purpose: Read or write a checkpoint: the iteration, the seed and the
+        weights, as text.
+Parameters:
+        filename, a string representing the checkpoint path.
+Return Value: Boolean true on success; false, with an error message,
+        if the file could not be read or written.
+Algorithm:
+        load: read each labelled line and check that every weight was
+            found, keeping the tuner unchanged otherwise.
+        save: write to a temporary file beside the checkpoint, then
+            rename it over the checkpoint, so a run stopped while
+            saving keeps the previous checkpoint whole.
+Reference: None
+********************************************************************* */
+bool HeuristicTuner::load(const std::string& filename) {
+    std::ifstream inFile(filename);
+    if (!inFile.is_open()) {
+        std::cerr << "Error: Could not open checkpoint: " << filename << std::endl;
+        return false;
+    }
+
+    std::string label;
+    int iteration = -1;
+    unsigned int seed = 0;
+    double weights[WeightedStrategy::WEIGHT_COUNT];
+    int weightCount = 0;
+
+    while (inFile >> label) {
+        if (label == "Iteration:") {
+            inFile >> iteration;
+        }
+        else if (label == "Seed:") {
+            inFile >> seed;
+        }
+        else if (label == "Weights:") {
+            while (weightCount < WeightedStrategy::WEIGHT_COUNT && inFile >> weights[weightCount]) {
+                ++weightCount;
+            }
+        }
+    }
+
+    if (iteration < 0 || weightCount != WeightedStrategy::WEIGHT_COUNT) {
+        std::cerr << "Error: Checkpoint is incomplete: " << filename << std::endl;
+        return false;
+    }
+
+    m_iteration = iteration;
+    m_seed = seed;
+    for (int i = 0; i < WeightedStrategy::WEIGHT_COUNT; ++i) {
+        m_weights[i] = weights[i];
+    }
+    return true;
+}
+
+bool HeuristicTuner::save(const std::string& filename) const {
+    std::string partial = filename + ".tmp";
+    std::ofstream outFile(partial);
+    if (!outFile.is_open()) {
+        std::cerr << "Error: Could not write checkpoint: " << partial << std::endl;
+        return false;
+    }
+
+    // Enough digits that a resumed run continues from the same weights
+    outFile.precision(17);
+    outFile << "Iteration: " << m_iteration << "\n"
+        << "Seed: " << m_seed << "\n"
+        << "Weights:";
+    for (int i = 0; i < WeightedStrategy::WEIGHT_COUNT; ++i) {
+        outFile << " " << m_weights[i];
+    }
+    outFile << "\n";
+    outFile.close();
+
+    if (!outFile || std::rename(partial.c_str(), filename.c_str()) != 0) {
+        std::cerr << "Error: Could not write checkpoint: " << filename << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/* *********************************************************************
+Function Name: step
+Purpose: Runs one SPSA iteration.
+Parameters:
+        dealCount, an integer number of deals to play, more than 0.
+        threadCount, an integer. The number of worker threads, or 0 for
+            one per hardware thread.
+Return Value: None
+Algorithm:
+        1. Draw a sign for every weight but the pips' from the seed and
+            the iteration, and find this iteration's gains.
+        2. Play the weights moved by the perturbation each way against
+            first-fit on the same deals with compare().
+        3. Move each weight by the step times the difference in score
+            over twice the perturbation, in the direction of its sign.
+Reference: Spall, J. C. (1998), "Implementation of the simultaneous
+        perturbation algorithm for stochastic optimization"
+********************************************************************* */
+void HeuristicTuner::step(int dealCount, int threadCount) {
+    // 1. The perturbation and gains of this iteration
+    std::mt19937 generator(m_seed + static_cast<unsigned int>(m_iteration) * 2654435761U);
+    double stepSize = STEP_SIZE / std::pow(m_iteration + 1 + STEP_STABILITY, 0.602);
+    double perturbation = PERTURBATION / std::pow(m_iteration + 1, 0.101);
+
+    double signs[WeightedStrategy::WEIGHT_COUNT] = {};
+    double plus[WeightedStrategy::WEIGHT_COUNT];
+    double minus[WeightedStrategy::WEIGHT_COUNT];
+    for (int i = 0; i < WeightedStrategy::WEIGHT_COUNT; ++i) {
+        if (i != WeightedStrategy::WEIGHT_PIPS) {
+            signs[i] = (generator() & 1) ? 1.0 : -1.0;
+        }
+        plus[i] = m_weights[i] + perturbation * signs[i];
+        minus[i] = m_weights[i] - perturbation * signs[i];
+    }
+
+    // 2. Both on the same deals, numbered so that no iteration repeats another's
+    double plusScore = 0.0;
+    double minusScore = 0.0;
+    unsigned int firstDeal = m_seed * 2246822519U + static_cast<unsigned int>(m_iteration) * static_cast<unsigned int>(dealCount);
+    compare(plus, minus, firstDeal, dealCount, threadCount, plusScore, minusScore);
+
+    // 3. Along the estimated gradient
+    double slope = (plusScore - minusScore) / (2.0 * perturbation);
+    for (int i = 0; i < WeightedStrategy::WEIGHT_COUNT; ++i) {
+        m_weights[i] += stepSize * slope * signs[i];
+    }
+
+    m_score = (plusScore + minusScore) / 2.0;
+    ++m_iteration;
+}
+
+/* *********************************************************************
+Function Name: compare
+Purpose: Measures two weightings against the Computer's first-fit
+        strategy on the same deals.
+Parameters:
+        first, second, arrays of WeightedStrategy::WEIGHT_COUNT doubles.
+        firstDeal, an unsigned integer. The number of the first deal;
+            deal i is dealt from seed firstDeal + i.
+        dealCount, an integer number of deals.
+        threadCount. As for step().
+        outFirst, outSecond, doubles passed by reference. Receive each
+            weighting's mean points per round more than first-fit's.
+Return Value: None
+Algorithm:
+        1. Start the workers on playDeals(), sharing a counter of the
+            next block of deals.
+        2. Add up the points each worker counted in its own row.
+Reference: None
+********************************************************************* */
+void HeuristicTuner::compare(const double* first, const double* second, unsigned int firstDeal, int dealCount,
+    int threadCount, double& outFirst, double& outSecond) {
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::thread::hardware_concurrency());
+        if (threadCount <= 0) { threadCount = 1; }
+    }
+
+    // 1. The workers, each counting into its own row so no locking is needed
+    std::atomic<int> next(0);
+    std::vector<std::vector<long long>> margins(threadCount, std::vector<long long>(2, 0));
+    std::vector<std::thread> workers;
+
+    for (int t = 0; t < threadCount; ++t) {
+        workers.emplace_back(&HeuristicTuner::playDeals, first, second, firstDeal, dealCount, std::ref(next),
+            margins[t].data());
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    // 2. The totals, per round played
+    long long firstTotal = 0;
+    long long secondTotal = 0;
+    for (int t = 0; t < threadCount; ++t) {
+        firstTotal += margins[t][0];
+        secondTotal += margins[t][1];
+    }
+
+    double rounds = 2.0 * dealCount;
+    outFirst = firstTotal / rounds;
+    outSecond = secondTotal / rounds;
+}
+
+/* *********************************************************************
+Function Name: playDeals
+Purpose: The body of a worker thread.
+Parameters:
+        first, second, firstDeal, dealCount. As for compare().
+        next, a std::atomic<int> passed by reference. The shared
+            count of deals claimed.
+        margins, a pointer to two counters. Receive each weighting's
+            points minus first-fit's.
+Return Value: None
+Algorithm: Claim blocks of deals until none are left. Deal each one
+        with the engine of a rotating round number, and play it four
+        times: each weighting as the Human and as the Computer, with
+        first-fit on the other side.
+Reference: None
+********************************************************************* */
+void HeuristicTuner::playDeals(const double* first, const double* second, unsigned int firstDeal, int dealCount,
+    std::atomic<int>& next, long long* margins) {
+    WeightedStrategy strategies[2] = { WeightedStrategy(first), WeightedStrategy(second) };
+    GreedyStrategy greedy;
+    long long totals[2] = { 0, 0 };
+
+    for (int block = next.fetch_add(BLOCK_SIZE); block < dealCount; block = next.fetch_add(BLOCK_SIZE)) {
+        int end = (block + BLOCK_SIZE < dealCount) ? block + BLOCK_SIZE : dealCount;
+
+        for (int deal = block; deal < end; ++deal) {
+            Playout start;
+            start.dealRound(1 + deal % (StandardSet::MAX_PIPS + 1), firstDeal + static_cast<unsigned int>(deal));
+
+            for (int s = 0; s < 2; ++s) {
+                Playout round = start;
+                round.playRound(strategies[s], greedy);
+                totals[s] += round.getPoints(Playout::HUMAN) - round.getPoints(Playout::COMPUTER);
+
+                round = start;
+                round.playRound(greedy, strategies[s]);
+                totals[s] += round.getPoints(Playout::COMPUTER) - round.getPoints(Playout::HUMAN);
+            }
+        }
+    }
+
+    margins[0] = totals[0];
+    margins[1] = totals[1];
+}
\ No newline at end of file
@@ -0,0 +1,209 @@
+#ifndef HEURISTICTUNER_H
+#define HEURISTICTUNER_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <atomic>
+#include <string>
+
+#include "WeightedStrategy.h"
+
+/* *********************************************************************
+Class Name: HeuristicTuner
+Purpose: Tunes the weights of a WeightedStrategy by self-play against the
+        Computer's first-fit strategy with simultaneous perturbation
+        stochastic approximation (SPSA). Each iteration nudges every weight
+        up or down at random, plays the nudged strategy both ways round on
+        the same deals, and steps along the difference in points won. Two
+        strengths are measured per iteration whatever the number of
+        weights, and playing both sides on the same deals cancels most of
+        the luck of the deal from the difference.
+
+        The pip weight is held at 1 as the unit the others are measured
+        in, since scaling every weight alike plays the same moves. Deals
+        are numbered from the seed and the iteration, so a tuning stopped
+        and resumed from its checkpoint continues exactly as it would
+        have, with any number of threads.
+********************************************************************* */
+class HeuristicTuner {
+public:
+
+    // Deals per iteration by default; each is played four times
+    static const int DEFAULT_DEALS = 10000;
+
+    // SPSA gains: step a / (k + 1 + A)^0.602, perturbation c / (k + 1)^0.101
+    static constexpr double STEP_SIZE = 0.5;
+    static constexpr double STEP_STABILITY = 50.0;
+    static constexpr double PERTURBATION = 0.2;
+
+    /* --- Constructor --- */
+
+    /* *********************************************************************
+    Function Name: HeuristicTuner
+    Purpose: Default constructor. Starts from the heaviest-tile weights.
+    Parameters: None
+    Return Value: None
+    Algorithm: Copy WeightedStrategy's default weights and zero the
+            iteration, seed and score.
+    Reference: None
+    ********************************************************************* */
+    HeuristicTuner();
+
+    /* --- Destructor --- */
+
+    /* *********************************************************************
+    Function Name: ~HeuristicTuner
+    Purpose: Destructor. Nothing is allocated, so nothing is released.
+    Parameters: None
+    Return Value: None
+    Algorithm: Standard object destruction.
+    Reference: None
+    ********************************************************************* */
+    ~HeuristicTuner() = default;
+
+    /* --- Selectors --- */
+
+    /* *********************************************************************
+    Function Name: getIteration / getSeed
+    Purpose: Retrieve the number of iterations run and the seed the deals
+            are numbered from.
+    Parameters: None
+    Return Value: An integer count. / An unsigned integer seed.
+    Algorithm: Return the stored values.
+    Reference: None
+    ********************************************************************* */
+    inline int getIteration() const { return m_iteration; }
+    inline unsigned int getSeed() const { return m_seed; }
+
+    /* *********************************************************************
+    Function Name: getStrategy
+    Purpose: Retrieves the strategy the current weights play.
+    Parameters: None
+    Return Value: A WeightedStrategy.
+    Algorithm: Construct one from the weights.
+    Reference: None
+    ********************************************************************* */
+    inline WeightedStrategy getStrategy() const { return WeightedStrategy(m_weights); }
+
+    /* *********************************************************************
+    Function Name: getScore
+    Purpose: Retrieves how the last iteration's two strategies did.
+    Parameters: None
+    Return Value: Their mean points per round more than first-fit's.
+    Algorithm: Return the stored value.
+    Reference: None
+    ********************************************************************* */
+    inline double getScore() const { return m_score; }
+
+    /* --- Mutators --- */
+
+    /* *********************************************************************
+    Function Name: setSeed
+    Purpose: Chooses the deals and perturbations of a new tuning.
+    Parameters:
+            seed, an unsigned integer.
+    Return Value: None
+    Algorithm: Assigns the seed parameter to the m_seed member variable.
+    Reference: None
+    ********************************************************************* */
+    inline void setSeed(unsigned int seed) { m_seed = seed; }
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: load / save
+    Purpose: Read or write a checkpoint: the iteration, the seed and the
+            weights, as text.
+    Parameters:
+            filename, a string representing the checkpoint path.
+    Return Value: Boolean true on success; false, with an error message,
+            if the file could not be read or written.
+    Algorithm:
+            load: read each labelled line and check that every weight was
+                found, keeping the tuner unchanged otherwise.
+            save: write to a temporary file beside the checkpoint, then
+                rename it over the checkpoint, so a run stopped while
+                saving keeps the previous checkpoint whole.
+    Reference: None
+    ********************************************************************* */
+    bool load(const std::string& filename);
+    bool save(const std::string& filename) const;
+
+    /* *********************************************************************
+    Function Name: step
+    Purpose: Runs one SPSA iteration.
+    Parameters:
+            dealCount, an integer number of deals to play, more than 0.
+            threadCount, an integer. The number of worker threads, or 0 for
+                one per hardware thread.
+    Return Value: None
+    Algorithm:
+            1. Draw a sign for every weight but the pips' from the seed and
+                the iteration, and find this iteration's gains.
+            2. Play the weights moved by the perturbation each way against
+                first-fit on the same deals with compare().
+            3. Move each weight by the step times the difference in score
+                over twice the perturbation, in the direction of its sign.
+    Reference: Spall, J. C. (1998), "Implementation of the simultaneous
+            perturbation algorithm for stochastic optimization"
+    ********************************************************************* */
+    void step(int dealCount, int threadCount);
+
+    /* *********************************************************************
+    Function Name: compare
+    Purpose: Measures two weightings against the Computer's first-fit
+            strategy on the same deals.
+    Parameters:
+            first, second, arrays of WeightedStrategy::WEIGHT_COUNT doubles.
+            firstDeal, an unsigned integer. The number of the first deal;
+                deal i is dealt from seed firstDeal + i.
+            dealCount, an integer number of deals.
+            threadCount. As for step().
+            outFirst, outSecond, doubles passed by reference. Receive each
+                weighting's mean points per round more than first-fit's.
+    Return Value: None
+    Algorithm:
+            1. Start the workers on playDeals(), sharing a counter of the
+                next block of deals.
+            2. Add up the points each worker counted in its own row.
+    Reference: None
+    ********************************************************************* */
+    static void compare(const double* first, const double* second, unsigned int firstDeal, int dealCount,
+        int threadCount, double& outFirst, double& outSecond);
+
+private:
+
+    // Deals a worker claims at a time
+    static const int BLOCK_SIZE = 64;
+
+    double m_weights[WeightedStrategy::WEIGHT_COUNT];
+    int m_iteration;
+    unsigned int m_seed;
+    double m_score;
+
+    /* *********************************************************************
+    Function Name: playDeals
+    Purpose: The body of a worker thread.
+    Parameters:
+            first, second, firstDeal, dealCount. As for compare().
+            next, a std::atomic<int> passed by reference. The shared
+                count of deals claimed.
+            margins, a pointer to two counters. Receive each weighting's
+                points minus first-fit's.
+    Return Value: None
+    Algorithm: Claim blocks of deals until none are left. Deal each one
+            with the engine of a rotating round number, and play it four
+            times: each weighting as the Human and as the Computer, with
+            first-fit on the other side.
+    Reference: None
+    ********************************************************************* */
+    static void playDeals(const double* first, const double* second, unsigned int firstDeal, int dealCount,
+        std::atomic<int>& next, long long* margins);
+};
+
+#endif
\ No newline at end of file
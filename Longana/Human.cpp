@@ -6,26 +6,33 @@
  ************************************************************/
 
 #include <cctype>
+#include <charconv>
 #include <iostream>
-#include <vector>
+#include <string>
 
 #include "Human.h"
 #include "Layout.h"
 #include "Stock.h"
+#include "Task.h"
 #include "Tile.h"
+#include "TurnChannel.h"
 
 /* *********************************************************************
-Function Name: playTurn
+Function Name: takeTurn
 Purpose: Executes the logic for the Human player's turn. Handles user
         input for tile and side selection, manages drawing from the
-        stock, and enforces immediate play rules.
+        stock, and enforces immediate play rules. Suspends whenever it
+        waits for the user's next word.
 Parameters:
         layout, a Layout object passed by reference. The current board.
         stock, a Stock object passed by reference. The boneyard.
         opponentPassed, a bool passed by value. Indicates if Computer passed.
-Return Value: Boolean true if a tile was placed, false if the Human passed.
+        channel, a TurnChannel passed by reference. Supplies the user's
+            words; its FramePool holds the coroutine's frame.
+Return Value: A task giving true if a tile was placed, false if the
+        Human passed or the channel closed mid-turn.
 Algorithm:
-        1. Scan the current hand to determine if any legal moves exist.
+        1. Check with hasPlayableTile() whether any legal move exists.
         2. If a valid move exists in the hand:
             a. Prompt the user to select a tile by its index.
             b. If the tile is playable on both sides, prompt the user
@@ -40,61 +47,49 @@ Algorithm:
             d. If playable, force the user to play it immediately
                 and return true.
             e. If not playable, return false (Pass).
+        4. If the channel closes while waiting, return false.
 Reference: None
 ********************************************************************* */
-bool Human::playTurn(Layout& layout, Stock& stock, bool opponentPassed) {
-    // Step 1: Identify all playable tiles in the current hand
-    std::vector<int> playableIndices;
-
-    // Run through the tiles in the Human's Hand
-    for (int i = 0; i < m_hand.getSize(); ++i) {
-        Tile tile = m_hand.getTileAtIndex(i);
-
-        // Check if the tile is playable
-        bool fitL = canPlayOnSide(tile, 'L', opponentPassed) && layout.isLegalMove(tile, 'L');
-        bool fitR = canPlayOnSide(tile, 'R', opponentPassed) && layout.isLegalMove(tile, 'R');
-
-        // If it fits, add it to the Human's playable universe
-        if (fitL || fitR) { playableIndices.push_back(i); }
-    }
-
-    // Step 2: Handle the scenario where no moves are available in the initial hand
-    if (playableIndices.empty()) {
-        std::cout << " >> No moves available. Drawing from boneyard..." << std::endl;
+Task<bool> Human::takeTurn(Layout& layout, Stock& stock, bool opponentPassed, TurnChannel& channel) {
+    // Step 1 and 2: Check the hand, and handle the scenario where no moves are available in it
+    if (!hasPlayableTile(layout, opponentPassed)) {
+        *m_output << " >> No moves available. Drawing from boneyard..." << std::endl;
 
         if (stock.isEmpty()) {
-            std::cout << " >> Boneyard empty. You must pass." << std::endl;
-            return false;
+            *m_output << " >> Boneyard empty. You must pass." << std::endl;
+            co_return false;
         }
 
         Tile drawn;
         stock.drawTile(drawn);
         m_hand.addTile(drawn);
-        std::cout << " >> You drew: " << drawn.getLeftPips() << "-" << drawn.getRightPips() << std::endl;
+        *m_output << " >> You drew: " << drawn.getLeftPips() << "-" << drawn.getRightPips() << std::endl;
 
         // Check if the newly drawn tile can be played immediately
-        bool fitL = canPlayOnSide(drawn, 'L', opponentPassed) && layout.isLegalMove(drawn, 'L');
-        bool fitR = canPlayOnSide(drawn, 'R', opponentPassed) && layout.isLegalMove(drawn, 'R');
+        bool fitL = canPlay(drawn, 'L', layout, opponentPassed);
+        bool fitR = canPlay(drawn, 'R', layout, opponentPassed);
 
         // Skip turn if tile doesn't fit
         if (!fitL && !fitR) {
-            std::cout << " >> Drawn tile cannot be played. You pass." << std::endl;
-            return false;
+            *m_output << " >> Drawn tile cannot be played. You pass." << std::endl;
+            co_return false;
         }
 
         // Determine which side to place the drawn tile
         char side = 'L';
         if (fitL && fitR) {
-            std::cout << " >> Drawn tile fits BOTH sides. Play (L)eft or (R)ight? ";
-            std::cin >> side;
-            side = toupper(side);
+            *m_output << " >> Drawn tile fits BOTH sides. Play (L)eft or (R)ight? ";
+
+            std::string word = co_await channel.readWord();
+            if (word.empty()) { co_return false; }
+            side = toupper(word[0]);
         }
         else if (fitR) {
             side = 'R';
-            std::cout << " >> Tile must be played on RIGHT." << std::endl;
+            *m_output << " >> Tile must be played on RIGHT." << std::endl;
         }
         else {
-            std::cout << " >> Tile must be played on LEFT." << std::endl;
+            *m_output << " >> Tile must be played on LEFT." << std::endl;
         }
 
         // Create tile for 'drawn' tile to be copied into
@@ -112,43 +107,49 @@ bool Human::playTurn(Layout& layout, Stock& stock, bool opponentPassed) {
             layout.addLeftTile(played); 
         }
 
-        return true;
+        co_return true;
     }
 
     // Step 3: Interaction loop for choosing a tile from the hand
     while (true) {
-        int choice;
-        std::cout << " >> Select tile index (1-" << m_hand.getSize() << "): ";
-        std::cin >> choice;
+        *m_output << " >> Select tile index (1-" << m_hand.getSize() << "): ";
+
+        std::string word = co_await channel.readWord();
+        if (word.empty()) { co_return false; }
+
+        // A word that is not a number is no index at all
+        int choice = 0;
+        std::from_chars(word.data(), word.data() + word.size(), choice);
 
         // Validate that the user input is a valid index within the hand
         if (choice < 1 || choice > m_hand.getSize()) {
-            std::cout << "Invalid index. Please try again." << std::endl;
+            *m_output << "Invalid index. Please try again." << std::endl;
             continue;
         }
 
         Tile tile = m_hand.getTileAtIndex(choice - 1);
 
         // Check which tiles are playable
-        bool fitL = canPlayOnSide(tile, 'L', opponentPassed) && layout.isLegalMove(tile, 'L');
-        bool fitR = canPlayOnSide(tile, 'R', opponentPassed) && layout.isLegalMove(tile, 'R');
+        bool fitL = canPlay(tile, 'L', layout, opponentPassed);
+        bool fitR = canPlay(tile, 'R', layout, opponentPassed);
 
         // Validate that the chosen tile can actually be placed on the board
         if (!fitL && !fitR) {
-            std::cout << "That tile cannot be played anywhere on the current layout." << std::endl;
+            *m_output << "That tile cannot be played anywhere on the current layout." << std::endl;
             continue;
         }
 
         char side = 'L';
         // If the tile is a double or the opponent passed, it might fit both ends
         if (fitL && fitR) {
-            std::cout << " >> Play on (L)eft or (R)ight? ";
-            std::cin >> side;
-            side = toupper(side);
+            *m_output << " >> Play on (L)eft or (R)ight? ";
+
+            word = co_await channel.readWord();
+            if (word.empty()) { co_return false; }
+            side = toupper(word[0]);
             if (side != 'L' && side != 'R') {
-                std::cout << "Invalid side selection.\n";
-                std::cin.clear();
-                std::cin.ignore(1000, '\n');
+                *m_output << "Invalid side selection.\n";
+                channel.discardLine();
                 continue;
             }
         }
@@ -169,8 +170,47 @@ bool Human::playTurn(Layout& layout, Stock& stock, bool opponentPassed) {
             layout.addRightTile(playedTile);
         }
 
-        return true;
+        co_return true;
+    }
+}
+
+/* *********************************************************************
+Function Name: canPlay
+Purpose: Checks a move against the rules the Human plays by, for the
+        console's turns and for any other way of taking them.
+Parameters:
+        tile, a Tile object passed by const reference. The tile to play.
+        side, a char passed by value. 'L' for Left, 'R' for Right.
+        layout, a Layout object passed by const reference. The current board.
+        opponentPassed, a bool passed by value. Indicates if Computer passed.
+Return Value: true if the Human may play the tile there and it fits.
+Algorithm: Check the side with canPlayOnSide(), then the open pips
+        with Layout::isLegalMove().
+Reference: None
+********************************************************************* */
+bool Human::canPlay(const Tile& tile, char side, const Layout& layout, bool opponentPassed) const {
+    return canPlayOnSide(tile, side, opponentPassed) && layout.isLegalMove(tile, side);
+}
+
+/* *********************************************************************
+Function Name: hasPlayableTile
+Purpose: Checks whether any tile in the hand can be played, which
+        decides whether the Human must draw or pass.
+Parameters:
+        layout, a Layout object passed by const reference. The current board.
+        opponentPassed, a bool passed by value. Indicates if Computer passed.
+Return Value: true if some tile may be played on some side.
+Algorithm: Try every tile in the hand on both sides with canPlay().
+Reference: None
+********************************************************************* */
+bool Human::hasPlayableTile(const Layout& layout, bool opponentPassed) const {
+    for (int i = 0; i < m_hand.getSize(); ++i) {
+        Tile tile = m_hand.getTileAtIndex(i);
+        if (canPlay(tile, 'L', layout, opponentPassed) || canPlay(tile, 'R', layout, opponentPassed)) {
+            return true;
+        }
     }
+    return false;
 }
 
 /* *********************************************************************
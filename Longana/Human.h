@@ -11,29 +11,38 @@
 #include "Player.h"
 #include "Layout.h"
 #include "Stock.h"
+#include "Task.h"
 #include "Tile.h"
 
+class TurnChannel;
+
 /* *********************************************************************
 Class Name: Human
 Purpose: Represents the human player in the Longana game. Inherits from
         the Player class and implements logic to interact with the user via
-        console input to play turns, validate moves, and draw tiles.
+        console input to play turns, validate moves, and draw tiles. The
+        turn itself is a coroutine reading from a TurnChannel, so it can
+        wait for the user without holding a thread.
 ********************************************************************* */
 class Human : public Player {
 public:
 
     /* *********************************************************************
-    Function Name: playTurn
+    Function Name: takeTurn
     Purpose: Executes the logic for the Human player's turn. Handles user
             input for tile and side selection, manages drawing from the
-            stock, and enforces immediate play rules.
+            stock, and enforces immediate play rules. Suspends whenever it
+            waits for the user's next word.
     Parameters:
             layout, a Layout object passed by reference. The current board.
             stock, a Stock object passed by reference. The boneyard.
             opponentPassed, a bool passed by value. Indicates if Computer passed.
-    Return Value: Boolean true if a tile was placed, false if the Human passed.
+            channel, a TurnChannel passed by reference. Supplies the user's
+                words; its FramePool holds the coroutine's frame.
+    Return Value: A task giving true if a tile was placed, false if the
+            Human passed or the channel closed mid-turn.
     Algorithm:
-            1. Scan the current hand to determine if any legal moves exist.
+            1. Check with hasPlayableTile() whether any legal move exists.
             2. If a valid move exists in the hand:
                 a. Prompt the user to select a tile by its index.
                 b. If the tile is playable on both sides, prompt the user
@@ -48,9 +57,39 @@ public:
                 d. If playable, force the user to play it immediately
                     and return true.
                 e. If not playable, return false (Pass).
+            4. If the channel closes while waiting, return false.
+    Reference: None
+    ********************************************************************* */
+    Task<bool> takeTurn(Layout& layout, Stock& stock, bool opponentPassed, TurnChannel& channel);
+
+    /* *********************************************************************
+    Function Name: canPlay
+    Purpose: Checks a move against the rules the Human plays by, for the
+            console's turns and for any other way of taking them.
+    Parameters:
+            tile, a Tile object passed by const reference. The tile to play.
+            side, a char passed by value. 'L' for Left, 'R' for Right.
+            layout, a Layout object passed by const reference. The current board.
+            opponentPassed, a bool passed by value. Indicates if Computer passed.
+    Return Value: true if the Human may play the tile there and it fits.
+    Algorithm: Check the side with canPlayOnSide(), then the open pips
+            with Layout::isLegalMove().
+    Reference: None
+    ********************************************************************* */
+    bool canPlay(const Tile& tile, char side, const Layout& layout, bool opponentPassed) const;
+
+    /* *********************************************************************
+    Function Name: hasPlayableTile
+    Purpose: Checks whether any tile in the hand can be played, which
+            decides whether the Human must draw or pass.
+    Parameters:
+            layout, a Layout object passed by const reference. The current board.
+            opponentPassed, a bool passed by value. Indicates if Computer passed.
+    Return Value: true if some tile may be played on some side.
+    Algorithm: Try every tile in the hand on both sides with canPlay().
     Reference: None
     ********************************************************************* */
-    bool playTurn(Layout& layout, Stock& stock, bool opponentPassed) override;
+    bool hasPlayableTile(const Layout& layout, bool opponentPassed) const;
 
 private:
 
@@ -6,8 +6,9 @@
  ************************************************************/
 
 #include <iostream>
-#include <sstream>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "Hand.h"
 #include "Layout.h"
@@ -152,19 +153,20 @@ bool Layout::findValidMoves(const Hand& hand) const {
 
 /* *********************************************************************
 Function Name: displayLayout
-Purpose: Prints the current state of the board to the console, showing
+Purpose: Prints the current state of the board to a stream, showing
         the chain of tiles from left to right.
-Parameters: None
+Parameters:
+        out, an ostream passed by reference. Usually std::cout.
 Return Value: None (void)
 Algorithm:
         1. Iterate through m_layout deque from begin to end.
         2. Print each tile.
 Reference: None
 ********************************************************************* */
-void Layout::displayLayout() const {
+void Layout::displayLayout(std::ostream& out) const {
     // Print the chain of tiles in order from Left to Right
     for (const Tile& tile : m_layout) {
-        std::cout << tile.getLeftPips() << "-" << tile.getRightPips() << " ";
+        out << tile.getLeftPips() << "-" << tile.getRightPips() << " ";
     }
 }
 
@@ -204,43 +206,29 @@ Purpose: Reconstructs the board layout by parsing a space-delimited string
         of tiles. Used primarily when restoring the game board from a
         saved state.
 Parameters:
-        data, a const std::string passed by reference. The raw string
+        data, a std::string_view passed by value. The raw characters
             containing board data (e.g., "L 6-6 6-1 1-0 R").
-Return Value: None (void)
+        errorOffset, a size_t passed by reference. Receives the offset
+            within data of the first malformed token, if any.
+Return Value: Boolean true if every token was a marker or a valid tile,
+        false otherwise.
 Algorithm:
         1. Clear any existing tiles from the m_layout deque.
-        2. Wrap the input string in a std::stringstream for easy tokenization.
-        3. While there are tokens in the stream:
-            a. Skip tokens that are strictly markers (like "L" or "R").
-            b. Locate the position of the dash ('-') within the tile token.
-            c. If found, extract the substring before the dash as the 'left' value.
-            d. Extract the substring after the dash as the 'right' value.
-            e. Convert these substrings to integers using std::stoi.
-            f. Construct a new Tile object and push it to the back of
-                the m_layout deque to maintain the sequence.
+        2. Parse the view with Tile::listFromString, skipping the "L"
+            and "R" markers, and return false if a token is malformed.
+        3. Copy the tiles into the m_layout deque in order.
 Reference: None
 ********************************************************************* */
-void Layout::loadFromString(const std::string& data) {
+bool Layout::loadFromString(std::string_view data, size_t& errorOffset) {
     // Empty the layout to prepare for new data from the save file
     m_layout.clear();
-    
-    // Use stringstream to split the string into individual "6-6" tokens
-    std::stringstream ss(data);
-    std::string token;
-
-    while (ss >> token) {
-        if (token == "L" || token == "R") { continue; }
 
-        size_t dashPos = token.find("-");
-
-        // If there exists a dashPos, execute
-        if (dashPos != std::string::npos) {
-            // Extract substrings and convert to integers
-            int left = std::stoi(token.substr(0, dashPos));
-            int right = std::stoi(token.substr(dashPos + 1));
-
-            // Create the Tile and store it to the layout
-            m_layout.push_back(Tile(left, right));
-        }
+    std::vector<Tile> tiles;
+    if (!Tile::listFromString(data, true, tiles, errorOffset)) {
+        return false;
     }
+
+    // The tiles are listed from the left end to the right end
+    m_layout.assign(tiles.begin(), tiles.end());
+    return true;
 }
\ No newline at end of file
@@ -9,7 +9,9 @@
  ************************************************************/
 
 #include <deque>
+#include <ostream>
 #include <string>
+#include <string_view>
 #include "Tile.h"
 #include "Hand.h"
 
@@ -80,6 +82,28 @@ public:
     ********************************************************************* */
     inline bool isEmpty() const { return m_layout.empty(); }
 
+    /* *********************************************************************
+    Function Name: getSize
+    Purpose: Retrieves the number of tiles in the line of play.
+    Parameters: None
+    Return Value: An integer count of tiles, including the engine.
+    Algorithm: Return m_layout.size().
+    Reference: None
+    ********************************************************************* */
+    inline int getSize() const { return static_cast<int>(m_layout.size()); }
+
+    /* *********************************************************************
+    Function Name: getTileAtIndex
+    Purpose: Retrieves a copy of a tile in the line of play, in the
+            orientation it was placed. Index 0 is the left end.
+    Parameters:
+            index, an integer passed by value. The position of the tile.
+    Return Value: A Tile object (by value).
+    Algorithm: Return the element at m_layout.at(index).
+    Reference: None
+    ********************************************************************* */
+    inline Tile getTileAtIndex(int index) const { return m_layout.at(index); }
+
     /* --- Mutators --- */
 
     /* *********************************************************************
@@ -121,6 +145,19 @@ public:
     ********************************************************************* */
     inline void setEngine(const Tile& tile) { m_layout.push_back(tile); }
 
+    /* *********************************************************************
+    Function Name: appendTile
+    Purpose: Places a tile at the right end of the layout exactly as given,
+            without matching or flipping it. Used when restoring a saved
+            layout tile by tile.
+    Parameters:
+            tile, a Tile object passed by const reference.
+    Return Value: None (void)
+    Algorithm: Push the tile onto the back of the deque.
+    Reference: None
+    ********************************************************************* */
+    inline void appendTile(const Tile& tile) { m_layout.push_back(tile); }
+
     /* *********************************************************************
     Function Name: clearLayout
     Purpose: To remove all tiles from the current game layout, resetting
@@ -173,16 +210,17 @@ public:
 
     /* *********************************************************************
     Function Name: displayLayout
-    Purpose: Prints the current state of the board to the console, showing
+    Purpose: Prints the current state of the board to a stream, showing
              the chain of tiles from left to right.
-    Parameters: None
+    Parameters:
+             out, an ostream passed by reference. Usually std::cout.
     Return Value: None (void)
     Algorithm:
              1. Iterate through m_layout deque from begin to end.
              2. Print each tile.
     Reference: None
     ********************************************************************* */
-    void displayLayout() const;
+    void displayLayout(std::ostream& out) const;
 
     /* *********************************************************************
     Function Name: toString
@@ -210,23 +248,20 @@ public:
             of tiles. Used primarily when restoring the game board from a
             saved state.
     Parameters:
-            data, a const std::string passed by reference. The raw string
+            data, a std::string_view passed by value. The raw characters
                 containing board data (e.g., "L 6-6 6-1 1-0 R").
-    Return Value: None (void)
-    lgorithm:
+            errorOffset, a size_t passed by reference. Receives the offset
+                within data of the first malformed token, if any.
+    Return Value: Boolean true if every token was a marker or a valid tile,
+            false otherwise.
+    Algorithm:
             1. Clear any existing tiles from the m_layout deque.
-            2. Wrap the input string in a std::stringstream for easy tokenization.
-            3. While there are tokens in the stream:
-                a. Skip tokens that are strictly markers (like "L" or "R").
-                b. Locate the position of the dash ('-') within the tile token.
-                c. If found, extract the substring before the dash as the 'left' value.
-                d. Extract the substring after the dash as the 'right' value.
-                e. Convert these substrings to integers using std::stoi.
-                f. Construct a new Tile object and push it to the back of
-                    the m_layout deque to maintain the sequence.
-    Reference: None
-    ********************************************************************* */
-    void loadFromString(const std::string& data);
+            2. Parse the view with Tile::listFromString, skipping the "L"
+                and "R" markers, and return false if a token is malformed.
+            3. Copy the tiles into the m_layout deque in order.
+    Reference: None
+    ********************************************************************* */
+    bool loadFromString(std::string_view data, size_t& errorOffset);
 
 private:
     // A double-ended queue to store the line of tiles
@@ -55,7 +55,7 @@ void LayoutView::displayBoard(const Layout& layout) const {
     std::cout << "Current Board Layout: L ";
 
     // Delegate the actual tile formatting to the Layout class
-    layout.displayLayout();
+    layout.displayLayout(std::cout);
 
     // End with R and flush to ensure the board is visible before the next turn starts
     std::cout << " R" << std::endl;
@@ -0,0 +1,527 @@
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "LinearEvaluator.h"
+#include "LockstepPlayout.h"
+#include "Playout.h"
+#include "TrainingData.h"
+
+// The vector paths exist only on x86; elsewhere they fall back to the scalar one
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define LINEAR_X86
+#include <immintrin.h>
+#endif
+
+// GCC and Clang compile intrinsics only inside functions built for the instruction set
+#if defined(LINEAR_X86) && defined(__GNUC__)
+#define LINEAR_TARGET_AVX2 __attribute__((target("avx2")))
+#define LINEAR_TARGET_AVX512 __attribute__((target("avx512f")))
+#else
+#define LINEAR_TARGET_AVX2
+#define LINEAR_TARGET_AVX512
+#endif
+
+/* *********************************************************************
+Function Name: LinearEvaluator
+Purpose: Default constructor. Every weight is zero, so every position
+        scores 0 until weights are loaded or trained.
+Parameters: None
+Return Value: None
+Algorithm: Zero the weights and build the tables.
+Reference: None
+********************************************************************* */
+LinearEvaluator::LinearEvaluator()
+    : m_weights(), m_groups(), m_arms()
+{
+    buildTables();
+}
+
+/* *********************************************************************
+Function Name: evaluate
+Purpose: Scores one position for its mover.
+Parameters:
+        position, a two-player Playout passed by const reference. The
+            round is in progress.
+Return Value: The mover's expected points minus the opponent's.
+Algorithm: Find the position's features and add up their table
+        entries.
+Reference: None
+********************************************************************* */
+float LinearEvaluator::evaluate(const Playout& position) const {
+    Batch batch;
+    addPosition(batch, position);
+
+    float value = 0.0f;
+    evaluateScalar(batch, &value);
+    return value;
+}
+
+/* *********************************************************************
+Function Name: evaluateBatch
+Purpose: Scores every position in a batch.
+Parameters:
+        batch, a Batch passed by const reference.
+        outValues, an array of at least batch.count floats. Receives
+            each position's score for its mover.
+        path, an integer. LockstepPlayout::PATH_SCALAR, PATH_AVX2 or
+            PATH_AVX512; the default, -1, takes the widest the
+            processor supports. A path it lacks falls back to the
+            scalar one.
+Return Value: None
+Algorithm: For sixteen positions at a time, look up each group of
+        seven tiles of each mask and the arms' entry, and add them;
+        the vector paths gather the lookups of every lane at once.
+Reference: Intel Intrinsics Guide
+********************************************************************* */
+void LinearEvaluator::evaluateBatch(const Batch& batch, float* outValues, int path) const {
+    int bestPath = LockstepPlayout::getBestPath();
+    if (path < 0 || path > bestPath) {
+        path = (path < 0) ? bestPath : LockstepPlayout::PATH_SCALAR;
+    }
+
+    // Lanes past the count hold stale but valid entries, so every path can score all of them
+    alignas(64) float values[BATCH_SIZE];
+    if (path == LockstepPlayout::PATH_AVX512) {
+        evaluateAvx512(batch, values);
+    }
+    else if (path == LockstepPlayout::PATH_AVX2) {
+        evaluateAvx2(batch, values);
+    }
+    else {
+        evaluateScalar(batch, values);
+    }
+
+    std::memcpy(outValues, values, static_cast<size_t>(batch.count) * sizeof(float));
+}
+
+/* *********************************************************************
+Function Name: evaluateMoves
+Purpose: Scores each of the mover's candidate moves at once.
+Parameters:
+        position, a two-player Playout passed by const reference. The
+            round is in progress.
+        indices, arms, arrays of count integers. The moves, as listed
+            by Playout::listMoves().
+        count, an integer between 0 and Playout::MAX_MOVES.
+        outValues, an array of count floats. Receives each move's
+            value for the mover: the score of the position after it,
+            turned to the mover's side, or the points won exactly if
+            the move goes out.
+Return Value: None
+Algorithm:
+        1. Make each move in a copy of the position and add the
+            position after it to batches; a move that ends the round
+            is worth its points.
+        2. Score the batches with evaluateBatch().
+        3. Negate each score, which is the opponent's.
+Reference: None
+********************************************************************* */
+void LinearEvaluator::evaluateMoves(const Playout& position, const int* indices, const int* arms, int count,
+    float* outValues) const {
+    int mover = position.getMover();
+    Playout child = position;
+    Playout::UndoStack stack;
+
+    Batch batch;
+    int lanes[BATCH_SIZE];
+    float values[BATCH_SIZE];
+
+    for (int i = 0; i < count; ++i) {
+        // 1. The position after the move
+        child.makePlay(indices[i], arms[i], stack);
+        if (child.isOver()) {
+            outValues[i] = static_cast<float>(child.getPoints(mover) - child.getPoints(1 - mover));
+        }
+        else {
+            lanes[batch.count] = i;
+            addPosition(batch, child);
+        }
+        child.unmake(stack);
+
+        // 2-3. A full batch, or the last one
+        if (batch.count == BATCH_SIZE || (i == count - 1 && batch.count > 0)) {
+            evaluateBatch(batch, values);
+            for (int lane = 0; lane < batch.count; ++lane) {
+                outValues[lanes[lane]] = -values[lane];
+            }
+            batch.count = 0;
+        }
+    }
+}
+
+/* *********************************************************************
+Function Name: addPosition / addRecord
+Purpose: Add a position to a batch, from its mover's side.
+Parameters:
+        batch, a Batch passed by reference. Holds fewer than
+            BATCH_SIZE positions.
+        position, a two-player Playout passed by const reference. /
+            record, a TrainingData::Record passed by const reference.
+Return Value: None
+Algorithm: Store the mover's hand, the opponent's, the boneyard and
+        the arms' entry in the next lane.
+Reference: None
+********************************************************************* */
+void LinearEvaluator::addPosition(Batch& batch, const Playout& position) {
+    int mover = position.getMover();
+    int other = 1 - mover;
+    int lane = batch.count++;
+
+    int32_t boneyard = 0;
+    for (int i = 0; i < position.getBoneyardSize(); ++i) {
+        unsigned char packed = position.getBoneyardPacked(i);
+        boneyard |= static_cast<int32_t>(StandardSet::getBit(StandardSet::getIndex(packed & 0x0F, packed >> 4)));
+    }
+
+    batch.ownHand[lane] = static_cast<int32_t>(position.getHandMask(mover));
+    batch.otherHand[lane] = static_cast<int32_t>(position.getHandMask(other));
+    batch.boneyard[lane] = boneyard;
+    batch.arms[lane] = getArmsEntry(position.getArmEnd(mover), position.getArmEnd(other), position.hasPassed(mover),
+        position.hasPassed(other));
+}
+
+void LinearEvaluator::addRecord(Batch& batch, const TrainingData::Record& record) {
+    int mover = record.mover;
+    int other = 1 - mover;
+    int lane = batch.count++;
+
+    batch.ownHand[lane] = static_cast<int32_t>(record.hands[mover]);
+    batch.otherHand[lane] = static_cast<int32_t>(record.hands[other]);
+    batch.boneyard[lane] = static_cast<int32_t>(record.boneyard);
+    batch.arms[lane] = getArmsEntry(record.armEnds[mover], record.armEnds[other],
+        (record.flags & (mover == 0 ? TrainingData::HUMAN_PASSED : TrainingData::COMPUTER_PASSED)) != 0,
+        (record.flags & (other == 0 ? TrainingData::HUMAN_PASSED : TrainingData::COMPUTER_PASSED)) != 0);
+}
+
+/* *********************************************************************
+Function Name: load
+Purpose: Reads weights written by save().
+Parameters:
+        filename, a string representing the model path.
+Return Value: Boolean true if the weights were read; false, with an
+        error message, otherwise, leaving the weights as they were.
+Algorithm:
+        1. Read and check the header.
+        2. Read the weights and build the tables.
+Reference: None
+********************************************************************* */
+bool LinearEvaluator::load(const std::string& filename) {
+    std::ifstream inFile(filename, std::ios::binary);
+    if (!inFile.is_open()) {
+        std::cerr << "Error: Could not open evaluator: " << filename << std::endl;
+        return false;
+    }
+
+    // 1. The header
+    unsigned char header[HEADER_SIZE] = {};
+    inFile.read(reinterpret_cast<char*>(header), HEADER_SIZE);
+    if (!inFile || std::memcmp(header, "LGEV", 4) != 0 || header[4] != FILE_VERSION || header[5] != WEIGHT_COUNT) {
+        std::cerr << "Error: Not an evaluator file of this version: " << filename << std::endl;
+        return false;
+    }
+
+    // 2. The weights
+    float weights[WEIGHT_COUNT];
+    inFile.read(reinterpret_cast<char*>(weights), sizeof(weights));
+    if (!inFile) {
+        std::cerr << "Error: Evaluator file is cut short: " << filename << std::endl;
+        return false;
+    }
+
+    std::memcpy(m_weights, weights, sizeof(weights));
+    buildTables();
+    return true;
+}
+
+/* *********************************************************************
+Function Name: train
+Purpose: Fits the weights to the outcomes of recorded rounds.
+Parameters:
+        data, an open TrainingData passed by const reference.
+        first, count, integers. The records to fit.
+        ridge, a double. The penalty on the square of every weight,
+            which keeps them finite where features always go
+            together (one end value per arm, for instance).
+Return Value: Boolean true if the weights were fitted; false if there
+        were no records.
+Algorithm:
+        1. For each record, list its active features from the mover's
+            side and add their products to the normal equations of
+            least squares; at most about forty features are active,
+            so a record costs about eight hundred additions.
+        2. Add the ridge to the diagonal and solve by Cholesky
+            decomposition.
+        3. Build the tables.
+Reference: Hoerl, A. E. and Kennard, R. W. (1970), "Ridge
+        regression: Biased estimation for nonorthogonal problems"
+********************************************************************* */
+bool LinearEvaluator::train(const TrainingData& data, long long first, long long count, double ridge) {
+    if (first < 0 || count <= 0 || first + count > data.getCount()) {
+        return false;
+    }
+
+    // 1. The normal equations, upper triangle only
+    std::vector<double> products(static_cast<size_t>(WEIGHT_COUNT * WEIGHT_COUNT), 0.0);
+    std::vector<double> targets(WEIGHT_COUNT, 0.0);
+    const TrainingData::Record* records = data.getRecords();
+
+    for (long long r = first; r < first + count; ++r) {
+        const TrainingData::Record& record = records[r];
+        int mover = record.mover;
+        int other = 1 - mover;
+
+        // Listed group by group, so the features come in increasing order
+        int active[WEIGHT_COUNT];
+        int activeCount = 0;
+        uint32_t masks[3] = { record.hands[mover], record.hands[other], record.boneyard };
+
+        for (int group = 0; group < 3; ++group) {
+            for (uint32_t mask = masks[group]; mask != 0; mask &= mask - 1) {
+                active[activeCount++] = WEIGHT_OWN_HAND + group * StandardSet::TILE_COUNT + std::countr_zero(mask);
+            }
+        }
+        active[activeCount++] = WEIGHT_OWN_END + record.armEnds[mover];
+        active[activeCount++] = WEIGHT_OTHER_END + record.armEnds[other];
+        if (record.flags & (mover == 0 ? TrainingData::HUMAN_PASSED : TrainingData::COMPUTER_PASSED)) {
+            active[activeCount++] = WEIGHT_OWN_PASSED;
+        }
+        if (record.flags & (other == 0 ? TrainingData::HUMAN_PASSED : TrainingData::COMPUTER_PASSED)) {
+            active[activeCount++] = WEIGHT_OTHER_PASSED;
+        }
+        active[activeCount++] = WEIGHT_BIAS;
+
+        double target = static_cast<double>(record.points[mover]) - record.points[other];
+        for (int i = 0; i < activeCount; ++i) {
+            double* row = &products[static_cast<size_t>(active[i] * WEIGHT_COUNT)];
+            for (int j = i; j < activeCount; ++j) {
+                row[active[j]] += 1.0;
+            }
+            targets[active[i]] += target;
+        }
+    }
+
+    // 2. The ridge, then A = L L^T in place in the lower triangle
+    for (int i = 0; i < WEIGHT_COUNT; ++i) {
+        for (int j = 0; j < i; ++j) {
+            products[i * WEIGHT_COUNT + j] = products[j * WEIGHT_COUNT + i];
+        }
+        products[i * WEIGHT_COUNT + i] += ridge * static_cast<double>(count);
+    }
+
+    for (int j = 0; j < WEIGHT_COUNT; ++j) {
+        double diagonal = products[j * WEIGHT_COUNT + j];
+        for (int k = 0; k < j; ++k) {
+            diagonal -= products[j * WEIGHT_COUNT + k] * products[j * WEIGHT_COUNT + k];
+        }
+        if (diagonal <= 0.0) {
+            std::cerr << "Error: The evaluator's equations are singular; use a larger ridge." << std::endl;
+            return false;
+        }
+        diagonal = std::sqrt(diagonal);
+        products[j * WEIGHT_COUNT + j] = diagonal;
+
+        for (int i = j + 1; i < WEIGHT_COUNT; ++i) {
+            double sum = products[i * WEIGHT_COUNT + j];
+            for (int k = 0; k < j; ++k) {
+                sum -= products[i * WEIGHT_COUNT + k] * products[j * WEIGHT_COUNT + k];
+            }
+            products[i * WEIGHT_COUNT + j] = sum / diagonal;
+        }
+    }
+
+    // Forward substitution for L y = b, then back substitution for L^T w = y
+    for (int i = 0; i < WEIGHT_COUNT; ++i) {
+        for (int k = 0; k < i; ++k) {
+            targets[i] -= products[i * WEIGHT_COUNT + k] * targets[k];
+        }
+        targets[i] /= products[i * WEIGHT_COUNT + i];
+    }
+    for (int i = WEIGHT_COUNT - 1; i >= 0; --i) {
+        for (int k = i + 1; k < WEIGHT_COUNT; ++k) {
+            targets[i] -= products[k * WEIGHT_COUNT + i] * targets[k];
+        }
+        targets[i] /= products[i * WEIGHT_COUNT + i];
+    }
+
+    // 3. The tables
+    for (int i = 0; i < WEIGHT_COUNT; ++i) {
+        m_weights[i] = static_cast<float>(targets[i]);
+    }
+    buildTables();
+    return true;
+}
+
+/* *********************************************************************
+Function Name: save
+Purpose: Writes the weights to a file.
+Parameters:
+        filename, a string representing the model path.
+Return Value: Boolean true if the file was written; false, with an
+        error message, otherwise.
+Algorithm: Write the header, then the weights.
+Reference: None
+********************************************************************* */
+bool LinearEvaluator::save(const std::string& filename) const {
+    std::ofstream outFile(filename, std::ios::binary);
+    if (!outFile.is_open()) {
+        std::cerr << "Error: Could not open file for writing: " << filename << std::endl;
+        return false;
+    }
+
+    unsigned char header[HEADER_SIZE] = { 'L', 'G', 'E', 'V', FILE_VERSION, WEIGHT_COUNT };
+    outFile.write(reinterpret_cast<const char*>(header), HEADER_SIZE);
+    outFile.write(reinterpret_cast<const char*>(m_weights), sizeof(m_weights));
+    return static_cast<bool>(outFile);
+}
+
+/* *********************************************************************
+Function Name: buildTables
+Purpose: Fills the lookup tables from the weights.
+Parameters: None
+Return Value: None
+Algorithm:
+        1. For each mask and group, total the weights of the tiles of
+            every subset of the group.
+        2. For each arms' entry, total the two ends' weights, the pass
+            flags' and the bias.
+Reference: None
+********************************************************************* */
+void LinearEvaluator::buildTables() {
+    // 1. Each subset is a smaller subset plus its lowest tile
+    for (int table = 0; table < TABLE_COUNT; ++table) {
+        int mask = table / GROUP_COUNT;
+        int firstTile = (table % GROUP_COUNT) * GROUP_BITS;
+
+        m_groups[table][0] = 0.0f;
+        for (int subset = 1; subset < GROUP_SIZE; ++subset) {
+            int lowest = std::countr_zero(static_cast<unsigned int>(subset));
+            m_groups[table][subset] = m_groups[table][subset & (subset - 1)]
+                + m_weights[WEIGHT_OWN_HAND + mask * StandardSet::TILE_COUNT + firstTile + lowest];
+        }
+    }
+
+    // 2. The arms
+    for (int ownEnd = 0; ownEnd <= StandardSet::MAX_PIPS; ++ownEnd) {
+        for (int otherEnd = 0; otherEnd <= StandardSet::MAX_PIPS; ++otherEnd) {
+            for (int flags = 0; flags < 4; ++flags) {
+                bool ownPassed = (flags & 2) != 0;
+                bool otherPassed = (flags & 1) != 0;
+                m_arms[getArmsEntry(ownEnd, otherEnd, ownPassed, otherPassed)] = m_weights[WEIGHT_OWN_END + ownEnd]
+                    + m_weights[WEIGHT_OTHER_END + otherEnd] + (ownPassed ? m_weights[WEIGHT_OWN_PASSED] : 0.0f)
+                    + (otherPassed ? m_weights[WEIGHT_OTHER_PASSED] : 0.0f) + m_weights[WEIGHT_BIAS];
+            }
+        }
+    }
+}
+
+/* *********************************************************************
+Function Name: evaluateScalar
+Purpose: Score BATCH_SIZE positions of a batch, lane by lane.
+Parameters:
+        batch, a Batch passed by const reference.
+        outValues, an array of BATCH_SIZE floats.
+Return Value: None
+Algorithm: For each mask, add the table entry of each of its groups,
+        then add the arms' entry.
+Reference: None
+********************************************************************* */
+void LinearEvaluator::evaluateScalar(const Batch& batch, float* outValues) const {
+    for (int lane = 0; lane < batch.count; ++lane) {
+        uint32_t masks[3] = { static_cast<uint32_t>(batch.ownHand[lane]), static_cast<uint32_t>(batch.otherHand[lane]),
+            static_cast<uint32_t>(batch.boneyard[lane]) };
+        float value = m_arms[batch.arms[lane]];
+
+        for (int table = 0; table < TABLE_COUNT; ++table) {
+            value += m_groups[table][(masks[table / GROUP_COUNT] >> ((table % GROUP_COUNT) * GROUP_BITS)) & (GROUP_SIZE - 1)];
+        }
+        outValues[lane] = value;
+    }
+}
+
+/* *********************************************************************
+Function Name: evaluateAvx2
+Purpose: Score BATCH_SIZE positions of a batch, eight lanes to a vector.
+Parameters:
+        batch, a Batch passed by const reference.
+        outValues, an array of BATCH_SIZE floats, 32-byte aligned.
+Return Value: None
+Algorithm: As evaluateScalar(), gathering the entries of eight lanes at
+        once.
+Reference: Intel Intrinsics Guide
+********************************************************************* */
+LINEAR_TARGET_AVX2 void LinearEvaluator::evaluateAvx2(const Batch& batch, float* outValues) const {
+#if defined(LINEAR_X86)
+    const __m256i groupMask = _mm256_set1_epi32(GROUP_SIZE - 1);
+
+    for (int first = 0; first < BATCH_SIZE; first += 8) {
+        __m256i masks[3] = {
+            _mm256_load_si256(reinterpret_cast<const __m256i*>(&batch.ownHand[first])),
+            _mm256_load_si256(reinterpret_cast<const __m256i*>(&batch.otherHand[first])),
+            _mm256_load_si256(reinterpret_cast<const __m256i*>(&batch.boneyard[first]))
+        };
+        __m256 value = _mm256_i32gather_ps(m_arms, _mm256_load_si256(reinterpret_cast<const __m256i*>(&batch.arms[first])), 4);
+
+        for (int table = 0; table < TABLE_COUNT; ++table) {
+            __m256i shifted = _mm256_srli_epi32(masks[table / GROUP_COUNT], (table % GROUP_COUNT) * GROUP_BITS);
+            value = _mm256_add_ps(value, _mm256_i32gather_ps(m_groups[table], _mm256_and_si256(shifted, groupMask), 4));
+        }
+        _mm256_store_ps(outValues + first, value);
+    }
+#else
+    evaluateScalar(batch, outValues);
+#endif
+}
+
+/* *********************************************************************
+Function Name: evaluateAvx512
+Purpose: Score BATCH_SIZE positions of a batch, sixteen lanes to a
+        vector.
+Parameters:
+        batch, a Batch passed by const reference.
+        outValues, an array of BATCH_SIZE floats, 64-byte aligned.
+Return Value: None
+Algorithm: As evaluateScalar(), gathering the entries of every lane at
+        once.
+Reference: Intel Intrinsics Guide
+********************************************************************* */
+// GCC 12's AVX-512 headers start gathers from an undefined vector and trip these falsely
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#endif
+LINEAR_TARGET_AVX512 void LinearEvaluator::evaluateAvx512(const Batch& batch, float* outValues) const {
+#if defined(LINEAR_X86)
+    const __m512i groupMask = _mm512_set1_epi32(GROUP_SIZE - 1);
+
+    __m512i masks[3] = {
+        _mm512_load_si512(batch.ownHand),
+        _mm512_load_si512(batch.otherHand),
+        _mm512_load_si512(batch.boneyard)
+    };
+    __m512 value = _mm512_i32gather_ps(_mm512_load_si512(batch.arms), m_arms, 4);
+
+    for (int table = 0; table < TABLE_COUNT; ++table) {
+        __m512i shifted = _mm512_srli_epi32(masks[table / GROUP_COUNT], (table % GROUP_COUNT) * GROUP_BITS);
+        value = _mm512_add_ps(value, _mm512_i32gather_ps(_mm512_and_si512(shifted, groupMask), m_groups[table], 4));
+    }
+    _mm512_store_ps(outValues, value);
+#else
+    evaluateScalar(batch, outValues);
+#endif
+}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
\ No newline at end of file
@@ -0,0 +1,299 @@
+#ifndef LINEAREVALUATOR_H
+#define LINEAREVALUATOR_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <cstdint>
+#include <string>
+
+#include "DominoSet.h"
+#include "Playout.h"
+#include "TrainingData.h"
+
+/* *********************************************************************
+Class Name: LinearEvaluator
+Purpose: A learned static evaluation of a two-player double-six position:
+        the points the mover can expect to win in the round minus the
+        opponent's, as a weighted sum of features. The features are seen
+        from the mover's side: one per tile for where it is (the mover's
+        hand, the opponent's hand or the boneyard; a tile on the layout
+        has none), one per pip value for each arm's open end, one for each
+        player's pass flag, and a constant. The weights are fitted to the
+        outcomes of self-play rounds (see TrainingData) by least squares,
+        and saved to and loaded from a small file.
+
+        The features are bits of tile masks, so a sum over them is a sum of
+        table lookups: each mask is cut into four groups of seven tiles,
+        and a table holds the weight total of every group, so a position
+        costs thirteen lookups whatever its tiles. Batches of positions
+        are kept as structure-of-arrays and scored sixteen at a time, by
+        vector gathers from the same tables on processors with AVX2 or
+        AVX-512 (see LockstepPlayout::getBestPath()) and lane by lane
+        otherwise.
+
+        The file is a HEADER_SIZE byte header (the bytes "LGEV", the
+        version and the number of weights) followed by WEIGHT_COUNT
+        little-endian floats, in the order the WEIGHT_ constants give.
+********************************************************************* */
+class LinearEvaluator {
+public:
+
+    static const int HEADER_SIZE = 16;
+    static const int FILE_VERSION = 1;
+
+    // Where each group of features starts among the weights
+    static const int WEIGHT_OWN_HAND = 0;
+    static const int WEIGHT_OTHER_HAND = WEIGHT_OWN_HAND + StandardSet::TILE_COUNT;
+    static const int WEIGHT_BONEYARD = WEIGHT_OTHER_HAND + StandardSet::TILE_COUNT;
+    static const int WEIGHT_OWN_END = WEIGHT_BONEYARD + StandardSet::TILE_COUNT;
+    static const int WEIGHT_OTHER_END = WEIGHT_OWN_END + StandardSet::MAX_PIPS + 1;
+    static const int WEIGHT_OWN_PASSED = WEIGHT_OTHER_END + StandardSet::MAX_PIPS + 1;
+    static const int WEIGHT_OTHER_PASSED = WEIGHT_OWN_PASSED + 1;
+    static const int WEIGHT_BIAS = WEIGHT_OTHER_PASSED + 1;
+    static const int WEIGHT_COUNT = WEIGHT_BIAS + 1;
+
+    // Positions scored together
+    static const int BATCH_SIZE = 16;
+
+    // Positions to be scored, from each one's mover's side; lanes never filled read as empty
+    struct Batch {
+        alignas(64) int32_t ownHand[BATCH_SIZE] = {};
+        alignas(64) int32_t otherHand[BATCH_SIZE] = {};
+        alignas(64) int32_t boneyard[BATCH_SIZE] = {};
+        alignas(64) int32_t arms[BATCH_SIZE] = {};  // ((ownEnd * 7 + otherEnd) * 2 + ownPassed) * 2 + otherPassed
+        int count = 0;
+    };
+
+    /* --- Constructor --- */
+
+    /* *********************************************************************
+    Function Name: LinearEvaluator
+    Purpose: Default constructor. Every weight is zero, so every position
+            scores 0 until weights are loaded or trained.
+    Parameters: None
+    Return Value: None
+    Algorithm: Zero the weights and build the tables.
+    Reference: None
+    ********************************************************************* */
+    LinearEvaluator();
+
+    /* --- Destructor --- */
+
+    /* *********************************************************************
+    Function Name: ~LinearEvaluator
+    Purpose: Destructor. Nothing is allocated, so nothing is released.
+    Parameters: None
+    Return Value: None
+    Algorithm: Standard object destruction.
+    Reference: None
+    ********************************************************************* */
+    ~LinearEvaluator() = default;
+
+    /* --- Selectors --- */
+
+    /* *********************************************************************
+    Function Name: getWeight
+    Purpose: Retrieves one weight.
+    Parameters:
+            index, an integer between 0 and WEIGHT_COUNT - 1.
+    Return Value: The weight, in points.
+    Algorithm: Return the stored weight.
+    Reference: None
+    ********************************************************************* */
+    inline float getWeight(int index) const { return m_weights[index]; }
+
+    /* *********************************************************************
+    Function Name: evaluate
+    Purpose: Scores one position for its mover.
+    Parameters:
+            position, a two-player Playout passed by const reference. The
+                round is in progress.
+    Return Value: The mover's expected points minus the opponent's.
+    Algorithm: Find the position's features and add up their table
+            entries.
+    Reference: None
+    ********************************************************************* */
+    float evaluate(const Playout& position) const;
+
+    /* *********************************************************************
+    Function Name: evaluateBatch
+    Purpose: Scores every position in a batch.
+    Parameters:
+            batch, a Batch passed by const reference.
+            outValues, an array of at least batch.count floats. Receives
+                each position's score for its mover.
+            path, an integer. LockstepPlayout::PATH_SCALAR, PATH_AVX2 or
+                PATH_AVX512; the default, -1, takes the widest the
+                processor supports. A path it lacks falls back to the
+                scalar one.
+    Return Value: None
+    Algorithm: For sixteen positions at a time, look up each group of
+            seven tiles of each mask and the arms' entry, and add them;
+            the vector paths gather the lookups of every lane at once.
+    Reference: Intel Intrinsics Guide
+    ********************************************************************* */
+    void evaluateBatch(const Batch& batch, float* outValues, int path = -1) const;
+
+    /* *********************************************************************
+    Function Name: evaluateMoves
+    Purpose: Scores each of the mover's candidate moves at once.
+    Parameters:
+            position, a two-player Playout passed by const reference. The
+                round is in progress.
+            indices, arms, arrays of count integers. The moves, as listed
+                by Playout::listMoves().
+            count, an integer between 0 and Playout::MAX_MOVES.
+            outValues, an array of count floats. Receives each move's
+                value for the mover: the score of the position after it,
+                turned to the mover's side, or the points won exactly if
+                the move goes out.
+    Return Value: None
+    Algorithm:
+            1. Make each move in a copy of the position and add the
+                position after it to batches; a move that ends the round
+                is worth its points.
+            2. Score the batches with evaluateBatch().
+            3. Negate each score, which is the opponent's.
+    Reference: None
+    ********************************************************************* */
+    void evaluateMoves(const Playout& position, const int* indices, const int* arms, int count, float* outValues) const;
+
+    /* *********************************************************************
+    Function Name: addPosition / addRecord
+    Purpose: Add a position to a batch, from its mover's side.
+    Parameters:
+            batch, a Batch passed by reference. Holds fewer than
+                BATCH_SIZE positions.
+            position, a two-player Playout passed by const reference. /
+                record, a TrainingData::Record passed by const reference.
+    Return Value: None
+    Algorithm: Store the mover's hand, the opponent's, the boneyard and
+            the arms' entry in the next lane.
+    Reference: None
+    ********************************************************************* */
+    static void addPosition(Batch& batch, const Playout& position);
+    static void addRecord(Batch& batch, const TrainingData::Record& record);
+
+    /* --- Mutators --- */
+
+    /* *********************************************************************
+    Function Name: load
+    Purpose: Reads weights written by save().
+    Parameters:
+            filename, a string representing the model path.
+    Return Value: Boolean true if the weights were read; false, with an
+            error message, otherwise, leaving the weights as they were.
+    Algorithm:
+            1. Read and check the header.
+            2. Read the weights and build the tables.
+    Reference: None
+    ********************************************************************* */
+    bool load(const std::string& filename);
+
+    /* *********************************************************************
+    Function Name: train
+    Purpose: Fits the weights to the outcomes of recorded rounds.
+    Parameters:
+            data, an open TrainingData passed by const reference.
+            first, count, integers. The records to fit.
+            ridge, a double. The penalty on the square of every weight,
+                which keeps them finite where features always go
+                together (one end value per arm, for instance).
+    Return Value: Boolean true if the weights were fitted; false if there
+            were no records.
+    Algorithm:
+            1. For each record, list its active features from the mover's
+                side and add their products to the normal equations of
+                least squares; at most about forty features are active,
+                so a record costs about eight hundred additions.
+            2. Add the ridge to the diagonal and solve by Cholesky
+                decomposition.
+            3. Build the tables.
+    Reference: Hoerl, A. E. and Kennard, R. W. (1970), "Ridge
+            regression: Biased estimation for nonorthogonal problems"
+    ********************************************************************* */
+    bool train(const TrainingData& data, long long first, long long count, double ridge);
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: save
+    Purpose: Writes the weights to a file.
+    Parameters:
+            filename, a string representing the model path.
+    Return Value: Boolean true if the file was written; false, with an
+            error message, otherwise.
+    Algorithm: Write the header, then the weights.
+    Reference: None
+    ********************************************************************* */
+    bool save(const std::string& filename) const;
+
+private:
+
+    // Tiles per lookup, and lookups per mask
+    static const int GROUP_BITS = 7;
+    static const int GROUP_COUNT = StandardSet::TILE_COUNT / GROUP_BITS;
+    static const int GROUP_SIZE = 1 << GROUP_BITS;
+
+    // Lookups per position: every group of the three masks, then the arms
+    static const int TABLE_COUNT = GROUP_COUNT * 3;
+    static const int ARM_ENTRIES = (StandardSet::MAX_PIPS + 1) * (StandardSet::MAX_PIPS + 1) * 4;
+
+    float m_weights[WEIGHT_COUNT];
+
+    // The weight totals of every group of each mask, mask by mask, and of every arms' entry with the bias
+    alignas(64) float m_groups[TABLE_COUNT][GROUP_SIZE];
+    alignas(64) float m_arms[ARM_ENTRIES];
+
+    /* *********************************************************************
+    Function Name: buildTables
+    Purpose: Fills the lookup tables from the weights.
+    Parameters: None
+    Return Value: None
+    Algorithm:
+            1. For each mask and group, total the weights of the tiles of
+                every subset of the group.
+            2. For each arms' entry, total the two ends' weights, the pass
+                flags' and the bias.
+    Reference: None
+    ********************************************************************* */
+    void buildTables();
+
+    /* *********************************************************************
+    Function Name: evaluateScalar / evaluateAvx2 / evaluateAvx512
+    Purpose: Score BATCH_SIZE positions of a batch, lane by lane, eight
+            lanes to a vector or sixteen to a vector.
+    Parameters:
+            batch, a Batch passed by const reference.
+            outValues, an array of BATCH_SIZE floats.
+    Return Value: None
+    Algorithm: For each mask, add the table entry of each of its groups,
+            then add the arms' entry.
+    Reference: Intel Intrinsics Guide
+    ********************************************************************* */
+    void evaluateScalar(const Batch& batch, float* outValues) const;
+    void evaluateAvx2(const Batch& batch, float* outValues) const;
+    void evaluateAvx512(const Batch& batch, float* outValues) const;
+
+    /* *********************************************************************
+    Function Name: getArmsEntry
+    Purpose: Numbers the state of the arms from the mover's side.
+    Parameters:
+            ownEnd, otherEnd, integers. The open pips of the mover's arm
+                and of the opponent's.
+            ownPassed, otherPassed, booleans. Each player's pass flag.
+    Return Value: An integer between 0 and ARM_ENTRIES - 1.
+    Algorithm: Combine the values, ends first.
+    Reference: None
+    ********************************************************************* */
+    static inline int getArmsEntry(int ownEnd, int otherEnd, bool ownPassed, bool otherPassed) {
+        return ((ownEnd * (StandardSet::MAX_PIPS + 1) + otherEnd) * 2 + (ownPassed ? 1 : 0)) * 2 + (otherPassed ? 1 : 0);
+    }
+};
+
+#endif
\ No newline at end of file
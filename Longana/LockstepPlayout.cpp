@@ -0,0 +1,545 @@
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <bit>
+#include <cstdint>
+
+#include "LockstepPlayout.h"
+#include "Playout.h"
+
+// The vector paths exist only on x86; elsewhere they fall back to the scalar one
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define LOCKSTEP_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+// GCC and Clang compile intrinsics only inside functions built for the instruction set
+#if defined(LOCKSTEP_X86) && defined(__GNUC__)
+#define LOCKSTEP_TARGET_AVX2 __attribute__((target("avx2")))
+#define LOCKSTEP_TARGET_AVX512 __attribute__((target("avx512f")))
+#else
+#define LOCKSTEP_TARGET_AVX2
+#define LOCKSTEP_TARGET_AVX512
+#endif
+
+/* *********************************************************************
+Function Name: LockstepPlayout
+Purpose: Default constructor. Every lane holds a finished, empty round.
+Parameters: None
+Return Value: None
+Algorithm: Zero every field and mark every lane over.
+Reference: None
+********************************************************************* */
+LockstepPlayout::LockstepPlayout()
+    : m_hands(), m_ends(), m_passed(), m_mover(), m_cursor(), m_tileCount(), m_isOver(), m_points(),
+    m_doubles(), m_pipMasks(), m_high(), m_low()
+{
+    for (int lane = 0; lane < LANES; ++lane) {
+        m_isOver[lane] = 1;
+    }
+}
+
+/* *********************************************************************
+Function Name: getBestPath
+Purpose: Finds the widest code path this processor supports.
+Parameters: None
+Return Value: PATH_AVX512, PATH_AVX2 or PATH_SCALAR.
+Algorithm: Ask the processor once, through CPUID on MSVC or the
+        compiler's built-in check elsewhere, and remember the answer.
+Reference: Intel 64 and IA-32 Architectures Software Developer's
+        Manual, CPUID leaf 7
+********************************************************************* */
+int LockstepPlayout::getBestPath() {
+    static const int bestPath = []() {
+#if defined(LOCKSTEP_X86) && defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7) {
+            return PATH_SCALAR;
+        }
+
+        // The operating system must also save the wider registers (OSXSAVE, then XCR0)
+        __cpuid(info, 1);
+        if ((info[2] & (1 << 27)) == 0) {
+            return PATH_SCALAR;
+        }
+        unsigned long long enabled = _xgetbv(0);
+
+        __cpuidex(info, 7, 0);
+        if ((info[1] & (1 << 16)) != 0 && (enabled & 0xE6) == 0xE6) {
+            return PATH_AVX512;
+        }
+        if ((info[1] & (1 << 5)) != 0 && (enabled & 0x06) == 0x06) {
+            return PATH_AVX2;
+        }
+        return PATH_SCALAR;
+#elif defined(LOCKSTEP_X86) && defined(__GNUC__)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            return PATH_AVX512;
+        }
+        if (__builtin_cpu_supports("avx2")) {
+            return PATH_AVX2;
+        }
+        return PATH_SCALAR;
+#else
+        return PATH_SCALAR;
+#endif
+    }();
+
+    return bestPath;
+}
+
+/* *********************************************************************
+Function Name: loadLane
+Purpose: Copies a two-player round into a lane.
+Parameters:
+        lane, an integer between 0 and LANES - 1.
+        round, a Playout passed by const reference. A two-player round.
+Return Value: None
+Algorithm:
+        1. Number the tiles by position: the Human's hand, the
+            Computer's hand, then the boneyard, each in order.
+        2. Build the lane's tables: the positions holding each pip
+            value, the doubles, and the pips at each position.
+        3. Copy the ends, pass flags and mover, and mark the lane over
+            if the round already is.
+Reference: None
+********************************************************************* */
+void LockstepPlayout::loadLane(int lane, const Playout& round) {
+    int position = 0;
+
+    for (int pips = 0; pips < 8; ++pips) {
+        m_pipMasks[lane][pips] = 0;
+    }
+    m_doubles[lane] = 0;
+
+    // 1-2. Hands first, then the boneyard, so draws always land after the hand
+    for (int player = HUMAN; player <= COMPUTER + 1; ++player) {
+        bool isBoneyard = (player > COMPUTER);
+        int count = isBoneyard ? round.getBoneyardSize() : round.getHandSize(player);
+        uint32_t hand = 0;
+
+        for (int i = 0; i < count; ++i) {
+            unsigned char packed = isBoneyard ? round.getBoneyardPacked(i) : round.getHandPacked(player, i);
+            int high = packed >> 4;
+            int low = packed & 0x0F;
+            uint32_t bit = uint32_t(1) << position;
+
+            m_high[lane][position] = high;
+            m_low[lane][position] = low;
+            m_pipMasks[lane][high] |= bit;
+            m_pipMasks[lane][low] |= bit;
+            if (high == low) {
+                m_doubles[lane] |= bit;
+            }
+
+            hand |= bit;
+            ++position;
+        }
+
+        if (!isBoneyard) {
+            m_hands[player][lane] = hand;
+        }
+        else {
+            m_cursor[lane] = position - count;
+            m_tileCount[lane] = position;
+        }
+    }
+
+    // 3. The rest of the state
+    for (int player = HUMAN; player <= COMPUTER; ++player) {
+        m_ends[player][lane] = round.getArmEnd(player);
+        m_passed[player][lane] = round.hasPassed(player) ? 1 : 0;
+        m_points[player][lane] = round.getPoints(player);
+    }
+    m_mover[lane] = round.getMover();
+    m_isOver[lane] = round.isOver() ? 1 : 0;
+}
+
+/* *********************************************************************
+Function Name: playRounds
+Purpose: Plays every lane's round to the end.
+Parameters:
+        path, an integer. PATH_SCALAR, PATH_AVX2 or PATH_AVX512; the
+            default, -1, takes getBestPath(). A path the processor
+            lacks falls back to the scalar one.
+Return Value: None
+Algorithm: Run turns on every unfinished lane together until all are
+        over, then award the points of each finished lane.
+Reference: None
+********************************************************************* */
+void LockstepPlayout::playRounds(int path) {
+    int bestPath = getBestPath();
+    if (path < 0 || path > bestPath) {
+        path = (path < 0) ? bestPath : PATH_SCALAR;
+    }
+
+    bool wasOver[LANES];
+    for (int lane = 0; lane < LANES; ++lane) {
+        wasOver[lane] = (m_isOver[lane] != 0);
+    }
+
+    if (path == PATH_AVX512) {
+        playAvx512();
+    }
+    else if (path == PATH_AVX2) {
+        playAvx2();
+    }
+    else {
+        playScalar();
+    }
+
+    for (int lane = 0; lane < LANES; ++lane) {
+        if (!wasOver[lane]) {
+            finishLane(lane);
+        }
+    }
+}
+
+/* *********************************************************************
+Function Name: playScalar
+Purpose: Run turns on every unfinished lane until all are over, one lane
+        at a time.
+Parameters: None
+Return Value: None
+Algorithm: See playAvx2(); each step is written with plain integers.
+Reference: None
+********************************************************************* */
+void LockstepPlayout::playScalar() {
+    for (int lane = 0; lane < LANES; ++lane) {
+        while (!m_isOver[lane]) {
+            int mover = m_mover[lane];
+            int other = 1 - mover;
+            uint32_t hand = m_hands[mover][lane];
+
+            // Masks of the positions fitting each end
+            uint32_t allowed = m_passed[other][lane] ? ~uint32_t(0) : m_doubles[lane];
+            uint32_t ownMask = m_pipMasks[lane][m_ends[mover][lane]];
+            uint32_t otherMask = m_pipMasks[lane][m_ends[other][lane]] & allowed;
+            uint32_t fitsOwn = hand & ownMask;
+            uint32_t fitsOther = hand & otherMask;
+
+            // Draw once if nothing fits
+            if ((fitsOwn | fitsOther) == 0 && m_cursor[lane] < m_tileCount[lane]) {
+                uint32_t drawn = uint32_t(1) << m_cursor[lane]++;
+                hand |= drawn;
+                fitsOwn = drawn & ownMask;
+                fitsOther = drawn & otherMask;
+            }
+
+            // Play the lowest position, own end first, or pass
+            uint32_t choices = (fitsOwn != 0) ? fitsOwn : fitsOther;
+            if (choices != 0) {
+                int position = std::countr_zero(choices);
+                int& end = m_ends[(fitsOwn != 0) ? mover : other][lane];
+
+                end = (end == m_high[lane][position]) ? m_low[lane][position] : m_high[lane][position];
+                hand &= ~(uint32_t(1) << position);
+                m_passed[mover][lane] = 0;
+            }
+            else {
+                m_passed[mover][lane] = 1;
+            }
+
+            m_hands[mover][lane] = hand;
+            m_mover[lane] = other;
+            m_isOver[lane] = isFinished(lane) ? 1 : 0;
+        }
+    }
+}
+
+/* *********************************************************************
+Function Name: playAvx2
+Purpose: Run turns on every unfinished lane until all are over, eight
+        lanes per 256-bit vector.
+Parameters: None
+Return Value: None
+Algorithm: For each half of the lanes, keep the state in registers and
+        repeat while any lane is playing:
+        1. Pick the mover's hand, ends and the opponent's pass flag by
+            blending the two players' vectors on mover == 0.
+        2. Gather each lane's masks of positions fitting both ends; the
+            opponent's end allows only doubles unless they passed.
+        3. Where nothing fits and the boneyard is not empty, add the
+            bit at the cursor to the hand and advance the cursor.
+        4. Isolate the lowest fitting bit, own end first, and find its
+            position from the exponent of its float conversion; gather
+            its pips and open the end it was played on.
+        5. Update the hands, pass flags and mover, and mark lanes over.
+Reference: Intel Intrinsics Guide
+********************************************************************* */
+LOCKSTEP_TARGET_AVX2 void LockstepPlayout::playAvx2() {
+#if defined(LOCKSTEP_X86)
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i allBits = _mm256_set1_epi32(-1);
+
+    for (int first = 0; first < LANES; first += 8) {
+        __m256i lanes = _mm256_setr_epi32(first, first + 1, first + 2, first + 3, first + 4, first + 5, first + 6, first + 7);
+        __m256i maskRows = _mm256_slli_epi32(lanes, 3);
+        __m256i pipRows = _mm256_slli_epi32(lanes, 5);
+
+        __m256i hand0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(&m_hands[HUMAN][first]));
+        __m256i hand1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(&m_hands[COMPUTER][first]));
+        __m256i end0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(&m_ends[HUMAN][first]));
+        __m256i end1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(&m_ends[COMPUTER][first]));
+        __m256i passed0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(&m_passed[HUMAN][first]));
+        __m256i passed1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(&m_passed[COMPUTER][first]));
+        __m256i mover = _mm256_load_si256(reinterpret_cast<const __m256i*>(&m_mover[first]));
+        __m256i cursor = _mm256_load_si256(reinterpret_cast<const __m256i*>(&m_cursor[first]));
+        __m256i tileCount = _mm256_load_si256(reinterpret_cast<const __m256i*>(&m_tileCount[first]));
+        __m256i isOver = _mm256_load_si256(reinterpret_cast<const __m256i*>(&m_isOver[first]));
+        __m256i doubles = _mm256_load_si256(reinterpret_cast<const __m256i*>(&m_doubles[first]));
+
+        __m256i active = _mm256_cmpeq_epi32(isOver, zero);
+
+        while (_mm256_movemask_epi8(active) != 0) {
+            // 1. The mover's view
+            __m256i isHuman = _mm256_cmpeq_epi32(mover, zero);
+            __m256i hand = _mm256_blendv_epi8(hand1, hand0, isHuman);
+            __m256i ownEnd = _mm256_blendv_epi8(end1, end0, isHuman);
+            __m256i otherEnd = _mm256_blendv_epi8(end0, end1, isHuman);
+            __m256i otherPassed = _mm256_cmpgt_epi32(_mm256_blendv_epi8(passed0, passed1, isHuman), zero);
+
+            // 2. Positions fitting each end
+            __m256i allowed = _mm256_blendv_epi8(doubles, allBits, otherPassed);
+            __m256i ownMask = _mm256_i32gather_epi32(reinterpret_cast<const int*>(&m_pipMasks[0][0]),
+                _mm256_add_epi32(maskRows, ownEnd), 4);
+            __m256i otherMask = _mm256_and_si256(allowed, _mm256_i32gather_epi32(reinterpret_cast<const int*>(&m_pipMasks[0][0]),
+                _mm256_add_epi32(maskRows, otherEnd), 4));
+            __m256i fitsOwn = _mm256_and_si256(hand, ownMask);
+            __m256i fitsOther = _mm256_and_si256(hand, otherMask);
+
+            // 3. Draw once where nothing fits
+            __m256i noMove = _mm256_cmpeq_epi32(_mm256_or_si256(fitsOwn, fitsOther), zero);
+            __m256i canDraw = _mm256_and_si256(_mm256_and_si256(noMove, active), _mm256_cmpgt_epi32(tileCount, cursor));
+            __m256i drawn = _mm256_and_si256(canDraw, _mm256_sllv_epi32(one, cursor));
+            cursor = _mm256_sub_epi32(cursor, canDraw);
+            hand = _mm256_or_si256(hand, drawn);
+            fitsOwn = _mm256_or_si256(fitsOwn, _mm256_and_si256(drawn, ownMask));
+            fitsOther = _mm256_or_si256(fitsOther, _mm256_and_si256(drawn, otherMask));
+
+            // 4. The lowest fitting position, own end first
+            __m256i useOwn = _mm256_xor_si256(_mm256_cmpeq_epi32(fitsOwn, zero), allBits);
+            __m256i choices = _mm256_and_si256(_mm256_blendv_epi8(fitsOther, fitsOwn, useOwn), active);
+            __m256i choice = _mm256_and_si256(choices, _mm256_sub_epi32(zero, choices));
+            __m256i played = _mm256_xor_si256(_mm256_cmpeq_epi32(choice, zero), allBits);
+
+            __m256i exponent = _mm256_srli_epi32(_mm256_castps_si256(_mm256_cvtepi32_ps(choice)), 23);
+            __m256i position = _mm256_and_si256(_mm256_sub_epi32(exponent, _mm256_set1_epi32(127)), played);
+            __m256i high = _mm256_i32gather_epi32(reinterpret_cast<const int*>(&m_high[0][0]), _mm256_add_epi32(pipRows, position), 4);
+            __m256i low = _mm256_i32gather_epi32(reinterpret_cast<const int*>(&m_low[0][0]), _mm256_add_epi32(pipRows, position), 4);
+
+            // The left end is the Human's own, so it was played on when isHuman == useOwn
+            __m256i onLeft = _mm256_cmpeq_epi32(isHuman, useOwn);
+            __m256i playedEnd = _mm256_blendv_epi8(end1, end0, onLeft);
+            __m256i newEnd = _mm256_blendv_epi8(high, low, _mm256_cmpeq_epi32(playedEnd, high));
+            end0 = _mm256_blendv_epi8(end0, newEnd, _mm256_and_si256(played, onLeft));
+            end1 = _mm256_blendv_epi8(end1, newEnd, _mm256_andnot_si256(onLeft, played));
+
+            // 5. Hands, pass flags, mover, and the end of the round
+            hand = _mm256_andnot_si256(choice, hand);
+            hand0 = _mm256_blendv_epi8(hand0, hand, isHuman);
+            hand1 = _mm256_blendv_epi8(hand, hand1, isHuman);
+
+            __m256i passedNow = _mm256_andnot_si256(played, one);
+            passed0 = _mm256_blendv_epi8(passed0, passedNow, _mm256_and_si256(active, isHuman));
+            passed1 = _mm256_blendv_epi8(passed1, passedNow, _mm256_andnot_si256(isHuman, active));
+            mover = _mm256_xor_si256(mover, _mm256_and_si256(active, one));
+
+            __m256i emptyHand = _mm256_or_si256(_mm256_cmpeq_epi32(hand0, zero), _mm256_cmpeq_epi32(hand1, zero));
+            __m256i blocked = _mm256_and_si256(_mm256_cmpeq_epi32(cursor, tileCount),
+                _mm256_and_si256(_mm256_cmpgt_epi32(passed0, zero), _mm256_cmpgt_epi32(passed1, zero)));
+            active = _mm256_andnot_si256(_mm256_or_si256(emptyHand, blocked), active);
+        }
+
+        _mm256_store_si256(reinterpret_cast<__m256i*>(&m_hands[HUMAN][first]), hand0);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(&m_hands[COMPUTER][first]), hand1);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(&m_ends[HUMAN][first]), end0);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(&m_ends[COMPUTER][first]), end1);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(&m_passed[HUMAN][first]), passed0);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(&m_passed[COMPUTER][first]), passed1);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(&m_mover[first]), mover);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(&m_cursor[first]), cursor);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(&m_isOver[first]), one);
+    }
+#else
+    playScalar();
+#endif
+}
+
+/* *********************************************************************
+Function Name: playAvx512
+Purpose: Run turns on every unfinished lane until all are over, all
+        sixteen lanes in one 512-bit vector.
+Parameters: None
+Return Value: None
+Algorithm: As playAvx2(), with mask registers in place of blends.
+Reference: Intel Intrinsics Guide
+********************************************************************* */
+// GCC 12's AVX-512 headers start from _mm512_undefined_epi32() and trip this falsely
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+LOCKSTEP_TARGET_AVX512 void LockstepPlayout::playAvx512() {
+#if defined(LOCKSTEP_X86)
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i one = _mm512_set1_epi32(1);
+    const __m512i allBits = _mm512_set1_epi32(-1);
+
+    __m512i lanes = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    __m512i maskRows = _mm512_slli_epi32(lanes, 3);
+    __m512i pipRows = _mm512_slli_epi32(lanes, 5);
+
+    __m512i hand0 = _mm512_load_si512(&m_hands[HUMAN][0]);
+    __m512i hand1 = _mm512_load_si512(&m_hands[COMPUTER][0]);
+    __m512i end0 = _mm512_load_si512(&m_ends[HUMAN][0]);
+    __m512i end1 = _mm512_load_si512(&m_ends[COMPUTER][0]);
+    __m512i passed0 = _mm512_load_si512(&m_passed[HUMAN][0]);
+    __m512i passed1 = _mm512_load_si512(&m_passed[COMPUTER][0]);
+    __m512i mover = _mm512_load_si512(&m_mover[0]);
+    __m512i cursor = _mm512_load_si512(&m_cursor[0]);
+    __m512i tileCount = _mm512_load_si512(&m_tileCount[0]);
+    __m512i doubles = _mm512_load_si512(&m_doubles[0]);
+
+    __mmask16 active = _mm512_cmpeq_epi32_mask(_mm512_load_si512(&m_isOver[0]), zero);
+
+    while (active != 0) {
+        // 1. The mover's view
+        __mmask16 isHuman = _mm512_cmpeq_epi32_mask(mover, zero);
+        __m512i hand = _mm512_mask_blend_epi32(isHuman, hand1, hand0);
+        __m512i ownEnd = _mm512_mask_blend_epi32(isHuman, end1, end0);
+        __m512i otherEnd = _mm512_mask_blend_epi32(isHuman, end0, end1);
+        __mmask16 otherPassed = _mm512_cmpgt_epi32_mask(_mm512_mask_blend_epi32(isHuman, passed0, passed1), zero);
+
+        // 2. Positions fitting each end
+        __m512i allowed = _mm512_mask_blend_epi32(otherPassed, doubles, allBits);
+        __m512i ownMask = _mm512_i32gather_epi32(_mm512_add_epi32(maskRows, ownEnd), &m_pipMasks[0][0], 4);
+        __m512i otherMask = _mm512_and_si512(allowed, _mm512_i32gather_epi32(_mm512_add_epi32(maskRows, otherEnd), &m_pipMasks[0][0], 4));
+        __m512i fitsOwn = _mm512_and_si512(hand, ownMask);
+        __m512i fitsOther = _mm512_and_si512(hand, otherMask);
+
+        // 3. Draw once where nothing fits
+        __mmask16 canDraw = _mm512_cmpeq_epi32_mask(_mm512_or_si512(fitsOwn, fitsOther), zero)
+            & active & _mm512_cmpgt_epi32_mask(tileCount, cursor);
+        __m512i drawn = _mm512_maskz_sllv_epi32(canDraw, one, cursor);
+        cursor = _mm512_mask_add_epi32(cursor, canDraw, cursor, one);
+        hand = _mm512_or_si512(hand, drawn);
+        fitsOwn = _mm512_or_si512(fitsOwn, _mm512_and_si512(drawn, ownMask));
+        fitsOther = _mm512_or_si512(fitsOther, _mm512_and_si512(drawn, otherMask));
+
+        // 4. The lowest fitting position, own end first
+        __mmask16 useOwn = _mm512_cmpneq_epi32_mask(fitsOwn, zero);
+        __m512i choices = _mm512_maskz_mov_epi32(active, _mm512_mask_blend_epi32(useOwn, fitsOther, fitsOwn));
+        __m512i choice = _mm512_and_si512(choices, _mm512_sub_epi32(zero, choices));
+        __mmask16 played = _mm512_cmpneq_epi32_mask(choice, zero);
+
+        __m512i exponent = _mm512_srli_epi32(_mm512_castps_si512(_mm512_cvtepi32_ps(choice)), 23);
+        __m512i position = _mm512_maskz_sub_epi32(played, exponent, _mm512_set1_epi32(127));
+        __m512i high = _mm512_i32gather_epi32(_mm512_add_epi32(pipRows, position), &m_high[0][0], 4);
+        __m512i low = _mm512_i32gather_epi32(_mm512_add_epi32(pipRows, position), &m_low[0][0], 4);
+
+        // The left end is the Human's own, so it was played on when isHuman == useOwn
+        __mmask16 onLeft = static_cast<__mmask16>(~(isHuman ^ useOwn));
+        __m512i playedEnd = _mm512_mask_blend_epi32(onLeft, end1, end0);
+        __m512i newEnd = _mm512_mask_blend_epi32(_mm512_cmpeq_epi32_mask(playedEnd, high), high, low);
+        end0 = _mm512_mask_mov_epi32(end0, played & onLeft, newEnd);
+        end1 = _mm512_mask_mov_epi32(end1, played & static_cast<__mmask16>(~onLeft), newEnd);
+
+        // 5. Hands, pass flags, mover, and the end of the round
+        hand = _mm512_andnot_si512(choice, hand);
+        hand0 = _mm512_mask_mov_epi32(hand0, isHuman, hand);
+        hand1 = _mm512_mask_mov_epi32(hand1, static_cast<__mmask16>(~isHuman), hand);
+
+        __m512i passedNow = _mm512_maskz_mov_epi32(static_cast<__mmask16>(~played), one);
+        passed0 = _mm512_mask_mov_epi32(passed0, active & isHuman, passedNow);
+        passed1 = _mm512_mask_mov_epi32(passed1, active & static_cast<__mmask16>(~isHuman), passedNow);
+        mover = _mm512_mask_xor_epi32(mover, active, mover, one);
+
+        __mmask16 emptyHand = _mm512_cmpeq_epi32_mask(hand0, zero) | _mm512_cmpeq_epi32_mask(hand1, zero);
+        __mmask16 blocked = _mm512_cmpeq_epi32_mask(cursor, tileCount)
+            & _mm512_cmpgt_epi32_mask(passed0, zero) & _mm512_cmpgt_epi32_mask(passed1, zero);
+        active = active & static_cast<__mmask16>(~(emptyHand | blocked));
+    }
+
+    _mm512_store_si512(&m_hands[HUMAN][0], hand0);
+    _mm512_store_si512(&m_hands[COMPUTER][0], hand1);
+    _mm512_store_si512(&m_ends[HUMAN][0], end0);
+    _mm512_store_si512(&m_ends[COMPUTER][0], end1);
+    _mm512_store_si512(&m_passed[HUMAN][0], passed0);
+    _mm512_store_si512(&m_passed[COMPUTER][0], passed1);
+    _mm512_store_si512(&m_mover[0], mover);
+    _mm512_store_si512(&m_cursor[0], cursor);
+    _mm512_store_si512(&m_isOver[0], one);
+#else
+    playScalar();
+#endif
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+/* *********************************************************************
+Function Name: finishLane
+Purpose: Awards the points of a lane that has just ended, as
+        Playout::checkOver does.
+Parameters:
+        lane, an integer between 0 and LANES - 1.
+Return Value: None
+Algorithm:
+        1. Total the pips at the positions in each hand.
+        2. A player with an empty hand wins the other total; otherwise
+            the lower total wins the other, and a tie scores nothing.
+Reference: None
+********************************************************************* */
+void LockstepPlayout::finishLane(int lane) {
+    int totals[2] = { 0, 0 };
+
+    for (int player = HUMAN; player <= COMPUTER; ++player) {
+        for (uint32_t hand = m_hands[player][lane]; hand != 0; hand &= hand - 1) {
+            int position = std::countr_zero(hand);
+            totals[player] += m_high[lane][position] + m_low[lane][position];
+        }
+        m_points[player][lane] = 0;
+    }
+
+    if (m_hands[HUMAN][lane] == 0) {
+        m_points[HUMAN][lane] = totals[COMPUTER];
+    }
+    else if (m_hands[COMPUTER][lane] == 0) {
+        m_points[COMPUTER][lane] = totals[HUMAN];
+    }
+    else if (totals[HUMAN] < totals[COMPUTER]) {
+        m_points[HUMAN][lane] = totals[COMPUTER];
+    }
+    else if (totals[COMPUTER] < totals[HUMAN]) {
+        m_points[COMPUTER][lane] = totals[HUMAN];
+    }
+}
+
+/* *********************************************************************
+Function Name: isFinished
+Purpose: Checks whether a lane's round has just ended.
+Parameters:
+        lane, an integer between 0 and LANES - 1.
+Return Value: Boolean true if a hand is empty, or the boneyard is empty
+        and both players passed.
+Algorithm: Test the hands, cursor and pass flags.
+Reference: None
+********************************************************************* */
+bool LockstepPlayout::isFinished(int lane) const {
+    if (m_hands[HUMAN][lane] == 0 || m_hands[COMPUTER][lane] == 0) {
+        return true;
+    }
+    return m_cursor[lane] == m_tileCount[lane] && m_passed[HUMAN][lane] != 0 && m_passed[COMPUTER][lane] != 0;
+}
\ No newline at end of file
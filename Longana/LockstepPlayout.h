@@ -0,0 +1,212 @@
+#ifndef LOCKSTEPPLAYOUT_H
+#define LOCKSTEPPLAYOUT_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <cstdint>
+
+#include "Playout.h"
+
+/* *********************************************************************
+Class Name: LockstepPlayout
+Purpose: Plays sixteen independent two-player double-six rounds out at
+        once with the Computer's first-fit strategy, one round per vector
+        lane, for Monte Carlo rollouts in bulk.
+
+        The state is kept as structure-of-arrays: each field has one entry
+        per lane, so a vector instruction advances every lane by a turn.
+        The trick that makes first-fit vectorizable is to number a lane's
+        tiles by position: the Human's hand in order, then the Computer's,
+        then the boneyard from the top. Tiles only ever join a hand from
+        the top of the boneyard, at its end, so hand order is always
+        position order, and "the first tile in the hand that fits" is the
+        lowest set bit of the hand's position mask ANDed with the mask of
+        positions that fit. Per-lane tables give the positions holding each
+        pip value and the pips of each position.
+
+        playRounds() picks the widest code path the processor supports at
+        run time: AVX-512 (all sixteen lanes in one vector), AVX2 (two
+        vectors of eight) or plain C++ (lane by lane). All three produce
+        exactly the results of Playout::playRound.
+********************************************************************* */
+class LockstepPlayout {
+public:
+
+    static const int LANES = 16;
+
+    static const int HUMAN = 0;
+    static const int COMPUTER = 1;
+
+    // Code paths playRounds() can take
+    static const int PATH_SCALAR = 0;
+    static const int PATH_AVX2 = 1;
+    static const int PATH_AVX512 = 2;
+
+    /* --- Constructor --- */
+
+    /* *********************************************************************
+    Function Name: LockstepPlayout
+    Purpose: Default constructor. Every lane holds a finished, empty round.
+    Parameters: None
+    Return Value: None
+    Algorithm: Zero every field and mark every lane over.
+    Reference: None
+    ********************************************************************* */
+    LockstepPlayout();
+
+    /* --- Destructor --- */
+
+    /* *********************************************************************
+    Function Name: ~LockstepPlayout
+    Purpose: Destructor. Nothing is allocated, so nothing is released.
+    Parameters: None
+    Return Value: None
+    Algorithm: Standard object destruction.
+    Reference: None
+    ********************************************************************* */
+    ~LockstepPlayout() = default;
+
+    /* --- Selectors --- */
+
+    /* *********************************************************************
+    Function Name: isOver
+    Purpose: Checks whether a lane's round has ended.
+    Parameters:
+            lane, an integer between 0 and LANES - 1.
+    Return Value: Boolean true once a hand is empty or the game is blocked.
+    Algorithm: Return the lane's over flag.
+    Reference: None
+    ********************************************************************* */
+    inline bool isOver(int lane) const { return m_isOver[lane] != 0; }
+
+    /* *********************************************************************
+    Function Name: getPoints
+    Purpose: Retrieves the points a player was awarded in a lane.
+    Parameters:
+            lane, an integer between 0 and LANES - 1.
+            player, HUMAN or COMPUTER.
+    Return Value: An integer number of points; 0 while the round is running.
+    Algorithm: Return the lane's entry of m_points.
+    Reference: None
+    ********************************************************************* */
+    inline int getPoints(int lane, int player) const { return m_points[player][lane]; }
+
+    /* *********************************************************************
+    Function Name: getBestPath
+    Purpose: Finds the widest code path this processor supports.
+    Parameters: None
+    Return Value: PATH_AVX512, PATH_AVX2 or PATH_SCALAR.
+    Algorithm: Ask the processor once, through CPUID on MSVC or the
+            compiler's built-in check elsewhere, and remember the answer.
+    Reference: Intel 64 and IA-32 Architectures Software Developer's
+            Manual, CPUID leaf 7
+    ********************************************************************* */
+    static int getBestPath();
+
+    /* --- Mutators --- */
+
+    /* *********************************************************************
+    Function Name: loadLane
+    Purpose: Copies a two-player round into a lane.
+    Parameters:
+            lane, an integer between 0 and LANES - 1.
+            round, a Playout passed by const reference. A two-player round.
+    Return Value: None
+    Algorithm:
+            1. Number the tiles by position: the Human's hand, the
+                Computer's hand, then the boneyard, each in order.
+            2. Build the lane's tables: the positions holding each pip
+                value, the doubles, and the pips at each position.
+            3. Copy the ends, pass flags and mover, and mark the lane over
+                if the round already is.
+    Reference: None
+    ********************************************************************* */
+    void loadLane(int lane, const Playout& round);
+
+    /* *********************************************************************
+    Function Name: playRounds
+    Purpose: Plays every lane's round to the end.
+    Parameters:
+            path, an integer. PATH_SCALAR, PATH_AVX2 or PATH_AVX512; the
+                default, -1, takes getBestPath(). A path the processor
+                lacks falls back to the scalar one.
+    Return Value: None
+    Algorithm: Run turns on every unfinished lane together until all are
+            over, then award the points of each finished lane.
+    Reference: None
+    ********************************************************************* */
+    void playRounds(int path = -1);
+
+private:
+
+    // Per-lane state, one entry per lane in each array
+    alignas(64) uint32_t m_hands[2][LANES];     // position masks of each hand
+    alignas(64) int32_t m_ends[2][LANES];       // open pips, left (Human) and right (Computer)
+    alignas(64) int32_t m_passed[2][LANES];     // 1 if the player passed last turn
+    alignas(64) int32_t m_mover[LANES];
+    alignas(64) int32_t m_cursor[LANES];        // position of the top of the boneyard
+    alignas(64) int32_t m_tileCount[LANES];     // one past the last boneyard position
+    alignas(64) int32_t m_isOver[LANES];
+    alignas(64) int32_t m_points[2][LANES];
+    alignas(64) uint32_t m_doubles[LANES];      // positions holding doubles
+
+    // Per-lane tables, lane by lane so each lane's rows can be gathered
+    alignas(64) uint32_t m_pipMasks[LANES][8];  // positions holding each pip value
+    alignas(64) int32_t m_high[LANES][32];      // pips at each position
+    alignas(64) int32_t m_low[LANES][32];
+
+    /* *********************************************************************
+    Function Name: playScalar / playAvx2 / playAvx512
+    Purpose: Run turns on every unfinished lane until all are over.
+    Parameters: None
+    Return Value: None
+    Algorithm: For each lane that is still playing, in one step:
+            1. Pick the mover's hand, ends and the opponent's pass flag.
+            2. Mask the hand with the positions fitting each end; the
+                opponent's end allows only doubles unless they passed.
+            3. If nothing fits and the boneyard is not empty, draw the top
+                position into the hand and mask it the same way.
+            4. Play the lowest position fitting the own end, else the
+                lowest fitting the other, and open that end to its
+                other half; with nothing to play, pass.
+            5. Mark lanes whose hand emptied, or that are blocked, over.
+    Reference: Intel Intrinsics Guide
+    ********************************************************************* */
+    void playScalar();
+    void playAvx2();
+    void playAvx512();
+
+    /* *********************************************************************
+    Function Name: finishLane
+    Purpose: Awards the points of a lane that has just ended, as
+            Playout::checkOver does.
+    Parameters:
+            lane, an integer between 0 and LANES - 1.
+    Return Value: None
+    Algorithm:
+            1. Total the pips at the positions in each hand.
+            2. A player with an empty hand wins the other total; otherwise
+                the lower total wins the other, and a tie scores nothing.
+    Reference: None
+    ********************************************************************* */
+    void finishLane(int lane);
+
+    /* *********************************************************************
+    Function Name: isFinished
+    Purpose: Checks whether a lane's round has just ended.
+    Parameters:
+            lane, an integer between 0 and LANES - 1.
+    Return Value: Boolean true if a hand is empty, or the boneyard is empty
+            and both players passed.
+    Algorithm: Test the hands, cursor and pass flags.
+    Reference: None
+    ********************************************************************* */
+    bool isFinished(int lane) const;
+};
+
+#endif
\ No newline at end of file
@@ -5,37 +5,1372 @@
  * Date:  02/12/2026                                        *
  ************************************************************/
 
+#include <algorithm>
+#include <cstdio>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
 #include <string>
+#include <vector>
 
+#include "Arena.h"
+#include "BatchAnalyzer.h"
+#include "EngineProtocol.h"
+#include "ExternalPlayer.h"
+#include "EndgameTablebase.h"
+#include "GameLog.h"
+#include "GameServer.h"
+#include "HeuristicTuner.h"
+#include "LinearEvaluator.h"
+#include "LockstepPlayout.h"
+#include "Playout.h"
+#include "Replay.h"
+#include "Round.h"
 #include "Tournament.h"
 #include "Serializer.h"
+#include "StrategyRegistry.h"
+#include "Task.h"
+#include "TrainingData.h"
+#include "TurnChannel.h"
+#include "WinEstimator.h"
+
+/* *********************************************************************
+Function Name: replayLog
+Purpose: Reconstructs a position from a game log for a post-mortem and
+        optionally saves it so it can be inspected or played on.
+Parameters:
+        filename, a string representing the game log path.
+        eventCount, an integer. The number of events to replay, or -1
+            for the whole log.
+        outputFile, a string. Where to save the position; empty to only
+            report it.
+Return Value: Integer 0 on success, 1 on failure.
+Algorithm:
+        1. Load and index the log.
+        2. Seek to the requested position.
+        3. Report the number of events replayed and the resulting round.
+        4. If an output file was given, save the position to it, in the
+            binary format if it ends in ".bin".
+Reference: None
+********************************************************************* */
+int replayLog(const std::string& filename, int eventCount, const std::string& outputFile) {
+    Replay replay;
+    Tournament game;
+
+    if (!replay.load(filename)) {
+        std::cerr << "Error: " << filename << ": " << replay.getErrorMessage() << std::endl;
+        return 1;
+    }
+
+    if (eventCount < 0 || eventCount > replay.getEventCount()) {
+        eventCount = replay.getEventCount();
+    }
+
+    if (!replay.seek(eventCount, game)) {
+        std::cerr << "Error: " << filename << ": event " << replay.getErrorEvent() << ": "
+            << replay.getErrorMessage() << std::endl;
+        return 1;
+    }
+
+    std::cout << "Replayed " << eventCount << " of " << replay.getEventCount() << " events. Round "
+        << game.getRoundNumber() << ", " << (game.isHumanTurn() ? "Human" : "Computer") << " to play." << std::endl;
+
+    if (!outputFile.empty()) {
+        bool isBinary = outputFile.size() > 4 && outputFile.compare(outputFile.size() - 4, 4, ".bin") == 0;
+        bool saved = isBinary ? Serializer::saveBinary(outputFile, game) : Serializer::saveGame(outputFile, game);
+
+        if (!saved) {
+            return 1;
+        }
+        std::cout << "Position saved to " << outputFile << std::endl;
+    }
+
+    return 0;
+}
+
+/* *********************************************************************
+Function Name: analyzeSaves
+Purpose: Analyzes every saved game in a directory and writes a summary.
+Parameters:
+        directory, a string representing the directory of saves.
+        outputFile, a string. Where to write the results; empty to
+            write them to the console.
+        strategy, a string. The specification of the strategy that
+            evaluates each position.
+Return Value: Integer 0 on success, 1 on failure.
+Algorithm:
+        1. Open the output file, if one was given.
+        2. Run a BatchAnalyzer over the directory with one thread per core.
+        3. Report the totals.
+Reference: None
+********************************************************************* */
+int analyzeSaves(const std::string& directory, const std::string& outputFile, const std::string& strategy) {
+    std::ofstream file;
+    if (!outputFile.empty()) {
+        file.open(outputFile);
+        if (!file.is_open()) {
+            std::cerr << "Error: Could not open " << outputFile << " for writing." << std::endl;
+            return 1;
+        }
+    }
+
+    BatchAnalyzer analyzer(outputFile.empty() ? std::cout : file, strategy);
+    if (!analyzer.analyzeDirectory(directory, 0)) {
+        return 1;
+    }
+
+    std::cout << "Analyzed " << analyzer.getFileCount() << " saves (" << analyzer.getFailureCount()
+        << " could not be loaded). Found " << analyzer.getComparedCount() << " in a game log; the strategy agreed with "
+        << analyzer.getAgreementCount() << " of those moves." << std::endl;
+    return 0;
+}
+
+/* *********************************************************************
+Function Name: estimateOdds
+Purpose: Estimates each side's chance of winning the tournament from a
+        saved game.
+Parameters:
+        filename, a string representing the save file path.
+        milliseconds, an integer time budget for the simulations.
+Return Value: Integer 0 on success, 1 on failure.
+Algorithm:
+        1. Load the save.
+        2. Run a WinEstimator on every core for the time budget.
+        3. Print each outcome's probability and 95% confidence interval.
+Reference: None
+********************************************************************* */
+int estimateOdds(const std::string& filename, int milliseconds) {
+    Tournament game;
+
+    if (!Serializer::loadGame(filename, game)) {
+        return 1;
+    }
+
+    WinEstimator estimator;
+    estimator.estimate(game, milliseconds, 0);
+
+    const char* names[3] = { "Human wins", "Computer wins", "Draw" };
+    if (estimator.isDecided()) {
+        std::cout << "Tournament already decided\n";
+    }
+    else {
+        std::cout << estimator.getSimulationCount() << " simulations\n";
+    }
+
+    for (int outcome = WinEstimator::HUMAN_WINS; outcome <= WinEstimator::DRAW; ++outcome) {
+        double low = 0.0;
+        double high = 0.0;
+        estimator.getInterval(outcome, low, high);
+
+        std::cout << names[outcome] << ": " << estimator.getProbability(outcome)
+            << " (95% CI " << low << " - " << high << ")\n";
+    }
+
+    return 0;
+}
+
+/* *********************************************************************
+Function Name: buildTablebase
+Purpose: Generates an endgame tablebase file and reports its size and
+        the time taken.
+Parameters:
+        filename, a string representing the output path.
+        maxTiles, an integer. The most tiles per hand to solve.
+Return Value: Integer 0 on success, 1 on failure.
+Algorithm:
+        1. Generate the table on every core, timing it.
+        2. Open the file written and report its positions and bytes.
+Reference: None
+********************************************************************* */
+int buildTablebase(const std::string& filename, int maxTiles) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    if (!EndgameTablebase::generate(filename, maxTiles, 0)) {
+        return 1;
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    EndgameTablebase tablebase;
+    if (!tablebase.open(filename)) {
+        return 1;
+    }
+
+    std::cout << "Solved " << tablebase.getEntryCount() << " positions with up to " << maxTiles
+        << " tiles per hand in " << elapsed.count() << " seconds.\n"
+        << "Wrote " << (EndgameTablebase::HEADER_SIZE + tablebase.getEntryCount()) << " bytes to " << filename << std::endl;
+    return 0;
+}
+
+/* *********************************************************************
+Function Name: measureTablebase
+Purpose: Reports how often a tablebase covers the endgames of real
+        rounds, and what a probe costs.
+Parameters:
+        filename, a string representing the table path.
+        roundCount, an integer. The number of first-fit rounds to play.
+Return Value: Integer 0 on success, 1 on failure.
+Algorithm:
+        1. Deal and play out roundCount rounds with the first-fit
+            strategy. At every turn taken with an empty boneyard, count
+            whether the table holds the position and keep the positions
+            it holds.
+        2. Probe the kept positions over and over for a fixed number of
+            probes, timing them.
+        3. Report the hit rate and the time per probe.
+Reference: None
+********************************************************************* */
+int measureTablebase(const std::string& filename, int roundCount) {
+    EndgameTablebase tablebase;
+    if (!tablebase.open(filename)) {
+        return 1;
+    }
+
+    // 1. The hit rate over real endgames
+    std::vector<Playout> positions;
+    long long turnCount = 0;
+
+    for (int round = 0; round < roundCount; ++round) {
+        Playout position;
+        position.dealRound(round % (StandardSet::MAX_PIPS + 1) + 1, static_cast<unsigned int>(round));
+
+        while (!position.isOver()) {
+            if (position.getBoneyardSize() == 0) {
+                ++turnCount;
+                if (tablebase.contains(position)) {
+                    positions.push_back(position);
+                }
+            }
+            position.playTurn();
+        }
+    }
+
+    std::cout << positions.size() << " of " << turnCount << " turns played with an empty boneyard ("
+        << (turnCount > 0 ? 100.0 * positions.size() / turnCount : 0.0) << "%) were in the table." << std::endl;
+    if (positions.empty()) {
+        return 0;
+    }
+
+    // 2. The cost of a probe; the total keeps the loop from being optimized away
+    const long long PROBE_COUNT = 10000000;
+    long long total = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    for (long long i = 0; i < PROBE_COUNT; ++i) {
+        int value = 0;
+        tablebase.probe(positions[static_cast<size_t>(i % static_cast<long long>(positions.size()))], value);
+        total += value;
+    }
+
+    // 3. The report
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << "Probing took " << elapsed.count() / PROBE_COUNT << " ns per position (checksum " << total << ")."
+        << std::endl;
+    return 0;
+}
+
+/* *********************************************************************
+Function Name: isSamePosition
+Purpose: Compares two playouts through their selectors.
+Parameters:
+        first, second, BasicPlayout objects passed by const reference.
+Return Value: Boolean true if the mover, the end of the round, every
+        hand in order, every arm, pass flag and score, and the boneyard
+        in order are the same.
+Algorithm: Compare each in turn, stopping at the first difference.
+Reference: None
+********************************************************************* */
+template <int MaxPips>
+bool isSamePosition(const BasicPlayout<MaxPips>& first, const BasicPlayout<MaxPips>& second) {
+    if (first.getPlayerCount() != second.getPlayerCount() || first.getMover() != second.getMover()
+        || first.isOver() != second.isOver() || first.getBoneyardSize() != second.getBoneyardSize()) {
+        return false;
+    }
+
+    for (int player = 0; player < first.getPlayerCount(); ++player) {
+        if (first.getHandSize(player) != second.getHandSize(player) || first.getArmEnd(player) != second.getArmEnd(player)
+            || first.hasPassed(player) != second.hasPassed(player) || first.getPoints(player) != second.getPoints(player)) {
+            return false;
+        }
+        for (int i = 0; i < first.getHandSize(player); ++i) {
+            if (first.getHandPacked(player, i) != second.getHandPacked(player, i)) {
+                return false;
+            }
+        }
+    }
+
+    for (int i = 0; i < first.getBoneyardSize(); ++i) {
+        if (first.getBoneyardPacked(i) != second.getBoneyardPacked(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* *********************************************************************
+Function Name: findPlayoutFault
+Purpose: Plays a dealt round out turn by turn, checking the playout
+        against the rules written out afresh, so that sets and tables
+        with no Round to compare against are checked too.
+Parameters:
+        dealt, a BasicPlayout passed by const reference. A round just
+            dealt, which is played out on a copy.
+Return Value: A description of the first rule broken, or nullptr if the
+        round was played correctly.
+Algorithm:
+        1. Each turn, play a copy with playTurn() and GreedyStrategy, and
+            play the table with the make functions: the move chooseMove()
+            picks, else a draw and the drawn tile if it now fits, else a
+            pass.
+        2. Check that listMoves() lists exactly the moves the rules allow,
+            that chooseMove() finds one whenever there is one, that every
+            tile played was allowed on its arm and left the arm open to
+            its other half, and that both ways of playing the turn agree.
+        3. Check that the turn went to the next player in order, that
+            the mover's pass flag now says whether they passed, and that
+            no other player's flag changed.
+        4. Check that the round is over exactly when a hand is empty, or
+            the boneyard is empty and every player passed.
+        5. Check that every tile of the set is in exactly one hand, the
+            boneyard or the layout, and that each hand's mask holds
+            exactly its tiles.
+        6. When the round ends, check the points: going out wins every
+            pip left in hand; a block goes to the unique lowest hand, and
+            a tie scores nothing.
+        7. Take every step back with unmake() and check that the deal is
+            restored.
+Reference: None
+********************************************************************* */
+template <int MaxPips>
+const char* findPlayoutFault(const BasicPlayout<MaxPips>& dealt) {
+    typedef BasicPlayout<MaxPips> Table;
+    typedef typename Table::Set Set;
+
+    Table table = dealt;
+    typename Table::UndoStack stack;
+    bool isPlayed[Set::TILE_COUNT] = {};
+    int indices[Table::MAX_MOVES];
+    int arms[Table::MAX_MOVES];
+
+    // The engine is the only tile on the layout after the deal, so every arm ends in its pips
+    int engine = table.getArmEnd(0);
+    isPlayed[Set::getIndex(engine, engine)] = true;
+
+    // Whether the rules let the mover put a tile on an arm
+    auto isAllowed = [&](unsigned char packed, int arm) {
+        int low = packed & 0x0F;
+        int high = packed >> 4;
+        bool isOpen = (arm == table.getMover() || low == high || table.hasPassed(arm));
+        return isOpen && (low == table.getArmEnd(arm) || high == table.getArmEnd(arm));
+    };
+
+    // A play through the make functions, checked and recorded
+    auto play = [&](int index, int arm) {
+        unsigned char packed = table.getHandPacked(table.getMover(), index);
+        if (!isAllowed(packed, arm)) {
+            return false;
+        }
+        int low = packed & 0x0F;
+        int high = packed >> 4;
+        int openEnd = (table.getArmEnd(arm) == low) ? high : low;
+
+        isPlayed[Set::getIndex(low, high)] = true;
+        table.makePlay(index, arm, stack);
+        return table.getArmEnd(arm) == openEnd;
+    };
+
+    while (!table.isOver()) {
+        // 1. The turn both ways
+        Table expected = table;
+        expected.playTurn();
+
+        int mover = table.getMover();
+        int moveCount = table.listMoves(indices, arms);
+
+        bool wasPassed[Table::MAX_PLAYERS];
+        for (int player = 0; player < table.getPlayerCount(); ++player) {
+            wasPassed[player] = table.hasPassed(player);
+        }
+
+        // 2. The moves the rules allow, and the turn
+        int allowedCount = 0;
+        for (int i = 0; i < table.getHandSize(mover); ++i) {
+            for (int arm = 0; arm < table.getPlayerCount(); ++arm) {
+                allowedCount += isAllowed(table.getHandPacked(mover, i), arm) ? 1 : 0;
+            }
+        }
+        for (int m = 0; m < moveCount; ++m) {
+            if (!isAllowed(table.getHandPacked(mover, indices[m]), arms[m])) {
+                return "listMoves() listed a move the rules forbid";
+            }
+        }
+        if (moveCount != allowedCount) {
+            return "listMoves() missed a legal move";
+        }
+
+        int index = 0;
+        int arm = mover;
+        bool isPlaced = true;
+        if (table.chooseMove(index, arm) != (moveCount > 0)) {
+            return "chooseMove() and listMoves() disagree";
+        }
+
+        if (moveCount > 0) {
+            if (!play(index, arm)) {
+                return "a tile was played where the rules forbid";
+            }
+        }
+        else if (table.getBoneyardSize() > 0) {
+            table.makeDraw(stack);
+            if (table.chooseMove(index, arm)) {
+                if (index != table.getHandSize(mover) - 1 || !play(index, arm)) {
+                    return "after a draw, a tile was played where the rules forbid";
+                }
+            }
+            else {
+                table.makePass(stack);
+                isPlaced = false;
+            }
+        }
+        else {
+            table.makePass(stack);
+            isPlaced = false;
+        }
+
+        if (!isSamePosition(table, expected)) {
+            return "playTurn() and the make functions played the turn differently";
+        }
+
+        // 3. The turn order and the pass flags
+        if (table.getMover() != (mover + 1) % table.getPlayerCount()) {
+            return "the turn did not go to the next player";
+        }
+        for (int player = 0; player < table.getPlayerCount(); ++player) {
+            if (table.hasPassed(player) != ((player == mover) ? !isPlaced : wasPassed[player])) {
+                return "a pass flag does not match the last turn";
+            }
+        }
+
+        // 4. The end of the round
+        bool isOut = false;
+        bool isBlocked = (table.getBoneyardSize() == 0);
+        for (int player = 0; player < table.getPlayerCount(); ++player) {
+            isOut = isOut || table.getHandSize(player) == 0;
+            isBlocked = isBlocked && table.hasPassed(player);
+        }
+        if (table.isOver() != (isOut || isBlocked)) {
+            return "the round ended at the wrong time";
+        }
+
+        // 5. Every tile in one place
+        int seen[Set::TILE_COUNT] = {};
+        for (int t = 0; t < Set::TILE_COUNT; ++t) {
+            seen[t] = isPlayed[t] ? 1 : 0;
+        }
+        for (int i = 0; i < table.getBoneyardSize(); ++i) {
+            unsigned char packed = table.getBoneyardPacked(i);
+            ++seen[Set::getIndex(packed & 0x0F, packed >> 4)];
+        }
+        for (int player = 0; player < table.getPlayerCount(); ++player) {
+            bool isHeld[Set::TILE_COUNT] = {};
+            for (int i = 0; i < table.getHandSize(player); ++i) {
+                unsigned char packed = table.getHandPacked(player, i);
+                int tile = Set::getIndex(packed & 0x0F, packed >> 4);
+                ++seen[tile];
+                isHeld[tile] = true;
+            }
+            for (int t = 0; t < Set::TILE_COUNT; ++t) {
+                if (static_cast<bool>(table.getHandMask(player) & Set::getBit(t)) != isHeld[t]) {
+                    return "a hand's mask does not match its tiles";
+                }
+            }
+        }
+        for (int t = 0; t < Set::TILE_COUNT; ++t) {
+            if (seen[t] != 1) {
+                return "a tile was lost or duplicated";
+            }
+        }
+    }
+
+    // 6. The points
+    int totals[Table::MAX_PLAYERS];
+    int sum = 0;
+    int outPlayer = -1;
+    for (int player = 0; player < table.getPlayerCount(); ++player) {
+        totals[player] = table.getHandPips(player);
+        sum += totals[player];
+        if (table.getHandSize(player) == 0) {
+            outPlayer = player;
+        }
+    }
+
+    for (int player = 0; player < table.getPlayerCount(); ++player) {
+        int points = 0;
+        if (outPlayer != -1) {
+            points = (player == outPlayer) ? sum : 0;
+        }
+        else {
+            int lowerCount = 0;
+            int tieCount = 0;
+            for (int other = 0; other < table.getPlayerCount(); ++other) {
+                lowerCount += (totals[other] < totals[player]) ? 1 : 0;
+                tieCount += (other != player && totals[other] == totals[player]) ? 1 : 0;
+            }
+            points = (lowerCount == 0 && tieCount == 0) ? sum - totals[player] : 0;
+        }
+        if (table.getPoints(player) != points) {
+            return "the points awarded break the scoring rules";
+        }
+    }
+
+    // 7. Every step taken back
+    while (!stack.isEmpty()) {
+        table.unmake(stack);
+    }
+    if (!isSamePosition(table, dealt)) {
+        return "unmake() did not restore the deal";
+    }
+    return nullptr;
+}
+
+/* *********************************************************************
+Function Name: checkPlayouts
+Purpose: Checks the playout for one set and table size against the
+        rules with findPlayoutFault() and reports the result.
+Parameters:
+        roundCount, an integer. The number of deals to check.
+        playerCount, an integer. The players at the table.
+Return Value: The number of deals in which a rule was broken.
+Algorithm:
+        1. Deal each round from its number and seed.
+        2. Check it, reporting any rule broken.
+        3. Report the number of faults and the time per round.
+Reference: None
+********************************************************************* */
+template <int MaxPips>
+int checkPlayouts(int roundCount, int playerCount) {
+    int faultCount = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < roundCount; ++i) {
+        // 1. The deal
+        int roundNumber = i % (MaxPips + 1) + 1;
+        unsigned int seed = static_cast<unsigned int>(i);
+
+        BasicPlayout<MaxPips> table(playerCount);
+        table.dealRound(roundNumber, seed);
+
+        // 2. The check
+        const char* fault = findPlayoutFault(table);
+        if (fault != nullptr) {
+            ++faultCount;
+            std::cout << "Double-" << MaxPips << ", " << playerCount << " players, round " << roundNumber << ", seed "
+                << seed << ": " << fault << "." << std::endl;
+        }
+    }
+
+    // 3. The report
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << "Double-" << MaxPips << ", " << playerCount << " players: " << roundCount
+        << " rounds checked against the rules; " << faultCount << " broke one";
+    if (roundCount > 0) {
+        std::cout << " (" << elapsed.count() * 1e6 / roundCount << " us per round)";
+    }
+    std::cout << "." << std::endl;
+    return faultCount;
+}
+
+/* *********************************************************************
+Function Name: verifyPlayout
+Purpose: Checks that the Playout plays a round exactly as Round does,
+        by playing the same deals both ways, and compares their speed.
+        The larger sets and tables of three to eight players, which Round
+        does not play, are checked against the rules instead.
+Parameters:
+        roundCount, an integer. The number of deals to play.
+Return Value: Integer 0 if every deal ended the same way, 1 otherwise.
+Algorithm:
+        1. Deal each round from its seed to both a Round and a Playout.
+        2. Play the Round with Round::playRound(), discarding its output.
+            The Computer plays the "greedy" strategy; the Human answers
+            each prompt with the move GreedyStrategy chooses in a Playout
+            loaded from the round.
+        3. Play the Playout with GreedyStrategy for both players.
+        4. Compare the points, the hands and the boneyard, reporting any
+            deal that differs, and report the time per round of each.
+        5. Check as many deals of each set, from double-six to
+            double-fifteen, at each table from two to eight players, with
+            checkPlayouts().
+Reference: None
+********************************************************************* */
+int verifyPlayout(int roundCount) {
+    std::unique_ptr<ComputerStrategy> greedy = StrategyRegistry::create("greedy");
+    if (greedy == nullptr) {
+        return 1;
+    }
+
+    Tournament tournament;
+    std::ostringstream output;
+    int mismatchCount = 0;
+    std::chrono::duration<double> roundTime(0);
+    std::chrono::duration<double> playoutTime(0);
+
+    for (int i = 0; i < roundCount; ++i) {
+        // 1. The deal
+        int roundNumber = i % (StandardSet::MAX_PIPS + 1) + 1;
+        unsigned int seed = static_cast<unsigned int>(i);
+
+        Round round(roundNumber, tournament.getTargetScore(), 0, 0);
+        round.setOutput(output);
+        round.setStrategy(greedy.get());
+        round.dealRound(roundNumber, seed);
+
+        Playout playout;
+        playout.dealRound(roundNumber, seed);
+
+        // 2. The Round, answering the prompt each time it waits
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        TurnChannel channel(output);
+        Task<bool> task = round.playRound(tournament, channel);
+        task.start();
+
+        while (!task.isDone()) {
+            std::string prompt = output.str();
+            output.str("");
+
+            Playout position;
+            position.loadRound(round);
+            int index = 0;
+            int arm = 0;
+
+            if (prompt.find("Enter command") != std::string::npos) {
+                channel.supply("play");
+            }
+            else if (!position.chooseMove(index, arm)) {
+                channel.close();
+            }
+            else if (prompt.find("Select tile index") != std::string::npos) {
+                channel.supply(std::to_string(index + 1));
+            }
+            else {
+                channel.supply((arm == Playout::HUMAN) ? "L" : "R");
+            }
+        }
+        output.str("");
+        roundTime += std::chrono::steady_clock::now() - start;
+
+        // 3. The Playout
+        start = std::chrono::steady_clock::now();
+        playout.playRound();
+        playoutTime += std::chrono::steady_clock::now() - start;
+
+        // 4. The comparison
+        if (!task.getResult() || round.getHumanScore() != playout.getPoints(Playout::HUMAN)
+            || round.getComputerScore() != playout.getPoints(Playout::COMPUTER)
+            || round.getHumanHand().getSize() != playout.getHandSize(Playout::HUMAN)
+            || round.getComputerHand().getSize() != playout.getHandSize(Playout::COMPUTER)
+            || round.getStock().getSize() != playout.getBoneyardSize()) {
+            ++mismatchCount;
+            std::cout << "Round " << roundNumber << ", seed " << seed << ": Round scored " << round.getHumanScore()
+                << "-" << round.getComputerScore() << ", the Playout " << playout.getPoints(Playout::HUMAN) << "-"
+                << playout.getPoints(Playout::COMPUTER) << "." << std::endl;
+        }
+    }
+
+    std::cout << roundCount << " rounds played both ways; " << mismatchCount << " differed." << std::endl;
+    if (roundCount > 0) {
+        std::cout << "Round took " << roundTime.count() * 1e6 / roundCount << " us per round, the Playout "
+            << playoutTime.count() * 1e6 / roundCount << " us." << std::endl;
+    }
+
+    // 5. Every set the Playout is built for, at every size of table, against the rules
+    int faultCount = 0;
+    for (int players = Playout::MIN_PLAYERS; players <= Playout::MAX_PLAYERS; ++players) {
+        faultCount += checkPlayouts<StandardSet::MAX_PIPS>(roundCount, players) + checkPlayouts<9>(roundCount, players)
+            + checkPlayouts<12>(roundCount, players) + checkPlayouts<15>(roundCount, players);
+    }
+    return (mismatchCount == 0 && faultCount == 0) ? 0 : 1;
+}
+
+/* *********************************************************************
+Function Name: generateTrainingData
+Purpose: Writes a file of self-play positions and reports how fast they
+        were played and how fast the file reads back.
+Parameters:
+        filename, a string representing the output path.
+        recordCount, the number of positions to record.
+        humanName, computerName, strings. Each player's strategy, as
+            accepted by TrainingData::findStrategy().
+        threadCount, an integer. The number of threads, or 0 for one per
+            hardware thread.
+Return Value: Integer 0 on success, 1 on failure.
+Algorithm:
+        1. Generate the file to the default target score, timing it.
+        2. Map the file and stream every record once, totalling the
+            mover's share of the points, timing it.
+Reference: None
+********************************************************************* */
+int generateTrainingData(const std::string& filename, long long recordCount, const std::string& humanName,
+    const std::string& computerName, int threadCount) {
+    // 1. The tournaments
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    long long written = TrainingData::generate(filename, recordCount, humanName, computerName,
+        TrainingData::DEFAULT_TARGET, threadCount, 1);
+    if (written < 0) {
+        return 1;
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << "Recorded " << written << " positions in " << elapsed.count() << " seconds ("
+        << written / elapsed.count() << " per second)." << std::endl;
+
+    // 2. Reading back, in place
+    TrainingData data;
+    if (!data.open(filename)) {
+        return 1;
+    }
+
+    start = std::chrono::steady_clock::now();
+    long long moverPoints = 0;
+    long long totalPoints = 0;
+    const TrainingData::Record* records = data.getRecords();
+
+    for (long long i = 0; i < data.getCount(); ++i) {
+        moverPoints += records[i].points[records[i].mover];
+        totalPoints += records[i].points[0] + records[i].points[1];
+    }
+    elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << "Read " << data.getCount() << " records back in " << elapsed.count() << " seconds; the mover won "
+        << (totalPoints > 0 ? 100.0 * moverPoints / totalPoints : 0.0) << "% of the points." << std::endl;
+    return 0;
+}
+
+/* *********************************************************************
+Function Name: trainEvaluator
+Purpose: Fits a LinearEvaluator to self-play data, saves it, and reports
+        how well it predicts rounds it was not fitted to and how fast it
+        scores positions.
+Parameters:
+        dataFile, a string representing a TrainingData file.
+        modelFile, a string representing the output path.
+Return Value: Integer 0 on success, 1 on failure.
+Algorithm:
+        1. Fit the weights to the first nine tenths of the records and
+            save them.
+        2. Over the last tenth, compare the root mean square error of
+            the model with that of the search's pip count, the
+            opponent's pips in hand minus the mover's.
+        3. Score the last tenth in batches on every code path the
+            processor has, timing each.
+Reference: None
+********************************************************************* */
+int trainEvaluator(const std::string& dataFile, const std::string& modelFile) {
+    TrainingData data;
+    if (!data.open(dataFile)) {
+        return 1;
+    }
+
+    // 1. The fit
+    long long trainCount = data.getCount() * 9 / 10;
+    long long testCount = data.getCount() - trainCount;
+    LinearEvaluator evaluator;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    if (testCount <= 0 || !evaluator.train(data, 0, trainCount, 1e-4) || !evaluator.save(modelFile)) {
+        std::cerr << "Error: Could not train an evaluator on " << dataFile << std::endl;
+        return 1;
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << "Fitted " << LinearEvaluator::WEIGHT_COUNT << " weights to " << trainCount << " positions in "
+        << elapsed.count() << " seconds." << std::endl;
+
+    // 2. The error on the rest
+    const TrainingData::Record* records = data.getRecords() + trainCount;
+    std::vector<float> values(static_cast<size_t>(testCount));
+    double modelError = 0.0;
+    double pipError = 0.0;
+
+    for (long long first = 0; first < testCount; first += LinearEvaluator::BATCH_SIZE) {
+        LinearEvaluator::Batch batch;
+        for (long long i = first; i < testCount && i < first + LinearEvaluator::BATCH_SIZE; ++i) {
+            LinearEvaluator::addRecord(batch, records[i]);
+        }
+        evaluator.evaluateBatch(batch, &values[static_cast<size_t>(first)]);
+    }
+
+    int tilePips[StandardSet::TILE_COUNT];
+    for (int high = 0; high <= StandardSet::MAX_PIPS; ++high) {
+        for (int low = 0; low <= high; ++low) {
+            tilePips[StandardSet::getIndex(low, high)] = low + high;
+        }
+    }
+
+    for (long long i = 0; i < testCount; ++i) {
+        const TrainingData::Record& record = records[i];
+        int pips[2] = { 0, 0 };
+        for (int player = 0; player < 2; ++player) {
+            for (uint32_t mask = record.hands[player]; mask != 0; mask &= mask - 1) {
+                pips[player] += tilePips[std::countr_zero(mask)];
+            }
+        }
+
+        double target = static_cast<double>(record.points[record.mover]) - record.points[1 - record.mover];
+        double pipValue = pips[1 - record.mover] - pips[record.mover];
+        modelError += (values[static_cast<size_t>(i)] - target) * (values[static_cast<size_t>(i)] - target);
+        pipError += (pipValue - target) * (pipValue - target);
+    }
+
+    std::cout << "On " << testCount << " held-out positions, the root mean square error is "
+        << std::sqrt(modelError / testCount) << " points (the pip count's is " << std::sqrt(pipError / testCount) << ")."
+        << std::endl;
+
+    // 3. The speed of each path, over batches filled once
+    std::vector<LinearEvaluator::Batch> batches(static_cast<size_t>((testCount + LinearEvaluator::BATCH_SIZE - 1)
+        / LinearEvaluator::BATCH_SIZE));
+    for (long long i = 0; i < testCount; ++i) {
+        LinearEvaluator::addRecord(batches[static_cast<size_t>(i / LinearEvaluator::BATCH_SIZE)], records[i]);
+    }
+
+    const char* names[] = { "scalar", "AVX2", "AVX-512" };
+    for (int path = LockstepPlayout::PATH_SCALAR; path <= LockstepPlayout::getBestPath(); ++path) {
+        start = std::chrono::steady_clock::now();
+        for (const LinearEvaluator::Batch& batch : batches) {
+            evaluator.evaluateBatch(batch, &values[0], path);
+        }
+        elapsed = std::chrono::steady_clock::now() - start;
+        std::cout << "The " << names[path] << " path scores " << testCount / elapsed.count() << " positions per second."
+            << std::endl;
+    }
+    return 0;
+}
+
+/* *********************************************************************
+Function Name: tuneHeuristic
+Purpose: Tunes the weights of the weighted heuristic by self-play,
+        checkpointing after every iteration so the run can be stopped and
+        resumed.
+Parameters:
+        checkpoint, a string representing the checkpoint path. Resumed
+            from if it exists.
+        iterations, an integer number of iterations to run.
+        dealCount, an integer number of deals per iteration.
+        threadCount, an integer. The number of threads, or 0 for one per
+            hardware thread.
+Return Value: Integer 0 on success, 1 on failure.
+Algorithm:
+        1. Resume from the checkpoint, or seed a new tuning.
+        2. Run the iterations, saving after each and reporting every
+            tenth with the speed of play.
+        3. Measure the tuned weights against first-fit and the
+            heaviest-tile weights they started from on fresh deals.
+Reference: None
+********************************************************************* */
+int tuneHeuristic(const std::string& checkpoint, int iterations, int dealCount, int threadCount) {
+    if (iterations <= 0 || dealCount <= 0) {
+        std::cerr << "Error: Tuning needs a positive number of iterations and deals." << std::endl;
+        return 1;
+    }
+
+    // 1. Where to start
+    HeuristicTuner tuner;
+    if (std::filesystem::exists(checkpoint)) {
+        if (!tuner.load(checkpoint)) {
+            return 1;
+        }
+        std::cout << "Resuming from iteration " << tuner.getIteration() << "." << std::endl;
+    }
+    else {
+        std::random_device device;
+        tuner.setSeed(device());
+    }
+
+    // 2. The iterations
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int i = 1; i <= iterations; ++i) {
+        tuner.step(dealCount, threadCount);
+        if (!tuner.save(checkpoint)) {
+            return 1;
+        }
+
+        if (i % 10 == 0 || i == iterations) {
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            WeightedStrategy strategy = tuner.getStrategy();
+
+            std::cout << "Iteration " << tuner.getIteration() << ": weights";
+            for (int w = 0; w < WeightedStrategy::WEIGHT_COUNT; ++w) {
+                std::cout << " " << strategy.getWeight(w);
+            }
+            std::cout << ", " << tuner.getScore() << " points per round over first-fit, "
+                << 4.0 * dealCount * i / elapsed.count() << " rounds per second." << std::endl;
+        }
+    }
+
+    // 3. The result, on deals no iteration played
+    WeightedStrategy tuned = tuner.getStrategy();
+    WeightedStrategy heaviest;
+    double weights[2][WeightedStrategy::WEIGHT_COUNT];
+    for (int w = 0; w < WeightedStrategy::WEIGHT_COUNT; ++w) {
+        weights[0][w] = tuned.getWeight(w);
+        weights[1][w] = heaviest.getWeight(w);
+    }
+
+    const int testDeals = 100000;
+    double tunedScore = 0.0;
+    double heaviestScore = 0.0;
+    HeuristicTuner::compare(weights[0], weights[1], tuner.getSeed() ^ 0x9E3779B9U, testDeals, threadCount,
+        tunedScore, heaviestScore);
+
+    std::cout << "Over " << 2 * testDeals << " new rounds, the tuned weights score " << tunedScore
+        << " points per round more than first-fit; the heaviest tile scores " << heaviestScore << "." << std::endl;
+    return 0;
+}
+
+/* *********************************************************************
+Function Name: runArena
+Purpose: Plays a round robin between strategies and reports each
+        pairing and the ratings.
+Parameters:
+        names, a vector of strings. The strategies, as accepted by
+            Arena::addEntrant().
+        maxGames, an integer. The most games a pairing plays.
+        maxPips, an integer. The set the games are dealt from, as
+            accepted by Arena::setMaxPips().
+Return Value: Integer 0 on success, 1 on failure.
+Algorithm:
+        1. Choose the set and enter the strategies; at least two are
+            needed.
+        2. Run the arena on every hardware thread, timing it.
+        3. Print each pairing's record, score and verdict, then the
+            ratings from strongest to weakest.
+Reference: None
+********************************************************************* */
+int runArena(const std::vector<std::string>& names, int maxGames, int maxPips) {
+    // 1. The set and the entrants
+    Arena arena;
+    if (!arena.setMaxPips(maxPips)) {
+        return 1;
+    }
+    for (const std::string& name : names) {
+        if (!arena.addEntrant(name)) {
+            return 1;
+        }
+    }
+    if (arena.getEntrantCount() < 2 || maxGames <= 0) {
+        std::cerr << "Error: The arena needs two strategies and a positive number of games." << std::endl;
+        return 1;
+    }
+
+    // 2. The games
+    std::random_device device;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    arena.run(maxGames, 0, device());
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    // 3. The results
+    const char* verdicts[] = { "undecided", "first stronger", "second stronger", "equal" };
+    long long totalGames = 0;
+    char line[160];
+
+    for (int p = 0; p < arena.getPairingCount(); ++p) {
+        int first = 0;
+        int second = 0;
+        long long wins = 0;
+        long long draws = 0;
+        long long losses = 0;
+        int decision = arena.getPairing(p, first, second, wins, draws, losses);
+        long long games = wins + draws + losses;
+        totalGames += games;
+
+        std::snprintf(line, sizeof(line), "%-16s vs %-16s %7lld-%lld-%lld  %5.1f%%  %s", arena.getEntrantName(first).c_str(),
+            arena.getEntrantName(second).c_str(), wins, draws, losses, 100.0 * (wins + 0.5 * draws) / games,
+            verdicts[decision]);
+        std::cout << line << std::endl;
+    }
+
+    std::vector<int> order(arena.getEntrantCount());
+    for (int i = 0; i < arena.getEntrantCount(); ++i) {
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [&](int a, int b) { return arena.getRating(a) > arena.getRating(b); });
+
+    std::cout << "\nRatings (Elo about the mean, 95% interval):" << std::endl;
+    for (int i : order) {
+        std::snprintf(line, sizeof(line), "%-16s %+7.1f +/- %.1f", arena.getEntrantName(i).c_str(), arena.getRating(i),
+            1.96 * arena.getRatingError(i));
+        std::cout << line << std::endl;
+    }
+
+    std::cout << "\nPlayed " << totalGames << " games of the " << static_cast<long long>(maxGames) * arena.getPairingCount()
+        << " allowed in " << elapsed.count() << " seconds." << std::endl;
+    return 0;
+}
+
+/* *********************************************************************
+Function Name: playMatchRound
+Purpose: Plays one round between two players, without output.
+Parameters:
+        humanSeat, computerSeat, ExternalPlayers passed by reference.
+            The players in the Human's and the Computer's seats.
+        roundNumber, an integer. Selects the engine.
+        seed, an unsigned integer. Shuffles the boneyard.
+Return Value: The points the Human's seat won minus the Computer's.
+Algorithm:
+        1. Deal the round with Round::dealRound() and hand each seat its
+            tiles.
+        2. Alternate turns, tracking passes, until a hand is empty or
+            both players pass with the boneyard empty.
+        3. Score the round as Round does: the player who went out, or
+            the lower hand in a block, wins the other's pips.
+Reference: None
+********************************************************************* */
+int playMatchRound(ExternalPlayer& humanSeat, ExternalPlayer& computerSeat, int roundNumber, unsigned int seed) {
+    // 1. The deal
+    Round deal(roundNumber, 0, 0, 0);
+    deal.dealRound(roundNumber, seed);
+
+    ExternalPlayer* seats[2] = { &humanSeat, &computerSeat };
+    seats[0]->getHand() = deal.getHumanHand();
+    seats[1]->getHand() = deal.getComputerHand();
+    seats[0]->setSeat(true, seats[1]);
+    seats[1]->setSeat(false, seats[0]);
+
+    Layout layout = deal.getLayout();
+    Stock stock = deal.getStock();
+
+    // 2. The turns
+    int mover = deal.isHumanTurn() ? 0 : 1;
+    bool passed[2] = { false, false };
+    while (true) {
+        passed[mover] = !seats[mover]->playTurn(layout, stock, passed[1 - mover]);
+        if (seats[mover]->isHandEmpty() || (stock.isEmpty() && passed[0] && passed[1])) {
+            break;
+        }
+        mover = 1 - mover;
+    }
+
+    // 3. The points
+    int pips[2] = { seats[0]->getHand().getHandScore(), seats[1]->getHand().getHandScore() };
+    if (seats[0]->isHandEmpty()) {
+        return pips[1];
+    }
+    if (seats[1]->isHandEmpty()) {
+        return -pips[0];
+    }
+    if (pips[0] != pips[1]) {
+        return (pips[0] < pips[1]) ? pips[1] : -pips[0];
+    }
+    return 0;
+}
+
+/* *********************************************************************
+Function Name: playMatch
+Purpose: Plays a match between two engine programs through the engine
+        protocol and reports the result.
+Parameters:
+        games, an integer. Each game is one deal played twice, with the
+            seats swapped.
+        commands, two strings. The command lines of the programs.
+        milliseconds, an integer. The search budget per move, or 0 for
+            each program's own.
+Return Value: Integer 0 on success, 1 if a program could not start.
+Algorithm:
+        1. Start both programs once for the whole match.
+        2. Deal each game from a fresh seed, rotating the engine, and
+            play it twice with the seats swapped; the player with more
+            points over the two rounds wins the game.
+        3. Print the record, the points per round and the faults, and
+            the rate of requests.
+Reference: None
+********************************************************************* */
+int playMatch(int games, const std::string* commands, int milliseconds) {
+    // 1. The programs
+    ExternalPlayer players[2];
+    for (int p = 0; p < 2; ++p) {
+        players[p].setMilliseconds(milliseconds);
+        if (!players[p].start(commands[p])) {
+            std::cerr << "Error: Could not start " << commands[p] << std::endl;
+            return 1;
+        }
+    }
+
+    // 2. The games
+    std::mt19937 generator(std::random_device{}());
+    long long wins = 0;
+    long long draws = 0;
+    long long losses = 0;
+    long long margin = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    for (int game = 0; game < games; ++game) {
+        int roundNumber = 1 + game % (StandardSet::MAX_PIPS + 1);
+        unsigned int seed = generator();
+
+        int points = playMatchRound(players[0], players[1], roundNumber, seed)
+            - playMatchRound(players[1], players[0], roundNumber, seed);
+        margin += points;
+        wins += (points > 0) ? 1 : 0;
+        draws += (points == 0) ? 1 : 0;
+        losses += (points < 0) ? 1 : 0;
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    // 3. The result
+    char line[160];
+    std::snprintf(line, sizeof(line), "%-16s vs %-16s %7lld-%lld-%lld  %+.2f points per round",
+        players[0].getName().c_str(), players[1].getName().c_str(), wins, draws, losses,
+        (games > 0) ? margin / (2.0 * games) : 0.0);
+    std::cout << line << std::endl;
+
+    std::cout << "Faults: " << players[0].getFaultCount() << " and " << players[1].getFaultCount()
+        << " turns played first-fit after a late, illegal or missing reply." << std::endl;
+
+    long long requests = players[0].getRequestCount() + players[1].getRequestCount();
+    std::cout << "Played " << 2LL * games << " rounds in " << elapsed.count() << " seconds, "
+        << requests / elapsed.count() << " requests per second." << std::endl;
+    return 0;
+}
+
+/* *********************************************************************
+Function Name: runEngine
+Purpose: Serves the engine protocol on standard input and output, so
+        another program can drive the engine.
+Parameters:
+        strategy, a string. A StrategyRegistry spec to play with, or
+            empty for EngineProtocol::DEFAULT_STRATEGY.
+Return Value: Integer 0 on success, 1 on failure.
+Algorithm:
+        1. Untie the standard streams from C stdio and from each other,
+            since the protocol flushes its own replies.
+        2. Apply the strategy, as a "setoption" would, then answer
+            commands until "quit".
+Reference: None
+********************************************************************* */
+int runEngine(const std::string& strategy) {
+    // 1. Streams
+    std::ios::sync_with_stdio(false);
+    std::cin.tie(nullptr);
+
+    // 2. The session
+    EngineProtocol protocol(std::cin, std::cout);
+    if (!strategy.empty() && !protocol.setStrategy(strategy)) {
+        return 1;
+    }
+    return protocol.run();
+}
+
+/* *********************************************************************
+Function Name: runServer
+Purpose: Hosts tournaments for remote Humans until the process ends.
+Parameters:
+        address, a string. The Unix socket path, "host:port" or port
+            to listen on.
+        strategy, a string. A StrategyRegistry spec for the Computer, or
+            empty for GameServer::DEFAULT_STRATEGY.
+        loopCount, workerCount, integers. The event loops and worker
+            threads, or 0 for one per hardware thread.
+        store, a string. A file to park idle sessions in, or empty to
+            keep every session in memory until its client leaves.
+Return Value: Integer 1 if the server could not start.
+Algorithm:
+        1. Choose the strategy, open the store and the socket.
+        2. Announce the address and serve.
+Reference: None
+********************************************************************* */
+int runServer(const std::string& address, const std::string& strategy, int loopCount, int workerCount,
+    const std::string& store) {
+    // 1. The server
+    GameServer server;
+    if ((!strategy.empty() && !server.setStrategy(strategy)) || (!store.empty() && !server.setStore(store))
+        || !server.listen(address)) {
+        return 1;
+    }
+
+    // 2. Serving
+    std::cout << "Serving Longana on " << address << "." << std::endl;
+    return server.run(loopCount, workerCount);
+}
 
 /* *********************************************************************
 Function Name: main
 Purpose: The entry point of the Longana application. It initializes the
         tournament controller, handles the initial menu for new or
         saved games, and starts the game execution.
-Parameters: None
+Parameters:
+        argc, an integer count of command-line arguments.
+        argv, the command-line arguments. "--log <file>" records the game
+            to a log; "--search <milliseconds>" has the Computer search
+            each move for that long instead of playing first-fit;
+            "--tablebase <file>" has it play the endgames the tablebase
+            holds perfectly; "--evaluator <file>" has its search score
+            the positions it stops at with a trained LinearEvaluator;
+            "--strategy <spec>" chooses any registered strategy (see
+            StrategyRegistry), and the first three are shorthands for
+            the "solver" and "tablebase" strategies.
+            Instead of playing, "--replay <file> [events]
+            [output]" reconstructs a position from a log; "--analyze
+            <directory> [output] [strategy]" analyzes a directory of
+            saves with a registered strategy, first-fit by default;
+            "--odds <file> [milliseconds]" estimates the tournament odds
+            of a save;
+            "--build-tablebase <file> [tiles]" generates an endgame
+            tablebase; "--probe-tablebase <file> [rounds]" measures one;
+            "--verify-playout [rounds]" checks the Playout against Round,
+            and every set and table of two to eight against the rules;
+            "--self-play <file> <positions> [human] [computer] [threads]"
+            records self-play positions for training; "--train-evaluator
+            <data> <model>" fits an evaluator to them; "--tune
+            <checkpoint> [iterations] [deals] [threads]" tunes the
+            weighted heuristic by self-play, resuming from the checkpoint;
+            "--arena <games> [--set <pips>] <strategy> <strategy>
+            [...]" rates strategies against each other, dealing from a
+            double-9, 12 or 15 set instead of double-six if asked; "--engine [strategy]" serves
+            the engine protocol to another program; "--match <games>
+            <command> <command> [milliseconds]" plays two programs that
+            serve it against each other; "--serve <address> [strategy]
+            [loops] [workers] [store]" hosts tournaments over a socket,
+            parking idle sessions in the store file if one is given.
 Return Value: Integer 0 upon successful completion.
 Algorithm:
-        1. Instantiate a Tournament object named 'game'.
-        2. Continuously display the main menu (Start New Game vs. Load Game)
+        1. If replaying, analyzing, estimating odds, building or
+            measuring a tablebase, verifying the Playout, recording
+            self-play, training an evaluator, tuning the heuristic,
+            running an arena, serving the engine protocol or playing a
+            match through it, or hosting tournaments, hand over to
+            replayLog(), analyzeSaves(), estimateOdds(), buildTablebase(),
+            measureTablebase(), verifyPlayout(), generateTrainingData(),
+            trainEvaluator(), tuneHeuristic(), runArena(), runEngine(),
+            playMatch() or runServer() and return its result.
+        2. Instantiate a Tournament object named 'game', attaching the
+            game log and choosing the Computer's strategy if requested.
+        3. Continuously display the main menu (Start New Game vs. Load Game)
             and validate input until a valid choice (1 or 2) is received.
-        3. If 'Load Game' (2) is selected:
+        4. If 'Load Game' (2) is selected:
             a. Prompt the user for the target filename.
             b. Call Serializer::loadGame to populate the 'game' object.
-            c. Report success. If loading fails, output an error message
-                and default to starting a new game.
-        4. Call the playTournament() method to begin the primary game loop.
-        5. Return 0 to the operating system.
+            c. Report success, and reapply a strategy from the command
+                line over the saved one. If loading fails, output an error
+                message and default to starting a new game.
+        5. Call the playTournament() method to begin the primary game loop.
+        6. Return 0 to the operating system.
 Reference: None
 ********************************************************************* */
-int main() {
+int main(int argc, char* argv[]) {
+    // Replay mode: reconstruct a position from a log and exit
+    if (argc >= 3 && std::string(argv[1]) == "--replay") {
+        int eventCount = (argc >= 4) ? std::atoi(argv[3]) : -1;
+        return replayLog(argv[2], eventCount, (argc >= 5) ? argv[4] : "");
+    }
+
+    // Analysis mode: evaluate a directory of saves and exit
+    if (argc >= 3 && std::string(argv[1]) == "--analyze") {
+        return analyzeSaves(argv[2], (argc >= 4) ? argv[3] : "", (argc >= 5) ? argv[4] : Tournament::DEFAULT_STRATEGY);
+    }
+
+    // Odds mode: estimate the tournament odds of a save and exit
+    if (argc >= 3 && std::string(argv[1]) == "--odds") {
+        return estimateOdds(argv[2], (argc >= 4) ? std::atoi(argv[3]) : 1000);
+    }
+
+    // Tablebase modes: solve the small endgames, or measure a table, and exit
+    if (argc >= 3 && std::string(argv[1]) == "--build-tablebase") {
+        return buildTablebase(argv[2], (argc >= 4) ? std::atoi(argv[3]) : 2);
+    }
+    if (argc >= 3 && std::string(argv[1]) == "--probe-tablebase") {
+        return measureTablebase(argv[2], (argc >= 4) ? std::atoi(argv[3]) : 100000);
+    }
+
+    // Verification mode: play the same deals with Round and with the Playout, and exit
+    if (argc >= 2 && std::string(argv[1]) == "--verify-playout") {
+        return verifyPlayout((argc >= 3) ? std::atoi(argv[2]) : 10000);
+    }
+
+    // Self-play modes: record positions for training, or fit an evaluator to them, and exit
+    if (argc >= 4 && std::string(argv[1]) == "--self-play") {
+        return generateTrainingData(argv[2], std::atoll(argv[3]), (argc >= 5) ? argv[4] : "greedy",
+            (argc >= 6) ? argv[5] : "greedy", (argc >= 7) ? std::atoi(argv[6]) : 0);
+    }
+    if (argc >= 4 && std::string(argv[1]) == "--train-evaluator") {
+        return trainEvaluator(argv[2], argv[3]);
+    }
+
+    // Tuning mode: adjust the weighted heuristic by self-play, resumably, and exit
+    if (argc >= 3 && std::string(argv[1]) == "--tune") {
+        return tuneHeuristic(argv[2], (argc >= 4) ? std::atoi(argv[3]) : 100,
+            (argc >= 5) ? std::atoi(argv[4]) : HeuristicTuner::DEFAULT_DEALS, (argc >= 6) ? std::atoi(argv[5]) : 0);
+    }
+
+    // Arena mode: rate strategies against each other and exit
+    if (argc >= 5 && std::string(argv[1]) == "--arena") {
+        bool hasSet = (argc >= 7 && std::string(argv[3]) == "--set");
+        return runArena(std::vector<std::string>(argv + (hasSet ? 5 : 3), argv + argc), std::atoi(argv[2]),
+            hasSet ? std::atoi(argv[4]) : StandardSet::MAX_PIPS);
+    }
+    if (argc >= 5 && std::string(argv[1]) == "--match") {
+        std::string commands[2] = { argv[3], argv[4] };
+        return playMatch(std::atoi(argv[2]), commands, (argc >= 6) ? std::atoi(argv[5]) : 0);
+    }
+    if (argc >= 2 && std::string(argv[1]) == "--engine") {
+        return runEngine((argc >= 3) ? argv[2] : "");
+    }
+
+    // Server mode: host tournaments over a socket until the process ends
+    if (argc >= 3 && std::string(argv[1]) == "--serve") {
+        return runServer(argv[2], (argc >= 4) ? argv[3] : "", (argc >= 5) ? std::atoi(argv[4]) : 0,
+            (argc >= 6) ? std::atoi(argv[5]) : 0, (argc >= 7) ? argv[6] : "");
+    }
+
     // Create tournament object
     Tournament game;
+    GameLog gameLog;
     int choice;
 
+    // Options for a game, in any order
+    std::string strategy;
+    int searchMilliseconds = 0;
+    std::string tablebase;
+    std::string evaluator;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string option = argv[i];
+
+        if (option == "--log") {
+            if (gameLog.open(argv[i + 1])) {
+                game.setGameLog(&gameLog);
+            }
+        }
+        else if (option == "--strategy") {
+            strategy = argv[i + 1];
+        }
+        else if (option == "--search") {
+            searchMilliseconds = std::max(0, std::atoi(argv[i + 1]));
+        }
+        else if (option == "--tablebase") {
+            tablebase = argv[i + 1];
+        }
+        else if (option == "--evaluator") {
+            evaluator = argv[i + 1];
+        }
+    }
+
+    // The older options are shorthands for the strategies that replaced them
+    if (strategy.empty() && searchMilliseconds > 0) {
+        strategy = "solver:ms=" + std::to_string(searchMilliseconds) + (tablebase.empty() ? "" : ",tablebase=" + tablebase)
+            + (evaluator.empty() ? "" : ",evaluator=" + evaluator);
+    }
+    else if (strategy.empty() && !tablebase.empty()) {
+        strategy = "tablebase:file=" + tablebase;
+    }
+    if (!strategy.empty() && !game.setStrategy(strategy)) {
+        return 1;
+    }
+
     while (true) {
         // Display menu options to user
         std::cout << "Welcome to Longana!\n"
@@ -70,6 +1405,11 @@ int main() {
         // Attempt to populate the tournament object with data from file
         if (Serializer::loadGame(filename, game)) {
             std::cout << "Game loaded successfully." << std::endl;
+
+            // A strategy chosen on the command line overrides the saved one
+            if (!strategy.empty() && strategy != game.getStrategyName()) {
+                game.setStrategy(strategy);
+            }
         }
         else {
             // If loading fails, print error and continue to new game
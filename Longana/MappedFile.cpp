@@ -0,0 +1,221 @@
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "MappedFile.h"
+
+/* *********************************************************************
+Function Name: MappedFile
+Purpose: Default constructor. Nothing is mapped.
+Parameters: None
+Return Value: None
+Algorithm: Null the view and zero its size.
+Reference: None
+********************************************************************* */
+MappedFile::MappedFile()
+    : m_data(nullptr), m_size(0), m_isWritable(false)
+{
+}
+
+/* *********************************************************************
+Function Name: ~MappedFile
+Purpose: Destructor. Unmaps the file, if one is mapped.
+Parameters: None
+Return Value: None
+Algorithm: Call close().
+Reference: None
+********************************************************************* */
+MappedFile::~MappedFile() {
+    close();
+}
+
+/* *********************************************************************
+Function Name: open
+Purpose: Maps a file, unmapping any file mapped before.
+Parameters:
+        filename, a string representing the file path.
+Return Value: Boolean true if the file was mapped; false if it could
+        not be opened or is empty.
+Algorithm:
+        1. Open the file for reading and find its size.
+        2. Map the whole file read-only.
+        3. Close the file handles, keeping the view.
+Reference: Microsoft Learn, "Creating a File Mapping Object"; POSIX
+        mmap(2)
+********************************************************************* */
+bool MappedFile::open(const std::string& filename) {
+    close();
+
+#ifdef _WIN32
+    // 1. The file and its size
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+
+    // 2. The view
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    void* view = (mapping != nullptr) ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+
+    // 3. The view keeps the mapping alive on its own
+    if (mapping != nullptr) {
+        CloseHandle(mapping);
+    }
+    CloseHandle(file);
+
+    if (view == nullptr) {
+        return false;
+    }
+    m_size = static_cast<size_t>(size.QuadPart);
+#else
+    // 1. The file and its size
+    int file = ::open(filename.c_str(), O_RDONLY);
+    if (file < 0) {
+        return false;
+    }
+
+    struct stat status;
+    if (fstat(file, &status) != 0 || status.st_size == 0) {
+        ::close(file);
+        return false;
+    }
+
+    // 2. The view
+    void* view = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_SHARED, file, 0);
+
+    // 3. The view keeps the file alive on its own
+    ::close(file);
+
+    if (view == MAP_FAILED) {
+        return false;
+    }
+    m_size = static_cast<size_t>(status.st_size);
+#endif
+
+    m_data = static_cast<unsigned char*>(view);
+    return true;
+}
+
+/* *********************************************************************
+Function Name: create
+Purpose: Makes a file of a given size, replacing any file of that
+        name, and maps it for writing, unmapping any file mapped
+        before.
+Parameters:
+        filename, a string representing the file path.
+        size, the size of the file in bytes, more than 0. The new
+            bytes read as zero.
+Return Value: Boolean true if the file was made and mapped; false if
+        it could not be.
+Algorithm:
+        1. Create the file for reading and writing and extend it to
+            the size.
+        2. Map the whole file shared, so writes reach the file.
+        3. Close the file handles, keeping the view.
+Reference: Microsoft Learn, "Creating a File Mapping Object"; POSIX
+        mmap(2)
+********************************************************************* */
+bool MappedFile::create(const std::string& filename, size_t size) {
+    close();
+
+    if (size == 0) {
+        return false;
+    }
+
+#ifdef _WIN32
+    // 1. The file; the mapping extends it to the size
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+        FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    // 2. The view
+    unsigned long long wideSize = size;
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, static_cast<DWORD>(wideSize >> 32),
+        static_cast<DWORD>(wideSize & 0xFFFFFFFFULL), nullptr);
+    void* view = (mapping != nullptr) ? MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, 0) : nullptr;
+
+    // 3. The view keeps the mapping alive on its own
+    if (mapping != nullptr) {
+        CloseHandle(mapping);
+    }
+    CloseHandle(file);
+
+    if (view == nullptr) {
+        return false;
+    }
+#else
+    // 1. The file, extended to the size
+    int file = ::open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (file < 0) {
+        return false;
+    }
+
+    if (ftruncate(file, static_cast<off_t>(size)) != 0) {
+        ::close(file);
+        return false;
+    }
+
+    // 2. The view
+    void* view = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+
+    // 3. The view keeps the file alive on its own
+    ::close(file);
+
+    if (view == MAP_FAILED) {
+        return false;
+    }
+#endif
+
+    m_data = static_cast<unsigned char*>(view);
+    m_size = size;
+    m_isWritable = true;
+    return true;
+}
+
+/* *********************************************************************
+Function Name: close
+Purpose: Unmaps the file. Does nothing if no file is mapped.
+Parameters: None
+Return Value: None
+Algorithm: Unmap the view, which writes back the pages of a writable
+        one, then null it and zero its size.
+Reference: None
+********************************************************************* */
+void MappedFile::close() {
+    if (m_data == nullptr) {
+        return;
+    }
+
+#ifdef _WIN32
+    UnmapViewOfFile(m_data);
+#else
+    munmap(m_data, m_size);
+#endif
+
+    m_data = nullptr;
+    m_size = 0;
+    m_isWritable = false;
+}
\ No newline at end of file
@@ -0,0 +1,149 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <cstddef>
+#include <string>
+
+/* *********************************************************************
+Class Name: MappedFile
+Purpose: Maps a whole file into memory, so large tables can be used in
+        place without being read into the heap first. Pages are loaded by
+        the operating system as they are touched and shared between
+        processes mapping the same file. open() maps an existing file
+        read-only; create() makes a new file of a given size and maps it
+        for writing, so many threads can fill separate parts of it with
+        plain stores and the operating system writes the pages back.
+        Mapping uses CreateFileMapping on Windows and mmap elsewhere; the
+        file handles are closed as soon as the view exists, so only the
+        view is kept. The object owns the view, and cannot be copied.
+********************************************************************* */
+class MappedFile {
+public:
+
+    /* --- Constructor --- */
+
+    /* *********************************************************************
+    Function Name: MappedFile
+    Purpose: Default constructor. Nothing is mapped.
+    Parameters: None
+    Return Value: None
+    Algorithm: Null the view and zero its size.
+    Reference: None
+    ********************************************************************* */
+    MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /* --- Destructor --- */
+
+    /* *********************************************************************
+    Function Name: ~MappedFile
+    Purpose: Destructor. Unmaps the file, if one is mapped.
+    Parameters: None
+    Return Value: None
+    Algorithm: Call close().
+    Reference: None
+    ********************************************************************* */
+    ~MappedFile();
+
+    /* --- Selectors --- */
+
+    /* *********************************************************************
+    Function Name: isOpen
+    Purpose: Checks whether a file is mapped.
+    Parameters: None
+    Return Value: Boolean true if open() succeeded and close() has not
+            been called since.
+    Algorithm: Test the view pointer.
+    Reference: None
+    ********************************************************************* */
+    inline bool isOpen() const { return m_data != nullptr; }
+
+    /* *********************************************************************
+    Function Name: getData / getSize
+    Purpose: Retrieve the mapped bytes and their count.
+    Parameters: None
+    Return Value: A pointer to the first byte of the file, or null if
+            nothing is mapped. / The size of the file in bytes.
+    Algorithm: Return the stored view and size.
+    Reference: None
+    ********************************************************************* */
+    inline const unsigned char* getData() const { return m_data; }
+    inline size_t getSize() const { return m_size; }
+
+    /* *********************************************************************
+    Function Name: getWritableData
+    Purpose: Retrieves the mapped bytes of a file made by create().
+    Parameters: None
+    Return Value: A pointer to the first byte of the file, or null if
+            nothing is mapped or the file was mapped read-only.
+    Algorithm: Return the stored view if it is writable.
+    Reference: None
+    ********************************************************************* */
+    inline unsigned char* getWritableData() const { return m_isWritable ? m_data : nullptr; }
+
+    /* --- Mutators --- */
+
+    /* *********************************************************************
+    Function Name: open
+    Purpose: Maps a file, unmapping any file mapped before.
+    Parameters:
+            filename, a string representing the file path.
+    Return Value: Boolean true if the file was mapped; false if it could
+            not be opened or is empty.
+    Algorithm:
+            1. Open the file for reading and find its size.
+            2. Map the whole file read-only.
+            3. Close the file handles, keeping the view.
+    Reference: Microsoft Learn, "Creating a File Mapping Object"; POSIX
+            mmap(2)
+    ********************************************************************* */
+    bool open(const std::string& filename);
+
+    /* *********************************************************************
+    Function Name: create
+    Purpose: Makes a file of a given size, replacing any file of that
+            name, and maps it for writing, unmapping any file mapped
+            before.
+    Parameters:
+            filename, a string representing the file path.
+            size, the size of the file in bytes, more than 0. The new
+                bytes read as zero.
+    Return Value: Boolean true if the file was made and mapped; false if
+            it could not be.
+    Algorithm:
+            1. Create the file for reading and writing and extend it to
+                the size.
+            2. Map the whole file shared, so writes reach the file.
+            3. Close the file handles, keeping the view.
+    Reference: Microsoft Learn, "Creating a File Mapping Object"; POSIX
+            mmap(2)
+    ********************************************************************* */
+    bool create(const std::string& filename, size_t size);
+
+    /* *********************************************************************
+    Function Name: close
+    Purpose: Unmaps the file. Does nothing if no file is mapped.
+    Parameters: None
+    Return Value: None
+    Algorithm: Unmap the view, which writes back the pages of a writable
+            one, then null it and zero its size.
+    Reference: None
+    ********************************************************************* */
+    void close();
+
+private:
+    unsigned char* m_data;
+    size_t m_size;
+    bool m_isWritable;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,150 @@
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+
+#include "MonteCarloStrategy.h"
+
+/* *********************************************************************
+Function Name: MonteCarloStrategy
+Purpose: Constructor. Simulates for a time budget per move.
+Parameters:
+        milliseconds, an integer time budget, more than 0.
+Return Value: None
+Algorithm: Store the budget, seed the generator and clear the last
+        result.
+Reference: None
+********************************************************************* */
+MonteCarloStrategy::MonteCarloStrategy(int milliseconds)
+    : m_milliseconds(milliseconds), m_generator(std::random_device()()), m_stopSignal(nullptr), m_simulationCount(0), m_value(0.0)
+{
+}
+
+/* *********************************************************************
+Function Name: chooseMove
+Purpose: Chooses the mover's move by simulation.
+Parameters:
+        position, outIndex, outArm. As for ComputerStrategy.
+Return Value: Boolean true if any tile can be played.
+Algorithm:
+        1. List the moves; with one, play it without simulating.
+        2. Until the budget is spent or the stop signal is set, pick
+            the move with the highest mean plus EXPLORATION *
+            sqrt(ln(total) / count), playing each once first, and
+            simulate it: play the move, shuffle the boneyard and
+            finish the round, scoring the mover's points minus the
+            opponent's.
+        3. Return the move simulated most often, which is the one
+            UCB1 trusts; remember its mean for getReason().
+Reference: Auer, P., Cesa-Bianchi, N. and Fischer, P. (2002), "Finite-
+        time analysis of the multiarmed bandit problem"
+********************************************************************* */
+bool MonteCarloStrategy::chooseMove(const Playout& position, int& outIndex, int& outArm) {
+    // 1. The moves
+    int indices[Playout::MAX_MOVES];
+    int arms[Playout::MAX_MOVES];
+    int moveCount = position.listMoves(indices, arms);
+
+    m_simulationCount = 0;
+    m_value = 0.0;
+    if (moveCount == 0) {
+        return false;
+    }
+    outIndex = indices[0];
+    outArm = arms[0];
+    if (moveCount == 1) {
+        return true;
+    }
+
+    // 2. Simulations, checking the clock and the stop signal every 64
+    std::chrono::steady_clock::time_point deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(m_milliseconds);
+    int mover = position.getMover();
+    double totals[Playout::MAX_MOVES] = {};
+    long long counts[Playout::MAX_MOVES] = {};
+    long long simulations = 0;
+
+    while (simulations < moveCount || (simulations % 64 != 0)
+        || (std::chrono::steady_clock::now() < deadline && (m_stopSignal == nullptr || !m_stopSignal->load(std::memory_order_relaxed)))) {
+        int pick = 0;
+        if (simulations < moveCount) {
+            pick = static_cast<int>(simulations);
+        }
+        else {
+            double logTotal = std::log(static_cast<double>(simulations));
+            double bestBound = 0.0;
+            for (int m = 0; m < moveCount; ++m) {
+                double bound = totals[m] / counts[m] + EXPLORATION * std::sqrt(logTotal / counts[m]);
+                if (m == 0 || bound > bestBound) {
+                    bestBound = bound;
+                    pick = m;
+                }
+            }
+        }
+
+        Playout round = position;
+        round.playTile(indices[pick], arms[pick]);
+        round.shuffleBoneyard(m_generator);
+        round.playRound();
+
+        totals[pick] += round.getPoints(mover) - round.getPoints(1 - mover);
+        ++counts[pick];
+        ++simulations;
+    }
+
+    // 3. The most simulated
+    int best = 0;
+    for (int m = 1; m < moveCount; ++m) {
+        if (counts[m] > counts[best]) {
+            best = m;
+        }
+    }
+
+    outIndex = indices[best];
+    outArm = arms[best];
+    m_simulationCount = simulations;
+    m_value = totals[best] / counts[best];
+    return true;
+}
+
+/* *********************************************************************
+Function Name: getReason
+Purpose: Explains the last move chosen.
+Parameters: None
+Return Value: The number of simulations and the move's mean result.
+Algorithm: Describe the remembered result.
+Reference: None
+********************************************************************* */
+std::string MonteCarloStrategy::getReason() const {
+    if (m_simulationCount == 0) {
+        return "It is the only tile that fits.";
+    }
+
+    char value[16];
+    std::snprintf(value, sizeof(value), "%+.1f", m_value);
+    return "In " + std::to_string(m_simulationCount) + " simulated endings of the round, this move\n"
+        "\taveraged " + value + " points against the Human, the most trusted of its moves.";
+}
+
+/* *********************************************************************
+Function Name: getValue
+Purpose: Retrieves what the last move chosen is worth.
+Parameters:
+        outValue, a double passed by reference. Receives the value.
+Return Value: Boolean true if the move was simulated.
+Algorithm: Return the mean result remembered by chooseMove().
+Reference: None
+********************************************************************* */
+bool MonteCarloStrategy::getValue(double& outValue) const {
+    outValue = m_value;
+    return m_simulationCount > 0;
+}
\ No newline at end of file
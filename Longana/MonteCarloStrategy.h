@@ -0,0 +1,132 @@
+#ifndef MONTECARLOSTRATEGY_H
+#define MONTECARLOSTRATEGY_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <atomic>
+#include <random>
+#include <string>
+
+#include "ComputerStrategy.h"
+
+/* *********************************************************************
+Class Name: MonteCarloStrategy
+Purpose: A ComputerStrategy that plays each candidate move out many
+        times and keeps the one that did best. Each simulation reshuffles
+        the boneyard, whose order is hidden, and finishes the round with
+        first-fit on both sides. Simulations are shared out among the
+        moves by the UCB1 rule of Monte Carlo tree search, so moves that
+        look poor stop being played out early; the tree is one level
+        deep, since below the root the playouts are already the
+        Computer's own policy. Registered as "mcts".
+********************************************************************* */
+class MonteCarloStrategy : public ComputerStrategy {
+public:
+
+    // How widely simulations explore, in points; about the spread of a round's outcome
+    static constexpr double EXPLORATION = 20.0;
+
+    /* --- Constructor --- */
+
+    /* *********************************************************************
+    Function Name: MonteCarloStrategy
+    Purpose: Constructor. Simulates for a time budget per move.
+    Parameters:
+            milliseconds, an integer time budget, more than 0.
+    Return Value: None
+    Algorithm: Store the budget, seed the generator and clear the last
+            result.
+    Reference: None
+    ********************************************************************* */
+    explicit MonteCarloStrategy(int milliseconds);
+
+    /* --- Selectors --- */
+
+    /* *********************************************************************
+    Function Name: getMilliseconds
+    Purpose: Retrieves the time budget per move. As for ComputerStrategy.
+    Parameters: None
+    Return Value: The budget in milliseconds.
+    Algorithm: Return m_milliseconds.
+    Reference: None
+    ********************************************************************* */
+    inline int getMilliseconds() const override { return m_milliseconds; }
+
+    /* --- Mutators --- */
+
+    /* *********************************************************************
+    Function Name: setMilliseconds / setStopSignal
+    Purpose: Change the time budget per move, or attach a flag that ends
+            the simulations early. As for ComputerStrategy.
+    Parameters:
+            milliseconds, an integer time budget. / stop, a pointer to a
+                std::atomic<bool>, or nullptr.
+    Return Value: None
+    Algorithm: Assign the parameter to its member variable.
+    Reference: None
+    ********************************************************************* */
+    inline void setMilliseconds(int milliseconds) override { m_milliseconds = milliseconds; }
+    inline void setStopSignal(const std::atomic<bool>* stop) override { m_stopSignal = stop; }
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: chooseMove
+    Purpose: Chooses the mover's move by simulation.
+    Parameters:
+            position, outIndex, outArm. As for ComputerStrategy.
+    Return Value: Boolean true if any tile can be played.
+    Algorithm:
+            1. List the moves; with one, play it without simulating.
+            2. Until the budget is spent or the stop signal is set, pick
+                the move with the highest mean plus EXPLORATION *
+                sqrt(ln(total) / count), playing each once first, and
+                simulate it: play the move, shuffle the boneyard and
+                finish the round, scoring the mover's points minus the
+                opponent's.
+            3. Return the move simulated most often, which is the one
+                UCB1 trusts; remember its mean for getReason().
+    Reference: Auer, P., Cesa-Bianchi, N. and Fischer, P. (2002), "Finite-
+            time analysis of the multiarmed bandit problem"
+    ********************************************************************* */
+    bool chooseMove(const Playout& position, int& outIndex, int& outArm) override;
+
+    /* *********************************************************************
+    Function Name: getReason
+    Purpose: Explains the last move chosen.
+    Parameters: None
+    Return Value: The number of simulations and the move's mean result.
+    Algorithm: Describe the remembered result.
+    Reference: None
+    ********************************************************************* */
+    std::string getReason() const override;
+
+    /* *********************************************************************
+    Function Name: getValue
+    Purpose: Retrieves what the last move chosen is worth.
+    Parameters:
+            outValue, a double passed by reference. Receives the value.
+    Return Value: Boolean true if the move was simulated.
+    Algorithm: Return the mean result remembered by chooseMove().
+    Reference: None
+    ********************************************************************* */
+    bool getValue(double& outValue) const override;
+
+private:
+    int m_milliseconds;
+    std::mt19937 m_generator;
+
+    // Ends the simulations early when set (not owned)
+    const std::atomic<bool>* m_stopSignal;
+
+    // The last choice
+    long long m_simulationCount;
+    double m_value;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,152 @@
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <chrono>
+#include <cstdint>
+#include <random>
+
+#include "MoveAdvisor.h"
+#include "PipSymmetry.h"
+
+/* *********************************************************************
+Function Name: MoveAdvisor
+Purpose: Default constructor. Nothing has been ranked.
+Parameters: None
+Return Value: None
+Algorithm: Seed the generator and clear the last ranking. The cache
+        is allocated on first use, so a Round that never asks for
+        help stays cheap to copy.
+Reference: None
+********************************************************************* */
+MoveAdvisor::MoveAdvisor()
+    : m_generator(std::random_device()()), m_choices(), m_indices(), m_choiceCount(0), m_simulationCount(0), m_isCached(false)
+{
+}
+
+/* *********************************************************************
+Function Name: rank
+Purpose: Ranks the mover's choices in a position.
+Parameters:
+        position, a two-player Playout passed by const reference, in
+            which the round is not over.
+        milliseconds, an integer time budget, more than 0.
+Return Value: None
+Algorithm:
+        1. Canonicalize the position and look its key up in the cache.
+        2. On a miss, list the moves, or the draw or pass if there are
+            none. Until the budget is spent, simulate each in turn:
+            play it, shuffle the boneyard and finish the round,
+            checking the clock every 64 rounds. Sort the choices by
+            average points, keeping hand order among equals, and
+            store them with canonical tiles.
+        3. Map each stored tile to its place in the mover's hand.
+Reference: None
+********************************************************************* */
+void MoveAdvisor::rank(const Playout& position, int milliseconds) {
+    // 1. The cache entry for the canonical position
+    if (m_cache.empty()) {
+        m_cache.resize(CACHE_SIZE);
+    }
+
+    Playout canonical;
+    int permutation[PipSymmetry::PIP_COUNT];
+    PipSymmetry::canonicalize(position, canonical, permutation);
+
+    uint64_t key = PipSymmetry::getKey(canonical);
+    CacheEntry& entry = m_cache[key & (CACHE_SIZE - 1)];
+
+    // 2. Simulate on a miss
+    m_isCached = (entry.simulationCount != 0 && entry.key == key);
+    if (!m_isCached) {
+        entry.key = key;
+        simulate(canonical, milliseconds, entry);
+    }
+
+    // 3. Tiles keep their places in the canonical hand
+    int mover = canonical.getMover();
+    m_choiceCount = entry.choiceCount;
+    m_simulationCount = entry.simulationCount;
+    for (int c = 0; c < m_choiceCount; ++c) {
+        m_choices[c] = entry.choices[c];
+        m_indices[c] = -1;
+
+        for (int i = 0; m_choices[c].arm >= 0 && i < canonical.getHandSize(mover); ++i) {
+            if (canonical.getHandPacked(mover, i) == m_choices[c].tile) {
+                m_indices[c] = i;
+                break;
+            }
+        }
+    }
+}
+
+/* *********************************************************************
+Function Name: simulate
+Purpose: Simulates every choice in a position for a time budget.
+Parameters:
+        position, a canonical Playout passed by const reference.
+        milliseconds, an integer time budget.
+        outEntry, a CacheEntry passed by reference. Receives the
+            ranking.
+Return Value: None
+Algorithm: As step 2 of rank().
+Reference: None
+********************************************************************* */
+void MoveAdvisor::simulate(const Playout& position, int milliseconds, CacheEntry& outEntry) {
+    int indices[MAX_CHOICES];
+    int arms[MAX_CHOICES];
+    int choiceCount = position.listMoves(indices, arms);
+
+    // With no tile to play, the only choice is to draw or pass
+    if (choiceCount == 0) {
+        indices[0] = -1;
+        arms[0] = -1;
+        choiceCount = 1;
+    }
+
+    std::chrono::steady_clock::time_point deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(milliseconds);
+    int mover = position.getMover();
+    double totals[MAX_CHOICES] = {};
+    long long wins[MAX_CHOICES] = {};
+    long long simulations = 0;
+
+    while (simulations < choiceCount || (simulations % 64 != 0) || std::chrono::steady_clock::now() < deadline) {
+        int pick = static_cast<int>(simulations % choiceCount);
+
+        Playout round = position;
+        if (arms[pick] >= 0) {
+            round.playTile(indices[pick], arms[pick]);
+        }
+        round.shuffleBoneyard(m_generator);
+        round.playRound();
+
+        int margin = round.getPoints(mover) - round.getPoints(1 - mover);
+        totals[pick] += margin;
+        wins[pick] += (margin > 0) ? 1 : 0;
+        ++simulations;
+    }
+
+    // Insertion sort by average, best first; earlier choices ran no fewer rounds
+    outEntry.simulationCount = simulations;
+    outEntry.choiceCount = choiceCount;
+    for (int c = 0; c < choiceCount; ++c) {
+        long long count = simulations / choiceCount + ((c < simulations % choiceCount) ? 1 : 0);
+
+        Choice choice;
+        choice.tile = (arms[c] >= 0) ? position.getHandPacked(mover, indices[c]) : 0;
+        choice.arm = static_cast<signed char>(arms[c]);
+        choice.value = totals[c] / count;
+        choice.winRate = static_cast<double>(wins[c]) / count;
+
+        int slot = c;
+        while (slot > 0 && outEntry.choices[slot - 1].value < choice.value) {
+            outEntry.choices[slot] = outEntry.choices[slot - 1];
+            --slot;
+        }
+        outEntry.choices[slot] = choice;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,195 @@
+#ifndef MOVEADVISOR_H
+#define MOVEADVISOR_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "Playout.h"
+
+/* *********************************************************************
+Class Name: MoveAdvisor
+Purpose: Ranks every choice the mover has, best first, for the Human's
+        help command. Each move (or the draw or pass when no tile fits)
+        is played out many times with the boneyard reshuffled and both
+        sides then playing first-fit, and is scored by its average points
+        against the opponent and the share of the rounds it won.
+        Simulations are dealt to the moves in turn, so every estimate
+        rests on the same number of rounds, until the time budget runs
+        out.
+
+        Rankings are cached by PipSymmetry::getKey(), so asking again in
+        the same position, or in one that differs only by order or a
+        renaming of pips that keeps every value, answers at once. The
+        cache stores tiles in canonical pips and maps them back to the
+        hand asked about.
+********************************************************************* */
+class MoveAdvisor {
+public:
+
+    // Rankings remembered, a power of two
+    static const int CACHE_SIZE = 1 << 8;
+
+    // The most choices a ranking holds: every move, or the draw or pass
+    static const int MAX_CHOICES = Playout::MAX_MOVES;
+
+    /* --- Constructor --- */
+
+    /* *********************************************************************
+    Function Name: MoveAdvisor
+    Purpose: Default constructor. Nothing has been ranked.
+    Parameters: None
+    Return Value: None
+    Algorithm: Seed the generator and clear the last ranking. The cache
+            is allocated on first use, so a Round that never asks for
+            help stays cheap to copy.
+    Reference: None
+    ********************************************************************* */
+    MoveAdvisor();
+
+    /* --- Destructor --- */
+
+    /* *********************************************************************
+    Function Name: ~MoveAdvisor
+    Purpose: Destructor. The cache releases its own storage.
+    Parameters: None
+    Return Value: None
+    Algorithm: Standard object destruction.
+    Reference: None
+    ********************************************************************* */
+    ~MoveAdvisor() = default;
+
+    /* --- Selectors --- */
+
+    /* *********************************************************************
+    Function Name: getChoiceCount
+    Purpose: Retrieves the number of choices in the last ranking.
+    Parameters: None
+    Return Value: An integer count, at least 1.
+    Algorithm: Return the stored count.
+    Reference: None
+    ********************************************************************* */
+    inline int getChoiceCount() const { return m_choiceCount; }
+
+    /* *********************************************************************
+    Function Name: getIndex / getArm
+    Purpose: Retrieve a choice of the last ranking.
+    Parameters:
+            rank, an integer from 0 (best) to getChoiceCount() - 1.
+    Return Value: The tile's position in the mover's hand, or -1 for the
+            draw or pass. / The player number of the arm, or -1.
+    Algorithm: Return the stored choice.
+    Reference: None
+    ********************************************************************* */
+    inline int getIndex(int rank) const { return m_indices[rank]; }
+    inline int getArm(int rank) const { return m_choices[rank].arm; }
+
+    /* *********************************************************************
+    Function Name: getValue / getWinRate
+    Purpose: Retrieve the estimates for a choice of the last ranking.
+    Parameters:
+            rank, an integer from 0 (best) to getChoiceCount() - 1.
+    Return Value: The mover's average points minus the opponent's. / The
+            share of simulated rounds the mover won, from 0 to 1.
+    Algorithm: Return the stored estimate.
+    Reference: None
+    ********************************************************************* */
+    inline double getValue(int rank) const { return m_choices[rank].value; }
+    inline double getWinRate(int rank) const { return m_choices[rank].winRate; }
+
+    /* *********************************************************************
+    Function Name: getSimulationCount
+    Purpose: Retrieves the number of rounds simulated for the last ranking.
+    Parameters: None
+    Return Value: A count of rounds, over all choices.
+    Algorithm: Return the stored count.
+    Reference: None
+    ********************************************************************* */
+    inline long long getSimulationCount() const { return m_simulationCount; }
+
+    /* *********************************************************************
+    Function Name: isCached
+    Purpose: Checks whether the last ranking came from the cache.
+    Parameters: None
+    Return Value: Boolean true if nothing was simulated for it.
+    Algorithm: Return the stored flag.
+    Reference: None
+    ********************************************************************* */
+    inline bool isCached() const { return m_isCached; }
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: rank
+    Purpose: Ranks the mover's choices in a position.
+    Parameters:
+            position, a two-player Playout passed by const reference, in
+                which the round is not over.
+            milliseconds, an integer time budget, more than 0.
+    Return Value: None
+    Algorithm:
+            1. Canonicalize the position and look its key up in the cache.
+            2. On a miss, list the moves, or the draw or pass if there are
+                none. Until the budget is spent, simulate each in turn:
+                play it, shuffle the boneyard and finish the round,
+                checking the clock every 64 rounds. Sort the choices by
+                average points, keeping hand order among equals, and
+                store them with canonical tiles.
+            3. Map each stored tile to its place in the mover's hand.
+    Reference: None
+    ********************************************************************* */
+    void rank(const Playout& position, int milliseconds);
+
+private:
+
+    // A ranked choice; tile is the canonical packed tile, unused for the draw or pass
+    struct Choice {
+        unsigned char tile;
+        signed char arm;
+        double value;
+        double winRate;
+    };
+
+    // A stored ranking; a simulation count of 0 marks an empty entry
+    struct CacheEntry {
+        uint64_t key;
+        long long simulationCount;
+        int choiceCount;
+        Choice choices[MAX_CHOICES];
+    };
+
+    std::mt19937 m_generator;
+
+    // Rankings, indexed by the low bits of the key
+    std::vector<CacheEntry> m_cache;
+
+    // The last ranking, with each tile's place in the hand asked about
+    Choice m_choices[MAX_CHOICES];
+    int m_indices[MAX_CHOICES];
+    int m_choiceCount;
+    long long m_simulationCount;
+    bool m_isCached;
+
+    /* *********************************************************************
+    Function Name: simulate
+    Purpose: Simulates every choice in a position for a time budget.
+    Parameters:
+            position, a canonical Playout passed by const reference.
+            milliseconds, an integer time budget.
+            outEntry, a CacheEntry passed by reference. Receives the
+                ranking.
+    Return Value: None
+    Algorithm: As step 2 of rank().
+    Reference: None
+    ********************************************************************* */
+    void simulate(const Playout& position, int milliseconds, CacheEntry& outEntry);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,358 @@
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <bit>
+#include <cstdint>
+
+#include "DominoSet.h"
+#include "PipSymmetry.h"
+#include "Playout.h"
+#include "Round.h"
+
+/* *********************************************************************
+Function Name: findCanonical
+Purpose: Finds the renaming that makes a position canonical.
+Parameters:
+        position, a Playout passed by const reference.
+        outPermutation, an array of PIP_COUNT integers. Receives the
+            new value of each pip value.
+Return Value: The number of renamings of the live pips that keep the
+        value of the position, 1 if only the identity does.
+Algorithm:
+        1. Mark the tiles in play and the pips they carry.
+        2. Try every renaming of the live pips, pip by pip, that keeps
+            the total of every tile in play between pips already
+            renamed; a double in play fixes its pip.
+        3. Complete each with the dead pips, giving the lowest values
+            left to the dead arms in arm order, and keep the renaming
+            whose signature comes first.
+Reference: None
+********************************************************************* */
+int PipSymmetry::findCanonical(const Playout& position, int* outPermutation) {
+    Relabeling state;
+    findBest(position, state);
+
+    for (int pips = 0; pips < PIP_COUNT; ++pips) {
+        outPermutation[pips] = state.best[pips];
+    }
+    return state.count;
+}
+
+/* *********************************************************************
+Function Name: canonicalize
+Purpose: Copies a position, or a round in progress, and renames its
+        pips to the canonical form.
+Parameters:
+        position, a Playout passed by const reference. / round, a
+            Round passed by const reference.
+        outCanonical, a Playout passed by reference. Receives the
+            canonical position. Tiles keep their places in the hands,
+            so a move found in it is played from the original with the
+            same hand position and arm.
+        outPermutation, an array of PIP_COUNT integers. Receives the
+            renaming used; a tile of the original is found in the
+            canonical position by renaming both halves.
+Return Value: None
+Algorithm: Copy the position, or load the round into a Playout, find
+        the canonical renaming and apply it.
+Reference: None
+********************************************************************* */
+void PipSymmetry::canonicalize(const Playout& position, Playout& outCanonical, int* outPermutation) {
+    findCanonical(position, outPermutation);
+    outCanonical = position;
+    outCanonical.relabelPips(outPermutation);
+}
+
+void PipSymmetry::canonicalize(const Round& round, Playout& outCanonical, int* outPermutation) {
+    Playout position;
+    position.loadRound(round);
+    canonicalize(position, outCanonical, outPermutation);
+}
+
+/* *********************************************************************
+Function Name: getKey
+Purpose: Computes a 64-bit key for a position that is the same for
+        every renaming of it that keeps its value. The key ignores the
+        order of the hands and the boneyard, which change no value.
+Parameters:
+        position, a Playout passed by const reference.
+Return Value: The key.
+Algorithm: Find the canonical renaming, then mix its signature with
+        the mover, the player count and the pass flags.
+Reference: Steele, G. L., Lea, D. and Flood, C. H. (2014), "Fast
+        splittable pseudorandom number generators" (the SplitMix64
+        finalizer)
+********************************************************************* */
+uint64_t PipSymmetry::getKey(const Playout& position) {
+    Relabeling state;
+    findBest(position, state);
+
+    // The turn, packed into one word
+    uint64_t turn = static_cast<uint64_t>(position.getMover()) | (static_cast<uint64_t>(position.getPlayerCount()) << 4);
+    for (int player = 0; player < position.getPlayerCount(); ++player) {
+        turn |= static_cast<uint64_t>(position.hasPassed(player) ? 1 : 0) << (8 + player);
+    }
+
+    // Each word is mixed in whole before the next, so no two words can cancel
+    uint64_t key = 0;
+    for (int i = -1; i < SIGNATURE_SIZE; ++i) {
+        key = (key ^ (i < 0 ? turn : state.bestSignature[i])) + 0x9E3779B97F4A7C15ULL;
+        key = (key ^ (key >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        key = (key ^ (key >> 27)) * 0x94D049BB133111EBULL;
+        key ^= key >> 31;
+    }
+    return key;
+}
+
+/* *********************************************************************
+Function Name: findBest
+Purpose: Finds the renamings of a position that keep its value and the
+        one whose signature comes first.
+Parameters:
+        position, a Playout passed by const reference.
+        state, a Relabeling passed by reference. Receives the best
+            renaming, its signature and the number of renamings.
+Return Value: None
+Algorithm:
+        1. Mark the tiles in play and the pips they carry.
+        2. Fix every pip joined by tiles in play to a double in play:
+            a double keeps its pip, and each tile then forces the next.
+        3. Try every renaming of the other live pips with extend(); each
+            is completed and compared by complete().
+Reference: None
+********************************************************************* */
+void PipSymmetry::findBest(const Playout& position, Relabeling& state) {
+    state = Relabeling();
+    state.position = &position;
+
+    // 1. The tiles in play, from every hand and the boneyard
+    auto mark = [&state](unsigned char packed) {
+        int high = packed >> 4;
+        int low = packed & 0x0F;
+        state.neighbors[high] |= 1u << low;
+        state.neighbors[low] |= 1u << high;
+    };
+
+    for (int player = 0; player < position.getPlayerCount(); ++player) {
+        for (int i = 0; i < position.getHandSize(player); ++i) {
+            mark(position.getHandPacked(player, i));
+        }
+    }
+    for (int i = 0; i < position.getBoneyardSize(); ++i) {
+        mark(position.getBoneyardPacked(i));
+    }
+
+    // 2. A double keeps its pip, and through the tiles every pip connected to it
+    unsigned fixed = 0;
+    for (int pips = 0; pips < PIP_COUNT; ++pips) {
+        state.permutation[pips] = -1;
+        if (state.neighbors[pips] & (1u << pips)) {
+            fixed |= 1u << pips;
+        }
+    }
+
+    for (unsigned reached = fixed, grown = 0; reached != grown; ) {
+        grown = reached;
+        for (int pips = 0; pips < PIP_COUNT; ++pips) {
+            if (grown & (1u << pips)) {
+                reached |= state.neighbors[pips];
+            }
+        }
+        fixed = reached;
+    }
+
+    for (int pips = 0; pips < PIP_COUNT; ++pips) {
+        if (fixed & (1u << pips)) {
+            state.permutation[pips] = pips;
+            state.isUsed[pips] = true;
+        }
+    }
+
+    // 3. The rest can move
+    extend(state, 0);
+}
+
+
+/* *********************************************************************
+Function Name: extend
+Purpose: Renames the live pips from a pip value on, in every way that
+        keeps the tiles' totals, and completes each renaming.
+Parameters:
+        state, a Relabeling passed by reference.
+        pips, an integer. Every live pip below it is renamed.
+Return Value: None
+Algorithm:
+        1. Find the next live pip not yet renamed; past the last pip,
+            call complete().
+        2. Try each value not yet used for it. A tile between a renamed
+            pip and another forces the other's value, so follow the tiles
+            in play from it, renaming every pip they reach, and give up
+            on the value if a forced value is out of range, taken, or
+            disagrees with one already forced.
+        3. Recurse, then undo the values this attempt forced.
+Reference: None
+********************************************************************* */
+void PipSymmetry::extend(Relabeling& state, int pips) {
+    // 1. The next pip to choose a value for
+    while (pips < PIP_COUNT && (state.neighbors[pips] == 0 || state.permutation[pips] >= 0)) {
+        ++pips;
+    }
+    if (pips == PIP_COUNT) {
+        complete(state);
+        return;
+    }
+
+    for (int value = 0; value < PIP_COUNT; ++value) {
+        if (state.isUsed[value]) {
+            continue;
+        }
+
+        // 2. Follow the tiles from the pip; renamed pips double as the queue
+        int queue[PIP_COUNT];
+        int queueSize = 0;
+        bool keepsTotals = true;
+
+        state.permutation[pips] = value;
+        state.isUsed[value] = true;
+        queue[queueSize++] = pips;
+
+        for (int next = 0; next < queueSize && keepsTotals; ++next) {
+            int from = queue[next];
+
+            for (unsigned tiles = state.neighbors[from]; tiles != 0 && keepsTotals; tiles &= tiles - 1) {
+                int to = std::countr_zero(tiles);
+                int forced = from + to - state.permutation[from];
+
+                if (state.permutation[to] >= 0) {
+                    keepsTotals = (state.permutation[to] == forced);
+                }
+                else if (forced < 0 || forced >= PIP_COUNT || state.isUsed[forced]) {
+                    keepsTotals = false;
+                }
+                else {
+                    state.permutation[to] = forced;
+                    state.isUsed[forced] = true;
+                    queue[queueSize++] = to;
+                }
+            }
+        }
+
+        // 3. Recurse, then take back every value forced by this one
+        if (keepsTotals) {
+            extend(state, pips + 1);
+        }
+        for (int i = 0; i < queueSize; ++i) {
+            state.isUsed[state.permutation[queue[i]]] = false;
+            state.permutation[queue[i]] = -1;
+        }
+    }
+}
+
+
+/* *********************************************************************
+Function Name: complete
+Purpose: Gives the dead pips the values left and keeps the renaming if
+        its signature comes first so far.
+Parameters:
+        state, a Relabeling passed by reference.
+Return Value: None
+Algorithm:
+        1. Give the lowest values left to the dead pips open on an
+            arm, in arm order, then the rest in order.
+        2. Compute the signature and compare it with the best.
+Reference: None
+********************************************************************* */
+void PipSymmetry::complete(Relabeling& state) {
+    const Playout& position = *state.position;
+    int permutation[PIP_COUNT];
+    bool isDone[PIP_COUNT];
+    bool isUsed[PIP_COUNT];
+
+    for (int pips = 0; pips < PIP_COUNT; ++pips) {
+        permutation[pips] = state.permutation[pips];
+        isDone[pips] = (state.permutation[pips] >= 0);
+        isUsed[pips] = state.isUsed[pips];
+    }
+
+    // 1. The dead arms take the lowest values left, so every dead arm looks alike
+    int next = 0;
+    auto assign = [&](int pips) {
+        while (isUsed[next]) {
+            ++next;
+        }
+        permutation[pips] = next;
+        isUsed[next] = true;
+        isDone[pips] = true;
+    };
+
+    for (int arm = 0; arm < position.getPlayerCount(); ++arm) {
+        if (!isDone[position.getArmEnd(arm)]) {
+            assign(position.getArmEnd(arm));
+        }
+    }
+    for (int pips = 0; pips < PIP_COUNT; ++pips) {
+        if (!isDone[pips]) {
+            assign(pips);
+        }
+    }
+
+    // 2. Keep the first signature
+    Mask signature[SIGNATURE_SIZE];
+    getSignature(position, permutation, signature);
+
+    int order = (state.count == 0) ? -1 : 0;
+    for (int i = 0; i < SIGNATURE_SIZE && order == 0; ++i) {
+        if (signature[i] != state.bestSignature[i]) {
+            order = (signature[i] < state.bestSignature[i]) ? -1 : 1;
+        }
+    }
+
+    if (order < 0) {
+        for (int pips = 0; pips < PIP_COUNT; ++pips) {
+            state.best[pips] = permutation[pips];
+        }
+        for (int i = 0; i < SIGNATURE_SIZE; ++i) {
+            state.bestSignature[i] = signature[i];
+        }
+    }
+    ++state.count;
+}
+
+/* *********************************************************************
+Function Name: getSignature
+Purpose: Describes a position under a renaming, ignoring the order of
+        the hands and the boneyard.
+Parameters:
+        position, a Playout passed by const reference.
+        permutation, an array of PIP_COUNT integers.
+        outSignature, an array of SIGNATURE_SIZE masks. Receives the
+            renamed mask of each hand and of the boneyard, then the
+            renamed pips of each arm; unused words are 0.
+Return Value: None
+Algorithm: Rename both halves of every tile and set its bit.
+Reference: None
+********************************************************************* */
+void PipSymmetry::getSignature(const Playout& position, const int* permutation, Mask* outSignature) {
+    int playerCount = position.getPlayerCount();
+
+    for (int i = 0; i < SIGNATURE_SIZE; ++i) {
+        outSignature[i] = 0;
+    }
+
+    for (int player = 0; player < playerCount; ++player) {
+        for (int i = 0; i < position.getHandSize(player); ++i) {
+            unsigned char packed = position.getHandPacked(player, i);
+            outSignature[player] |= getTileBit(permutation[packed >> 4], permutation[packed & 0x0F]);
+        }
+        outSignature[Playout::MAX_PLAYERS + 1 + player] = static_cast<Mask>(permutation[position.getArmEnd(player)]);
+    }
+
+    for (int i = 0; i < position.getBoneyardSize(); ++i) {
+        unsigned char packed = position.getBoneyardPacked(i);
+        outSignature[Playout::MAX_PLAYERS] |= getTileBit(permutation[packed >> 4], permutation[packed & 0x0F]);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,225 @@
+#ifndef PIPSYMMETRY_H
+#define PIPSYMMETRY_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <cstdint>
+
+#include "DominoSet.h"
+#include "Playout.h"
+
+class Round;
+
+/* *********************************************************************
+Class Name: PipSymmetry
+Purpose: Maps a position to a canonical representative of the positions
+        that differ from it only by renaming pip values, so tables keyed
+        by position (the search's transposition table, analysis caches)
+        share one entry between them.
+
+        Renaming pips keeps the moves, passes and draws of a round the
+        same, but not its points: a round is scored in pips, so 6-6 is
+        worth twelve points and 0-0 none. A renaming therefore only leaves
+        the value of a position unchanged if every tile still in play (in
+        a hand or the boneyard) keeps its pip total. Two kinds qualify:
+            - Any renaming of the dead pips, the values no tile in play
+                carries. They survive only as the open pips of an arm
+                that can never be played on again, so every dead arm is
+                alike whatever its number.
+            - Renamings of the live pips that pair them off so every tile
+                keeps its total, such as swapping 1 with 4 and 2 with 3
+                when 1-4 and 2-3 are the only tiles carrying them. A
+                double in play fixes its pip, so these need few doubles
+                left.
+        The canonical position is the one of these renamings whose hands,
+        boneyard and arms, as masks and pips, come first in a fixed order.
+
+        Only double-six positions are handled, the set the game and its
+        tables are built for.
+********************************************************************* */
+class PipSymmetry {
+public:
+
+    static const int PIP_COUNT = StandardSet::MAX_PIPS + 1;
+
+    /* --- Constructor --- */
+
+    /* *********************************************************************
+    Function Name: PipSymmetry (Constructor)
+    Purpose: To prevent instantiation. The class is a static utility.
+    Parameters: None
+    Return Value: None
+    Algorithm: None (Function is deleted)
+    Reference: None
+    ********************************************************************* */
+    PipSymmetry() = delete;
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: findCanonical
+    Purpose: Finds the renaming that makes a position canonical.
+    Parameters:
+            position, a Playout passed by const reference.
+            outPermutation, an array of PIP_COUNT integers. Receives the
+                new value of each pip value.
+    Return Value: The number of renamings of the live pips that keep the
+            value of the position, 1 if only the identity does.
+    Algorithm:
+            1. Try every renaming of the live pips that keeps the total of
+                every tile in play; a double in play fixes its pip.
+            2. Complete each with the dead pips, giving the lowest values
+                left to the dead arms in arm order, and keep the renaming
+                whose signature comes first.
+    Reference: None
+    ********************************************************************* */
+    static int findCanonical(const Playout& position, int* outPermutation);
+
+    /* *********************************************************************
+    Function Name: canonicalize
+    Purpose: Copies a position, or a round in progress, and renames its
+            pips to the canonical form.
+    Parameters:
+            position, a Playout passed by const reference. / round, a
+                Round passed by const reference.
+            outCanonical, a Playout passed by reference. Receives the
+                canonical position. Tiles keep their places in the hands,
+                so a move found in it is played from the original with the
+                same hand position and arm.
+            outPermutation, an array of PIP_COUNT integers. Receives the
+                renaming used; a tile of the original is found in the
+                canonical position by renaming both halves.
+    Return Value: None
+    Algorithm: Copy the position, or load the round into a Playout, find
+            the canonical renaming and apply it.
+    Reference: None
+    ********************************************************************* */
+    static void canonicalize(const Playout& position, Playout& outCanonical, int* outPermutation);
+    static void canonicalize(const Round& round, Playout& outCanonical, int* outPermutation);
+
+    /* *********************************************************************
+    Function Name: getKey
+    Purpose: Computes a 64-bit key for a position that is the same for
+            every renaming of it that keeps its value. The key ignores the
+            order of the hands and the boneyard, which change no value.
+    Parameters:
+            position, a Playout passed by const reference.
+    Return Value: The key.
+    Algorithm: Find the canonical renaming, then mix its signature with
+            the mover, the player count and the pass flags.
+    Reference: Steele, G. L., Lea, D. and Flood, C. H. (2014), "Fast
+            splittable pseudorandom number generators" (the SplitMix64
+            finalizer)
+    ********************************************************************* */
+    static uint64_t getKey(const Playout& position);
+
+private:
+
+    // Words in a signature: a mask per hand, the boneyard's mask, and the arms' pips
+    static const int SIGNATURE_SIZE = Playout::MAX_PLAYERS * 2 + 1;
+
+    typedef StandardSet::Mask Mask;
+
+    // The state of the search for the canonical renaming
+    struct Relabeling {
+        const Playout* position;
+        unsigned neighbors[PIP_COUNT];  // bit q of pip p is set if the tile p-q is in play
+        bool isUsed[PIP_COUNT];
+        int permutation[PIP_COUNT];     // -1 until renamed
+        int best[PIP_COUNT];
+        Mask bestSignature[SIGNATURE_SIZE];
+        int count;
+    };
+
+    /* *********************************************************************
+    Function Name: findBest
+    Purpose: Finds the renamings of a position that keep its value and the
+            one whose signature comes first.
+    Parameters:
+            position, a Playout passed by const reference.
+            state, a Relabeling passed by reference. Receives the best
+                renaming, its signature and the number of renamings.
+    Return Value: None
+    Algorithm:
+            1. Mark the tiles in play and the pips they carry.
+            2. Fix every pip joined by tiles in play to a double in play:
+                a double keeps its pip, and each tile then forces the next.
+            3. Try every renaming of the other live pips with extend(); each
+                is completed and compared by complete().
+    Reference: None
+    ********************************************************************* */
+    static void findBest(const Playout& position, Relabeling& state);
+
+    /* *********************************************************************
+    Function Name: extend
+    Purpose: Renames the live pips from a pip value on, in every way that
+            keeps the tiles' totals, and completes each renaming.
+    Parameters:
+            state, a Relabeling passed by reference.
+            pips, an integer. Every live pip below it is renamed.
+    Return Value: None
+    Algorithm:
+            1. Find the next live pip not yet renamed; past the last pip,
+                call complete().
+            2. Try each value not yet used for it. A tile between a renamed
+                pip and another forces the other's value, so follow the tiles
+                in play from it, renaming every pip they reach, and give up
+                on the value if a forced value is out of range, taken, or
+                disagrees with one already forced.
+            3. Recurse, then undo the values this attempt forced.
+    Reference: None
+    ********************************************************************* */
+    static void extend(Relabeling& state, int pips);
+
+    /* *********************************************************************
+    Function Name: complete
+    Purpose: Gives the dead pips the values left and keeps the renaming if
+            its signature comes first so far.
+    Parameters:
+            state, a Relabeling passed by reference.
+    Return Value: None
+    Algorithm:
+            1. Give the lowest values left to the dead pips open on an
+                arm, in arm order, then the rest in order.
+            2. Compute the signature and compare it with the best.
+    Reference: None
+    ********************************************************************* */
+    static void complete(Relabeling& state);
+
+    /* *********************************************************************
+    Function Name: getSignature
+    Purpose: Describes a position under a renaming, ignoring the order of
+            the hands and the boneyard.
+    Parameters:
+            position, a Playout passed by const reference.
+            permutation, an array of PIP_COUNT integers.
+            outSignature, an array of SIGNATURE_SIZE masks. Receives the
+                renamed mask of each hand and of the boneyard, then the
+                renamed pips of each arm; unused words are 0.
+    Return Value: None
+    Algorithm: Rename both halves of every tile and set its bit.
+    Reference: None
+    ********************************************************************* */
+    static void getSignature(const Playout& position, const int* permutation, Mask* outSignature);
+
+    /* *********************************************************************
+    Function Name: getTileBit
+    Purpose: Finds the bit of a tile, given as two pip values in any order.
+    Parameters:
+            first, second, integers. The pips of the halves.
+    Return Value: The mask holding only that tile.
+    Algorithm: Order the halves and look up the bit.
+    Reference: None
+    ********************************************************************* */
+    static inline Mask getTileBit(int first, int second) {
+        return (first < second) ? StandardSet::getBit(StandardSet::getIndex(first, second))
+            : StandardSet::getBit(StandardSet::getIndex(second, first));
+    }
+};
+
+#endif
\ No newline at end of file
@@ -8,6 +8,9 @@
  * Date:  02/12/2026                                        *
  ************************************************************/
 
+#include <iostream>
+#include <ostream>
+
 #include "Hand.h"
 #include "Layout.h"
 #include "Stock.h"
@@ -15,10 +18,12 @@
 
 /* *********************************************************************
 Class Name: Player
-Purpose: An abstract base class representing a generic player in the
-        Longana game. It manages the common state (Hand and Score) and
-        defines the interface for playing a turn, which must be implemented
-        by derived classes (Human and Computer).
+Purpose: A base class representing a generic player in the Longana
+        game. It manages the common state (Hand and Score). Each kind of
+        player takes its turns its own way: the Human from a TurnChannel,
+        the Computer with the round's ComputerStrategy (see
+        Round::playStrategyTurn), and an ExternalPlayer through another
+        program.
 ********************************************************************* */
 class Player {
 public:
@@ -32,11 +37,11 @@ public:
     Parameters: None
     Return Value: None
     Algorithm:
-            1. Initialize m_score to 0.
+            1. Initialize m_score to 0, writing to std::cout.
             2. Hand constructor is called implicitly.
     Reference: None
     ********************************************************************* */
-    Player() : m_score(0) {}
+    Player() : m_score(0), m_output(&std::cout) {}
 
     /* --- Destructor --- */
 
@@ -129,6 +134,18 @@ public:
     ********************************************************************* */
     inline void setScore(int score) { m_score = score; }
 
+    /* *********************************************************************
+    Function Name: setOutput
+    Purpose: Chooses the stream the player's turns are reported on.
+    Parameters:
+            output, an ostream passed by reference. Must outlive the
+                player's turns.
+    Return Value: None (void)
+    Algorithm: Store the stream's address in m_output.
+    Reference: None
+    ********************************************************************* */
+    inline void setOutput(std::ostream& output) { m_output = &output; }
+
     /* --- Utility Functions --- */
 
     /* *********************************************************************
@@ -151,24 +168,13 @@ public:
     ********************************************************************* */
     inline int getHandSize() const { return m_hand.getSize(); }
 
-    /* *********************************************************************
-    Function Name: playTurn
-    Purpose: Pure virtual function defining the interface for a turn.
-            Derived classes must implement their specific turn logic here.
-    Parameters:
-            layout, a Layout object passed by reference.
-            stock, a Stock object passed by reference.
-            opponentPassed, a boolean indicating if the opponent passed.
-    Return Value: true if a move was made, false if passed.
-    Algorithm: N/A (Abstract function)
-    Reference: None
-    ********************************************************************* */
-    virtual bool playTurn(Layout& layout, Stock& stock, bool opponentPassed) = 0;
-
 protected:
     Hand m_hand;
     int m_score;
 
+    // Where turns are reported, std::cout unless set (not owned)
+    std::ostream* m_output;
+
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,648 @@
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <random>
+#include <utility>
+
+#include "DominoSet.h"
+#include "GreedyStrategy.h"
+#include "Playout.h"
+#include "Round.h"
+#include "Tile.h"
+
+/* *********************************************************************
+Function Name: BasicPlayout
+Purpose: Default constructor. Creates an empty, finished round for two
+        players.
+Parameters: None
+Return Value: None
+Algorithm: Zero every member.
+Reference: None
+********************************************************************* */
+template <int MaxPips>
+BasicPlayout<MaxPips>::BasicPlayout()
+    : BasicPlayout(MIN_PLAYERS)
+{
+}
+
+/* *********************************************************************
+Function Name: BasicPlayout
+Purpose: Creates an empty, finished round for a table of players.
+Parameters:
+        playerCount, an integer. Between MIN_PLAYERS and MAX_PLAYERS;
+            any other value defaults to two players.
+Return Value: None
+Algorithm: Zero every member and store the player count.
+Reference: None
+********************************************************************* */
+template <int MaxPips>
+BasicPlayout<MaxPips>::BasicPlayout(int playerCount)
+    : m_players(), m_playerCount(MIN_PLAYERS), m_boneyard(), m_boneyardTop(0), m_boneyardSize(0),
+    m_mover(HUMAN), m_isOver(true)
+{
+    if (playerCount >= MIN_PLAYERS && playerCount <= MAX_PLAYERS) {
+        m_playerCount = playerCount;
+    }
+}
+
+/* *********************************************************************
+Function Name: getHandPips
+Purpose: Totals the pips in a player's hand.
+Parameters:
+        player, a player number.
+Return Value: An integer pip total.
+Algorithm: Sum both halves of every tile in the hand.
+Reference: None
+********************************************************************* */
+template <int MaxPips>
+int BasicPlayout<MaxPips>::getHandPips(int player) const {
+    const PlayerState& state = m_players[player];
+    int total = 0;
+    for (int i = 0; i < state.handSize; ++i) {
+        total += (state.hand[i] >> 4) + (state.hand[i] & 0x0F);
+    }
+    return total;
+}
+
+/* *********************************************************************
+Function Name: chooseMove
+Purpose: Chooses a move for the player whose turn it is with the
+        Computer's first-fit strategy: the first tile in hand order that
+        fits the player's own arm, otherwise the first that fits an arm
+        it is allowed on, trying the arms in turn order after the mover.
+Parameters:
+        outIndex, an integer passed by reference. Receives the position
+            of the chosen tile in the hand.
+        outArm, an integer passed by reference. Receives the player
+            number of the arm to play on.
+Return Value: Boolean true if any tile can be played.
+Algorithm:
+        1. Intersect the hand's mask with the masks of tiles matching
+            each arm; another player's arm allows only doubles unless
+            that player passed. Stop if nothing fits.
+        2. Otherwise scan the hand in order for the first tile that
+            fits the own arm, else the first that fits another arm.
+        3. For a tile on another arm, take the first arm it is allowed
+            on in turn order.
+Reference: None
+********************************************************************* */
+template <int MaxPips>
+bool BasicPlayout<MaxPips>::chooseMove(int& outIndex, int& outArm) const {
+    const PlayerState& mover = m_players[m_mover];
+
+    // 1. Decide from the masks whether anything fits at all
+    typename Set::Mask ownFits = mover.handMask & Set::getPipMask(mover.armEnd);
+    typename Set::Mask otherFits = 0;
+    for (int arm = 0; arm < m_playerCount; ++arm) {
+        if (arm == m_mover) {
+            continue;
+        }
+        typename Set::Mask fits = mover.handMask & Set::getPipMask(m_players[arm].armEnd);
+        otherFits |= m_players[arm].passed ? fits : (fits & Set::getDoublesMask());
+    }
+
+    outIndex = -1;
+    if (!ownFits && !otherFits) {
+        return false;
+    }
+
+    // 2. Hand order decides between the tiles that fit
+    for (int i = 0; i < mover.handSize; ++i) {
+        typename Set::Mask tile = getTileBit(mover.hand[i]);
+
+        if (ownFits & tile) {
+            outIndex = i;
+            outArm = m_mover;
+            return true;
+        }
+        if (outIndex == -1 && (otherFits & tile)) {
+            outIndex = i;
+        }
+    }
+
+    // 3. Turn order decides between the other arms the tile fits
+    for (int step = 1; step < m_playerCount; ++step) {
+        int arm = (m_mover + step) % m_playerCount;
+        if (canPlay(mover.hand[outIndex], arm)) {
+            outArm = arm;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* *********************************************************************
+Function Name: listMoves
+Purpose: Lists every legal move for the player whose turn it is.
+Parameters:
+        outIndices, outArms, integer arrays of at least MAX_MOVES
+            entries. Receive the hand position and arm of each move.
+Return Value: The number of moves listed.
+Algorithm: For each tile in hand order, add each arm in turn order
+        after the mover, starting with the own arm, that allows and
+        matches it.
+Reference: None
+********************************************************************* */
+template <int MaxPips>
+int BasicPlayout<MaxPips>::listMoves(int* outIndices, int* outArms) const {
+    const PlayerState& mover = m_players[m_mover];
+    int count = 0;
+
+    for (int i = 0; i < mover.handSize; ++i) {
+        for (int step = 0; step < m_playerCount; ++step) {
+            int arm = (m_mover + step) % m_playerCount;
+            if (canPlay(mover.hand[i], arm)) {
+                outIndices[count] = i;
+                outArms[count] = arm;
+                ++count;
+            }
+        }
+    }
+
+    return count;
+}
+
+/* *********************************************************************
+Function Name: loadRound
+Purpose: Copies the state of a round in progress, as a two-player table.
+Parameters:
+        round, a Round object passed by const reference.
+Return Value: None
+Algorithm:
+        1. Copy both hands and the boneyard in order.
+        2. Copy the open ends of the layout to the two arms, and the
+            turn flags.
+        3. Check whether the round is already over.
+Reference: None
+********************************************************************* */
+template <int MaxPips>
+void BasicPlayout<MaxPips>::loadRound(const Round& round) requires (MaxPips == StandardSet::MAX_PIPS) {
+    const Hand* hands[2] = { &round.getHumanHand(), &round.getComputerHand() };
+
+    m_playerCount = 2;
+    for (int player = HUMAN; player <= COMPUTER; ++player) {
+        PlayerState& state = m_players[player];
+
+        state.handSize = hands[player]->getSize();
+        state.handMask = 0;
+        for (int i = 0; i < state.handSize; ++i) {
+            state.hand[i] = pack(hands[player]->getTileAtIndex(i));
+            state.handMask |= getTileBit(state.hand[i]);
+        }
+        state.points = 0;
+    }
+
+    m_boneyardTop = 0;
+    m_boneyardSize = round.getStock().getSize();
+    for (int i = 0; i < m_boneyardSize; ++i) {
+        m_boneyard[i] = pack(round.getStock().getTileAtIndex(i));
+    }
+
+    m_players[HUMAN].armEnd = round.getLayout().getLeftEdge();
+    m_players[COMPUTER].armEnd = round.getLayout().getRightEdge();
+
+    m_mover = round.isHumanTurn() ? HUMAN : COMPUTER;
+    m_players[HUMAN].passed = round.getHumanPassed();
+    m_players[COMPUTER].passed = round.getComputerPassed();
+    m_isOver = false;
+    checkOver();
+}
+
+/* *********************************************************************
+Function Name: dealRound
+Purpose: Deals a new round for the table. With two players the deal is
+        exactly the one Round::dealRound makes for the same round
+        number and seed.
+Parameters:
+        roundNumber, an integer. Selects the engine.
+        seed, an unsigned integer. Shuffles the boneyard.
+Return Value: None
+Algorithm:
+        1. Build the full set in Stock::initializeFullSet order and
+            shuffle it as Stock::shuffle does.
+        2. Deal Set::getHandSize() tiles to each player, one at a time
+            in turn order.
+        3. Place the engine from the first hand holding it, or by
+            drawing in turn order; the next player moves first.
+Reference: None
+********************************************************************* */
+template <int MaxPips>
+void BasicPlayout<MaxPips>::dealRound(int roundNumber, unsigned int seed) {
+    // 1. Full set, then the same Fisher-Yates shuffle as the Stock
+    m_boneyardTop = 0;
+    m_boneyardSize = 0;
+    for (int left = 0; left <= MaxPips; ++left) {
+        for (int right = left; right <= MaxPips; ++right) {
+            m_boneyard[m_boneyardSize++] = static_cast<unsigned char>((right << 4) | left);
+        }
+    }
+
+    std::mt19937 g(seed);
+    for (int i = m_boneyardSize - 1; i > 0; --i) {
+        int j = static_cast<int>(g() % static_cast<unsigned int>(i + 1));
+        std::swap(m_boneyard[i], m_boneyard[j]);
+    }
+
+    // 2. Deal a hand each
+    int pips = Set::getEngine(roundNumber);
+    for (int player = 0; player < m_playerCount; ++player) {
+        PlayerState& state = m_players[player];
+        state.handSize = 0;
+        state.handMask = 0;
+        state.armEnd = pips;
+        state.points = 0;
+        state.passed = false;
+    }
+
+    int handSize = Set::getHandSize(m_playerCount);
+    for (int i = 0; i < handSize; ++i) {
+        for (int player = 0; player < m_playerCount; ++player) {
+            drawTile(player);
+        }
+    }
+
+    m_isOver = false;
+
+    // 3. Place the engine; whoever plays it hands the turn to the next player
+    unsigned char engine = static_cast<unsigned char>((pips << 4) | pips);
+
+    for (int player = 0; player < m_playerCount; ++player) {
+        const PlayerState& state = m_players[player];
+        if (!(state.handMask & getTileBit(engine))) {
+            continue;
+        }
+        for (int i = 0; i < state.handSize; ++i) {
+            if (state.hand[i] == engine) {
+                m_mover = player;
+                playTile(i, player);
+                return;
+            }
+        }
+    }
+
+    for (int player = 0; m_boneyardSize > 0; player = (player + 1) % m_playerCount) {
+        drawTile(player);
+        if (m_players[player].hand[m_players[player].handSize - 1] == engine) {
+            m_mover = player;
+            playTile(m_players[player].handSize - 1, player);
+            return;
+        }
+    }
+}
+
+/* *********************************************************************
+Function Name: shuffleBoneyard
+Purpose: Puts the boneyard in a random order. The order of the boneyard
+        is hidden from every player, so simulations of a position in
+        progress shuffle it rather than trusting the saved order.
+Parameters:
+        generator, a std::mt19937 passed by reference.
+Return Value: None
+Algorithm: Fisher-Yates shuffle, as Stock::shuffle does.
+Reference: None
+********************************************************************* */
+template <int MaxPips>
+void BasicPlayout<MaxPips>::shuffleBoneyard(std::mt19937& generator) {
+    unsigned char* boneyard = m_boneyard + m_boneyardTop;
+    for (int i = m_boneyardSize - 1; i > 0; --i) {
+        int j = static_cast<int>(generator() % static_cast<unsigned int>(i + 1));
+        std::swap(boneyard[i], boneyard[j]);
+    }
+}
+
+/* *********************************************************************
+Function Name: relabelPips
+Purpose: Renames the pip values throughout the position: every tile in
+        the hands and boneyard, and the open pips of every arm. Tiles
+        keep their places, so hand and boneyard order are unchanged.
+Parameters:
+        permutation, an array of MaxPips + 1 integers. The new value of
+            each pip value; each value appears once.
+Return Value: None
+Algorithm: Map both halves of every tile, repacking the larger half on
+        top, rebuild the hand masks and map the arms' pips.
+Reference: None
+********************************************************************* */
+template <int MaxPips>
+void BasicPlayout<MaxPips>::relabelPips(const int* permutation) {
+    auto relabel = [permutation](unsigned char packed) {
+        int high = permutation[packed >> 4];
+        int low = permutation[packed & 0x0F];
+        return static_cast<unsigned char>(high > low ? (high << 4) | low : (low << 4) | high);
+    };
+
+    for (int player = 0; player < m_playerCount; ++player) {
+        PlayerState& state = m_players[player];
+
+        state.handMask = 0;
+        for (int i = 0; i < state.handSize; ++i) {
+            state.hand[i] = relabel(state.hand[i]);
+            state.handMask |= getTileBit(state.hand[i]);
+        }
+        state.armEnd = permutation[state.armEnd];
+    }
+
+    for (int i = 0; i < m_boneyardSize; ++i) {
+        m_boneyard[m_boneyardTop + i] = relabel(m_boneyard[m_boneyardTop + i]);
+    }
+}
+
+/* *********************************************************************
+Function Name: playTile
+Purpose: Plays a tile from the mover's hand and passes the turn.
+Parameters:
+        index, an integer position in the mover's hand.
+        arm, an integer. The player number of the arm to play on. The
+            caller has checked the tile is allowed there and fits.
+Return Value: None
+Algorithm:
+        1. Open the arm to the other half of the tile.
+        2. Remove the tile, keeping the rest of the hand in order.
+        3. Clear the mover's pass flag, check for the end of the
+            round and hand the turn to the next player.
+Reference: None
+********************************************************************* */
+template <int MaxPips>
+void BasicPlayout<MaxPips>::playTile(int index, int arm) {
+    PlayerState& mover = m_players[m_mover];
+    int high = mover.hand[index] >> 4;
+    int low = mover.hand[index] & 0x0F;
+    int& end = m_players[arm].armEnd;
+
+    end = (end == high) ? low : high;
+    mover.handMask &= ~getTileBit(mover.hand[index]);
+
+    for (int i = index + 1; i < mover.handSize; ++i) {
+        mover.hand[i - 1] = mover.hand[i];
+    }
+    --mover.handSize;
+
+    mover.passed = false;
+    checkOver();
+    m_mover = (m_mover + 1) % m_playerCount;
+}
+
+/* *********************************************************************
+Function Name: makePlay / makeDraw / makePass
+Purpose: Make one step of a turn reversibly, for searches that explore
+        a position in place instead of copying it: play a tile from the
+        mover's hand on an arm, draw a tile from the boneyard into the
+        mover's hand, or pass. The caller checks the step is legal; the
+        round must not be over.
+Parameters:
+        index, arm. As for playTile(). For makeDraw(), index is the
+            position in the boneyard of the tile to draw; the default,
+            0, is the top. A search draws each tile in turn to treat
+            the draw as a chance event.
+        stack, an UndoStack passed by reference. Receives the record.
+Return Value: None
+Algorithm: Push the mover, their pass flag and, for a play, the tile,
+        its position and the arm's open pips, or for a draw the
+        boneyard position, then make the step with playTile(), pass(),
+        or drawTile() after swapping the chosen tile to the top.
+Reference: None
+********************************************************************* */
+template <int MaxPips>
+void BasicPlayout<MaxPips>::makePlay(int index, int arm, UndoStack& stack) {
+    Undo& undo = stack.push();
+
+    undo.kind = UNDO_PLAY;
+    undo.tile = m_players[m_mover].hand[index];
+    undo.index = static_cast<unsigned char>(index);
+    undo.arm = static_cast<signed char>(arm);
+    undo.armEnd = static_cast<signed char>(m_players[arm].armEnd);
+    undo.mover = static_cast<signed char>(m_mover);
+    undo.passed = m_players[m_mover].passed;
+
+    playTile(index, arm);
+}
+
+template <int MaxPips>
+void BasicPlayout<MaxPips>::makeDraw(UndoStack& stack, int index) {
+    Undo& undo = stack.push();
+
+    undo.kind = UNDO_DRAW;
+    undo.index = static_cast<unsigned char>(index);
+    undo.mover = static_cast<signed char>(m_mover);
+    undo.passed = m_players[m_mover].passed;
+
+    std::swap(m_boneyard[m_boneyardTop], m_boneyard[m_boneyardTop + index]);
+    drawTile(m_mover);
+}
+
+template <int MaxPips>
+void BasicPlayout<MaxPips>::makePass(UndoStack& stack) {
+    Undo& undo = stack.push();
+
+    undo.kind = UNDO_PASS;
+    undo.mover = static_cast<signed char>(m_mover);
+    undo.passed = m_players[m_mover].passed;
+
+    pass();
+}
+
+/* *********************************************************************
+Function Name: unmake
+Purpose: Takes back the last step made with makePlay(), makeDraw() or
+        makePass().
+Parameters:
+        stack, an UndoStack passed by reference. Not empty.
+Return Value: None
+Algorithm:
+        1. Pop the record. If the step ended the round, reopen it and
+            clear the points awarded.
+        2. Restore the mover and their pass flag.
+        3. For a play, put the tile back at its position in the hand
+            and restore the arm; for a draw, return the last tile in
+            the hand to the top of the boneyard and swap it back to the
+            position it was drawn from.
+Reference: None
+********************************************************************* */
+template <int MaxPips>
+void BasicPlayout<MaxPips>::unmake(UndoStack& stack) {
+    const Undo& undo = stack.pop();
+
+    // 1. Points are only ever awarded as a round ends, so they were all 0 before
+    if (m_isOver) {
+        m_isOver = false;
+        for (int player = 0; player < m_playerCount; ++player) {
+            m_players[player].points = 0;
+        }
+    }
+
+    // 2. The turn
+    m_mover = undo.mover;
+    PlayerState& mover = m_players[m_mover];
+    mover.passed = undo.passed;
+
+    // 3. The tiles
+    if (undo.kind == UNDO_PLAY) {
+        for (int i = mover.handSize; i > undo.index; --i) {
+            mover.hand[i] = mover.hand[i - 1];
+        }
+        mover.hand[undo.index] = undo.tile;
+        ++mover.handSize;
+        mover.handMask |= getTileBit(undo.tile);
+        m_players[undo.arm].armEnd = undo.armEnd;
+    }
+    else if (undo.kind == UNDO_DRAW) {
+        --mover.handSize;
+        mover.handMask &= ~getTileBit(mover.hand[mover.handSize]);
+        --m_boneyardTop;
+        ++m_boneyardSize;
+        std::swap(m_boneyard[m_boneyardTop], m_boneyard[m_boneyardTop + undo.index]);
+    }
+}
+
+/* *********************************************************************
+Function Name: pack / unpack
+Purpose: Convert between a Tile and its one-byte form.
+Parameters:
+        tile, a Tile. / packed, a tile byte.
+Return Value: The tile byte. / The Tile, low pips on the left.
+Algorithm: Store the larger half in the top four bits.
+Reference: None
+********************************************************************* */
+template <int MaxPips>
+unsigned char BasicPlayout<MaxPips>::pack(const Tile& tile) requires (MaxPips == StandardSet::MAX_PIPS) {
+    int left = tile.getLeftPips();
+    int right = tile.getRightPips();
+    return static_cast<unsigned char>(left > right ? (left << 4) | right : (right << 4) | left);
+}
+
+template <int MaxPips>
+Tile BasicPlayout<MaxPips>::unpack(unsigned char packed) requires (MaxPips == StandardSet::MAX_PIPS) {
+    return Tile(packed & 0x0F, packed >> 4);
+}
+
+/* *********************************************************************
+Function Name: canPlay
+Purpose: Checks whether the mover may play a tile on an arm.
+Parameters:
+        packed, a tile byte.
+        arm, an integer. The player number of the arm.
+Return Value: Boolean true if the tile is allowed on that arm and
+        matches its open pips.
+Algorithm:
+        1. The mover may use another player's arm only with a double
+            or after that player passed.
+        2. Either half of the tile must match the open pips.
+Reference: None
+********************************************************************* */
+template <int MaxPips>
+bool BasicPlayout<MaxPips>::canPlay(unsigned char packed, int arm) const {
+    int high = packed >> 4;
+    int low = packed & 0x0F;
+
+    if (arm != m_mover && high != low && !m_players[arm].passed) {
+        return false;
+    }
+
+    int end = m_players[arm].armEnd;
+    return high == end || low == end;
+}
+
+/* *********************************************************************
+Function Name: drawTile
+Purpose: Moves the top of the boneyard to the end of a player's hand.
+Parameters:
+        player, a player number.
+Return Value: None
+Algorithm: Append the tile at m_boneyardTop, add it to the hand's
+        mask and advance the top.
+Reference: None
+********************************************************************* */
+template <int MaxPips>
+void BasicPlayout<MaxPips>::drawTile(int player) {
+    PlayerState& state = m_players[player];
+    unsigned char tile = m_boneyard[m_boneyardTop++];
+
+    state.hand[state.handSize++] = tile;
+    state.handMask |= getTileBit(tile);
+    --m_boneyardSize;
+}
+
+/* *********************************************************************
+Function Name: pass
+Purpose: Records a pass by the mover and hands over the turn.
+Parameters: None
+Return Value: None
+Algorithm: Set the pass flag, check for a block and move to the next
+        player.
+Reference: None
+********************************************************************* */
+template <int MaxPips>
+void BasicPlayout<MaxPips>::pass() {
+    m_players[m_mover].passed = true;
+    checkOver();
+    m_mover = (m_mover + 1) % m_playerCount;
+}
+
+/* *********************************************************************
+Function Name: checkOver
+Purpose: Ends the round and awards points, as Round::checkWinCondition
+        does for two players.
+Parameters: None
+Return Value: None
+Algorithm:
+        1. A player with an empty hand wins the pips of every other
+            hand.
+        2. If the boneyard is empty and every player passed, the player
+            with the lowest pip total wins the other totals; a tie for
+            the lowest total scores nothing.
+Reference: None
+********************************************************************* */
+template <int MaxPips>
+void BasicPlayout<MaxPips>::checkOver() {
+    int outPlayer = -1;
+    bool allPassed = (m_boneyardSize == 0);
+
+    for (int player = 0; player < m_playerCount; ++player) {
+        if (m_players[player].handSize == 0) {
+            outPlayer = player;
+        }
+        allPassed = allPassed && m_players[player].passed;
+    }
+    if (outPlayer == -1 && !allPassed) {
+        return;
+    }
+
+    int totals[MAX_PLAYERS];
+    int sum = 0;
+    int lowest = 0;
+    bool isTied = false;
+
+    for (int player = 0; player < m_playerCount; ++player) {
+        totals[player] = getHandPips(player);
+        sum += totals[player];
+
+        if (player > 0 && totals[player] < totals[lowest]) {
+            lowest = player;
+            isTied = false;
+        }
+        else if (player > 0 && totals[player] == totals[lowest]) {
+            isTied = true;
+        }
+    }
+
+    // 1. Going out wins every other hand, even one of only 0-0
+    if (outPlayer != -1) {
+        m_players[outPlayer].points = sum;
+    }
+    // 2. A block goes to the unique lowest total
+    else if (!isTied) {
+        m_players[lowest].points = sum - totals[lowest];
+    }
+    m_isOver = true;
+}
+
+// The sets the playout is built for; Round-based members exist only for double-six
+template class BasicPlayout<6>;
+template class BasicPlayout<9>;
+template class BasicPlayout<12>;
+template class BasicPlayout<15>;
\ No newline at end of file
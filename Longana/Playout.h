@@ -0,0 +1,635 @@
+#ifndef PLAYOUT_H
+#define PLAYOUT_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <random>
+
+#include "DominoSet.h"
+#include "GreedyStrategy.h"
+#include "Tile.h"
+
+class Round;
+
+/* *********************************************************************
+Class Name: BasicPlayout
+Purpose: A compact, silent copy of a round used to play positions out
+        quickly for analysis, for a double-MaxPips set and two to eight
+        players. Hands and the boneyard are fixed-size arrays of tiles
+        packed into one byte each (high pips in the top four bits, low pips
+        in the bottom four), kept in the same order as the Hand and Stock
+        they were copied from, so a move chosen here is the move the
+        Computer would choose in the real game. Each hand is also kept as
+        a DominoSet mask, so whether any tile fits an arm is decided with a
+        few word operations before the hand is scanned.
+
+        Players take turns in the order 0, 1, 2 and so on. The layout has
+        one arm per player, growing from the engine, and only the open pips
+        of each arm are kept. A player always may play on their own arm,
+        and on another player's arm with a double or when that player
+        passed on their last turn. With two players, player 0 is the Human,
+        whose arm is the left end, and player 1 is the Computer, whose arm
+        is the right end, which are exactly the rules of the real game.
+
+        Everything a player owns is kept in one flat PlayerState, and the
+        states sit in a fixed array, so the object has no heap storage and
+        can be copied freely.
+
+        Turns are played by a strategy policy (see GreedyStrategy) given as
+        a template argument, so the strategy is inlined into the turn.
+
+        The members are defined in Playout.cpp and instantiated there for
+        double-six, -nine, -twelve and -fifteen. Copying from a Round and
+        converting to Tile objects are only available for double-six, the
+        set the interactive game is played with.
+********************************************************************* */
+template <int MaxPips>
+class BasicPlayout {
+public:
+
+    typedef DominoSet<MaxPips> Set;
+
+    static const int HUMAN = 0;
+    static const int COMPUTER = 1;
+
+    static const int MIN_PLAYERS = 2;
+    static const int MAX_PLAYERS = 8;
+
+    // Room for every legal move in any position: each tile on each arm
+    static const int MAX_MOVES = DominoSet<MaxPips>::TILE_COUNT * MAX_PLAYERS;
+
+    // Kinds of change the make functions record
+    static const int UNDO_PLAY = 0;
+    static const int UNDO_DRAW = 1;
+    static const int UNDO_PASS = 2;
+
+    // Room for the records of a whole round: every tile played and drawn once, and a
+    // pass by every player around each play
+    static const int MAX_UNDO = Set::TILE_COUNT * 2 + (Set::TILE_COUNT + 1) * MAX_PLAYERS;
+
+    // What unmake() needs to put a move back: the state the move overwrote
+    struct Undo {
+        unsigned char kind;         // UNDO_PLAY, UNDO_DRAW or UNDO_PASS
+        unsigned char tile;         // the packed tile played
+        unsigned char index;        // its position in the hand, or the boneyard position drawn
+        signed char arm;            // the arm it was played on
+        signed char armEnd;         // that arm's open pips before the play
+        signed char mover;
+        bool passed;                // the mover's pass flag before the move
+    };
+
+    /* *********************************************************************
+    Class Name: UndoStack
+    Purpose: The records of the moves made on a BasicPlayout, newest last,
+            in a fixed array, so a search can make and unmake moves without
+            allocating. The search owns the stack and passes it to the make
+            functions and unmake().
+    ********************************************************************* */
+    class UndoStack {
+    public:
+        UndoStack() : m_records(), m_size(0) {}
+
+        inline int getSize() const { return m_size; }
+        inline bool isEmpty() const { return m_size == 0; }
+        inline void clear() { m_size = 0; }
+        inline Undo& push() { return m_records[m_size++]; }
+        inline const Undo& pop() { return m_records[--m_size]; }
+
+    private:
+        Undo m_records[MAX_UNDO];
+        int m_size;
+    };
+
+    /* --- Constructor --- */
+
+    /* *********************************************************************
+    Function Name: BasicPlayout
+    Purpose: Default constructor. Creates an empty, finished round for two
+            players.
+    Parameters: None
+    Return Value: None
+    Algorithm: Zero every member.
+    Reference: None
+    ********************************************************************* */
+    BasicPlayout();
+
+    /* *********************************************************************
+    Function Name: BasicPlayout
+    Purpose: Creates an empty, finished round for a table of players.
+    Parameters:
+            playerCount, an integer. Between MIN_PLAYERS and MAX_PLAYERS;
+                any other value defaults to two players.
+    Return Value: None
+    Algorithm: Zero every member and store the player count.
+    Reference: None
+    ********************************************************************* */
+    explicit BasicPlayout(int playerCount);
+
+    /* --- Destructor --- */
+
+    /* *********************************************************************
+    Function Name: ~BasicPlayout
+    Purpose: Destructor. Nothing is allocated, so nothing is released.
+    Parameters: None
+    Return Value: None
+    Algorithm: Standard object destruction.
+    Reference: None
+    ********************************************************************* */
+    ~BasicPlayout() = default;
+
+    /* --- Selectors --- */
+
+    /* *********************************************************************
+    Function Name: getPlayerCount
+    Purpose: Retrieves the number of players at the table.
+    Parameters: None
+    Return Value: An integer between MIN_PLAYERS and MAX_PLAYERS.
+    Algorithm: Return m_playerCount.
+    Reference: None
+    ********************************************************************* */
+    inline int getPlayerCount() const { return m_playerCount; }
+
+    /* *********************************************************************
+    Function Name: getMover
+    Purpose: Retrieves the player whose turn it is.
+    Parameters: None
+    Return Value: A player number; HUMAN or COMPUTER for two players.
+    Algorithm: Return m_mover.
+    Reference: None
+    ********************************************************************* */
+    inline int getMover() const { return m_mover; }
+
+    /* *********************************************************************
+    Function Name: isOver
+    Purpose: Checks whether the round has ended.
+    Parameters: None
+    Return Value: Boolean true once a hand is empty or the game is blocked.
+    Algorithm: Return m_isOver.
+    Reference: None
+    ********************************************************************* */
+    inline bool isOver() const { return m_isOver; }
+
+    /* *********************************************************************
+    Function Name: getPoints
+    Purpose: Retrieves the points a player was awarded when the round ended.
+    Parameters:
+            player, a player number.
+    Return Value: An integer number of points; 0 while the round is running.
+    Algorithm: Return the player's points.
+    Reference: None
+    ********************************************************************* */
+    inline int getPoints(int player) const { return m_players[player].points; }
+
+    /* *********************************************************************
+    Function Name: hasPassed
+    Purpose: Checks whether a player passed on their last turn, which opens
+            their arm to everyone.
+    Parameters:
+            player, a player number.
+    Return Value: Boolean true if the player's last turn was a pass.
+    Algorithm: Return the player's pass flag.
+    Reference: None
+    ********************************************************************* */
+    inline bool hasPassed(int player) const { return m_players[player].passed; }
+
+    /* *********************************************************************
+    Function Name: getArmEnd
+    Purpose: Retrieves the open pips of a player's arm of the layout.
+    Parameters:
+            arm, a player number. The owner of the arm.
+    Return Value: An integer pip value.
+    Algorithm: Return the player's arm end.
+    Reference: None
+    ********************************************************************* */
+    inline int getArmEnd(int arm) const { return m_players[arm].armEnd; }
+
+    /* *********************************************************************
+    Function Name: getHandSize
+    Purpose: Retrieves the number of tiles a player holds.
+    Parameters:
+            player, a player number.
+    Return Value: An integer count of tiles.
+    Algorithm: Return the player's hand size.
+    Reference: None
+    ********************************************************************* */
+    inline int getHandSize(int player) const { return m_players[player].handSize; }
+
+    /* *********************************************************************
+    Function Name: getHandMask
+    Purpose: Retrieves a player's hand as a set of tiles.
+    Parameters:
+            player, a player number.
+    Return Value: The mask with bit Set::getIndex(low, high) set for each
+            tile in the hand.
+    Algorithm: Return the player's hand mask.
+    Reference: None
+    ********************************************************************* */
+    inline typename Set::Mask getHandMask(int player) const { return m_players[player].handMask; }
+
+    /* *********************************************************************
+    Function Name: getBoneyardSize
+    Purpose: Retrieves the number of tiles left in the boneyard.
+    Parameters: None
+    Return Value: An integer count of tiles.
+    Algorithm: Return m_boneyardSize.
+    Reference: None
+    ********************************************************************* */
+    inline int getBoneyardSize() const { return m_boneyardSize; }
+
+    /* *********************************************************************
+    Function Name: getBoneyardPacked
+    Purpose: Retrieves a tile from the boneyard in its one-byte form.
+    Parameters:
+            index, an integer position, 0 being the next tile drawn.
+    Return Value: The tile byte.
+    Algorithm: Return the byte that far past m_boneyardTop.
+    Reference: None
+    ********************************************************************* */
+    inline unsigned char getBoneyardPacked(int index) const { return m_boneyard[m_boneyardTop + index]; }
+
+    /* *********************************************************************
+    Function Name: getHandPacked
+    Purpose: Retrieves a tile from a player's hand in its one-byte form,
+            for sets whose tiles do not fit a double-six Tile.
+    Parameters:
+            player, a player number.
+            index, an integer position in the hand.
+    Return Value: The tile byte.
+    Algorithm: Return the byte at that position.
+    Reference: None
+    ********************************************************************* */
+    inline unsigned char getHandPacked(int player, int index) const { return m_players[player].hand[index]; }
+
+    /* *********************************************************************
+    Function Name: getHandTile
+    Purpose: Retrieves a tile from a player's hand.
+    Parameters:
+            player, a player number.
+            index, an integer position in the hand.
+    Return Value: The Tile at that position.
+    Algorithm: Unpack the tile byte.
+    Reference: None
+    ********************************************************************* */
+    inline Tile getHandTile(int player, int index) const requires (MaxPips == StandardSet::MAX_PIPS) {
+        return unpack(m_players[player].hand[index]);
+    }
+
+    /* *********************************************************************
+    Function Name: getHandPips
+    Purpose: Totals the pips in a player's hand.
+    Parameters:
+            player, a player number.
+    Return Value: An integer pip total.
+    Algorithm: Sum both halves of every tile in the hand.
+    Reference: None
+    ********************************************************************* */
+    int getHandPips(int player) const;
+
+    /* *********************************************************************
+    Function Name: chooseMove
+    Purpose: Chooses a move for the player whose turn it is with the
+            Computer's first-fit strategy: the first tile in hand order that
+            fits the player's own arm, otherwise the first that fits an arm
+            it is allowed on, trying the arms in turn order after the mover.
+    Parameters:
+            outIndex, an integer passed by reference. Receives the position
+                of the chosen tile in the hand.
+            outArm, an integer passed by reference. Receives the player
+                number of the arm to play on.
+    Return Value: Boolean true if any tile can be played.
+    Algorithm:
+            1. Intersect the hand's mask with the masks of tiles matching
+                each arm; another player's arm allows only doubles unless
+                that player passed. Stop if nothing fits.
+            2. Otherwise scan the hand in order for the first tile that
+                fits the own arm, else the first that fits another arm.
+            3. For a tile on another arm, take the first arm it is allowed
+                on in turn order.
+    Reference: None
+    ********************************************************************* */
+    bool chooseMove(int& outIndex, int& outArm) const;
+
+    /* *********************************************************************
+    Function Name: listMoves
+    Purpose: Lists every legal move for the player whose turn it is.
+    Parameters:
+            outIndices, outArms, integer arrays of at least MAX_MOVES
+                entries. Receive the hand position and arm of each move.
+    Return Value: The number of moves listed.
+    Algorithm: For each tile in hand order, add each arm in turn order
+            after the mover, starting with the own arm, that allows and
+            matches it.
+    Reference: None
+    ********************************************************************* */
+    int listMoves(int* outIndices, int* outArms) const;
+
+    /* --- Mutators --- */
+
+    /* *********************************************************************
+    Function Name: loadRound
+    Purpose: Copies the state of a round in progress, as a two-player table.
+    Parameters:
+            round, a Round object passed by const reference.
+    Return Value: None
+    Algorithm:
+            1. Copy both hands and the boneyard in order.
+            2. Copy the open ends of the layout to the two arms, and the
+                turn flags.
+            3. Check whether the round is already over.
+    Reference: None
+    ********************************************************************* */
+    void loadRound(const Round& round) requires (MaxPips == StandardSet::MAX_PIPS);
+
+    /* *********************************************************************
+    Function Name: dealRound
+    Purpose: Deals a new round for the table. With two players the deal is
+            exactly the one Round::dealRound makes for the same round
+            number and seed.
+    Parameters:
+            roundNumber, an integer. Selects the engine.
+            seed, an unsigned integer. Shuffles the boneyard.
+    Return Value: None
+    Algorithm:
+            1. Build the full set in Stock::initializeFullSet order and
+                shuffle it as Stock::shuffle does.
+            2. Deal Set::getHandSize() tiles to each player, one at a time
+                in turn order.
+            3. Place the engine from the first hand holding it, or by
+                drawing in turn order; the next player moves first.
+    Reference: None
+    ********************************************************************* */
+    void dealRound(int roundNumber, unsigned int seed);
+
+    /* *********************************************************************
+    Function Name: shuffleBoneyard
+    Purpose: Puts the boneyard in a random order. The order of the boneyard
+            is hidden from every player, so simulations of a position in
+            progress shuffle it rather than trusting the saved order.
+    Parameters:
+            generator, a std::mt19937 passed by reference.
+    Return Value: None
+    Algorithm: Fisher-Yates shuffle, as Stock::shuffle does.
+    Reference: None
+    ********************************************************************* */
+    void shuffleBoneyard(std::mt19937& generator);
+
+    /* *********************************************************************
+    Function Name: relabelPips
+    Purpose: Renames the pip values throughout the position: every tile in
+            the hands and boneyard, and the open pips of every arm. Tiles
+            keep their places, so hand and boneyard order are unchanged.
+    Parameters:
+            permutation, an array of MaxPips + 1 integers. The new value of
+                each pip value; each value appears once.
+    Return Value: None
+    Algorithm: Map both halves of every tile, repacking the larger half on
+            top, rebuild the hand masks and map the arms' pips.
+    Reference: None
+    ********************************************************************* */
+    void relabelPips(const int* permutation);
+
+    /* *********************************************************************
+    Function Name: playTile
+    Purpose: Plays a tile from the mover's hand and passes the turn.
+    Parameters:
+            index, an integer position in the mover's hand.
+            arm, an integer. The player number of the arm to play on. The
+                caller has checked the tile is allowed there and fits.
+    Return Value: None
+    Algorithm:
+            1. Open the arm to the other half of the tile.
+            2. Remove the tile, keeping the rest of the hand in order.
+            3. Clear the mover's pass flag, check for the end of the
+                round and hand the turn to the next player.
+    Reference: None
+    ********************************************************************* */
+    void playTile(int index, int arm);
+
+    /* *********************************************************************
+    Function Name: makePlay / makeDraw / makePass
+    Purpose: Make one step of a turn reversibly, for searches that explore
+            a position in place instead of copying it: play a tile from the
+            mover's hand on an arm, draw a tile from the boneyard into the
+            mover's hand, or pass. The caller checks the step is legal; the
+            round must not be over.
+    Parameters:
+            index, arm. As for playTile(). For makeDraw(), index is the
+                position in the boneyard of the tile to draw; the default,
+                0, is the top. A search draws each tile in turn to treat
+                the draw as a chance event.
+            stack, an UndoStack passed by reference. Receives the record.
+    Return Value: None
+    Algorithm: Push the mover, their pass flag and, for a play, the tile,
+            its position and the arm's open pips, or for a draw the
+            boneyard position, then make the step with playTile(), pass(),
+            or drawTile() after swapping the chosen tile to the top.
+    Reference: None
+    ********************************************************************* */
+    void makePlay(int index, int arm, UndoStack& stack);
+    void makeDraw(UndoStack& stack, int index = 0);
+    void makePass(UndoStack& stack);
+
+    /* *********************************************************************
+    Function Name: unmake
+    Purpose: Takes back the last step made with makePlay(), makeDraw() or
+            makePass().
+    Parameters:
+            stack, an UndoStack passed by reference. Not empty.
+    Return Value: None
+    Algorithm:
+            1. Pop the record. If the step ended the round, reopen it and
+                clear the points awarded.
+            2. Restore the mover and their pass flag.
+            3. For a play, put the tile back at its position in the hand
+                and restore the arm; for a draw, return the last tile in
+                the hand to the top of the boneyard and swap it back to the
+                position it was drawn from.
+    Reference: None
+    ********************************************************************* */
+    void unmake(UndoStack& stack);
+
+    /* *********************************************************************
+    Function Name: playTurn
+    Purpose: Plays a whole turn for the mover with a strategy, following
+            the rules the players follow in a real round.
+    Parameters:
+            strategy, a strategy policy passed by reference. Chooses the
+                move; with no argument, the Computer's GreedyStrategy.
+    Return Value: Boolean true if a tile was placed, false if the mover passed.
+    Algorithm:
+            1. If the strategy finds a move, play it.
+            2. Otherwise draw one tile if the boneyard is not empty, and
+                play it where the strategy chooses if it fits.
+            3. Otherwise pass.
+    Reference: None
+    ********************************************************************* */
+    template <class Strategy>
+    bool playTurn(Strategy& strategy) {
+        int index = 0;
+        int arm = m_mover;
+
+        if (strategy.chooseMove(*this, index, arm)) {
+            playTile(index, arm);
+            return true;
+        }
+
+        if (m_boneyardSize > 0) {
+            drawTile(m_mover);
+
+            // The drawn tile is the only candidate, so the choice reduces to its arm
+            if (strategy.chooseMove(*this, index, arm)) {
+                playTile(index, arm);
+                return true;
+            }
+        }
+
+        pass();
+        return false;
+    }
+
+    inline bool playTurn() {
+        GreedyStrategy greedy;
+        return playTurn(greedy);
+    }
+
+    /* *********************************************************************
+    Function Name: playRound
+    Purpose: Plays turns until the round is over.
+    Parameters:
+            first, a strategy policy passed by reference. Plays for player
+                0, the Human in a two-player round.
+            second, a strategy policy passed by reference. Plays for every
+                other player. With no arguments both are GreedyStrategy.
+    Return Value: None
+    Algorithm: Call playTurn() with the mover's strategy while isOver() is
+            false.
+    Reference: None
+    ********************************************************************* */
+    template <class FirstStrategy, class SecondStrategy>
+    inline void playRound(FirstStrategy& first, SecondStrategy& second) {
+        while (!m_isOver) {
+            if (m_mover == HUMAN) {
+                playTurn(first);
+            }
+            else {
+                playTurn(second);
+            }
+        }
+    }
+
+    inline void playRound() {
+        GreedyStrategy greedy;
+        playRound(greedy, greedy);
+    }
+
+    /* *********************************************************************
+    Function Name: pack / unpack
+    Purpose: Convert between a Tile and its one-byte form.
+    Parameters:
+            tile, a Tile. / packed, a tile byte.
+    Return Value: The tile byte. / The Tile, low pips on the left.
+    Algorithm: Store the larger half in the top four bits.
+    Reference: None
+    ********************************************************************* */
+    static unsigned char pack(const Tile& tile) requires (MaxPips == StandardSet::MAX_PIPS);
+    static Tile unpack(unsigned char packed) requires (MaxPips == StandardSet::MAX_PIPS);
+
+private:
+
+    // Everything one player owns, kept together so a turn touches one block of memory
+    struct PlayerState {
+        unsigned char hand[Set::TILE_COUNT];    // packed tiles, in the order they are held
+        typename Set::Mask handMask;            // the same tiles, as a set
+        int handSize;
+        int armEnd;                             // open pips of the arm this player owns
+        int points;
+        bool passed;
+    };
+
+    PlayerState m_players[MAX_PLAYERS];
+    int m_playerCount;
+
+    // The boneyard runs from m_boneyardTop, so drawing does not shift it
+    unsigned char m_boneyard[Set::TILE_COUNT];
+    int m_boneyardTop;
+    int m_boneyardSize;
+
+    int m_mover;
+    bool m_isOver;
+
+    /* *********************************************************************
+    Function Name: canPlay
+    Purpose: Checks whether the mover may play a tile on an arm.
+    Parameters:
+            packed, a tile byte.
+            arm, an integer. The player number of the arm.
+    Return Value: Boolean true if the tile is allowed on that arm and
+            matches its open pips.
+    Algorithm:
+            1. The mover may use another player's arm only with a double
+                or after that player passed.
+            2. Either half of the tile must match the open pips.
+    Reference: None
+    ********************************************************************* */
+    bool canPlay(unsigned char packed, int arm) const;
+
+    /* *********************************************************************
+    Function Name: drawTile
+    Purpose: Moves the top of the boneyard to the end of a player's hand.
+    Parameters:
+            player, a player number.
+    Return Value: None
+    Algorithm: Append the tile at m_boneyardTop, add it to the hand's
+            mask and advance the top.
+    Reference: None
+    ********************************************************************* */
+    void drawTile(int player);
+
+    /* *********************************************************************
+    Function Name: pass
+    Purpose: Records a pass by the mover and hands over the turn.
+    Parameters: None
+    Return Value: None
+    Algorithm: Set the pass flag, check for a block and move to the next
+            player.
+    Reference: None
+    ********************************************************************* */
+    void pass();
+
+    /* *********************************************************************
+    Function Name: checkOver
+    Purpose: Ends the round and awards points, as Round::checkWinCondition
+            does for two players.
+    Parameters: None
+    Return Value: None
+    Algorithm:
+            1. A player with an empty hand wins the pips of every other
+                hand.
+            2. If the boneyard is empty and every player passed, the player
+                with the lowest pip total wins the other totals; a tie for
+                the lowest total scores nothing.
+    Reference: None
+    ********************************************************************* */
+    void checkOver();
+
+    /* *********************************************************************
+    Function Name: getTileBit
+    Purpose: Finds a packed tile's bit in a hand mask.
+    Parameters:
+            packed, a tile byte.
+    Return Value: The mask holding only that tile.
+    Algorithm: Index the tile from its halves and look up the bit.
+    Reference: None
+    ********************************************************************* */
+    static inline typename Set::Mask getTileBit(unsigned char packed) { return Set::getBit(Set::getIndex(packed & 0x0F, packed >> 4)); }
+};
+
+// The double-six playout used by the game's analysis tools
+typedef BasicPlayout<StandardSet::MAX_PIPS> Playout;
+
+#endif
\ No newline at end of file
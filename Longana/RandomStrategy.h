@@ -0,0 +1,76 @@
+#ifndef RANDOMSTRATEGY_H
+#define RANDOMSTRATEGY_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <random>
+
+template <int MaxPips>
+class BasicPlayout;
+
+/* *********************************************************************
+Class Name: RandomStrategy
+Purpose: A playout policy that plays a legal move chosen uniformly at
+        random, for weak opponents and for testing policies against. See
+        GreedyStrategy for what a policy is.
+********************************************************************* */
+class RandomStrategy {
+public:
+
+    /* --- Constructor --- */
+
+    /* *********************************************************************
+    Function Name: RandomStrategy
+    Purpose: Constructor. Draws its choices from a generator.
+    Parameters:
+            generator, a std::mt19937 passed by reference. Must outlive
+                the strategy.
+    Return Value: None
+    Algorithm: Store the generator.
+    Reference: None
+    ********************************************************************* */
+    explicit RandomStrategy(std::mt19937& generator) : m_generator(generator) {}
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: chooseMove
+    Purpose: Chooses the mover's move.
+    Parameters:
+            table, a BasicPlayout passed by const reference. The position.
+            outIndex, an integer passed by reference. Receives the position
+                of the chosen tile in the mover's hand.
+            outArm, an integer passed by reference. Receives the player
+                number of the arm to play on.
+    Return Value: Boolean true if any tile can be played.
+    Algorithm:
+            1. List the legal moves.
+            2. Return one of them with equal probability.
+    Reference: None
+    ********************************************************************* */
+    template <int MaxPips>
+    bool chooseMove(const BasicPlayout<MaxPips>& table, int& outIndex, int& outArm) {
+        int indices[BasicPlayout<MaxPips>::MAX_MOVES];
+        int arms[BasicPlayout<MaxPips>::MAX_MOVES];
+
+        int count = table.listMoves(indices, arms);
+        if (count == 0) {
+            return false;
+        }
+
+        int pick = static_cast<int>(m_generator() % static_cast<unsigned int>(count));
+        outIndex = indices[pick];
+        outArm = arms[pick];
+        return true;
+    }
+
+private:
+    std::mt19937& m_generator;
+};
+
+#endif
\ No newline at end of file
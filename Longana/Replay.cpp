@@ -0,0 +1,289 @@
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include "GameLog.h"
+#include "Replay.h"
+#include "Serializer.h"
+#include "Tile.h"
+#include "Tournament.h"
+
+/* *********************************************************************
+Function Name: Replay
+Purpose: Default constructor. Creates an empty replay with no events.
+Parameters: None
+Return Value: None
+Algorithm: Initialize the error state.
+Reference: None
+********************************************************************* */
+Replay::Replay()
+    : m_data(), m_offsets(), m_roundStarts(), m_errorEvent(-1), m_errorMessage("")
+{
+}
+
+/* *********************************************************************
+Function Name: load
+Purpose: Reads a game log into memory and indexes its events.
+Parameters:
+        filename, a string representing the log file path.
+Return Value: Boolean true if the file is a readable game log.
+Algorithm:
+        1. Read the whole file in a single call.
+        2. Check the header.
+        3. Walk the records, remembering where each event and each
+            round starts. A record cut short at the end of the file
+            (a crash during a write) is ignored.
+Reference: None
+********************************************************************* */
+bool Replay::load(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return fail(-1, "Could not open the log file");
+    }
+
+    m_data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    m_offsets.clear();
+    m_roundStarts.clear();
+
+    if (m_data.size() < static_cast<size_t>(GameLog::HEADER_SIZE) || std::memcmp(m_data.data(), "LGNL", 4) != 0
+        || m_data[4] != GameLog::VERSION) {
+        return fail(-1, "Not a game log");
+    }
+
+    const unsigned char* data = reinterpret_cast<const unsigned char*>(m_data.data());
+    size_t position = GameLog::HEADER_SIZE;
+
+    while (position < m_data.size()) {
+        unsigned char record = data[position];
+        size_t length = 1;
+
+        if ((record >> 6) == GameLog::EVENT_CONTROL) {
+            int code = record & 0x1F;
+            if (code == GameLog::CONTROL_DEAL) {
+                length += GameLog::DEAL_SIZE;
+            }
+            else if (code == GameLog::CONTROL_SNAPSHOT) {
+                length += Serializer::BINARY_SIZE;
+            }
+
+            if (code != GameLog::CONTROL_PASS) {
+                m_roundStarts.push_back(static_cast<int>(m_offsets.size()));
+            }
+        }
+
+        // Drop a record that was cut short
+        if (position + length > m_data.size()) {
+            if (!m_roundStarts.empty() && m_roundStarts.back() == static_cast<int>(m_offsets.size())) {
+                m_roundStarts.pop_back();
+            }
+            break;
+        }
+
+        m_offsets.push_back(position);
+        position += length;
+    }
+
+    return true;
+}
+
+/* *********************************************************************
+Function Name: getEvent
+Purpose: Decodes an event without applying it.
+Parameters:
+        index, an integer. The index of the event.
+        outType, an integer passed by reference. Receives one of the
+            GameLog::EVENT_ constants.
+        outIsHuman, a boolean passed by reference. Receives true if the
+            event belongs to the Human.
+        outOperand, an integer passed by reference. Receives the tile
+            index, or a GameLog::CONTROL_ constant for control records.
+Return Value: Boolean true if the index is within the log.
+Algorithm: Split the record byte into its fields.
+Reference: None
+********************************************************************* */
+bool Replay::getEvent(int index, int& outType, bool& outIsHuman, int& outOperand) const {
+    if (index < 0 || index >= getEventCount()) {
+        return false;
+    }
+
+    unsigned char record = static_cast<unsigned char>(m_data[m_offsets[index]]);
+    outType = record >> 6;
+    outIsHuman = (record & 0x20) == 0;
+    outOperand = record & 0x1F;
+    return true;
+}
+
+/* *********************************************************************
+Function Name: seek
+Purpose: Reconstructs the game as it stood after a given number of
+        events.
+Parameters:
+        eventCount, an integer. The number of events to replay; clamped
+            to the length of the log.
+        tournament, a Tournament object passed by reference. Receives
+            the reconstructed game, flagged as resumed so it can be
+            saved or played on. Tournament scores are those at the
+            start of the round.
+Return Value: Boolean true if the position was reconstructed; false if
+        the log is inconsistent, in which case the error selectors
+        describe the problem.
+Algorithm:
+        1. Find the last deal or snapshot before the requested position.
+        2. Apply that record and every following event up to the position.
+Reference: None
+********************************************************************* */
+bool Replay::seek(int eventCount, Tournament& tournament) {
+    eventCount = std::clamp(eventCount, 0, getEventCount());
+    m_errorEvent = -1;
+    m_errorMessage = "";
+
+    // The round containing the position starts at the last round record before it
+    std::vector<int>::const_iterator start =
+        std::lower_bound(m_roundStarts.begin(), m_roundStarts.end(), eventCount);
+    if (start == m_roundStarts.begin()) {
+        return eventCount == 0 ? true : fail(0, "Log does not begin with a deal");
+    }
+    --start;
+
+    for (int i = *start; i < eventCount; ++i) {
+        if (!applyEvent(i, tournament)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* *********************************************************************
+Function Name: step
+Purpose: Applies one more event to a game reconstructed by seek() or
+        by earlier steps, so a log can be walked in a single pass.
+Parameters:
+        index, an integer. The index of the event, which is the number
+            of events the game already reflects.
+        tournament, a Tournament object passed by reference. The game
+            after index events; receives the game after index + 1.
+Return Value: Boolean true if the event was applied; false if it is out
+        of range or inconsistent, in which case the error selectors
+        describe the problem.
+Algorithm: Clear the last error and apply the event with applyEvent().
+Reference: None
+********************************************************************* */
+bool Replay::step(int index, Tournament& tournament) {
+    m_errorEvent = -1;
+    m_errorMessage = "";
+
+    if (index < 0 || index >= getEventCount()) {
+        return fail(index, "No such event");
+    }
+    return applyEvent(index, tournament);
+}
+
+/* *********************************************************************
+Function Name: applyEvent
+Purpose: Applies a single event to the tournament.
+Parameters:
+        index, an integer. The index of the event.
+        tournament, a Tournament object passed by reference.
+Return Value: Boolean true if the event was consistent with the game.
+Algorithm:
+        1. Decode the kind, player and operand from the record byte.
+        2. Deal: restore the tournament data and re-deal the round from
+            its seed.
+        3. Snapshot: decode the saved position, placing the engine if
+            the save was made before it was played.
+        4. Draw, play or pass: apply the move to the round, checking the
+            drawn tile matches the boneyard and the play is legal.
+Reference: None
+********************************************************************* */
+bool Replay::applyEvent(int index, Tournament& tournament) {
+    const unsigned char* data = reinterpret_cast<const unsigned char*>(m_data.data()) + m_offsets[index];
+    Round& round = tournament.getCurrentRound();
+
+    int type = data[0] >> 6;
+    bool isHuman = (data[0] & 0x20) == 0;
+    int operand = data[0] & 0x1F;
+
+    if (type == GameLog::EVENT_CONTROL) {
+        if (operand == GameLog::CONTROL_PASS) {
+            round.applyPass(isHuman);
+            return true;
+        }
+
+        if (operand == GameLog::CONTROL_DEAL) {
+            // Round number (16 bits) then seed, target and scores (32 bits each)
+            unsigned int values[4] = {};
+            for (int i = 0; i < 4; ++i) {
+                for (int b = 0; b < 4; ++b) {
+                    values[i] |= static_cast<unsigned int>(data[3 + i * 4 + b]) << (8 * b);
+                }
+            }
+            int roundNumber = data[1] | (data[2] << 8);
+
+            tournament.setRoundNumber(roundNumber);
+            tournament.setTargetScore(static_cast<int>(values[1]));
+            tournament.setHumanScore(static_cast<int>(values[2]));
+            tournament.setComputerScore(static_cast<int>(values[3]));
+            round.dealRound(roundNumber, values[0]);
+        }
+        else if (operand == GameLog::CONTROL_SNAPSHOT) {
+            if (!Serializer::decodeBinary(data + 1, Serializer::BINARY_SIZE, tournament)) {
+                return fail(index, "Corrupt snapshot");
+            }
+            if (round.getLayout().isEmpty()) {
+                round.placeEngine();
+            }
+        }
+        else {
+            return fail(index, "Unknown control record");
+        }
+
+        round.setTargetScore(tournament.getTargetScore());
+        round.setScores(tournament.getHumanScore(), tournament.getComputerScore());
+        tournament.setIsResumed(true);
+        return true;
+    }
+
+    if (operand >= Tile::TILE_COUNT) {
+        return fail(index, "Tile out of range");
+    }
+    Tile tile = Tile::fromIndex(operand);
+
+    if (type == GameLog::EVENT_DRAW) {
+        Tile drawn;
+        if (!round.applyDraw(isHuman, drawn) || !(drawn == tile)) {
+            return fail(index, "Drawn tile does not match the boneyard");
+        }
+        return true;
+    }
+
+    if (!round.applyPlay(isHuman, tile, type == GameLog::EVENT_PLAY_LEFT ? 'L' : 'R')) {
+        return fail(index, "Illegal play");
+    }
+    return true;
+}
+
+/* *********************************************************************
+Function Name: fail
+Purpose: Records a replay error.
+Parameters:
+        index, an integer. The index of the offending event.
+        message, a constant C string describing the error.
+Return Value: Boolean false, so callers can write "return fail(...)".
+Algorithm: Store the index and message and return false.
+Reference: None
+********************************************************************* */
+bool Replay::fail(int index, const char* message) {
+    m_errorEvent = index;
+    m_errorMessage = message;
+    return false;
+}
\ No newline at end of file
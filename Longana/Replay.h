@@ -0,0 +1,204 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Tournament.h"
+
+/* *********************************************************************
+Class Name: Replay
+Purpose: Reads a game log written by GameLog and reconstructs the game
+        at any point in its history. The log is read into memory once and
+        indexed, so that seeking to a position only replays the events of
+        the round that contains it: the round is re-dealt from its seed (or
+        restored from its snapshot) and its moves are applied without any
+        output or prompting.
+********************************************************************* */
+class Replay {
+public:
+
+    /* --- Constructor --- */
+
+    /* *********************************************************************
+    Function Name: Replay
+    Purpose: Default constructor. Creates an empty replay with no events.
+    Parameters: None
+    Return Value: None
+    Algorithm: Initialize the error state.
+    Reference: None
+    ********************************************************************* */
+    Replay();
+
+    /* --- Destructor --- */
+
+    /* *********************************************************************
+    Function Name: ~Replay
+    Purpose: Destructor. Releases the log data.
+    Parameters: None
+    Return Value: None
+    Algorithm: Standard object destruction.
+    Reference: None
+    ********************************************************************* */
+    ~Replay() = default;
+
+    /* --- Selectors --- */
+
+    /* *********************************************************************
+    Function Name: getEventCount
+    Purpose: Retrieves the number of complete events in the log.
+    Parameters: None
+    Return Value: An integer count of events.
+    Algorithm: Return the size of the event index.
+    Reference: None
+    ********************************************************************* */
+    inline int getEventCount() const { return static_cast<int>(m_offsets.size()); }
+
+    /* *********************************************************************
+    Function Name: getErrorEvent
+    Purpose: Retrieves the 0-based index of the event that could not be
+            replayed.
+    Parameters: None
+    Return Value: An integer event index, or -1 if no error occurred.
+    Algorithm: Return m_errorEvent.
+    Reference: None
+    ********************************************************************* */
+    inline int getErrorEvent() const { return m_errorEvent; }
+
+    /* *********************************************************************
+    Function Name: getErrorMessage
+    Purpose: Retrieves a description of the last failure.
+    Parameters: None
+    Return Value: A constant C string. Empty if no error occurred.
+    Algorithm: Return m_errorMessage.
+    Reference: None
+    ********************************************************************* */
+    inline const char* getErrorMessage() const { return m_errorMessage; }
+
+    /* *********************************************************************
+    Function Name: getEvent
+    Purpose: Decodes an event without applying it.
+    Parameters:
+            index, an integer. The index of the event.
+            outType, an integer passed by reference. Receives one of the
+                GameLog::EVENT_ constants.
+            outIsHuman, a boolean passed by reference. Receives true if the
+                event belongs to the Human.
+            outOperand, an integer passed by reference. Receives the tile
+                index, or a GameLog::CONTROL_ constant for control records.
+    Return Value: Boolean true if the index is within the log.
+    Algorithm: Split the record byte into its fields.
+    Reference: None
+    ********************************************************************* */
+    bool getEvent(int index, int& outType, bool& outIsHuman, int& outOperand) const;
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: load
+    Purpose: Reads a game log into memory and indexes its events.
+    Parameters:
+            filename, a string representing the log file path.
+    Return Value: Boolean true if the file is a readable game log.
+    Algorithm:
+            1. Read the whole file in a single call.
+            2. Check the header.
+            3. Walk the records, remembering where each event and each
+                round starts. A record cut short at the end of the file
+                (a crash during a write) is ignored.
+    Reference: None
+    ********************************************************************* */
+    bool load(const std::string& filename);
+
+    /* *********************************************************************
+    Function Name: seek
+    Purpose: Reconstructs the game as it stood after a given number of
+            events.
+    Parameters:
+            eventCount, an integer. The number of events to replay; clamped
+                to the length of the log.
+            tournament, a Tournament object passed by reference. Receives
+                the reconstructed game, flagged as resumed so it can be
+                saved or played on. Tournament scores are those at the
+                start of the round.
+    Return Value: Boolean true if the position was reconstructed; false if
+            the log is inconsistent, in which case the error selectors
+            describe the problem.
+    Algorithm:
+            1. Find the last deal or snapshot before the requested position.
+            2. Apply that record and every following event up to the position.
+    Reference: None
+    ********************************************************************* */
+    bool seek(int eventCount, Tournament& tournament);
+
+    /* *********************************************************************
+    Function Name: step
+    Purpose: Applies one more event to a game reconstructed by seek() or
+            by earlier steps, so a log can be walked in a single pass.
+    Parameters:
+            index, an integer. The index of the event, which is the number
+                of events the game already reflects.
+            tournament, a Tournament object passed by reference. The game
+                after index events; receives the game after index + 1.
+    Return Value: Boolean true if the event was applied; false if it is out
+            of range or inconsistent, in which case the error selectors
+            describe the problem.
+    Algorithm: Clear the last error and apply the event with applyEvent().
+    Reference: None
+    ********************************************************************* */
+    bool step(int index, Tournament& tournament);
+
+private:
+
+    // The raw contents of the log
+    std::string m_data;
+
+    // Offset of every event, and the indices of the events that start a round
+    std::vector<size_t> m_offsets;
+    std::vector<int> m_roundStarts;
+
+    // Location and description of the last error
+    int m_errorEvent;
+    const char* m_errorMessage;
+
+    /* *********************************************************************
+    Function Name: applyEvent
+    Purpose: Applies a single event to the tournament.
+    Parameters:
+            index, an integer. The index of the event.
+            tournament, a Tournament object passed by reference.
+    Return Value: Boolean true if the event was consistent with the game.
+    Algorithm:
+            1. Decode the kind, player and operand from the record byte.
+            2. Deal: restore the tournament data and re-deal the round from
+                its seed.
+            3. Snapshot: decode the saved position, placing the engine if
+                the save was made before it was played.
+            4. Draw, play or pass: apply the move to the round, checking the
+                drawn tile matches the boneyard and the play is legal.
+    Reference: None
+    ********************************************************************* */
+    bool applyEvent(int index, Tournament& tournament);
+
+    /* *********************************************************************
+    Function Name: fail
+    Purpose: Records a replay error.
+    Parameters:
+            index, an integer. The index of the offending event.
+            message, a constant C string describing the error.
+    Return Value: Boolean false, so callers can write "return fail(...)".
+    Algorithm: Store the index and message and return false.
+    Reference: None
+    ********************************************************************* */
+    bool fail(int index, const char* message);
+};
+
+#endif
\ No newline at end of file
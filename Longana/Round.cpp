@@ -5,16 +5,25 @@
  * Date:  02/12/2026                                        *
  ************************************************************/
 
+#include <cstdio>
 #include <cstdlib>
+#include <iomanip>
 #include <iostream>
+#include <random>
 #include <string>
 
+#include "DominoSet.h"
+#include "ComputerStrategy.h"
+#include "GameLog.h"
 #include "Hand.h"
+#include "Playout.h"
 #include "Round.h"
 #include "Serializer.h"
 #include "Stock.h"
 #include "Tile.h"
 #include "Tournament.h"
+#include "TurnChannel.h"
+#include "WinEstimator.h"
 
  /* *********************************************************************
 Function Name: Round
@@ -42,7 +51,12 @@ Round::Round(int roundNumber, int tournamentTargetScore, int humanScore, int com
     m_computerPassed(false),
     m_humanPassed(false),
     m_isHumanTurn(false),
-    m_engineValue(0)
+    m_engineValue(0),
+    m_seed(0),
+    m_gameLog(nullptr),
+    m_strategy(nullptr),
+    m_advisor(),
+    m_output(&std::cout)
 {
     // Sync the local round players with the overall tournament scores
     m_human.setScore(humanScore);
@@ -62,22 +76,39 @@ Parameters:
             to calculate which double tile is the engine.
 Return Value: None
 Algorithm:
-        1. Reset round variables (pass flags and round number).
-        2. Clear any data from previous rounds in the layout and hands.
-        3. Initialize and shuffle the stock (boneyard).
-        4. Deal 8 tiles to each player.
-        5. Calculate the engine value based on the round number
-            (e.g., Round 1 is 6-6, Round 2 is 5-5).
-        6. Search player hands for the engine tile.
-        7. If a player has the engine, play it to the layout and set
-            the next turn to the opponent.
-        8. If neither has it, pull the engine from the stock, place it,
-            and default the first turn to the human.
+        1. Draw a fresh seed from std::random_device.
+        2. Deal the round from that seed with dealRound().
+        3. Report who held or found the engine.
 Reference: None
 ********************************************************************* */
 void Round::prepareRound(int roundNumber) {
+    int draws = dealRound(roundNumber, std::random_device{}());
+    reportEngine(draws);
+}
+
+/* *********************************************************************
+Function Name: dealRound
+Purpose: To set up a round from a known seed without any output. The
+        same round number and seed always produce the same hands,
+        boneyard and starting player, which lets a game log replay a
+        round from its seed alone.
+Parameters:
+        roundNumber - An integer representing the current round.
+        seed - An unsigned integer used to shuffle the boneyard.
+Return Value: The number of tiles drawn while searching for the engine,
+        0 if a player was dealt it.
+Algorithm:
+        1. Reset round variables (pass flags, round number and seed).
+        2. Clear any data from previous rounds in the layout and hands.
+        3. Initialize the stock (boneyard) and shuffle it with the seed.
+        4. Deal 8 tiles to each player, alternating, Human first.
+        5. Place the engine with placeEngine().
+Reference: None
+********************************************************************* */
+int Round::dealRound(int roundNumber, unsigned int seed) {
     // 1. Reset Game State
     m_roundNumber = roundNumber;
+    m_seed = seed;
     m_humanPassed = false;
     m_computerPassed = false;
 
@@ -88,10 +119,10 @@ void Round::prepareRound(int roundNumber) {
 
     // 2. Initialize and Shuffle Stock
     m_stock.initializeFullSet();
-    m_stock.shuffle();
+    m_stock.shuffle(m_seed);
 
     // 3. Deal 8 tiles to each player per Longana rules
-    for (int i = 0; i < 8; ++i) {
+    for (int i = 0; i < StandardSet::HAND_SIZE; ++i) {
         Tile tile;
         // Check to ensure stock isn't empty (though it shouldn't be at start)
         if (m_stock.drawTile(tile)) {
@@ -102,216 +133,37 @@ void Round::prepareRound(int roundNumber) {
         }
     }
 
-    // 4. Calculate Engine Value (Double-Double based on round)
-    // Round 1 = 6-6, Round 2 = 5-5 ... Round 7 = 0-0, Round 8 = 6-6
-    int pips = 6 - ((m_roundNumber - 1) % 7);
-    Tile engineTile(pips, pips);
-    m_engineValue = pips;
-
-    // 5. Identify who starts the round by checking for the engine tile
-    bool humanHasEngine = false;
-    bool computerHasEngine = false;
-
-    // Check Human Hand
-    for (int i = 0; i < m_human.getHand().getSize(); ++i) {
-        if (m_human.getHand().getTileAtIndex(i) == engineTile) {
-            humanHasEngine = true;
-
-            // Remove from hand and play immediately
-            Tile played;
-            m_human.getHand().playTile(i, played);
-            m_layout.setEngine(played);
-            break;
-        }
-    }
-
-    // Check Computer Hand (if Human didn't have it)
-    if (!humanHasEngine) {
-        for (int i = 0; i < m_computer.getHand().getSize(); ++i) {
-            if (m_computer.getHand().getTileAtIndex(i) == engineTile) {
-                computerHasEngine = true;
-
-                Tile played;
-                m_computer.getHand().playTile(i, played);
-                m_layout.setEngine(played);
-                break;
-            }
-        }
-    }
-
-    // 6. Set Turn Logic based on Engine ownership
-    if (humanHasEngine) {
-        std::cout << " >> Human holds the Engine " << pips << "-" << pips << " and plays first.\n";
-        m_isHumanTurn = false; // Next turn is Computer's because Human just played
-    }
-    else if (computerHasEngine) {
-        std::cout << " >> Computer holds the Engine " << pips << "-" << pips << " and plays first.\n";
-        m_isHumanTurn = true; // Next turn is Human's because Computer just played
-    }
-    else {
-        // Neither has it; draw from stock and place it
-        std::cout << " >> Neither player holds the Engine " << pips << "-" << pips << ".\n"
-            << " >> Players will draw from the boneyard alternatively until the Engine is found." << std::endl;
-
-        bool engineFound = false;
-
-        while (!engineFound && !m_stock.isEmpty()) {
-            // Human draws first
-            Tile drawn;
-            if (m_stock.drawTile(drawn)) {
-                m_human.getHand().addTile(drawn);
-                std::cout << "Human draws: " << drawn.getLeftPips() << "-" << drawn.getRightPips() << std::endl;
-
-                if (drawn == engineTile) {
-                    std::cout << " >> Engine found by Human. Human plays first." << std::endl;
-
-                    Tile played;
-                    int playedIndex = m_human.getHand().getSize() - 1;
-                    m_human.getHand().playTile(playedIndex, played);
-
-                    m_layout.setEngine(played);
-                    // Computer goes next because Human just played
-                    m_isHumanTurn = false;
-                    engineFound = true;
-                    break;
-                }
-            }
-
-            if (m_stock.isEmpty()) { break; }
-
-            if (m_stock.drawTile(drawn)) {
-                m_computer.getHand().addTile(drawn);
-                std::cout << "Computer draws: " << drawn.getLeftPips() << "-" << drawn.getRightPips() << std::endl;
-
-                if (drawn == engineTile) {
-                    std::cout << " >> Engine found by Computer. Computer plays first." << std::endl;
-
-                    Tile played;
-                    int playedIndex = m_computer.getHand().getSize() - 1;
-                    m_computer.getHand().playTile(playedIndex, played);
-
-                    m_layout.setEngine(played);
-                    // Human goes next because Human just played
-                    m_isHumanTurn = true;
-                    engineFound = true;
-                    break;
-                }
-            }
-        }
-    }
+    return placeEngine();
 }
 
 /* *********************************************************************
 Function Name: playRound
 Purpose: The main round loop. Continues to execute turns for each player
-        until one player wins or the game becomes blocked.
-Parameters: None
-Return Value: None (void)
+        until one player wins or the game becomes blocked. A coroutine:
+        it suspends while waiting for the Human's commands and moves.
+Parameters:
+        tournament - The Tournament passed by const reference, for saving
+            and the odds.
+        channel - A TurnChannel passed by reference. Supplies the Human's
+            words; its FramePool holds the coroutine frames.
+Return Value: A task giving true if the round was played out, false if
+        the Human saved, quit or the input ended.
 Algorithm:
         1. Enter a while loop that persists until roundOver is true.
         2. Display the full game state.
-        3. If it is the Human's turn, call m_human.playTurn(). Update pass status.
-        4. If it is the Computer's turn, call m_computer.playTurn(). Update pass status.
+        3. If it is the Human's turn, read commands until "play", then
+            await m_human.takeTurn(). Update pass status.
+        4. If it is the Computer's turn, call playStrategyTurn(). Update pass status.
         5. Toggle the turn to the other player.
         6. Call checkWinCondition() to update roundOver status.
 Reference: None
 ********************************************************************* */
-void Round::playRound(const Tournament& tournament) {
+Task<bool> Round::playRound(const Tournament& tournament, TurnChannel& channel) {
     bool roundOver = false;
 
-    if (m_layout.isEmpty()) { // Assuming Layout has isEmpty(). If not, check if m_layout.getCount() == 0
-
-        std::cout << " >> Game Loaded or Started with empty board. Locating Engine..." << std::endl;
-
-        // 1. Recalculate what the engine is for this round
-        int pips = 6 - ((m_roundNumber - 1) % 7);
-        Tile engineTile(pips, pips);
-        m_engineValue = pips;
-
-        bool humanHasEngine = false;
-        bool computerHasEngine = false;
-        bool enginePlayed = false;
-
-        // 2. Check Human Hand
-        for (int i = 0; i < m_human.getHand().getSize(); ++i) {
-            if (m_human.getHand().getTileAtIndex(i) == engineTile) {
-                humanHasEngine = true;
-                Tile played;
-                m_human.getHand().playTile(i, played);
-                m_layout.setEngine(played);
-                std::cout << " >> Human holds the Engine " << pips << "-" << pips << " and plays first.\n";
-
-                m_isHumanTurn = false; 
-                enginePlayed = true;
-                break;
-            }
-        }
-
-        // 3. Check Computer Hand (if Human didn't play it)
-        if (!enginePlayed) {
-            for (int i = 0; i < m_computer.getHand().getSize(); ++i) {
-                if (m_computer.getHand().getTileAtIndex(i) == engineTile) {
-                    computerHasEngine = true;
-                    Tile played;
-
-                    m_computer.getHand().playTile(i, played);
-                    m_layout.setEngine(played);
-                    std::cout << " >> Computer holds the Engine " << pips << "-" << pips << " and plays first.\n";
-                    m_isHumanTurn = true;
-                    enginePlayed = true;
-                    break;
-                }
-            }
-        }
-
-        // 4. Alternating Draw Logic (If neither had it initially)
-        if (!enginePlayed) {
-            std::cout << " >> Neither player holds the Engine " << pips << "-" << pips << ".\n";
-            std::cout << " >> Players will draw from the boneyard alternately until the Engine is found.\n";
-
-            while (!enginePlayed && !m_stock.isEmpty()) {
-                // -- Human Draw --
-                Tile drawn;
-                if (m_stock.drawTile(drawn)) {
-                    m_human.getHand().addTile(drawn);
-                    std::cout << "Human draws: " << drawn.getLeftPips() << "-" << drawn.getRightPips() << "\n";
-
-                    if (drawn == engineTile) {
-                        // Play it immediately
-                        Tile played;
-                        int lastIdx = m_human.getHand().getSize() - 1;
-                        m_human.getHand().playTile(lastIdx, played);
-                        m_layout.setEngine(played);
-
-                        std::cout << " >> Human found the Engine! Playing to layout.\n";
-                        m_isHumanTurn = false;
-                        enginePlayed = true;
-                        break;
-                    }
-                }
-
-                if (m_stock.isEmpty()) break;
-
-                // -- Computer Draw --
-                if (m_stock.drawTile(drawn)) {
-                    m_computer.getHand().addTile(drawn);
-                    std::cout << "Computer draws: " << drawn.getLeftPips() << "-" << drawn.getRightPips() << "\n";
-
-                    if (drawn == engineTile) {
-                        // Play it immediately
-                        Tile played;
-                        int lastIdx = m_computer.getHand().getSize() - 1;
-                        m_computer.getHand().playTile(lastIdx, played);
-                        m_layout.setEngine(played);
-
-                        std::cout << " >> Computer found the Engine! Playing to layout.\n";
-                        m_isHumanTurn = true; // Human goes next
-                        enginePlayed = true;
-                        break;
-                    }
-                }
-            }
-        }
+    if (m_layout.isEmpty()) {
+        *m_output << " >> Game Loaded or Started with empty board. Locating Engine..." << std::endl;
+        reportEngine(placeEngine());
     }
 
     while (!roundOver) {
@@ -321,120 +173,345 @@ void Round::playRound(const Tournament& tournament) {
         if (m_isHumanTurn) {
             // Execute Human turn logic
             while (true) {
-                // Prompt user (No flush needed because cin comes next)
-                std::cout << "Enter command (play / help / save / quit): ";
+                // Prompt user (No flush needed because the driver flushes before reading)
+                *m_output << "Enter command (play / help / odds / save / quit): ";
 
-                std::string command;
-                std::cin >> command;
+                std::string command = co_await channel.readWord();
+                if (command.empty()) {
+                    co_return false;
+                }
 
                 if (command == "help") {
                     help();
                     continue;
                 }
+                else if (command == "odds") {
+                    showOdds(tournament);
+                    continue;
+                }
                 else if (command == "save") {
-                    // Prompt user (No flush needed because cin comes next)
-                    std::cout << "Enter filename to save to: ";
+                    // Prompt user (No flush needed because the driver flushes before reading)
+                    *m_output << "Enter filename to save to: ";
+
+                    std::string filename = co_await channel.readWord();
+                    if (filename.empty()) {
+                        co_return false;
+                    }
 
-                    std::string filename;
-                    std::cin >> filename;
+                    // A ".bin" extension selects the compact binary snapshot
+                    bool isBinary = filename.size() > 4 && filename.compare(filename.size() - 4, 4, ".bin") == 0;
+                    bool saved = isBinary ? Serializer::saveBinary(filename, tournament)
+                        : Serializer::saveGame(filename, tournament);
 
-                    if (Serializer::saveGame(filename, tournament)) {
-                        std::cout << "Game saved successfully to " << filename << std::endl;
-                        std::exit(0);
+                    if (saved) {
+                        *m_output << "Game saved successfully to " << filename << std::endl;
+                        co_return false;
                     }
                     else {
-                        std::cout << "Game save was unsuccessful" << std::endl;
+                        *m_output << "Game save was unsuccessful" << std::endl;
                     }
                 }
                 else if (command == "quit") {
-                    std::cout << "Exiting game..." << std::endl;
-                    exit(0);
+                    *m_output << "Exiting game..." << std::endl;
+                    co_return false;
                 }
                 else if (command == "play") {
                     break;
                 }
                 else {
-                    std::cout << "Invalid command. Try again." << std::endl;
+                    *m_output << "Invalid command. Try again." << std::endl;
                 }
             }
+        }
 
+        // Remember the ends of the boneyard and layout so the turn can be logged
+        bool isHuman = m_isHumanTurn;
+        int stockSize = m_stock.getSize();
+        Tile topTile = m_stock.isEmpty() ? Tile() : m_stock.getTileAtIndex(0);
+        Tile leftTile = m_layout.isEmpty() ? Tile() : m_layout.getTileAtIndex(0);
+
+        if (isHuman) {
             // Execute Human turn logic
-            bool moveMade = m_human.playTurn(m_layout, m_stock, m_computerPassed);
+            bool moveMade = co_await m_human.takeTurn(m_layout, m_stock, m_computerPassed, channel);
+            if (channel.isExhausted()) {
+                co_return false;
+            }
             m_humanPassed = !moveMade;
             m_isHumanTurn = false;
         }
         else {
             // Execute Computer turn logic
-            bool moveMade = m_computer.playTurn(m_layout, m_stock, m_humanPassed);
+            bool moveMade = playStrategyTurn();
             m_computerPassed = !moveMade;
             m_isHumanTurn = true;
         }
 
+        if (m_gameLog != nullptr) {
+            logTurn(isHuman, stockSize, topTile, leftTile);
+        }
+
         // Check if the move resulted in a win or a block
         roundOver = checkWinCondition();
     }
+
+    co_return true;
 }
 
 /* *********************************************************************
 Function Name: help
-Purpose: To provide the human player with a recommended move based on
-        the current hand and layout state. It evaluates legal moves
-        on the player's own side and, if the computer has passed,
-        checks for legal moves on the opponent's side.
+Purpose: To provide the human player with every legal move, ranked
+        best first, with the points each is expected to gain against
+        the Computer and the chance it wins the round. With no legal
+        move, the choice shown is to draw, or to pass if the
+        boneyard is empty.
 Parameters: None
 Return Value: None (void)
 Algorithm:
-        1. Iterate through each tile in the human player's hand.
-        2. Check if the tile can be legally placed on the LEFT side
-            (the human's standard side).
-        3. If the computer has passed, check if the tile can be
-            legally placed on the RIGHT side (the computer's side).
-        4. If a legal move is found, output the suggestion and exit.
-        5. If no moves are found in the hand:
-            - Suggest drawing if the stock (boneyard) is not empty.
-            - Suggest passing if both the hand and boneyard offer no
-                options.
+        1. Load the round into a Playout and have m_advisor rank the
+            Human's choices within HELP_MILLISECONDS, or recall the
+            ranking if this position was ranked before.
+        2. Output the best choice as the suggestion, with a reason.
+        3. If there is more than one, list them all in order with
+            their expected points and round win chance.
 Reference: None
 ********************************************************************* */
 void Round::help() {
+    // 1. The ranking
+    Playout position;
+    position.loadRound(*this);
+    m_advisor.rank(position, HELP_MILLISECONDS);
+
     const Hand& hand = m_human.getHand();
-    bool foundMove = false;
+    auto describe = [this, &hand](int rank) {
+        if (m_advisor.getIndex(rank) < 0) {
+            return std::string(m_stock.isEmpty() ? "PASS" : "DRAW");
+        }
+        Tile t = hand.getTileAtIndex(m_advisor.getIndex(rank));
+        return std::to_string(t.getLeftPips()) + "-" + std::to_string(t.getRightPips())
+            + ((m_advisor.getArm(rank) == Playout::HUMAN) ? " on the LEFT" : " on the RIGHT");
+    };
+
+    // 2. The best choice
+    char estimate[64];
+    std::snprintf(estimate, sizeof(estimate), "%+.1f points against the Computer and won %.1f%%",
+        m_advisor.getValue(0), 100.0 * m_advisor.getWinRate(0));
+    std::string source = "In " + std::to_string(m_advisor.getSimulationCount()) + " simulated endings of the round"
+        + (m_advisor.isCached() ? " (ranked earlier)" : "");
+
+    if (m_advisor.getIndex(0) < 0 && !m_stock.isEmpty()) {
+        *m_output << "No moves found. You Should DRAW." << std::endl;
+        *m_output << "Reason: You have no tiles that match either the left or right side.\n"
+            << "\t" << source << ", drawing averaged\n\t" << estimate << " of them." << std::endl;
+        return;
+    }
+    if (m_advisor.getIndex(0) < 0) {
+        *m_output << "No moves and boneyard is empty. You must PASS." << std::endl;
+        *m_output << "Reason: You have no legal moves and the boneyard is empty, you must forfeit your turn.\n"
+            << "\t" << source << ", passing averaged\n\t" << estimate << " of them." << std::endl;
+        return;
+    }
 
-    for (int i = 0; i < hand.getSize(); i++) {
-        Tile t = hand.getTileAtIndex(i);
+    *m_output << "Suggestion: Play " << describe(0) << std::endl;
+    *m_output << "Reason: " << source << ", this move averaged\n"
+        << "\t" << estimate << " of them, "
+        << ((m_advisor.getChoiceCount() == 1) ? "your only move." : "the best of your " + std::to_string(m_advisor.getChoiceCount()) + " moves.")
+        << std::endl;
+
+    // 3. Every move, best first
+    if (m_advisor.getChoiceCount() > 1) {
+        *m_output << "All moves, best first:\n";
+        for (int rank = 0; rank < m_advisor.getChoiceCount(); ++rank) {
+            char line[96];
+            std::snprintf(line, sizeof(line), "   %2d. %-18s %+6.1f points, wins %5.1f%%\n", rank + 1,
+                describe(rank).c_str(), m_advisor.getValue(rank), 100.0 * m_advisor.getWinRate(rank));
+            *m_output << line;
+        }
+        *m_output << std::flush;
+    }
+}
 
-        if (m_layout.isLegalMove(t, 'L')) {
-            std::cout << "Suggestion: Play " << t.getLeftPips() << "-" << t.getRightPips()
-                << " on the LEFT" << std::endl;
+/* *********************************************************************
+Function Name: showOdds
+Purpose: To show each side's chance of winning the tournament from the
+        current position.
+Parameters:
+        tournament, a Tournament passed by const reference. Supplies the
+            scores and target as they stood at the start of the round.
+Return Value: None (void)
+Algorithm:
+        1. Run a WinEstimator for half a second on every core.
+        2. Print each probability with its 95% confidence interval.
+Reference: None
+********************************************************************* */
+void Round::showOdds(const Tournament& tournament) const {
+    WinEstimator estimator;
+    estimator.estimate(tournament, 500, 0);
 
-            std::cout << "Reason: This first tile matches the open pips on your side (LEFT).\n"
-                << "\tPlaying your own side is the standard move." << std::endl;
-            foundMove = true;
-            break;
+    const char* names[3] = { "Human wins", "Computer wins", "Draw" };
+    if (estimator.isDecided()) {
+        *m_output << "Tournament odds (already decided):\n";
+    }
+    else {
+        *m_output << "Tournament odds (" << estimator.getSimulationCount() << " simulations, both sides playing the Computer's strategy):\n";
+    }
+
+    for (int outcome = WinEstimator::HUMAN_WINS; outcome <= WinEstimator::DRAW; ++outcome) {
+        double low = 0.0;
+        double high = 0.0;
+        estimator.getInterval(outcome, low, high);
+
+        *m_output << "   " << names[outcome] << ": " << std::fixed << std::setprecision(1)
+            << 100.0 * estimator.getProbability(outcome) << "% (95% CI " << 100.0 * low << "% - "
+            << 100.0 * high << "%)\n";
+    }
+    m_output->unsetf(std::ios::fixed);
+    *m_output << std::setprecision(6) << std::flush;
+}
+
+/* *********************************************************************
+Function Name: applyPlay
+Purpose: To play a tile from a player's hand without any prompting or
+        output. Used to replay a recorded move.
+Parameters:
+        isHuman - A boolean; true to play from the Human's hand.
+        tile - The Tile to play, in either orientation.
+        side - A character, 'L' or 'R', the end of the layout to play on.
+Return Value: Boolean true if the player held the tile and it fit that end.
+Algorithm:
+        1. Find the tile in the player's hand.
+        2. Add it to the requested end of the layout, which orients it.
+        3. Remove it from the hand, clear the player's pass flag and
+            hand the turn to the opponent.
+Reference: None
+********************************************************************* */
+bool Round::applyPlay(bool isHuman, const Tile& tile, char side) {
+    Hand& hand = isHuman ? m_human.getHand() : m_computer.getHand();
+
+    for (int i = 0; i < hand.getSize(); ++i) {
+        if (hand.getTileAtIndex(i) == tile) {
+            bool placed = (side == 'L') ? m_layout.addLeftTile(tile) : m_layout.addRightTile(tile);
+            if (!placed) {
+                return false;
+            }
+
+            Tile played;
+            hand.playTile(i, played);
+            (isHuman ? m_humanPassed : m_computerPassed) = false;
+            m_isHumanTurn = !isHuman;
+            return true;
         }
+    }
 
-        if (m_computerPassed && m_layout.isLegalMove(t, 'R')) {
-            std::cout << "Suggestion: Play " << t.getLeftPips() << "-" << t.getRightPips() 
-                << " on the RIGHT" << std::endl;
-            
-            std::cout << "Reason: You can play on the Computer's side (RIGHT) because\n"
-                << "\tthe computer passed on their previous turn and no moves are available on your side." << std::endl;
+    return false;
+}
 
-            foundMove = true;
-            break;
+/* *********************************************************************
+Function Name: applyDraw
+Purpose: To move the top tile of the boneyard into a player's hand
+        without any output. The turn does not change, since a player
+        who draws goes on to play or pass.
+Parameters:
+        isHuman - A boolean; true to draw for the Human.
+        outTile - A Tile passed by reference. Receives the drawn tile.
+Return Value: Boolean true if the boneyard was not empty.
+Algorithm:
+        1. Draw the top tile from the stock.
+        2. Add it to the end of the player's hand.
+Reference: None
+********************************************************************* */
+bool Round::applyDraw(bool isHuman, Tile& outTile) {
+    if (!m_stock.drawTile(outTile)) {
+        return false;
+    }
+
+    (isHuman ? m_human.getHand() : m_computer.getHand()).addTile(outTile);
+    return true;
+}
+
+/* *********************************************************************
+Function Name: applyPass
+Purpose: To record that a player passed, without any output.
+Parameters:
+        isHuman - A boolean; true if the Human passed.
+Return Value: None
+Algorithm:
+        1. Set the player's pass flag.
+        2. Hand the turn to the opponent.
+Reference: None
+********************************************************************* */
+void Round::applyPass(bool isHuman) {
+    (isHuman ? m_humanPassed : m_computerPassed) = true;
+    m_isHumanTurn = !isHuman;
+}
+
+/* *********************************************************************
+Function Name: hasComputerPlay
+Purpose: To check whether the Computer holds any tile it may play, by
+        the rules canComputerPlay() applies.
+Parameters: None
+Return Value: Boolean true if any tile in the Computer's hand may be played.
+Algorithm: Try every tile in the hand on both ends of the layout.
+Reference: None
+********************************************************************* */
+bool Round::hasComputerPlay() const {
+    const Hand& hand = m_computer.getHand();
+    for (int i = 0; i < hand.getSize(); ++i) {
+        Tile tile = hand.getTileAtIndex(i);
+        if (canComputerPlay(tile, 'L') || canComputerPlay(tile, 'R')) {
+            return true;
         }
     }
+    return false;
+}
+
+/* *********************************************************************
+Function Name: scoreRound
+Purpose: To check whether the round is over and, if it is, award its
+        points, without any output.
+Parameters:
+        outHumanPoints, outComputerPoints - Integers passed by reference.
+            Receive the points each player won this round.
+Return Value: Boolean true if the round has concluded.
+Algorithm:
+        1. If a hand is empty, its player wins the other hand's pips.
+        2. If the game is blocked (stock empty and both players passed),
+            the player with fewer pips wins the other's; a tie wins
+            nothing.
+        3. Add the points to the players' scores.
+Reference: None
+********************************************************************* */
+bool Round::scoreRound(int& outHumanPoints, int& outComputerPoints) {
+    outHumanPoints = 0;
+    outComputerPoints = 0;
 
-    if (!foundMove) {
-        if (!m_stock.isEmpty()) {
-            std::cout << "No moves found. You Should DRAW." << std::endl;
-            std::cout << "Reason: You have no tiles that match either the left or right side." << std::endl;
+    int humanTotal = m_human.getHand().getHandScore();
+    int computerTotal = m_computer.getHand().getHandScore();
+    bool isBlocked = m_stock.isEmpty() && m_humanPassed && m_computerPassed;
+
+    // 1. A player went out
+    if (m_human.isHandEmpty()) {
+        outHumanPoints = computerTotal;
+    }
+    else if (m_computer.isHandEmpty()) {
+        outComputerPoints = humanTotal;
+    }
+    // 2. The lower hand wins a block
+    else if (isBlocked) {
+        if (humanTotal < computerTotal) {
+            outHumanPoints = computerTotal;
         }
-        else {
-            std::cout << "No moves and boneyard is empty. You must PASS." << std::endl;
-            std::cout << "Reason: You have no legal moves and the boneyard is empty, you must forfeit your turn" << std::endl;
+        else if (computerTotal < humanTotal) {
+            outComputerPoints = humanTotal;
         }
     }
+    else {
+        return false;
+    }
+
+    // 3. The scores
+    m_human.setScore(m_human.getScore() + outHumanPoints);
+    m_computer.setScore(m_computer.getScore() + outComputerPoints);
+    return true;
 }
 
 /* *********************************************************************
@@ -443,60 +520,44 @@ Purpose: Evaluates if the round has ended and calculates points for the winner.
 Parameters: None
 Return Value: Boolean true if the round has concluded, false if it should continue.
 Algorithm:
-        1. Check if Human's hand is empty. If so, add Computer's hand pips to Human's score.
-        2. Check if Computer's hand is empty. If so, add Human's hand pips to Computer's score.
-        3. Check if the game is "Blocked" (Stock empty and both players passed).
-            a. Compare total pips in both hands.
-            b. The player with fewer pips wins the block and receives the opponent's pip total.
-            c. If tied, 0 points are awarded.
-        4. Return true for any of the above, otherwise return false.
+        1. Score the round with scoreRound(); stop if it goes on.
+        2. If a hand is empty, announce that its player went out.
+        3. Otherwise the game is "Blocked": show both pip totals and
+            announce who won the block, or a tie.
 Reference: None
 ********************************************************************* */
 bool Round::checkWinCondition() {
-    // Check for a standard "Out" win for the Human
+    int humanPoints = 0;
+    int computerPoints = 0;
+    if (!scoreRound(humanPoints, computerPoints)) {
+        return false;
+    }
+
+    // Standard "Out" wins
     if (m_human.isHandEmpty()) {
-        int points = m_computer.getHand().getHandScore();
-        m_human.setScore(m_human.getScore() + points);
-        std::cout << "*** Human Wins Round! + " << points << " points ***" << std::endl;
+        *m_output << "*** Human Wins Round! + " << humanPoints << " points ***" << std::endl;
         return true;
     }
-
-    // Check for a standard "Out" win for the Computer
     if (m_computer.isHandEmpty()) {
-        int points = m_human.getHand().getHandScore();
-        m_computer.setScore(m_computer.getScore() + points);
-        std::cout << "*** Computer Wins Round! + " << points << " points ***" << std::endl;
+        *m_output << "*** Computer Wins Round! + " << computerPoints << " points ***" << std::endl;
         return true;
     }
 
-    // Check for a "Blocked" game state
-    if (m_stock.isEmpty() && m_humanPassed && m_computerPassed) {
-        std::cout << "\n*** Game Blocked! Counting pips... ***\n";
-
-        int humanTotal = m_human.getHand().getHandScore();
-        int computerTotal = m_computer.getHand().getHandScore();
-
-        std::cout << "Human Pips: " << humanTotal << " | Computer Pips: " << computerTotal << "\n";
-
-        // In a block, the player with the lowest total wins the opponent's pips
-        if (humanTotal < computerTotal) {
-            int points = computerTotal;
-            m_human.setScore(m_human.getScore() + points);
-            std::cout << "*** Human Wins the Block! + " << points << " points ***" << std::endl;
-        }
-        else if (computerTotal < humanTotal) {
-            int points = humanTotal;
-            m_computer.setScore(m_computer.getScore() + points);
-            std::cout << "*** Computer Wins the Block! + " << points << " points ***" << std::endl;
-        }
-        else {
-            std::cout << "*** It's a Tie! 0 points awarded. ***" << std::endl;
-        }
+    // A "Blocked" game
+    *m_output << "\n*** Game Blocked! Counting pips... ***\n";
+    *m_output << "Human Pips: " << m_human.getHand().getHandScore() << " | Computer Pips: "
+        << m_computer.getHand().getHandScore() << "\n";
 
-        return true;
+    if (humanPoints > 0) {
+        *m_output << "*** Human Wins the Block! + " << humanPoints << " points ***" << std::endl;
     }
-
-    return false;
+    else if (computerPoints > 0) {
+        *m_output << "*** Computer Wins the Block! + " << computerPoints << " points ***" << std::endl;
+    }
+    else {
+        *m_output << "*** It's a Tie! 0 points awarded. ***" << std::endl;
+    }
+    return true;
 }
 
 /* *********************************************************************
@@ -515,35 +576,249 @@ Algorithm:
 Reference: None
 ********************************************************************* */
 void Round::displayGameState() {
-    std::cout << "\n--------------------------------------------------\n";
-    std::cout << "Tournament Score To Win: " << m_tournamentScore << "\n";
-    std::cout << "Round No.: " << m_roundNumber << "\n\n";
+    *m_output << "\n--------------------------------------------------\n";
+    *m_output << "Tournament Score To Win: " << m_tournamentScore << "\n";
+    *m_output << "Round No.: " << m_roundNumber << "\n\n";
 
     // Show Computer state (Hand is visible for verification)
-    std::cout << "Computer:\n";
-    std::cout << "   Hand: ";
-    m_computer.getHand().displayHand();
-    std::cout << "   Score: " << m_computer.getScore() << "\n\n";
+    *m_output << "Computer:\n";
+    *m_output << "   Hand: ";
+    m_computer.getHand().displayHand(*m_output);
+    *m_output << "   Score: " << m_computer.getScore() << "\n\n";
 
     // Show Human state
-    std::cout << "Human:\n";
-    std::cout << "   Hand: ";
-    m_human.getHand().displayHand();
-    std::cout << "   Score: " << m_human.getScore() << "\n\n";
+    *m_output << "Human:\n";
+    *m_output << "   Hand: ";
+    m_human.getHand().displayHand(*m_output);
+    *m_output << "   Score: " << m_human.getScore() << "\n\n";
 
     // Show board state
-    std::cout << "Layout:\n";
-    std::cout << "   L ";
-    m_layout.displayLayout();
-    std::cout << " R\n\n";
+    *m_output << "Layout:\n";
+    *m_output << "   L ";
+    m_layout.displayLayout(*m_output);
+    *m_output << " R\n\n";
 
     // Show all tiles in the boneyard
-    std::cout << "Boneyard:\n";
-    m_stock.printStock();
-    std::cout << "\n";
+    *m_output << "Boneyard:\n";
+    m_stock.printStock(*m_output);
+    *m_output << "\n";
 
     // Display turn status
-    std::cout << "Previous Player Passed: " << (m_isHumanTurn ? (m_computerPassed ? "Yes" : "No") : (m_humanPassed ? "Yes" : "No")) << "\n";
-    std::cout << "Next Player: " << (m_isHumanTurn ? "Human" : "Computer") << "\n";
-    std::cout << "--------------------------------------------------\n";
+    *m_output << "Previous Player Passed: " << (m_isHumanTurn ? (m_computerPassed ? "Yes" : "No") : (m_humanPassed ? "Yes" : "No")) << "\n";
+    *m_output << "Next Player: " << (m_isHumanTurn ? "Human" : "Computer") << "\n";
+    *m_output << "--------------------------------------------------\n";
+}
+
+/* *********************************************************************
+Function Name: placeEngine
+Purpose: To locate the engine for the current round and place it on the
+        empty layout, without any output. Also used for a round
+        resumed from a save made before the engine was placed.
+Parameters: None
+Return Value: The number of tiles drawn while searching for the engine,
+        0 if a player already held it.
+Algorithm:
+        1. Calculate the engine value based on the round number
+            (e.g., Round 1 is 6-6, Round 2 is 5-5).
+        2. If the Human, then the Computer, holds the engine, play it and
+            give the next turn to the opponent.
+        3. Otherwise the players draw alternately, Human first, until
+            one of them draws the engine, which is played at once.
+Reference: None
+********************************************************************* */
+int Round::placeEngine() {
+    // Round 1 = 6-6, Round 2 = 5-5 ... Round 7 = 0-0, Round 8 = 6-6
+    int pips = StandardSet::getEngine(m_roundNumber);
+    Tile engineTile(pips, pips);
+    m_engineValue = pips;
+
+    if (m_human.removeSpecificTile(engineTile)) {
+        m_layout.setEngine(engineTile);
+        m_isHumanTurn = false; // Next turn is Computer's because Human just played
+        return 0;
+    }
+    if (m_computer.removeSpecificTile(engineTile)) {
+        m_layout.setEngine(engineTile);
+        m_isHumanTurn = true; // Next turn is Human's because Computer just played
+        return 0;
+    }
+
+    // Neither has it; draw alternately from the stock, Human first
+    int draws = 0;
+    Tile drawn;
+
+    while (m_stock.drawTile(drawn)) {
+        bool humanDrew = (draws % 2 == 0);
+        ++draws;
+
+        if (drawn == engineTile) {
+            m_layout.setEngine(drawn);
+            m_isHumanTurn = !humanDrew;
+            break;
+        }
+
+        if (humanDrew) {
+            m_human.addTileToHand(drawn);
+        }
+        else {
+            m_computer.addTileToHand(drawn);
+        }
+    }
+
+    return draws;
+}
+
+/* *********************************************************************
+Function Name: reportEngine
+Purpose: To announce how the engine was placed by placeEngine().
+Parameters:
+        draws - An integer, the number of tiles drawn to find the engine.
+Return Value: None
+Algorithm:
+        1. If no tiles were drawn, announce who held the engine.
+        2. Otherwise list the tiles each player drew, which sit at the end
+            of their hands, followed by the engine itself.
+        3. Announce who found the engine and plays first.
+Reference: None
+********************************************************************* */
+void Round::reportEngine(int draws) const {
+    int pips = m_engineValue;
+
+    if (draws == 0 && !m_layout.isEmpty()) {
+        *m_output << " >> " << (m_isHumanTurn ? "Computer" : "Human") << " holds the Engine "
+            << pips << "-" << pips << " and plays first.\n";
+        return;
+    }
+
+    *m_output << " >> Neither player holds the Engine " << pips << "-" << pips << ".\n"
+        << " >> Players will draw from the boneyard alternately until the Engine is found." << std::endl;
+
+    // The tiles drawn before the engine are the last ones in each hand
+    bool found = !m_layout.isEmpty();
+    int humanDraws = found ? draws / 2 : (draws + 1) / 2;
+    int computerDraws = draws - humanDraws - (found ? 1 : 0);
+    int humanFirst = m_human.getHand().getSize() - humanDraws;
+    int computerFirst = m_computer.getHand().getSize() - computerDraws;
+
+    for (int i = 0; i < draws; ++i) {
+        bool humanDrew = (i % 2 == 0);
+        Tile drawn;
+
+        if (found && i == draws - 1) {
+            drawn = m_layout.getTileAtIndex(0);
+        }
+        else if (humanDrew) {
+            drawn = m_human.getHand().getTileAtIndex(humanFirst + i / 2);
+        }
+        else {
+            drawn = m_computer.getHand().getTileAtIndex(computerFirst + i / 2);
+        }
+
+        *m_output << (humanDrew ? "Human" : "Computer") << " draws: "
+            << drawn.getLeftPips() << "-" << drawn.getRightPips() << std::endl;
+    }
+
+    if (found) {
+        const char* finder = m_isHumanTurn ? "Computer" : "Human";
+        *m_output << " >> Engine found by " << finder << ". " << finder << " plays first." << std::endl;
+    }
+    else {
+        *m_output << " >> The Engine is not in the boneyard." << std::endl;
+    }
+}
+
+/* *********************************************************************
+Function Name: playStrategyTurn
+Purpose: To play the Computer's turn with m_strategy, explaining the
+        choice.
+Parameters: None
+Return Value: Boolean true if a tile was placed, false if the Computer passed.
+Algorithm:
+        1. Copy the round into a Playout and ask the strategy for a
+            move. If a tile fits, play the one chosen.
+        2. Otherwise draw one tile if the boneyard is not empty and
+            ask again where the drawn tile goes, if anywhere.
+        3. Otherwise pass.
+Reference: None
+********************************************************************* */
+bool Round::playStrategyTurn() {
+    *m_output << "Computer is thinking..." << std::endl;
+
+    Playout position;
+    int index = 0;
+    int arm = Playout::COMPUTER;
+    bool hasDrawn = false;
+
+    position.loadRound(*this);
+    bool hasMove = m_strategy->chooseMove(position, index, arm);
+
+    // 2. Nothing fits, so draw once and ask where the drawn tile goes
+    if (!hasMove && !m_stock.isEmpty()) {
+        *m_output << "No legal moves, the Computer must draw from the boneyard." << std::endl;
+
+        Tile drawn;
+        applyDraw(false, drawn);
+        *m_output << "Computer drew: " << drawn.getLeftPips() << "-" << drawn.getRightPips() << std::endl;
+
+        position.loadRound(*this);
+        hasMove = m_strategy->chooseMove(position, index, arm);
+        hasDrawn = true;
+    }
+
+    // 3. Nothing to play
+    if (!hasMove) {
+        *m_output << "Computer passes." << std::endl;
+        *m_output << (hasDrawn ? "Reason: Even the drawn tile does not fit on the board. Turn is forfeited."
+            : "Reason: Computer cannot move and stock is empty.") << std::endl;
+        return false;
+    }
+
+    // 1. Play the tile the strategy chose
+    Tile tile = position.getHandTile(Playout::COMPUTER, index);
+    char side = (arm == Playout::COMPUTER) ? 'R' : 'L';
+    applyPlay(false, tile, side);
+
+    *m_output << "Computer placed " << (hasDrawn ? "drawn tile " : "") << tile.getLeftPips() << "-"
+        << tile.getRightPips() << " on the " << (side == 'R' ? "RIGHT." : "LEFT.") << std::endl;
+    *m_output << "Reason: " << m_strategy->getReason() << std::endl;
+
+    return true;
+}
+
+/* *********************************************************************
+Function Name: logTurn
+Purpose: To write the turn that was just played to the game log, working
+        out what happened by comparing the board with its state before
+        the turn.
+Parameters:
+        isHuman - A boolean; true if the Human just moved.
+        stockSize - An integer, the size of the boneyard before the turn.
+        topTile - The Tile that was on top of the boneyard before the turn.
+        leftTile - The Tile that was at the left end of the layout before
+            the turn.
+Return Value: None
+Algorithm:
+        1. If the boneyard shrank, log a draw of its former top tile.
+        2. If the player passed, log a pass.
+        3. Otherwise, if the left end changed, log a play of the new left
+            tile on the left; if not, log a play of the right tile.
+        4. Flush the log.
+Reference: None
+********************************************************************* */
+void Round::logTurn(bool isHuman, int stockSize, const Tile& topTile, const Tile& leftTile) {
+    if (m_stock.getSize() < stockSize) {
+        m_gameLog->recordDraw(isHuman, topTile);
+    }
+
+    if (isHuman ? m_humanPassed : m_computerPassed) {
+        m_gameLog->recordPass(isHuman);
+    }
+    else if (!(m_layout.getTileAtIndex(0) == leftTile)) {
+        m_gameLog->recordPlay(isHuman, m_layout.getTileAtIndex(0), 'L');
+    }
+    else {
+        m_gameLog->recordPlay(isHuman, m_layout.getTileAtIndex(m_layout.getSize() - 1), 'R');
+    }
+
+    m_gameLog->flush();
 }
\ No newline at end of file
@@ -13,8 +13,13 @@
 #include "Stock.h"
 #include "Layout.h"
 #include "Hand.h"
+#include "MoveAdvisor.h"
+#include "Task.h"
 
+class ComputerStrategy;
+class GameLog;
 class Tournament;
+class TurnChannel;
 
 /* *********************************************************************
 Class Name: Round
@@ -26,6 +31,9 @@ Purpose: Manages the execution of a single round of Longana. It is
 class Round {
 public:
 
+    // Time the help command may spend ranking moves, in milliseconds
+    static const int HELP_MILLISECONDS = 100;
+
     /* --- Constructor --- */
 
     /* *********************************************************************
@@ -196,6 +204,43 @@ public:
     ********************************************************************* */
     inline bool isHumanTurn() const { return m_isHumanTurn; }
 
+    /* *********************************************************************
+    Function Name: canHumanPlay / hasHumanPlay
+    Purpose: To check the Human's moves by the rules their console turns
+            follow, for rounds driven some other way.
+    Parameters:
+            tile - The Tile to play, in either orientation.
+            side - A character, 'L' or 'R', the end of the layout to play on.
+    Return Value: Boolean true if the Human may play the tile there. /
+            Boolean true if any tile in the Human's hand may be played.
+    Algorithm: Ask Human::canPlay() or Human::hasPlayableTile() with the
+            layout and whether the Computer passed.
+    Reference: None
+    ********************************************************************* */
+    inline bool canHumanPlay(const Tile& tile, char side) const {
+        return m_human.canPlay(tile, side, m_layout, m_computerPassed);
+    }
+    inline bool hasHumanPlay() const { return m_human.hasPlayableTile(m_layout, m_computerPassed); }
+
+    /* *********************************************************************
+    Function Name: canComputerPlay / hasComputerPlay
+    Purpose: To check the Computer's moves by the same rules, mirrored:
+            its own end is the right, and it may play on the left with a
+            double or after the Human passed.
+    Parameters:
+            tile - The Tile to play, in either orientation.
+            side - A character, 'L' or 'R', the end of the layout to play on.
+    Return Value: Boolean true if the Computer may play the tile there. /
+            Boolean true if any tile in the Computer's hand may be played.
+    Algorithm: Check the end, then that the tile matches its open pips;
+            for any tile, try every tile in the hand on both ends.
+    Reference: None
+    ********************************************************************* */
+    inline bool canComputerPlay(const Tile& tile, char side) const {
+        return (side == 'R' || tile.isDouble() || m_humanPassed) && m_layout.isLegalMove(tile, side);
+    }
+    bool hasComputerPlay() const;
+
     /* *********************************************************************
     Function Name: getHumanPassed
     Purpose: To retrieve the status of whether the human player was forced
@@ -220,6 +265,47 @@ public:
     ********************************************************************* */
     inline bool getComputerPassed() const { return m_computerPassed; }
 
+    /* *********************************************************************
+    Function Name: getSeed
+    Purpose: To retrieve the seed that shuffled the boneyard for this round.
+            Together with the round number it determines the whole deal.
+    Parameters: None
+    Return Value: An unsigned integer seed.
+    Algorithm: Returns the value of the m_seed member variable.
+    Reference: None
+    ********************************************************************* */
+    inline unsigned int getSeed() const { return m_seed; }
+
+    /* *********************************************************************
+    Function Name: getRoundNumber
+    Purpose: To retrieve the number of this round in the tournament.
+    Parameters: None
+    Return Value: An integer round number, starting at 1.
+    Algorithm: Returns the value of the m_roundNumber member variable.
+    Reference: None
+    ********************************************************************* */
+    inline int getRoundNumber() const { return m_roundNumber; }
+
+    /* *********************************************************************
+    Function Name: getTargetScore
+    Purpose: To retrieve the score that wins the tournament.
+    Parameters: None
+    Return Value: An integer score.
+    Algorithm: Returns the value of the m_tournamentScore member variable.
+    Reference: None
+    ********************************************************************* */
+    inline int getTargetScore() const { return m_tournamentScore; }
+
+    /* *********************************************************************
+    Function Name: getEngineValue
+    Purpose: To retrieve the pips of the engine placed by placeEngine().
+    Parameters: None
+    Return Value: An integer pip value; 0 before the engine is placed.
+    Algorithm: Returns the value of the m_engineValue member variable.
+    Reference: None
+    ********************************************************************* */
+    inline int getEngineValue() const { return m_engineValue; }
+
     /* --- Mutators --- */
 
     /* *********************************************************************
@@ -266,21 +352,34 @@ public:
                 to calculate which double tile is the engine.
     Return Value: None
     Algorithm:
-            1. Reset round variables (pass flags and round number).
-            2. Clear any data from previous rounds in the layout and hands.
-            3. Initialize and shuffle the stock (boneyard).
-            4. Deal 8 tiles to each player.
-            5. Calculate the engine value based on the round number
-                (e.g., Round 1 is 6-6, Round 2 is 5-5).
-            6. Search player hands for the engine tile.
-            7. If a player has the engine, play it to the layout and set
-                the next turn to the opponent.
-            8. If neither has it, pull the engine from the stock, place it,
-                and default the first turn to the human.
+            1. Draw a fresh seed from std::random_device.
+            2. Deal the round from that seed with dealRound().
+            3. Report who held or found the engine.
     Reference: None
     ********************************************************************* */
     void prepareRound(int roundNumber);
 
+    /* *********************************************************************
+    Function Name: dealRound
+    Purpose: To set up a round from a known seed without any output. The
+            same round number and seed always produce the same hands,
+            boneyard and starting player, which lets a game log replay a
+            round from its seed alone.
+    Parameters:
+            roundNumber - An integer representing the current round.
+            seed - An unsigned integer used to shuffle the boneyard.
+    Return Value: The number of tiles drawn while searching for the engine,
+            0 if a player was dealt it.
+    Algorithm:
+            1. Reset round variables (pass flags, round number and seed).
+            2. Clear any data from previous rounds in the layout and hands.
+            3. Initialize the stock (boneyard) and shuffle it with the seed.
+            4. Deal 8 tiles to each player, alternating, Human first.
+            5. Place the engine with placeEngine().
+    Reference: None
+    ********************************************************************* */
+    int dealRound(int roundNumber, unsigned int seed);
+
     /* *********************************************************************
     Function Name: setRoundNumber
     Purpose: To establish or update the current round count within the
@@ -313,6 +412,73 @@ public:
     ********************************************************************* */
     inline void setHumanTurn(bool isHumanTurn) { m_isHumanTurn = isHumanTurn; }
 
+    /* *********************************************************************
+    Function Name: setSeed
+    Purpose: To record the seed the round's boneyard was shuffled with.
+            Used when restoring a round from a save file.
+    Parameters:
+            seed - An unsigned integer seed.
+    Return Value: None
+    Algorithm: Assigns the seed parameter to the m_seed member variable.
+    Reference: None
+    ********************************************************************* */
+    inline void setSeed(unsigned int seed) { m_seed = seed; }
+
+    /* *********************************************************************
+    Function Name: setEngineValue
+    Purpose: To record the pips of the engine. Used when restoring a round
+            from a snapshot.
+    Parameters:
+            pips - An integer pip value.
+    Return Value: None
+    Algorithm: Assigns the pips parameter to the m_engineValue member variable.
+    Reference: None
+    ********************************************************************* */
+    inline void setEngineValue(int pips) { m_engineValue = pips; }
+
+    /* *********************************************************************
+    Function Name: setGameLog
+    Purpose: To attach a game log that every turn played is written to.
+    Parameters:
+            gameLog - A pointer to an open GameLog, or nullptr to stop
+                logging. The round does not take ownership.
+    Return Value: None
+    Algorithm: Assigns the gameLog parameter to the m_gameLog member variable.
+    Reference: None
+    ********************************************************************* */
+    inline void setGameLog(GameLog* gameLog) { m_gameLog = gameLog; }
+
+    /* *********************************************************************
+    Function Name: setStrategy
+    Purpose: To choose the strategy the Computer plays with, made by
+            StrategyRegistry. A round must have one before playRound().
+    Parameters:
+            strategy - A pointer to a ComputerStrategy. The round does not
+                take ownership.
+    Return Value: None
+    Algorithm: Assigns the strategy parameter to the m_strategy member
+            variable.
+    Reference: None
+    ********************************************************************* */
+    inline void setStrategy(ComputerStrategy* strategy) { m_strategy = strategy; }
+
+    /* *********************************************************************
+    Function Name: setOutput
+    Purpose: To choose the stream the round and both players report on.
+    Parameters:
+            output - An ostream passed by reference. Must outlive the
+                round.
+    Return Value: None
+    Algorithm: Stores the stream's address in m_output and passes it to
+            m_human and m_computer.
+    Reference: None
+    ********************************************************************* */
+    inline void setOutput(std::ostream& output) {
+        m_output = &output;
+        m_human.setOutput(output);
+        m_computer.setOutput(output);
+    }
+
     /* *********************************************************************
     Function Name: setTargetScore
     Purpose: To establish the point threshold required to win the tournament.
@@ -358,42 +524,145 @@ public:
     /* *********************************************************************
     Function Name: playRound
     Purpose: Executes the main game loop for this round. Alternates turns
-             until a win condition is met.
-    Parameters: None
-    Return Value: None (void)
+             until a win condition is met. A coroutine: it suspends while
+             waiting for the Human's commands and moves.
+    Parameters:
+             tournament - The Tournament passed by const reference, for
+                 saving and the odds.
+             channel - A TurnChannel passed by reference. Supplies the
+                 Human's words; its FramePool holds the coroutine frames.
+    Return Value: A task giving true if the round was played out, false if
+             the Human saved, quit or the input ended.
     Algorithm:
              1. Loop while checkWinCondition() is false.
              2. Display game state (Layout, Hands, Scores).
-             3. If Human turn: call m_human.playTurn(). Update pass flag.
-             4. If Computer turn: call m_computer.playTurn(). Update pass flag.
+             3. If Human turn: read commands, then await m_human.takeTurn().
+                Update pass flag.
+             4. If Computer turn: call playStrategyTurn(). Update pass flag.
              5. Toggle m_isHumanTurn.
     Reference: None
     ********************************************************************* */
-    void playRound(const Tournament& tournament);
+    Task<bool> playRound(const Tournament& tournament, TurnChannel& channel);
 
     /* *********************************************************************
     Function Name: help
-    Purpose: To provide the human player with a recommended move based on
-            the current hand and layout state. It evaluates legal moves
-            on the player's own side and, if the computer has passed,
-            checks for legal moves on the opponent's side.
+    Purpose: To provide the human player with every legal move, ranked
+            best first, with the points each is expected to gain against
+            the Computer and the chance it wins the round. With no legal
+            move, the choice shown is to draw, or to pass if the
+            boneyard is empty.
     Parameters: None
     Return Value: None (void)
     Algorithm:
-            1. Iterate through each tile in the human player's hand.
-            2. Check if the tile can be legally placed on the LEFT side
-                (the human's standard side).
-            3. If the computer has passed, check if the tile can be
-                legally placed on the RIGHT side (the computer's side).
-            4. If a legal move is found, output the suggestion and exit.
-            5. If no moves are found in the hand:
-                - Suggest drawing if the stock (boneyard) is not empty.
-                - Suggest passing if both the hand and boneyard offer no
-                    options.
+            1. Load the round into a Playout and have m_advisor rank the
+                Human's choices within HELP_MILLISECONDS, or recall the
+                ranking if this position was ranked before.
+            2. Output the best choice as the suggestion, with a reason.
+            3. If there is more than one, list them all in order with
+                their expected points and round win chance.
     Reference: None
     ********************************************************************* */
     void help();
 
+    /* *********************************************************************
+    Function Name: placeEngine
+    Purpose: To locate the engine for the current round and place it on the
+            empty layout, without any output. Also used for a round
+            resumed from a save made before the engine was placed.
+    Parameters: None
+    Return Value: The number of tiles drawn while searching for the engine,
+            0 if a player already held it.
+    Algorithm:
+            1. Calculate the engine value based on the round number
+                (e.g., Round 1 is 6-6, Round 2 is 5-5).
+            2. If the Human, then the Computer, holds the engine, play it and
+                give the next turn to the opponent.
+            3. Otherwise the players draw alternately, Human first, until
+                one of them draws the engine, which is played at once.
+    Reference: None
+    ********************************************************************* */
+    int placeEngine();
+
+    /* *********************************************************************
+    Function Name: showOdds
+    Purpose: To show each side's chance of winning the tournament from the
+            current position.
+    Parameters:
+            tournament, a Tournament passed by const reference. Supplies the
+                scores and target as they stood at the start of the round.
+    Return Value: None (void)
+    Algorithm:
+            1. Run a WinEstimator for half a second on every core.
+            2. Print each probability with its 95% confidence interval.
+    Reference: None
+    ********************************************************************* */
+    void showOdds(const Tournament& tournament) const;
+
+    /* *********************************************************************
+    Function Name: applyPlay
+    Purpose: To play a tile from a player's hand without any prompting or
+            output. Used to replay a recorded move.
+    Parameters:
+            isHuman - A boolean; true to play from the Human's hand.
+            tile - The Tile to play, in either orientation.
+            side - A character, 'L' or 'R', the end of the layout to play on.
+    Return Value: Boolean true if the player held the tile and it fit that end.
+    Algorithm:
+            1. Find the tile in the player's hand.
+            2. Add it to the requested end of the layout, which orients it.
+            3. Remove it from the hand, clear the player's pass flag and
+                hand the turn to the opponent.
+    Reference: None
+    ********************************************************************* */
+    bool applyPlay(bool isHuman, const Tile& tile, char side);
+
+    /* *********************************************************************
+    Function Name: applyDraw
+    Purpose: To move the top tile of the boneyard into a player's hand
+            without any output. The turn does not change, since a player
+            who draws goes on to play or pass.
+    Parameters:
+            isHuman - A boolean; true to draw for the Human.
+            outTile - A Tile passed by reference. Receives the drawn tile.
+    Return Value: Boolean true if the boneyard was not empty.
+    Algorithm:
+            1. Draw the top tile from the stock.
+            2. Add it to the end of the player's hand.
+    Reference: None
+    ********************************************************************* */
+    bool applyDraw(bool isHuman, Tile& outTile);
+
+    /* *********************************************************************
+    Function Name: applyPass
+    Purpose: To record that a player passed, without any output.
+    Parameters:
+            isHuman - A boolean; true if the Human passed.
+    Return Value: None
+    Algorithm:
+            1. Set the player's pass flag.
+            2. Hand the turn to the opponent.
+    Reference: None
+    ********************************************************************* */
+    void applyPass(bool isHuman);
+
+    /* *********************************************************************
+    Function Name: scoreRound
+    Purpose: To check whether the round is over and, if it is, award its
+            points, without any output.
+    Parameters:
+            outHumanPoints, outComputerPoints - Integers passed by reference.
+                Receive the points each player won this round.
+    Return Value: Boolean true if the round has concluded.
+    Algorithm:
+            1. If a hand is empty, its player wins the other hand's pips.
+            2. If the game is blocked (stock empty and both players passed),
+                the player with fewer pips wins the other's; a tie wins
+                nothing.
+            3. Add the points to the players' scores.
+    Reference: None
+    ********************************************************************* */
+    bool scoreRound(int& outHumanPoints, int& outComputerPoints);
+
 private:
     int m_roundNumber;
     int m_tournamentScore;
@@ -408,6 +677,19 @@ private:
     bool m_computerPassed;
     bool m_isHumanTurn;
     int m_engineValue;
+    unsigned int m_seed;
+
+    // Optional log every turn is written to (not owned)
+    GameLog* m_gameLog;
+
+    // The Computer's strategy, set by the tournament (not owned)
+    ComputerStrategy* m_strategy;
+
+    // Ranks and remembers the Human's moves for help()
+    MoveAdvisor m_advisor;
+
+    // Where the round is reported, std::cout unless set (not owned)
+    std::ostream* m_output;
 
     /* *********************************************************************
     Function Name: checkWinCondition
@@ -416,13 +698,10 @@ private:
     Parameters: None
     Return Value: true if the round is over, false otherwise.
     Algorithm:
-             1. Check if Human hand is empty -> Add Computer's pips to Human score -> Return true.
-             2. Check if Computer hand is empty -> Add Human's pips to Computer score -> Return true.
-             3. Check if both players passed and Stock is empty (Block).
-                a. Compare pip totals.
-                b. Winner gets loser's pips (or own + loser's depending on variant).
-                c. Return true.
-             4. Return false.
+             1. Score the round with scoreRound(); stop if it goes on.
+             2. If a hand is empty, announce that its player went out.
+             3. Otherwise the game is "Blocked": show both pip totals and
+                announce who won the block, or a tie.
     Reference: None
     ********************************************************************* */
     bool checkWinCondition();
@@ -443,6 +722,59 @@ private:
     Reference: None
     ********************************************************************* */
     void displayGameState();
+
+    /* *********************************************************************
+    Function Name: reportEngine
+    Purpose: To announce how the engine was placed by placeEngine().
+    Parameters:
+            draws - An integer, the number of tiles drawn to find the engine.
+    Return Value: None
+    Algorithm:
+            1. If no tiles were drawn, announce who held the engine.
+            2. Otherwise list the tiles each player drew, which sit at the end
+                of their hands, followed by the engine itself.
+            3. Announce who found the engine and plays first.
+    Reference: None
+    ********************************************************************* */
+    void reportEngine(int draws) const;
+
+    /* *********************************************************************
+    Function Name: playStrategyTurn
+    Purpose: To play the Computer's turn with m_strategy, explaining the
+            choice.
+    Parameters: None
+    Return Value: Boolean true if a tile was placed, false if the Computer passed.
+    Algorithm:
+            1. Copy the round into a Playout and ask the strategy for a
+                move. If a tile fits, play the one chosen.
+            2. Otherwise draw one tile if the boneyard is not empty and
+                ask again where the drawn tile goes, if anywhere.
+            3. Otherwise pass.
+    Reference: None
+    ********************************************************************* */
+    bool playStrategyTurn();
+
+    /* *********************************************************************
+    Function Name: logTurn
+    Purpose: To write the turn that was just played to the game log, working
+            out what happened by comparing the board with its state before
+            the turn.
+    Parameters:
+            isHuman - A boolean; true if the Human just moved.
+            stockSize - An integer, the size of the boneyard before the turn.
+            topTile - The Tile that was on top of the boneyard before the turn.
+            leftTile - The Tile that was at the left end of the layout before
+                the turn.
+    Return Value: None
+    Algorithm:
+            1. If the boneyard shrank, log a draw of its former top tile.
+            2. If the player passed, log a pass.
+            3. Otherwise, if the left end changed, log a play of the new left
+                tile on the left; if not, log a play of the right tile.
+            4. Flush the log.
+    Reference: None
+    ********************************************************************* */
+    void logTurn(bool isHuman, int stockSize, const Tile& topTile, const Tile& leftTile);
 };
 
 #endif
\ No newline at end of file
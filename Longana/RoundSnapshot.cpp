@@ -0,0 +1,231 @@
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <cstring>
+#include <iostream>
+
+#include "Round.h"
+#include "RoundSnapshot.h"
+#include "Serializer.h"
+
+/* *********************************************************************
+Function Name: RoundSnapshot
+Purpose: Default constructor. Creates the snapshot of an empty round.
+Parameters: None
+Return Value: None
+Algorithm: Zero every member.
+Reference: None
+********************************************************************* */
+RoundSnapshot::RoundSnapshot()
+    : m_roundNumber(0), m_targetScore(0), m_humanScore(0), m_computerScore(0), m_seed(0),
+    m_flags(0), m_counts(), m_tiles()
+{
+}
+
+/* *********************************************************************
+Function Name: setTotals
+Purpose: Replaces the round number, target and scores taken from the
+        round. A Tournament keeps its own totals, which lead the
+        round's between rounds, and saves record those.
+Parameters:
+        roundNumber, targetScore, humanScore, computerScore, integers.
+Return Value: None
+Algorithm: Assign the members.
+Reference: None
+********************************************************************* */
+void RoundSnapshot::setTotals(int roundNumber, int targetScore, int humanScore, int computerScore) {
+    m_roundNumber = roundNumber;
+    m_targetScore = targetScore;
+    m_humanScore = humanScore;
+    m_computerScore = computerScore;
+}
+
+/* *********************************************************************
+Function Name: capture
+Purpose: Records the state of a round.
+Parameters:
+        round, a Round object passed by const reference.
+Return Value: Boolean true on success; false, leaving the snapshot
+        unchanged, if the round holds more than MAX_TILES tiles.
+Algorithm:
+        1. Check the total number of tiles.
+        2. Copy the round number, target, scores, seed and turn flags.
+        3. Copy the tiles of each section in order.
+Reference: None
+********************************************************************* */
+bool RoundSnapshot::capture(const Round& round) {
+    const Hand& computerHand = round.getComputerHand();
+    const Hand& humanHand = round.getHumanHand();
+    const Layout& layout = round.getLayout();
+    const Stock& stock = round.getStock();
+
+    // 1. The tiles must fit
+    int total = computerHand.getSize() + humanHand.getSize() + layout.getSize() + stock.getSize();
+    if (total > MAX_TILES) {
+        std::cerr << "Error: A round with " << total << " tiles does not fit in a snapshot." << std::endl;
+        return false;
+    }
+
+    // 2. Everything but the tiles
+    m_roundNumber = round.getRoundNumber();
+    m_targetScore = round.getTargetScore();
+    m_humanScore = round.getHumanScore();
+    m_computerScore = round.getComputerScore();
+    m_seed = round.getSeed();
+    m_flags = static_cast<unsigned char>((round.getHumanPassed() ? 1 : 0)
+        | (round.getComputerPassed() ? 2 : 0)
+        | (round.isHumanTurn() ? 4 : 0));
+
+    // 3. The tiles, section by section
+    m_counts[0] = static_cast<unsigned char>(computerHand.getSize());
+    m_counts[1] = static_cast<unsigned char>(humanHand.getSize());
+    m_counts[2] = static_cast<unsigned char>(layout.getSize());
+    m_counts[3] = static_cast<unsigned char>(stock.getSize());
+
+    unsigned char* tiles = m_tiles;
+    for (int i = 0; i < computerHand.getSize(); ++i) { *tiles++ = encodeTile(computerHand.getTileAtIndex(i)); }
+    for (int i = 0; i < humanHand.getSize(); ++i) { *tiles++ = encodeTile(humanHand.getTileAtIndex(i)); }
+    for (int i = 0; i < layout.getSize(); ++i) { *tiles++ = encodeTile(layout.getTileAtIndex(i)); }
+    for (int i = 0; i < stock.getSize(); ++i) { *tiles++ = encodeTile(stock.getTileAtIndex(i)); }
+
+    // Unused bytes stay zero, so equal rounds give byte-for-byte equal snapshots
+    while (tiles != m_tiles + MAX_TILES) {
+        *tiles++ = 0;
+    }
+
+    return true;
+}
+
+/* *********************************************************************
+Function Name: restore
+Purpose: Puts a round back into the recorded state.
+Parameters:
+        round, a Round object passed by reference. Its game log is
+            left as it is.
+Return Value: None
+Algorithm:
+        1. Restore the round number, target, scores, seed and turn
+            flags, and the engine, which follows from the round number.
+        2. Rebuild both hands, the layout and the boneyard in order.
+Reference: None
+********************************************************************* */
+void RoundSnapshot::restore(Round& round) const {
+    // 1. Everything but the tiles
+    round.setRoundNumber(m_roundNumber);
+    round.setTargetScore(m_targetScore);
+    round.setScores(m_humanScore, m_computerScore);
+    round.setSeed(m_seed);
+    round.setHumanPassed((m_flags & 1) != 0);
+    round.setComputerPassed((m_flags & 2) != 0);
+    round.setHumanTurn((m_flags & 4) != 0);
+    round.setEngineValue(StandardSet::getEngine(m_roundNumber));
+
+    // 2. The tiles, section by section
+    const unsigned char* tiles = m_tiles;
+
+    round.getComputerHand().clearHand();
+    for (int i = 0; i < m_counts[0]; ++i) { round.getComputerHand().addTile(decodeTile(*tiles++)); }
+
+    round.getHumanHand().clearHand();
+    for (int i = 0; i < m_counts[1]; ++i) { round.getHumanHand().addTile(decodeTile(*tiles++)); }
+
+    round.getLayout().clearLayout();
+    for (int i = 0; i < m_counts[2]; ++i) { round.getLayout().appendTile(decodeTile(*tiles++)); }
+
+    round.getStock().clearStock();
+    for (int i = 0; i < m_counts[3]; ++i) { round.getStock().addTile(decodeTile(*tiles++)); }
+}
+
+/* *********************************************************************
+Function Name: encode
+Purpose: Writes the snapshot as the body of a binary save.
+Parameters:
+        out, a pointer to at least ENCODED_SIZE bytes of storage.
+Return Value: None (void)
+Algorithm: Layout, from out, with all integers little-endian:
+            0  flags (1 = Human passed, 2 = Computer passed, 4 = Human's turn)
+            1  round number (16 bits)
+            3  target score, Human score, Computer score (32 bits each)
+            15 boneyard shuffle seed (32 bits)
+            19 tile counts: Computer hand, Human hand, layout, boneyard
+            23 tiles in that order, padded with zeros to MAX_TILES bytes
+Reference: None
+********************************************************************* */
+void RoundSnapshot::encode(unsigned char* out) const {
+    out[0] = m_flags;
+    Serializer::putInt16(out + 1, static_cast<uint32_t>(m_roundNumber));
+    Serializer::putInt32(out + 3, static_cast<uint32_t>(m_targetScore));
+    Serializer::putInt32(out + 7, static_cast<uint32_t>(m_humanScore));
+    Serializer::putInt32(out + 11, static_cast<uint32_t>(m_computerScore));
+    Serializer::putInt32(out + 15, m_seed);
+    std::memcpy(out + 19, m_counts, sizeof(m_counts));
+    std::memcpy(out + 23, m_tiles, sizeof(m_tiles));
+}
+
+/* *********************************************************************
+Function Name: decode
+Purpose: Reads a snapshot written by encode().
+Parameters:
+        in, a pointer to ENCODED_SIZE bytes.
+Return Value: Boolean true on success; false, leaving the snapshot
+        unchanged, if the tile counts do not fit in one set or a tile
+        is invalid or appears twice.
+Algorithm:
+        1. Check the counts and every tile byte.
+        2. Read the fields and copy the tile bytes.
+Reference: None
+********************************************************************* */
+bool RoundSnapshot::decode(const unsigned char* in) {
+    // 1. The tiles must fit and be distinct
+    int total = in[19] + in[20] + in[21] + in[22];
+    if (total > MAX_TILES) {
+        return false;
+    }
+
+    StandardSet::Mask seen = 0;
+    for (int i = 0; i < total; ++i) {
+        int index = in[23 + i] & 0x7F;
+        if (index >= Tile::TILE_COUNT || (seen & StandardSet::getBit(index))) {
+            return false;
+        }
+        seen |= StandardSet::getBit(index);
+    }
+
+    // 2. The fields and tiles
+    m_flags = in[0];
+    m_roundNumber = static_cast<int32_t>(Serializer::getInt16(in + 1));
+    m_targetScore = static_cast<int32_t>(Serializer::getInt32(in + 3));
+    m_humanScore = static_cast<int32_t>(Serializer::getInt32(in + 7));
+    m_computerScore = static_cast<int32_t>(Serializer::getInt32(in + 11));
+    m_seed = Serializer::getInt32(in + 15);
+    std::memcpy(m_counts, in + 19, sizeof(m_counts));
+    std::memcpy(m_tiles, in + 23, sizeof(m_tiles));
+
+    return true;
+}
+
+/* *********************************************************************
+Function Name: encodeTile / decodeTile
+Purpose: Convert between a Tile and its one-byte form.
+Parameters:
+        tile, the Tile to encode; or code, the byte to decode.
+Return Value: The encoded byte, or the decoded Tile.
+Algorithm: Use Tile::getIndex()/Tile::fromIndex() and flip the tile
+        when the orientation bit is set.
+Reference: None
+********************************************************************* */
+unsigned char RoundSnapshot::encodeTile(const Tile& tile) {
+    int code = tile.getIndex();
+    if (tile.getLeftPips() > tile.getRightPips()) { code |= 0x80; }
+    return static_cast<unsigned char>(code);
+}
+
+Tile RoundSnapshot::decodeTile(unsigned char code) {
+    Tile tile = Tile::fromIndex(code & 0x7F);
+    if (code & 0x80) { tile.flipTile(); }
+    return tile;
+}
\ No newline at end of file
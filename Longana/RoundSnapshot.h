@@ -0,0 +1,206 @@
+#ifndef ROUNDSNAPSHOT_H
+#define ROUNDSNAPSHOT_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <cstdint>
+#include <type_traits>
+
+#include "DominoSet.h"
+#include "Tile.h"
+
+class Round;
+
+/* *********************************************************************
+Class Name: RoundSnapshot
+Purpose: The complete state of a Round in one flat block of at most 64
+        bytes, with no pointers and no heap storage. A Round keeps its
+        hands, boneyard and layout in vectors and a deque, so copying one
+        allocates; a snapshot is copied with a plain assignment or memcpy.
+        capture() and restore() convert to and from a Round without losing
+        anything but the game log, which is not part of the position.
+
+        The snapshot is the body of the binary save: encode() writes it as
+        ENCODED_SIZE little-endian bytes, which Serializer wraps in the
+        magic, version and checksum. Tiles are kept in that byte form
+        (Tile::getIndex(), plus 0x80 when the left pips exceed the right
+        pips) in the order of the save: the Computer's hand, the Human's
+        hand, the layout from left to right, then the boneyard from the top.
+********************************************************************* */
+class RoundSnapshot {
+public:
+
+    // A snapshot holds at most one set of tiles
+    static const int MAX_TILES = StandardSet::TILE_COUNT;
+
+    // Bytes written by encode(): flags, round number, target, scores, seed,
+    // the four tile counts and MAX_TILES tile bytes
+    static const int ENCODED_SIZE = 23 + MAX_TILES;
+
+    /* --- Constructor --- */
+
+    /* *********************************************************************
+    Function Name: RoundSnapshot
+    Purpose: Default constructor. Creates the snapshot of an empty round.
+    Parameters: None
+    Return Value: None
+    Algorithm: Zero every member.
+    Reference: None
+    ********************************************************************* */
+    RoundSnapshot();
+
+    /* --- Destructor --- */
+
+    /* *********************************************************************
+    Function Name: ~RoundSnapshot
+    Purpose: Destructor. Defaulted so the snapshot stays trivially copyable.
+    Parameters: None
+    Return Value: None
+    Algorithm: Standard object destruction.
+    Reference: None
+    ********************************************************************* */
+    ~RoundSnapshot() = default;
+
+    /* --- Selectors --- */
+
+    /* *********************************************************************
+    Function Name: getRoundNumber / getTargetScore / getHumanScore /
+            getComputerScore
+    Purpose: Return the recorded round number, target and scores.
+    Parameters: None
+    Return Value: An integer.
+    Algorithm: Return the member.
+    Reference: None
+    ********************************************************************* */
+    inline int getRoundNumber() const { return m_roundNumber; }
+    inline int getTargetScore() const { return m_targetScore; }
+    inline int getHumanScore() const { return m_humanScore; }
+    inline int getComputerScore() const { return m_computerScore; }
+
+    /* *********************************************************************
+    Function Name: getTileCount
+    Purpose: Counts the tiles held in the snapshot.
+    Parameters: None
+    Return Value: An integer between 0 and MAX_TILES.
+    Algorithm: Sum the four section counts.
+    Reference: None
+    ********************************************************************* */
+    inline int getTileCount() const { return m_counts[0] + m_counts[1] + m_counts[2] + m_counts[3]; }
+
+    /* --- Mutators --- */
+
+    /* *********************************************************************
+    Function Name: setTotals
+    Purpose: Replaces the round number, target and scores taken from the
+            round. A Tournament keeps its own totals, which lead the
+            round's between rounds, and saves record those.
+    Parameters:
+            roundNumber, targetScore, humanScore, computerScore, integers.
+    Return Value: None
+    Algorithm: Assign the members.
+    Reference: None
+    ********************************************************************* */
+    void setTotals(int roundNumber, int targetScore, int humanScore, int computerScore);
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: capture
+    Purpose: Records the state of a round.
+    Parameters:
+            round, a Round object passed by const reference.
+    Return Value: Boolean true on success; false, leaving the snapshot
+            unchanged, if the round holds more than MAX_TILES tiles.
+    Algorithm:
+            1. Check the total number of tiles.
+            2. Copy the round number, target, scores, seed and turn flags.
+            3. Copy the tiles of each section in order.
+    Reference: None
+    ********************************************************************* */
+    bool capture(const Round& round);
+
+    /* *********************************************************************
+    Function Name: restore
+    Purpose: Puts a round back into the recorded state.
+    Parameters:
+            round, a Round object passed by reference. Its game log is
+                left as it is.
+    Return Value: None
+    Algorithm:
+            1. Restore the round number, target, scores, seed and turn
+                flags, and the engine, which follows from the round number.
+            2. Rebuild both hands, the layout and the boneyard in order.
+    Reference: None
+    ********************************************************************* */
+    void restore(Round& round) const;
+
+    /* *********************************************************************
+    Function Name: encode
+    Purpose: Writes the snapshot as the body of a binary save.
+    Parameters:
+            out, a pointer to at least ENCODED_SIZE bytes of storage.
+    Return Value: None (void)
+    Algorithm: Layout, from out, with all integers little-endian:
+                0  flags (1 = Human passed, 2 = Computer passed, 4 = Human's turn)
+                1  round number (16 bits)
+                3  target score, Human score, Computer score (32 bits each)
+                15 boneyard shuffle seed (32 bits)
+                19 tile counts: Computer hand, Human hand, layout, boneyard
+                23 tiles in that order, padded with zeros to MAX_TILES bytes
+    Reference: None
+    ********************************************************************* */
+    void encode(unsigned char* out) const;
+
+    /* *********************************************************************
+    Function Name: decode
+    Purpose: Reads a snapshot written by encode().
+    Parameters:
+            in, a pointer to ENCODED_SIZE bytes.
+    Return Value: Boolean true on success; false, leaving the snapshot
+            unchanged, if the tile counts do not fit in one set or a tile
+            is invalid or appears twice.
+    Algorithm:
+            1. Check the counts and every tile byte.
+            2. Read the fields and copy the tile bytes.
+    Reference: None
+    ********************************************************************* */
+    bool decode(const unsigned char* in);
+
+    /* *********************************************************************
+    Function Name: encodeTile / decodeTile
+    Purpose: Convert between a Tile and its one-byte form.
+    Parameters:
+            tile, the Tile to encode; or code, the byte to decode.
+    Return Value: The encoded byte, or the decoded Tile.
+    Algorithm: Use Tile::getIndex()/Tile::fromIndex() and flip the tile
+            when the orientation bit is set.
+    Reference: None
+    ********************************************************************* */
+    static unsigned char encodeTile(const Tile& tile);
+    static Tile decodeTile(unsigned char code);
+
+private:
+
+    int32_t m_roundNumber;
+    int32_t m_targetScore;
+    int32_t m_humanScore;
+    int32_t m_computerScore;
+    uint32_t m_seed;
+
+    // Bit 0: the Human passed; bit 1: the Computer passed; bit 2: the Human's turn
+    unsigned char m_flags;
+
+    // Tiles in the Computer's hand, the Human's hand, the layout and the boneyard
+    unsigned char m_counts[4];
+    unsigned char m_tiles[MAX_TILES];
+};
+
+static_assert(std::is_trivially_copyable_v<RoundSnapshot>, "A RoundSnapshot must copy as plain bytes");
+static_assert(sizeof(RoundSnapshot) <= 64, "A RoundSnapshot must fit in one cache line");
+
+#endif
\ No newline at end of file
@@ -0,0 +1,333 @@
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <charconv>
+#include <string>
+#include <string_view>
+
+#include "SaveParser.h"
+#include "Tournament.h"
+
+/* *********************************************************************
+Function Name: SaveParser
+Purpose: Constructor. Prepares the parser to scan the given text.
+Parameters:
+        buffer, a std::string_view passed by value. The complete
+            contents of a save file. The caller must keep the
+            underlying characters alive while parse() runs.
+Return Value: None
+Algorithm:
+        1. Store the view of the buffer.
+        2. Position the cursor at the start of the first line.
+        3. Clear the error state.
+Reference: None
+********************************************************************* */
+SaveParser::SaveParser(std::string_view buffer)
+    : m_buffer(buffer), m_position(0), m_line(), m_lineStart(0), m_lineNumber(0),
+    m_errorLine(0), m_errorColumn(0), m_errorMessage("")
+{
+}
+
+/* *********************************************************************
+Function Name: parse
+Purpose: Parses the whole buffer and reconstructs the tournament state.
+Parameters:
+        tournament, a Tournament object passed by reference. Populated
+            with the scores, hands, layout, boneyard and turn flags.
+Return Value: Boolean true if the buffer was parsed successfully; false
+        otherwise, in which case the error selectors describe the problem.
+Algorithm:
+        1. Visit each line of the buffer, skipping blank lines.
+        2. Match the line against the known entries ("Tournament Score:",
+            "Round No.:", "Computer:", "Human:", "Hand:", "Score:",
+            "Strategy:", "Layout:", "Boneyard:", "Previous Player Passed:",
+            "Next Player:").
+        3. Parse the value of the entry in place and store it in the
+            tournament, delegating tile lists to Hand, Layout and Stock.
+        4. Fail with the position of the offending text on any
+            unrecognized entry or malformed value.
+        5. Apply the turn flags to the round once all lines are read.
+Reference: None
+********************************************************************* */
+bool SaveParser::parse(Tournament& tournament) {
+    Round& round = tournament.getCurrentRound();
+
+    // The player section ("Computer:" or "Human:") that Hand and Score lines belong to
+    enum class Section { None, Computer, Human };
+    Section section = Section::None;
+
+    // Temporary storage of turn flags
+    bool previousPassed = false;
+    bool isHumanTurn = true;
+
+    while (nextLine()) {
+        std::string_view line = trim(m_line);
+        std::string_view rest;
+        int value = 0;
+        size_t errorOffset = 0;
+
+        // Skip empty lines
+        if (line.empty()) { continue; }
+
+        // --- Parse Tournament Data ---
+        if (matchKey(line, "Tournament Score:", rest)) {
+            if (!parseInteger(rest, value)) { return false; }
+            tournament.setTargetScore(value);
+        }
+        // --- Parse Round Data ---
+        else if (matchKey(line, "Round No.:", rest)) {
+            if (!parseInteger(rest, value)) { return false; }
+            tournament.setRoundNumber(value);
+            round.setRoundNumber(value);
+        }
+        // --- Context Switching ---
+        else if (line == "Computer:") {
+            section = Section::Computer;
+        }
+        else if (line == "Human:") {
+            section = Section::Human;
+        }
+        // --- Parse Hand Data ---
+        else if (matchKey(line, "Hand:", rest)) {
+            if (section == Section::None) {
+                return fail(line, "Hand entry must follow 'Computer:' or 'Human:'");
+            }
+
+            Hand& hand = (section == Section::Computer) ? round.getComputerHand() : round.getHumanHand();
+            if (!hand.loadFromString(rest, errorOffset)) {
+                return fail(rest.substr(errorOffset), "Malformed tile in hand");
+            }
+        }
+        // --- Parse Scores ---
+        else if (matchKey(line, "Score:", rest)) {
+            if (section == Section::None) {
+                return fail(line, "Score entry must follow 'Computer:' or 'Human:'");
+            }
+            if (!parseInteger(rest, value)) { return false; }
+
+            if (section == Section::Computer) {
+                tournament.setComputerScore(value);
+            }
+            else {
+                tournament.setHumanScore(value);
+            }
+        }
+        // --- Parse the Computer's Strategy ---
+        else if (matchKey(line, "Strategy:", rest)) {
+            if (section != Section::Computer) {
+                return fail(line, "Strategy entry must follow 'Computer:'");
+            }
+            if (!tournament.setStrategy(std::string(rest))) {
+                return fail(rest, "Unknown strategy or strategy option");
+            }
+        }
+        // --- Parse Board Layout ---
+        else if (matchKey(line, "Layout:", rest)) {
+            std::string_view layoutData;
+            if (!tileData(rest, layoutData)) {
+                return fail(line.substr(line.size()), "Expected layout tiles after 'Layout:'");
+            }
+            if (!round.getLayout().loadFromString(layoutData, errorOffset)) {
+                return fail(layoutData.substr(errorOffset), "Malformed tile in layout");
+            }
+        }
+        else if (matchKey(line, "Boneyard:", rest)) {
+            std::string_view boneyardData;
+            if (!tileData(rest, boneyardData)) {
+                return fail(line.substr(line.size()), "Expected boneyard tiles after 'Boneyard:'");
+            }
+            if (!round.getStock().loadFromString(boneyardData, errorOffset)) {
+                return fail(boneyardData.substr(errorOffset), "Malformed tile in boneyard");
+            }
+        }
+        // --- Parse Turn Flags ---
+        else if (matchKey(line, "Previous Player Passed:", rest)) {
+            // An empty value is written before the first move of a round
+            if (rest != "Yes" && rest != "No" && !rest.empty()) {
+                return fail(rest, "Expected 'Yes' or 'No'");
+            }
+            previousPassed = (rest == "Yes");
+        }
+        else if (matchKey(line, "Next Player:", rest)) {
+            if (rest != "Human" && rest != "Computer" && !rest.empty()) {
+                return fail(rest, "Expected 'Human' or 'Computer'");
+            }
+            isHumanTurn = (rest == "Human");
+            round.setHumanTurn(isHumanTurn);
+        }
+        else {
+            return fail(line, "Unrecognized entry");
+        }
+    }
+
+    // The pass flag belongs to whoever moved last, the opponent of the next player
+    if (isHumanTurn) {
+        tournament.setComputerPassed(previousPassed);
+        tournament.setHumanPassed(false);
+    }
+    else {
+        tournament.setHumanPassed(previousPassed);
+        tournament.setComputerPassed(false);
+    }
+
+    tournament.setIsResumed(true);
+
+    return true;
+}
+
+/* *********************************************************************
+Function Name: nextLine
+Purpose: Advances the cursor to the next line of the buffer.
+Parameters: None
+Return Value: Boolean true if a line was read, false at the end of the buffer.
+Algorithm:
+        1. Return false if the cursor is at the end of the buffer.
+        2. Find the next newline and slice the line up to it.
+        3. Drop a trailing carriage return so Windows line endings parse.
+        4. Update the line number and move the cursor past the newline.
+Reference: None
+********************************************************************* */
+bool SaveParser::nextLine() {
+    if (m_position >= m_buffer.size()) {
+        return false;
+    }
+
+    size_t end = m_buffer.find('\n', m_position);
+    if (end == std::string_view::npos) { end = m_buffer.size(); }
+
+    m_lineStart = m_position;
+    m_line = m_buffer.substr(m_position, end - m_position);
+    if (!m_line.empty() && m_line.back() == '\r') {
+        m_line.remove_suffix(1);
+    }
+
+    ++m_lineNumber;
+    m_position = end + 1;
+    return true;
+}
+
+/* *********************************************************************
+Function Name: fail
+Purpose: Records a parsing error at the position of the given text.
+Parameters:
+        at, a std::string_view passed by value. A slice of the current
+            line pointing at the offending characters.
+        message, a constant C string describing the error.
+Return Value: Boolean false, so callers can write "return fail(...)".
+Algorithm:
+        1. Store the current line number.
+        2. Compute the column from the distance between the slice and
+            the start of the line.
+        3. Store the message and return false.
+Reference: None
+********************************************************************* */
+bool SaveParser::fail(std::string_view at, const char* message) {
+    m_errorLine = m_lineNumber;
+    m_errorColumn = static_cast<int>(at.data() - (m_buffer.data() + m_lineStart)) + 1;
+    m_errorMessage = message;
+    return false;
+}
+
+/* *********************************************************************
+Function Name: parseInteger
+Purpose: Converts a trimmed slice of the line into an integer.
+Parameters:
+        text, a std::string_view passed by value. The value to convert.
+        value, an integer passed by reference. Receives the result.
+Return Value: Boolean true if the whole slice is a valid integer.
+Algorithm:
+        1. Convert the slice with std::from_chars.
+        2. Fail unless the conversion consumed every character.
+Reference: C++ Standard Library Documentation for std::from_chars
+********************************************************************* */
+bool SaveParser::parseInteger(std::string_view text, int& value) {
+    const char* last = text.data() + text.size();
+    std::from_chars_result result = std::from_chars(text.data(), last, value);
+
+    if (text.empty() || result.ec != std::errc() || result.ptr != last) {
+        return fail(text, "Expected an integer");
+    }
+
+    return true;
+}
+
+/* *********************************************************************
+Function Name: tileData
+Purpose: Locates the tile list that belongs to a "Layout:" or
+        "Boneyard:" heading. The list normally sits on the next line,
+        but it is also accepted on the heading line itself.
+Parameters:
+        rest, a std::string_view passed by value. The remainder of the
+            heading line after the key.
+        outData, a std::string_view passed by reference. Receives the
+            tile list.
+Return Value: Boolean true if a tile list was found, false at the end
+        of the buffer.
+Algorithm:
+        1. If the remainder of the heading line is not blank, use it.
+        2. Otherwise read the next line and use it, even if blank.
+Reference: None
+********************************************************************* */
+bool SaveParser::tileData(std::string_view rest, std::string_view& outData) {
+    if (!rest.empty()) {
+        outData = rest;
+        return true;
+    }
+
+    if (!nextLine()) {
+        return false;
+    }
+
+    outData = trim(m_line);
+    return true;
+}
+
+/* *********************************************************************
+Function Name: trim
+Purpose: Removes leading and trailing spaces, tabs and carriage
+        returns from a slice without copying it.
+Parameters:
+        text, a std::string_view passed by value.
+Return Value: The trimmed std::string_view.
+Algorithm:
+        1. Advance the start past leading whitespace.
+        2. Retreat the end past trailing whitespace.
+Reference: None
+********************************************************************* */
+std::string_view SaveParser::trim(std::string_view text) {
+    size_t first = text.find_first_not_of(" \t\r");
+    if (first == std::string_view::npos) {
+        return text.substr(text.size());
+    }
+
+    size_t last = text.find_last_not_of(" \t\r");
+    return text.substr(first, last - first + 1);
+}
+
+/* *********************************************************************
+Function Name: matchKey
+Purpose: Checks whether a line begins with the given key and, if so,
+        returns the trimmed remainder of the line.
+Parameters:
+        line, a std::string_view passed by value. The trimmed line.
+        key, a std::string_view passed by value. The expected key.
+        outRest, a std::string_view passed by reference. Receives the
+            trimmed text after the key.
+Return Value: Boolean true if the line begins with the key.
+Algorithm:
+        1. Compare the start of the line with the key.
+        2. If they match, trim the remainder into outRest.
+Reference: None
+********************************************************************* */
+bool SaveParser::matchKey(std::string_view line, std::string_view key, std::string_view& outRest) {
+    if (line.substr(0, key.size()) != key) {
+        return false;
+    }
+
+    outRest = trim(line.substr(key.size()));
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,229 @@
+#ifndef SAVEPARSER_H
+#define SAVEPARSER_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <cstddef>
+#include <string_view>
+
+#include "Tournament.h"
+
+/* *********************************************************************
+Class Name: SaveParser
+Purpose: Scans the text of a saved game that has already been read into
+        memory and populates a Tournament from it. The parser works
+        entirely on std::string_view slices of the caller's buffer and
+        converts numbers with std::from_chars, so loading a save does not
+        allocate per line or per token. When the text is malformed, the
+        parser records the line and column of the offending characters.
+********************************************************************* */
+class SaveParser {
+public:
+
+    /* --- Constructor --- */
+
+    /* *********************************************************************
+    Function Name: SaveParser
+    Purpose: Constructor. Prepares the parser to scan the given text.
+    Parameters:
+            buffer, a std::string_view passed by value. The complete
+                contents of a save file. The caller must keep the
+                underlying characters alive while parse() runs.
+    Return Value: None
+    Algorithm:
+            1. Store the view of the buffer.
+            2. Position the cursor at the start of the first line.
+            3. Clear the error state.
+    Reference: None
+    ********************************************************************* */
+    explicit SaveParser(std::string_view buffer);
+
+    /* --- Destructor --- */
+
+    /* *********************************************************************
+    Function Name: ~SaveParser
+    Purpose: Destructor. The parser does not own the buffer, so nothing
+            needs to be released.
+    Parameters: None
+    Return Value: None
+    Algorithm: Standard object destruction.
+    Reference: None
+    ********************************************************************* */
+    ~SaveParser() = default;
+
+    /* --- Selectors --- */
+
+    /* *********************************************************************
+    Function Name: getErrorLine
+    Purpose: Retrieves the 1-based line number where parsing failed.
+    Parameters: None
+    Return Value: An integer line number, or 0 if no error occurred.
+    Algorithm: Return m_errorLine.
+    Reference: None
+    ********************************************************************* */
+    inline int getErrorLine() const { return m_errorLine; }
+
+    /* *********************************************************************
+    Function Name: getErrorColumn
+    Purpose: Retrieves the 1-based column where parsing failed.
+    Parameters: None
+    Return Value: An integer column number, or 0 if no error occurred.
+    Algorithm: Return m_errorColumn.
+    Reference: None
+    ********************************************************************* */
+    inline int getErrorColumn() const { return m_errorColumn; }
+
+    /* *********************************************************************
+    Function Name: getErrorMessage
+    Purpose: Retrieves a description of the parsing failure.
+    Parameters: None
+    Return Value: A constant C string. Empty if no error occurred.
+    Algorithm: Return m_errorMessage.
+    Reference: None
+    ********************************************************************* */
+    inline const char* getErrorMessage() const { return m_errorMessage; }
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: parse
+    Purpose: Parses the whole buffer and reconstructs the tournament state.
+    Parameters:
+            tournament, a Tournament object passed by reference. Populated
+                with the scores, hands, layout, boneyard and turn flags.
+    Return Value: Boolean true if the buffer was parsed successfully; false
+            otherwise, in which case the error selectors describe the problem.
+    Algorithm:
+            1. Visit each line of the buffer, skipping blank lines.
+            2. Match the line against the known entries ("Tournament Score:",
+                "Round No.:", "Computer:", "Human:", "Hand:", "Score:",
+                "Strategy:", "Layout:", "Boneyard:", "Previous Player Passed:",
+                "Next Player:").
+            3. Parse the value of the entry in place and store it in the
+                tournament, delegating tile lists to Hand, Layout and Stock.
+            4. Fail with the position of the offending text on any
+                unrecognized entry or malformed value.
+            5. Apply the turn flags to the round once all lines are read.
+    Reference: None
+    ********************************************************************* */
+    bool parse(Tournament& tournament);
+
+private:
+
+    // The text being parsed and the offset of the next unread line
+    std::string_view m_buffer;
+    size_t m_position;
+
+    // The current line, its offset within the buffer, and its line number
+    std::string_view m_line;
+    size_t m_lineStart;
+    int m_lineNumber;
+
+    // Location and description of the first error encountered
+    int m_errorLine;
+    int m_errorColumn;
+    const char* m_errorMessage;
+
+    /* *********************************************************************
+    Function Name: nextLine
+    Purpose: Advances the cursor to the next line of the buffer.
+    Parameters: None
+    Return Value: Boolean true if a line was read, false at the end of the buffer.
+    Algorithm:
+            1. Return false if the cursor is at the end of the buffer.
+            2. Find the next newline and slice the line up to it.
+            3. Drop a trailing carriage return so Windows line endings parse.
+            4. Update the line number and move the cursor past the newline.
+    Reference: None
+    ********************************************************************* */
+    bool nextLine();
+
+    /* *********************************************************************
+    Function Name: fail
+    Purpose: Records a parsing error at the position of the given text.
+    Parameters:
+            at, a std::string_view passed by value. A slice of the current
+                line pointing at the offending characters.
+            message, a constant C string describing the error.
+    Return Value: Boolean false, so callers can write "return fail(...)".
+    Algorithm:
+            1. Store the current line number.
+            2. Compute the column from the distance between the slice and
+                the start of the line.
+            3. Store the message and return false.
+    Reference: None
+    ********************************************************************* */
+    bool fail(std::string_view at, const char* message);
+
+    /* *********************************************************************
+    Function Name: parseInteger
+    Purpose: Converts a trimmed slice of the line into an integer.
+    Parameters:
+            text, a std::string_view passed by value. The value to convert.
+            value, an integer passed by reference. Receives the result.
+    Return Value: Boolean true if the whole slice is a valid integer.
+    Algorithm:
+            1. Convert the slice with std::from_chars.
+            2. Fail unless the conversion consumed every character.
+    Reference: C++ Standard Library Documentation for std::from_chars
+    ********************************************************************* */
+    bool parseInteger(std::string_view text, int& value);
+
+    /* *********************************************************************
+    Function Name: tileData
+    Purpose: Locates the tile list that belongs to a "Layout:" or
+            "Boneyard:" heading. The list normally sits on the next line,
+            but it is also accepted on the heading line itself.
+    Parameters:
+            rest, a std::string_view passed by value. The remainder of the
+                heading line after the key.
+            outData, a std::string_view passed by reference. Receives the
+                tile list.
+    Return Value: Boolean true if a tile list was found, false at the end
+            of the buffer.
+    Algorithm:
+            1. If the remainder of the heading line is not blank, use it.
+            2. Otherwise read the next line and use it, even if blank.
+    Reference: None
+    ********************************************************************* */
+    bool tileData(std::string_view rest, std::string_view& outData);
+
+    /* *********************************************************************
+    Function Name: trim
+    Purpose: Removes leading and trailing spaces, tabs and carriage
+            returns from a slice without copying it.
+    Parameters:
+            text, a std::string_view passed by value.
+    Return Value: The trimmed std::string_view.
+    Algorithm:
+            1. Advance the start past leading whitespace.
+            2. Retreat the end past trailing whitespace.
+    Reference: None
+    ********************************************************************* */
+    static std::string_view trim(std::string_view text);
+
+    /* *********************************************************************
+    Function Name: matchKey
+    Purpose: Checks whether a line begins with the given key and, if so,
+            returns the trimmed remainder of the line.
+    Parameters:
+            line, a std::string_view passed by value. The trimmed line.
+            key, a std::string_view passed by value. The expected key.
+            outRest, a std::string_view passed by reference. Receives the
+                trimmed text after the key.
+    Return Value: Boolean true if the line begins with the key.
+    Algorithm:
+            1. Compare the start of the line with the key.
+            2. If they match, trim the remainder into outRest.
+    Reference: None
+    ********************************************************************* */
+    static bool matchKey(std::string_view line, std::string_view key, std::string_view& outRest);
+
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,125 @@
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <cstdio>
+#include <string>
+
+#include "SearchStrategy.h"
+
+/* *********************************************************************
+Function Name: SearchStrategy
+Purpose: Constructor. Prepares a search with no tablebase or evaluator.
+Parameters:
+        milliseconds, an integer time budget per search.
+        isTableOnly, a boolean. True to search only positions in the
+            tablebase.
+Return Value: None
+Algorithm: Store the parameters and clear the flags.
+Reference: None
+********************************************************************* */
+SearchStrategy::SearchStrategy(int milliseconds, bool isTableOnly)
+    : m_milliseconds(milliseconds), m_isTableOnly(isTableOnly), m_hasTablebase(false), m_isFallback(false)
+{
+}
+
+/* *********************************************************************
+Function Name: openTablebase / loadEvaluator
+Purpose: Attach an endgame tablebase or a learned evaluator to the
+        search from a file.
+Parameters:
+        filename, a string representing the file path.
+Return Value: Boolean true on success; false, with an error message
+        from the file's class, otherwise.
+Algorithm: Open the file into the member and attach it to the search.
+Reference: None
+********************************************************************* */
+bool SearchStrategy::openTablebase(const std::string& filename) {
+    if (!m_tablebase.open(filename)) {
+        return false;
+    }
+    m_hasTablebase = true;
+    m_search.setTablebase(&m_tablebase);
+    return true;
+}
+
+bool SearchStrategy::loadEvaluator(const std::string& filename) {
+    if (!m_evaluator.load(filename)) {
+        return false;
+    }
+    m_search.setEvaluator(&m_evaluator);
+    return true;
+}
+
+/* *********************************************************************
+Function Name: chooseMove
+Purpose: Chooses the mover's move.
+Parameters:
+        position, outIndex, outArm. As for ComputerStrategy.
+Return Value: Boolean true if any tile can be played.
+Algorithm:
+        1. In table-only mode, play first-fit unless the boneyard is
+            empty and the tablebase holds the position.
+        2. Otherwise search for the budget and play the best move.
+Reference: None
+********************************************************************* */
+bool SearchStrategy::chooseMove(const Playout& position, int& outIndex, int& outArm) {
+    // 1. First-fit where the table does not reach
+    m_isFallback = m_isTableOnly
+        && (!m_hasTablebase || position.getBoneyardSize() > 0 || !m_tablebase.contains(position));
+    if (m_isFallback) {
+        return m_fallback.chooseMove(position, outIndex, outArm);
+    }
+
+    // 2. The search
+    if (!m_search.search(position, m_milliseconds)) {
+        return false;
+    }
+    outIndex = m_search.getBestIndex();
+    outArm = m_search.getBestArm();
+    return true;
+}
+
+/* *********************************************************************
+Function Name: getReason
+Purpose: Explains the last move chosen.
+Parameters: None
+Return Value: How far the search looked and what the move is worth,
+        or the first-fit reason if it was not searched.
+Algorithm: Describe the search's result.
+Reference: None
+********************************************************************* */
+std::string SearchStrategy::getReason() const {
+    if (m_isFallback) {
+        return m_fallback.getReason();
+    }
+
+    std::string reach = m_search.isExact() ? "to the end of the round"
+        : "up to " + std::to_string(m_search.getDepth()) + " turns ahead";
+    if (m_search.getTablebaseHits() > 0) {
+        reach += " (" + std::to_string(m_search.getTablebaseHits()) + " from the endgame tablebase)";
+    }
+
+    char value[16];
+    std::snprintf(value, sizeof(value), "%+.1f", m_search.getValue());
+    return "Searching " + std::to_string(m_search.getNodeCount())
+        + (m_search.getNodeCount() == 1 ? " position " : " positions ") + reach + ", this move\n"
+        "\texpects " + value + " points against the Human, the best of its moves.";
+}
+
+/* *********************************************************************
+Function Name: getValue
+Purpose: Retrieves what the last move chosen is worth.
+Parameters:
+        outValue, a double passed by reference. Receives the value.
+Return Value: Boolean true if the move was searched.
+Algorithm: Return the search's value.
+Reference: None
+********************************************************************* */
+bool SearchStrategy::getValue(double& outValue) const {
+    outValue = m_search.getValue();
+    return !m_isFallback;
+}
\ No newline at end of file
@@ -0,0 +1,143 @@
+#ifndef SEARCHSTRATEGY_H
+#define SEARCHSTRATEGY_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <atomic>
+#include <string>
+
+#include "ComputerStrategy.h"
+#include "EndgameTablebase.h"
+#include "ExpectimaxSearch.h"
+#include "HeuristicStrategy.h"
+#include "LinearEvaluator.h"
+
+/* *********************************************************************
+Class Name: SearchStrategy
+Purpose: A ComputerStrategy that chooses with ExpectimaxSearch, which
+        solves the round when the budget allows ("solver"), optionally
+        with an endgame tablebase and a learned evaluator. In table-only
+        mode ("tablebase") it searches just the positions the tablebase
+        holds, which it solves at once, and plays first-fit elsewhere.
+        The strategy owns the tablebase and evaluator it opens.
+********************************************************************* */
+class SearchStrategy : public ComputerStrategy {
+public:
+
+    /* --- Constructor --- */
+
+    /* *********************************************************************
+    Function Name: SearchStrategy
+    Purpose: Constructor. Prepares a search with no tablebase or evaluator.
+    Parameters:
+            milliseconds, an integer time budget per search.
+            isTableOnly, a boolean. True to search only positions in the
+                tablebase.
+    Return Value: None
+    Algorithm: Store the parameters and clear the flags.
+    Reference: None
+    ********************************************************************* */
+    SearchStrategy(int milliseconds, bool isTableOnly);
+
+    /* --- Selectors --- */
+
+    /* *********************************************************************
+    Function Name: getMilliseconds
+    Purpose: Retrieves the time budget per move. As for ComputerStrategy.
+    Parameters: None
+    Return Value: The budget in milliseconds.
+    Algorithm: Return m_milliseconds.
+    Reference: None
+    ********************************************************************* */
+    inline int getMilliseconds() const override { return m_milliseconds; }
+
+    /* --- Mutators --- */
+
+    /* *********************************************************************
+    Function Name: openTablebase / loadEvaluator
+    Purpose: Attach an endgame tablebase or a learned evaluator to the
+            search from a file.
+    Parameters:
+            filename, a string representing the file path.
+    Return Value: Boolean true on success; false, with an error message
+            from the file's class, otherwise.
+    Algorithm: Open the file into the member and attach it to the search.
+    Reference: None
+    ********************************************************************* */
+    bool openTablebase(const std::string& filename);
+    bool loadEvaluator(const std::string& filename);
+
+    /* *********************************************************************
+    Function Name: setMilliseconds / setStopSignal
+    Purpose: Change the time budget per move, or attach a flag that ends
+            the search early. As for ComputerStrategy.
+    Parameters:
+            milliseconds, an integer time budget. / stop, a pointer to a
+                std::atomic<bool>, or nullptr.
+    Return Value: None
+    Algorithm: Assign the budget to m_milliseconds, or pass the flag to
+            the search.
+    Reference: None
+    ********************************************************************* */
+    inline void setMilliseconds(int milliseconds) override { m_milliseconds = milliseconds; }
+    inline void setStopSignal(const std::atomic<bool>* stop) override { m_search.setStopSignal(stop); }
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: chooseMove
+    Purpose: Chooses the mover's move.
+    Parameters:
+            position, outIndex, outArm. As for ComputerStrategy.
+    Return Value: Boolean true if any tile can be played.
+    Algorithm:
+            1. In table-only mode, play first-fit unless the boneyard is
+                empty and the tablebase holds the position.
+            2. Otherwise search for the budget and play the best move.
+    Reference: None
+    ********************************************************************* */
+    bool chooseMove(const Playout& position, int& outIndex, int& outArm) override;
+
+    /* *********************************************************************
+    Function Name: getReason
+    Purpose: Explains the last move chosen.
+    Parameters: None
+    Return Value: How far the search looked and what the move is worth,
+            or the first-fit reason if it was not searched.
+    Algorithm: Describe the search's result.
+    Reference: None
+    ********************************************************************* */
+    std::string getReason() const override;
+
+    /* *********************************************************************
+    Function Name: getValue
+    Purpose: Retrieves what the last move chosen is worth.
+    Parameters:
+            outValue, a double passed by reference. Receives the value.
+    Return Value: Boolean true if the move was searched.
+    Algorithm: Return the search's value.
+    Reference: None
+    ********************************************************************* */
+    bool getValue(double& outValue) const override;
+
+private:
+    int m_milliseconds;
+    bool m_isTableOnly;
+
+    // The search is kept so its transposition table is allocated once
+    ExpectimaxSearch m_search;
+    EndgameTablebase m_tablebase;
+    bool m_hasTablebase;
+    LinearEvaluator m_evaluator;
+
+    // The rule for positions not searched, and whether the last move was one
+    HeuristicStrategy m_fallback;
+    bool m_isFallback;
+};
+
+#endif
\ No newline at end of file
@@ -5,14 +5,21 @@
  * Date:  02/12/2026                                        *
  ************************************************************/
 
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <iostream>
-#include <sstream>
 #include <string>
 
+#include "RoundSnapshot.h"
+#include "SaveParser.h"
 #include "Serializer.h"
+#include "Tile.h"
 #include "Tournament.h"
 
+// The round follows the five header bytes and must end before the checksum
+static_assert(5 + RoundSnapshot::ENCODED_SIZE <= Serializer::BINARY_SIZE - 4, "A RoundSnapshot must fit in a binary save");
+
 /* *********************************************************************
 Function Name: saveGame
 Purpose: Serializes the current state of the tournament and round into
@@ -27,7 +34,8 @@ Algorithm:
         1. Attempt to open the file output stream.
         2. If open fails, print error and return false.
         3. Write Tournament Score and Round Number.
-        4. Write Computer's Hand and Score.
+        4. Write Computer's Hand and Score, and its Strategy if one
+            was chosen.
         5. Write Human's Hand and Score.
         6. Write the current Layout and Boneyard (Stock).
         7. Write state flags (Previous Player Passed, Next Player).
@@ -53,7 +61,13 @@ bool Serializer::saveGame(const std::string& filename, const Tournament& tournam
     // --- Serialize Computer Data ---
     outFile << "Computer:" << "\n";
     outFile << "\tHand: " << tournament.getComputerHand().toString() << "\n";
-    outFile << "\tScore: " << tournament.getComputerScore() << "\n\n";
+    outFile << "\tScore: " << tournament.getComputerScore() << "\n";
+
+    // The strategy line is only written when one was chosen, so default saves keep the original format
+    if (!tournament.getStrategyName().empty()) {
+        outFile << "\tStrategy: " << tournament.getStrategyName() << "\n";
+    }
+    outFile << "\n";
 
     // --- Serialize Human Data --- 
     outFile << "Human:" << "\n";
@@ -83,19 +97,41 @@ Parameters:
 Return Value:
         Boolean true if the file was parsed successfully; false otherwise.
 Algorithm:
-        1. Open the file input stream. Return false on failure.
-        2. Read the file line by line.
-        3. Use stringstream to extract keys (e.g., "Round", "Computer:").
-        4. Based on the key, parse the associated value (int, string, or boolean).
-        5. Delegate complex parsing (Hands, Layout) to their respective classes
-            using loadFromString().
-        6. Set the 'Next Player' and 'Passed' flags based on parsed strings.
-        7. Close file and return true.
+        1. Delegate to the buffered overload with a local buffer.
 Reference: None
 ********************************************************************* */
 bool Serializer::loadGame(const std::string& filename, Tournament& tournament) {
-    // Open file for reading
-    std::ifstream inFile(filename);
+    std::string buffer;
+    return loadGame(filename, tournament, buffer);
+}
+
+/* *********************************************************************
+Function Name: loadGame
+Purpose: Parses a saved game file and reconstructs the tournament state,
+        reusing the caller's buffer for the file contents. Callers that
+        load many saves in a row keep one buffer so that its capacity
+        is reused instead of being reallocated for every file.
+Parameters:
+        filename, a string representing the input file path.
+        tournament, a reference to the Tournament object to be populated.
+        buffer, a string passed by reference. Receives the raw file
+            contents, which the parser scans in place.
+Return Value:
+        Boolean true if the file was parsed successfully; false otherwise.
+Algorithm:
+        1. Open the file input stream in binary mode. Return false on failure.
+        2. Size the buffer to the file length and read the file in one call.
+        3. If the buffer begins with the binary magic, decode it as a
+            binary snapshot and return the result.
+        4. Otherwise hand the buffer to a SaveParser, which scans it with
+            std::string_view and std::from_chars without copying.
+        5. On a parse error, report the file, line, column and reason.
+        6. Return the result of the parse.
+Reference: None
+********************************************************************* */
+bool Serializer::loadGame(const std::string& filename, Tournament& tournament, std::string& buffer) {
+    // Open file for reading; binary mode keeps the byte count exact
+    std::ifstream inFile(filename, std::ios::binary | std::ios::ate);
 
     // Verify file access
     if (!inFile.is_open()) {
@@ -103,123 +139,199 @@ bool Serializer::loadGame(const std::string& filename, Tournament& tournament) {
         return false;
     }
 
-    std::string line, key;
-    std::string currentSection;
-
-    // Temporary storage of turn flags
-    bool tempPreviousPassed = false;
-    bool isHumanTurn = true;
-
-    // Read the file line by line
-    while (std::getline(inFile, line)) {
-        // Skip empty lines
-        if (line.empty()) { continue; }
-
-        // Extract the first word
-        std::stringstream ss(line);
-        ss >> key;
-        
-        // --- Parse Tournament Data ---
-        if (key == "Tournament") {
-            std::string temp;
-            ss >> temp;
-            if (temp == "Score:") {
-                int score;
-                ss >> score;
-                tournament.setTargetScore(score);
-            }
-        }
-        // --- Parse Round Data ---
-        else if (key == "Round") {
-            std::string temp;
-            ss >> temp;
-            if (temp == "No.:") {
-                int round;
-                ss >> round;
-
-                tournament.setRoundNumber(round);
-                tournament.getCurrentRound().setRoundNumber(round);
-            }
-        }
-        // --- Context Switching ---
-        else if (key == "Computer:") {
-            currentSection = "Computer";
-        }
-        else if (key == "Human:") {
-            currentSection = "Human";
-        }
-        // --- Parse Hand Data ---
-        else if (key == "Hand:") {
-            std::string handTiles;
-            std::getline(ss, handTiles);
-
-            if (currentSection == "Computer") {
-                tournament.getCurrentRound().getComputerHand().loadFromString(handTiles);
-            } else if (currentSection == "Human") {
-                tournament.getCurrentRound().getHumanHand().loadFromString(handTiles);
-            }
-        }
-        // --- Parse Scores ---
-        else if (key == "Score:") {
-            int score;
-            ss >> score;
-
-            if (currentSection == "Computer") {
-                tournament.setComputerScore(score);
-            }
-            else if (currentSection == "Human") {
-                tournament.setHumanScore(score);
-            }
-        }
-        // --- Parse Board Layout --- 
-        else if (key == "Layout:") {
-            std::string layoutData;
+    // Read the whole file with a single call
+    std::streamsize size = inFile.tellg();
+    inFile.seekg(0, std::ios::beg);
+    buffer.resize(static_cast<size_t>(size));
 
-            if (std::getline(inFile, layoutData)) {
-                tournament.getCurrentRound().getLayout().loadFromString(layoutData);
-            }
-        }
-        else if (key == "Boneyard:") {
-            std::string boneyardData;
-            
-            if (std::getline(inFile, boneyardData)) {
-                tournament.getCurrentRound().getStock().loadFromString(boneyardData);
-            }
-        }
-        // --- Parse Turn Flags ---
-        else if (key == "Previous:") {
-            std::string temp;
-            // Eat 'Player' and 'Passed:'
-            ss >> temp;
-            ss >> temp;
-            
-            std::string val;
-            ss >> val;
-            tempPreviousPassed = (val == "Yes");
+    if (size > 0 && !inFile.read(buffer.data(), size)) {
+        std::cerr << "Error: Could not read file: " << filename << std::endl;
+        return false;
+    }
+
+    inFile.close();
+
+    // Binary snapshots are recognized by their magic bytes
+    if (buffer.compare(0, 4, "LGNB") == 0) {
+        if (!decodeBinary(reinterpret_cast<const unsigned char*>(buffer.data()), buffer.size(), tournament)) {
+            std::cerr << "Error: " << filename << ": Invalid or corrupt binary save" << std::endl;
+            return false;
         }
-        else if (key == "Next") {
-            std::string temp;
-            // Eat 'Player:'
-            ss >> temp;
-
-            std::string val;
-            ss >> val;
-            isHumanTurn = (val == "Human");
-            tournament.getCurrentRound().setHumanTurn(isHumanTurn);
-        }       
+        return true;
+    }
+
+    // Scan the buffer in place
+    SaveParser parser(buffer);
+    if (!parser.parse(tournament)) {
+        std::cerr << "Error: " << filename << ":" << parser.getErrorLine() << ":"
+            << parser.getErrorColumn() << ": " << parser.getErrorMessage() << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+/* *********************************************************************
+Function Name: saveBinary
+Purpose: Writes the tournament and round state to a file as a single
+        fixed-size binary snapshot.
+Parameters:
+        filename, a string representing the output file path.
+        tournament, a const reference to the Tournament object to be saved.
+Return Value:
+        Boolean true if the file was opened and written successfully;
+            false otherwise.
+Algorithm:
+        1. Encode the tournament into a BINARY_SIZE byte array.
+        2. Open the file in binary mode and write the array.
+        3. Return whether the write succeeded.
+Reference: None
+********************************************************************* */
+bool Serializer::saveBinary(const std::string& filename, const Tournament& tournament) {
+    unsigned char snapshot[BINARY_SIZE];
+    encodeBinary(tournament, snapshot);
+
+    // Open file for writing in binary mode so no bytes are translated
+    std::ofstream outFile(filename, std::ios::binary);
+
+    // Verify file access
+    if (!outFile.is_open()) {
+        std::cerr << "Error: Could not open file for writing: " << filename << std::endl;
+        return false;
     }
-    if (!isHumanTurn) {
-        tournament.setComputerPassed(tempPreviousPassed);
-        tournament.setHumanPassed(false);
+
+    outFile.write(reinterpret_cast<const char*>(snapshot), BINARY_SIZE);
+    return static_cast<bool>(outFile);
+}
+
+/* *********************************************************************
+Function Name: encodeBinary
+Purpose: Encodes the complete tournament state into BINARY_SIZE bytes.
+        All integers are little-endian so snapshots move between machines.
+        See Serializer.h for the byte layout.
+Parameters:
+        tournament, a const reference to the Tournament object to encode.
+        out, a pointer to at least BINARY_SIZE bytes of storage.
+Return Value: None (void)
+Algorithm:
+        1. Clear the output bytes and write the header.
+        2. Capture the round in a RoundSnapshot with the tournament's
+            totals and encode it after the header.
+        3. Compute the checksum over the preceding bytes and append it.
+Reference: FNV-1a hash, Fowler/Noll/Vo
+********************************************************************* */
+void Serializer::encodeBinary(const Tournament& tournament, unsigned char* out) {
+    std::memset(out, 0, BINARY_SIZE);
+
+    // --- Header ---
+    std::memcpy(out, "LGNB", 4);
+    out[4] = static_cast<unsigned char>(BINARY_VERSION);
+
+    // --- Round ---
+    RoundSnapshot snapshot;
+    snapshot.capture(tournament.getCurrentRound());
+    snapshot.setTotals(tournament.getRoundNumber(), tournament.getTargetScore(),
+        tournament.getHumanScore(), tournament.getComputerScore());
+    snapshot.encode(out + 5);
+
+    putInt32(out + 60, checksum(out, 60));
+}
+
+/* *********************************************************************
+Function Name: decodeBinary
+Purpose: Restores the tournament state from a binary snapshot.
+Parameters:
+        data, a pointer to the snapshot bytes.
+        size, a size_t holding the number of bytes available.
+        tournament, a reference to the Tournament object to be populated.
+Return Value:
+        Boolean true if the snapshot was valid and decoded; false otherwise.
+Algorithm:
+        1. Check the size, magic, version and checksum.
+        2. Decode the RoundSnapshot, which checks that the tile counts
+            fit in one set and that no tile appears twice.
+        3. Restore the round from it and the tournament's totals.
+Reference: None
+********************************************************************* */
+bool Serializer::decodeBinary(const unsigned char* data, size_t size, Tournament& tournament) {
+    // --- Validate the envelope ---
+    if (size != static_cast<size_t>(BINARY_SIZE) || std::memcmp(data, "LGNB", 4) != 0) {
+        return false;
     }
-    else {
-        tournament.setHumanPassed(tempPreviousPassed);
-        tournament.setComputerPassed(false);
+    if (data[4] != BINARY_VERSION || getInt32(data + 60) != checksum(data, 60)) {
+        return false;
     }
 
-    inFile.close();
+    // --- Validate the round ---
+    RoundSnapshot snapshot;
+    if (!snapshot.decode(data + 5)) {
+        return false;
+    }
 
+    // --- Restore tournament data ---
+    snapshot.restore(tournament.getCurrentRound());
+    tournament.setRoundNumber(snapshot.getRoundNumber());
+    tournament.setTargetScore(snapshot.getTargetScore());
+    tournament.setHumanScore(snapshot.getHumanScore());
+    tournament.setComputerScore(snapshot.getComputerScore());
     tournament.setIsResumed(true);
 
     return true;
+}
+
+/* *********************************************************************
+Function Name: putInt16 / putInt32
+Purpose: Store an integer at the given address in little-endian order.
+Parameters:
+        out, a pointer to the destination bytes.
+        value, the value to store.
+Return Value: None (void)
+Algorithm: Write the value one byte at a time, least significant first.
+Reference: None
+********************************************************************* */
+void Serializer::putInt16(unsigned char* out, uint32_t value) {
+    out[0] = static_cast<unsigned char>(value & 0xFF);
+    out[1] = static_cast<unsigned char>((value >> 8) & 0xFF);
+}
+
+void Serializer::putInt32(unsigned char* out, uint32_t value) {
+    putInt16(out, value & 0xFFFF);
+    putInt16(out + 2, value >> 16);
+}
+
+/* *********************************************************************
+Function Name: getInt16 / getInt32
+Purpose: Read a little-endian integer from the given address.
+Parameters:
+        in, a pointer to the source bytes.
+Return Value: The decoded value.
+Algorithm: Combine the bytes, least significant first.
+Reference: None
+********************************************************************* */
+uint32_t Serializer::getInt16(const unsigned char* in) {
+    return static_cast<uint32_t>(in[0]) | (static_cast<uint32_t>(in[1]) << 8);
+}
+
+uint32_t Serializer::getInt32(const unsigned char* in) {
+    return getInt16(in) | (getInt16(in + 2) << 16);
+}
+
+/* *********************************************************************
+Function Name: checksum
+Purpose: Computes the 32-bit FNV-1a hash of a run of bytes.
+Parameters:
+        data, a pointer to the bytes.
+        size, the number of bytes to hash.
+Return Value: The 32-bit hash.
+Algorithm: For each byte, XOR it into the hash, then multiply by the
+        FNV prime.
+Reference: FNV-1a hash, Fowler/Noll/Vo
+********************************************************************* */
+uint32_t Serializer::checksum(const unsigned char* data, size_t size) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
 }
\ No newline at end of file
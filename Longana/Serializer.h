@@ -1,11 +1,29 @@
 #ifndef SERIALIZER_H
 #define SERIALIZER_H
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include "Tournament.h"
 
+/* *********************************************************************
+Class Name: Serializer
+Purpose: Static utility class that saves and restores a Tournament. Two
+        formats are supported: the human-readable text format, and a
+        fixed-size binary snapshot that is cheap enough to take every turn.
+        Loading detects the format from the first bytes of the file.
+********************************************************************* */
 class Serializer {
 public:
+
+    /* --- Constants --- */
+
+    // Size in bytes of every binary snapshot
+    static const int BINARY_SIZE = 64;
+
+    // Version written into new binary snapshots
+    static const int BINARY_VERSION = 1;
+
     /* --- Constructor --- */
 
     /* *********************************************************************
@@ -66,18 +84,136 @@ public:
     Return Value:
             Boolean true if the file was parsed successfully; false otherwise.
     Algorithm:
-            1. Open the file input stream. Return false on failure.
-            2. Read the file line by line.
-            3. Use stringstream to extract keys (e.g., "Round", "Computer:").
-            4. Based on the key, parse the associated value (int, string, or boolean).
-            5. Delegate complex parsing (Hands, Layout) to their respective classes
-                using loadFromString().
-            6. Set the 'Next Player' and 'Passed' flags based on parsed strings.
-            7. Close file and return true.
+            1. Delegate to the buffered overload with a local buffer.
     Reference: None
     ********************************************************************* */
     static bool loadGame(const std::string& filename, Tournament& tournament);
 
+    /* *********************************************************************
+    Function Name: loadGame
+    Purpose: Parses a saved game file and reconstructs the tournament state,
+            reusing the caller's buffer for the file contents. Callers that
+            load many saves in a row keep one buffer so that its capacity
+            is reused instead of being reallocated for every file.
+    Parameters:
+            filename, a string representing the input file path.
+            tournament, a reference to the Tournament object to be populated.
+            buffer, a string passed by reference. Receives the raw file
+                contents, which the parser scans in place.
+    Return Value:
+            Boolean true if the file was parsed successfully; false otherwise.
+    Algorithm:
+            1. Open the file input stream in binary mode. Return false on failure.
+            2. Size the buffer to the file length and read the file in one call.
+            3. If the buffer begins with the binary magic, decode it as a
+                binary snapshot and return the result.
+            4. Otherwise hand the buffer to a SaveParser, which scans it with
+                std::string_view and std::from_chars without copying.
+            5. On a parse error, report the file, line, column and reason.
+            6. Return the result of the parse.
+    Reference: None
+    ********************************************************************* */
+    static bool loadGame(const std::string& filename, Tournament& tournament, std::string& buffer);
+
+    /* *********************************************************************
+    Function Name: saveBinary
+    Purpose: Writes the tournament and round state to a file as a single
+            fixed-size binary snapshot.
+    Parameters:
+            filename, a string representing the output file path.
+            tournament, a const reference to the Tournament object to be saved.
+    Return Value:
+            Boolean true if the file was opened and written successfully;
+                false otherwise.
+    Algorithm:
+            1. Encode the tournament into a BINARY_SIZE byte array.
+            2. Open the file in binary mode and write the array.
+            3. Return whether the write succeeded.
+    Reference: None
+    ********************************************************************* */
+    static bool saveBinary(const std::string& filename, const Tournament& tournament);
+
+    /* *********************************************************************
+    Function Name: encodeBinary
+    Purpose: Encodes the complete tournament state into BINARY_SIZE bytes.
+            All integers are little-endian so snapshots move between machines.
+            Layout of the snapshot:
+                0  "LGNB" magic
+                4  format version
+                5  the RoundSnapshot of the round, RoundSnapshot::ENCODED_SIZE
+                    bytes (see RoundSnapshot::encode), padded with zeros
+                60 FNV-1a checksum of bytes 0 to 59 (32 bits)
+    Parameters:
+            tournament, a const reference to the Tournament object to encode.
+            out, a pointer to at least BINARY_SIZE bytes of storage.
+    Return Value: None (void)
+    Algorithm:
+            1. Clear the output bytes and write the header.
+            2. Capture the round in a RoundSnapshot with the tournament's
+                totals and encode it after the header.
+            3. Compute the checksum over the preceding bytes and append it.
+    Reference: FNV-1a hash, Fowler/Noll/Vo
+    ********************************************************************* */
+    static void encodeBinary(const Tournament& tournament, unsigned char* out);
+
+    /* *********************************************************************
+    Function Name: decodeBinary
+    Purpose: Restores the tournament state from a binary snapshot.
+    Parameters:
+            data, a pointer to the snapshot bytes.
+            size, a size_t holding the number of bytes available.
+            tournament, a reference to the Tournament object to be populated.
+    Return Value:
+            Boolean true if the snapshot was valid and decoded; false otherwise.
+    Algorithm:
+            1. Check the size, magic, version and checksum.
+            2. Decode the RoundSnapshot, which checks that the tile counts
+                fit in one set and that no tile appears twice.
+            3. Restore the round from it and the tournament's totals.
+    Reference: None
+    ********************************************************************* */
+    static bool decodeBinary(const unsigned char* data, size_t size, Tournament& tournament);
+
+    /* *********************************************************************
+    Function Name: putInt16 / putInt32
+    Purpose: Store an integer at the given address in little-endian order.
+    Parameters:
+            out, a pointer to the destination bytes.
+            value, the value to store.
+    Return Value: None (void)
+    Algorithm: Write the value one byte at a time, least significant first.
+    Reference: None
+    ********************************************************************* */
+    static void putInt16(unsigned char* out, uint32_t value);
+    static void putInt32(unsigned char* out, uint32_t value);
+
+    /* *********************************************************************
+    Function Name: getInt16 / getInt32
+    Purpose: Read a little-endian integer from the given address.
+    Parameters:
+            in, a pointer to the source bytes.
+    Return Value: The decoded value.
+    Algorithm: Combine the bytes, least significant first.
+    Reference: None
+    ********************************************************************* */
+    static uint32_t getInt16(const unsigned char* in);
+    static uint32_t getInt32(const unsigned char* in);
+
+private:
+
+    /* *********************************************************************
+    Function Name: checksum
+    Purpose: Computes the 32-bit FNV-1a hash of a run of bytes.
+    Parameters:
+            data, a pointer to the bytes.
+            size, the number of bytes to hash.
+    Return Value: The 32-bit hash.
+    Algorithm: For each byte, XOR it into the hash, then multiply by the
+            FNV prime.
+    Reference: FNV-1a hash, Fowler/Noll/Vo
+    ********************************************************************* */
+    static uint32_t checksum(const unsigned char* data, size_t size);
+
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,267 @@
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "GameSession.h"
+#include "SessionStore.h"
+
+/* *********************************************************************
+Function Name: SessionStore
+Purpose: Default constructor. The store is closed until open() is
+        called.
+Parameters: None
+Return Value: None
+Algorithm: Seed the tags from std::random_device, with no slots.
+Reference: None
+********************************************************************* */
+SessionStore::SessionStore()
+    : m_mutex(), m_file(), m_slotCount(0), m_freeSlots(), m_resident(), m_generator(std::random_device()())
+{
+}
+
+/* *********************************************************************
+Function Name: open
+Purpose: Opens the file sessions are parked in, creating it if it
+        does not exist.
+Parameters:
+        filename, a string. The file's path.
+Return Value: Boolean true if the file is ready; false, with an
+        error message, if it could not be opened or is not a store.
+Algorithm:
+        1. Create the file with its header if it is missing or
+            empty; otherwise check the header.
+        2. Read every record's tag, a block at a time, and list the
+            slots whose tag is zero as free.
+Reference: None
+********************************************************************* */
+bool SessionStore::open(const std::string& filename) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // 1. The header, written to a new file
+    unsigned char header[HEADER_SIZE] = { 'L', 'G', 'N', 'S', static_cast<unsigned char>(VERSION) };
+    {
+        std::ifstream existing(filename, std::ios::binary);
+        if (!existing.is_open() || existing.peek() == std::ifstream::traits_type::eof()) {
+            std::ofstream created(filename, std::ios::binary | std::ios::trunc);
+            created.write(reinterpret_cast<const char*>(header), HEADER_SIZE);
+            if (!created) {
+                std::cerr << "Error: Could not create session store " << filename << std::endl;
+                return false;
+            }
+        }
+    }
+
+    m_file.open(filename, std::ios::binary | std::ios::in | std::ios::out);
+    unsigned char found[HEADER_SIZE] = {};
+    if (!m_file.is_open() || !m_file.read(reinterpret_cast<char*>(found), HEADER_SIZE)
+        || std::memcmp(found, header, HEADER_SIZE) != 0) {
+        std::cerr << "Error: " << filename << " is not a session store" << std::endl;
+        m_file.close();
+        return false;
+    }
+
+    // 2. The slots in use
+    m_slotCount = 0;
+    m_freeSlots.clear();
+    m_resident.clear();
+
+    std::vector<char> block(static_cast<size_t>(SCAN_RECORDS) * RECORD_SIZE);
+    while (m_file.read(block.data(), static_cast<std::streamsize>(block.size())) || m_file.gcount() > 0) {
+        int records = static_cast<int>(m_file.gcount() / RECORD_SIZE);
+        for (int i = 0; i < records; ++i) {
+            const char* tag = block.data() + static_cast<size_t>(i) * RECORD_SIZE;
+            if (tag[0] == 0 && tag[1] == 0 && tag[2] == 0 && tag[3] == 0) {
+                m_freeSlots.push_back(m_slotCount);
+            }
+            ++m_slotCount;
+        }
+    }
+    m_file.clear();
+
+    return true;
+}
+
+/* *********************************************************************
+Function Name: create
+Purpose: Names a new session, resident from the start.
+Parameters: None
+Return Value: The session's id, never 0.
+Algorithm: Take a free slot, or the next past the end of the file,
+        draw a tag other than zero, and mark the slot resident. The
+        record is written when the session is first parked.
+Reference: None
+********************************************************************* */
+uint64_t SessionStore::create() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    uint32_t slot = m_slotCount;
+    if (!m_freeSlots.empty()) {
+        slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    }
+    else {
+        ++m_slotCount;
+    }
+
+    uint32_t tag = 0;
+    while (tag == 0) {
+        tag = static_cast<uint32_t>(m_generator());
+    }
+
+    m_resident.insert(slot);
+    return (static_cast<uint64_t>(tag) << 32) | slot;
+}
+
+/* *********************************************************************
+Function Name: park
+Purpose: Writes a resident session to its record and lets it go.
+Parameters:
+        id, a 64-bit session id from create() or resume().
+        session, a GameSession passed by const reference.
+Return Value: Boolean true if the record was written; false, with an
+        error message, if the file could not be written.
+Algorithm: Encode the session behind the id's tag, write the record
+        at the slot's offset and flush it, then mark the slot no
+        longer resident.
+Reference: None
+********************************************************************* */
+bool SessionStore::park(uint64_t id, const GameSession& session) {
+    // The record, little-endian like the Serializer's snapshots
+    unsigned char record[RECORD_SIZE];
+    uint32_t tag = static_cast<uint32_t>(id >> 32);
+    for (int i = 0; i < 4; ++i) {
+        record[i] = static_cast<unsigned char>(tag >> (8 * i));
+    }
+    session.encode(record + 4);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    uint32_t slot = static_cast<uint32_t>(id);
+    m_resident.erase(slot);
+
+    m_file.seekp(getOffset(slot));
+    m_file.write(reinterpret_cast<const char*>(record), RECORD_SIZE);
+    m_file.flush();
+    if (!m_file) {
+        std::cerr << "Error: Could not park session " << formatId(id) << std::endl;
+        m_file.clear();
+        return false;
+    }
+    return true;
+}
+
+/* *********************************************************************
+Function Name: resume
+Purpose: Brings a parked session back into memory.
+Parameters:
+        id, a 64-bit session id.
+        outSession, a GameSession passed by reference. Receives the
+            session.
+Return Value: Boolean true if the session was parked under that id
+        and is now resident; false if the id names no parked
+        session.
+Algorithm: Refuse a resident slot. Read the slot's record, check its
+        tag against the id's and decode the session, then mark the
+        slot resident.
+Reference: None
+********************************************************************* */
+bool SessionStore::resume(uint64_t id, GameSession& outSession) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    uint32_t slot = static_cast<uint32_t>(id);
+    if (slot >= m_slotCount || m_resident.count(slot) != 0) {
+        return false;
+    }
+
+    unsigned char record[RECORD_SIZE];
+    m_file.seekg(getOffset(slot));
+    if (!m_file.read(reinterpret_cast<char*>(record), RECORD_SIZE)) {
+        m_file.clear();
+        return false;
+    }
+
+    uint32_t tag = 0;
+    for (int i = 0; i < 4; ++i) {
+        tag |= static_cast<uint32_t>(record[i]) << (8 * i);
+    }
+    if (tag == 0 || tag != static_cast<uint32_t>(id >> 32) || !outSession.decode(record + 4)) {
+        return false;
+    }
+
+    m_resident.insert(slot);
+    return true;
+}
+
+/* *********************************************************************
+Function Name: release
+Purpose: Ends a resident session for good, freeing its slot.
+Parameters:
+        id, a 64-bit session id from create() or resume().
+Return Value: None
+Algorithm: Clear the record's tag if the record exists, mark the
+        slot no longer resident and add it to the free slots.
+Reference: None
+********************************************************************* */
+void SessionStore::release(uint64_t id) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    uint32_t slot = static_cast<uint32_t>(id);
+
+    // A session never parked has no record to clear
+    m_file.seekg(0, std::ios::end);
+    if (getOffset(slot) < static_cast<std::streamoff>(m_file.tellg())) {
+        const char zero[4] = {};
+        m_file.seekp(getOffset(slot));
+        m_file.write(zero, sizeof(zero));
+        m_file.flush();
+    }
+    m_file.clear();
+
+    m_resident.erase(slot);
+    m_freeSlots.push_back(slot);
+}
+
+/* *********************************************************************
+Function Name: formatId / parseId
+Purpose: Write a session id as sixteen hexadecimal digits, and read
+        one back.
+Parameters:
+        id, a 64-bit session id.
+        text, a std::string_view. The digits.
+        outId, a 64-bit integer passed by reference. Receives the id.
+Return Value: The digits. / Boolean true if the text is a nonzero
+        hexadecimal number and nothing else.
+Algorithm: Convert with std::to_chars and std::from_chars in base 16,
+        padding to sixteen digits.
+Reference: None
+********************************************************************* */
+std::string SessionStore::formatId(uint64_t id) {
+    char digits[16];
+    std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), id, 16);
+
+    std::string text(16 - (result.ptr - digits), '0');
+    text.append(digits, result.ptr);
+    return text;
+}
+
+bool SessionStore::parseId(std::string_view text, uint64_t& outId) {
+    uint64_t id = 0;
+    std::from_chars_result result = std::from_chars(text.data(), text.data() + text.size(), id, 16);
+    if (result.ec != std::errc() || result.ptr != text.data() + text.size() || id == 0) {
+        return false;
+    }
+
+    outId = id;
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,216 @@
+#ifndef SESSIONSTORE_H
+#define SESSIONSTORE_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include "GameSession.h"
+
+/* *********************************************************************
+Class Name: SessionStore
+Purpose: Keeps GameSessions on disk while no one is playing them, so a
+        server can hold far more tournaments than it has memory for. The
+        file starts with a short header and then holds one fixed-size
+        record per session: a 32-bit tag, zero for a free slot, and the
+        session's snapshot (see GameSession::encode). A parked session
+        costs its record on disk and nothing in memory.
+
+        A session is named by an id that joins its slot, in the low 32
+        bits, to its random tag, in the high 32 bits, so an id cannot be
+        guessed from another and an id whose slot has been reused finds
+        nothing. A session is resident while some connection holds it in
+        memory; it cannot be resumed a second time until it is parked
+        again. The store is shared by every event loop, and a mutex
+        guards the file and the lists of slots.
+
+        The file outlives the server: opening it again finds the
+        sessions parked in it. Sessions resident when the server ended
+        come back as they were last parked.
+********************************************************************* */
+class SessionStore {
+public:
+
+    // Size of the file header: the magic "LGNS", a version byte and padding
+    static const int HEADER_SIZE = 8;
+    static const int VERSION = 1;
+
+    // Size of a record: the tag, then the session
+    static const int RECORD_SIZE = 4 + GameSession::SNAPSHOT_SIZE;
+
+    /* --- Constructor --- */
+
+    /* *********************************************************************
+    Function Name: SessionStore
+    Purpose: Default constructor. The store is closed until open() is
+            called.
+    Parameters: None
+    Return Value: None
+    Algorithm: Seed the tags from std::random_device, with no slots.
+    Reference: None
+    ********************************************************************* */
+    SessionStore();
+
+    SessionStore(const SessionStore&) = delete;
+    SessionStore& operator=(const SessionStore&) = delete;
+
+    /* --- Destructor --- */
+
+    /* *********************************************************************
+    Function Name: ~SessionStore
+    Purpose: Destructor. The file stream closes itself.
+    Parameters: None
+    Return Value: None
+    Algorithm: Standard object destruction.
+    Reference: None
+    ********************************************************************* */
+    ~SessionStore() = default;
+
+    /* --- Selectors --- */
+
+    /* *********************************************************************
+    Function Name: isOpen
+    Purpose: Checks whether the store has a file to park sessions in.
+    Parameters: None
+    Return Value: Boolean true after a successful open().
+    Algorithm: Check the file stream.
+    Reference: None
+    ********************************************************************* */
+    inline bool isOpen() const { return m_file.is_open(); }
+
+    /* --- Mutators --- */
+
+    /* *********************************************************************
+    Function Name: open
+    Purpose: Opens the file sessions are parked in, creating it if it
+            does not exist.
+    Parameters:
+            filename, a string. The file's path.
+    Return Value: Boolean true if the file is ready; false, with an
+            error message, if it could not be opened or is not a store.
+    Algorithm:
+            1. Create the file with its header if it is missing or
+                empty; otherwise check the header.
+            2. Read every record's tag, a block at a time, and list the
+                slots whose tag is zero as free.
+    Reference: None
+    ********************************************************************* */
+    bool open(const std::string& filename);
+
+    /* *********************************************************************
+    Function Name: create
+    Purpose: Names a new session, resident from the start.
+    Parameters: None
+    Return Value: The session's id, never 0.
+    Algorithm: Take a free slot, or the next past the end of the file,
+            draw a tag other than zero, and mark the slot resident. The
+            record is written when the session is first parked.
+    Reference: None
+    ********************************************************************* */
+    uint64_t create();
+
+    /* *********************************************************************
+    Function Name: park
+    Purpose: Writes a resident session to its record and lets it go.
+    Parameters:
+            id, a 64-bit session id from create() or resume().
+            session, a GameSession passed by const reference.
+    Return Value: Boolean true if the record was written; false, with an
+            error message, if the file could not be written.
+    Algorithm: Encode the session behind the id's tag, write the record
+            at the slot's offset and flush it, then mark the slot no
+            longer resident.
+    Reference: None
+    ********************************************************************* */
+    bool park(uint64_t id, const GameSession& session);
+
+    /* *********************************************************************
+    Function Name: resume
+    Purpose: Brings a parked session back into memory.
+    Parameters:
+            id, a 64-bit session id.
+            outSession, a GameSession passed by reference. Receives the
+                session.
+    Return Value: Boolean true if the session was parked under that id
+            and is now resident; false if the id names no parked
+            session.
+    Algorithm: Refuse a resident slot. Read the slot's record, check its
+            tag against the id's and decode the session, then mark the
+            slot resident.
+    Reference: None
+    ********************************************************************* */
+    bool resume(uint64_t id, GameSession& outSession);
+
+    /* *********************************************************************
+    Function Name: release
+    Purpose: Ends a resident session for good, freeing its slot.
+    Parameters:
+            id, a 64-bit session id from create() or resume().
+    Return Value: None
+    Algorithm: Clear the record's tag if the record exists, mark the
+            slot no longer resident and add it to the free slots.
+    Reference: None
+    ********************************************************************* */
+    void release(uint64_t id);
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: formatId / parseId
+    Purpose: Write a session id as sixteen hexadecimal digits, and read
+            one back.
+    Parameters:
+            id, a 64-bit session id.
+            text, a std::string_view. The digits.
+            outId, a 64-bit integer passed by reference. Receives the id.
+    Return Value: The digits. / Boolean true if the text is a nonzero
+            hexadecimal number and nothing else.
+    Algorithm: Convert with std::to_chars and std::from_chars in base 16,
+            padding to sixteen digits.
+    Reference: None
+    ********************************************************************* */
+    static std::string formatId(uint64_t id);
+    static bool parseId(std::string_view text, uint64_t& outId);
+
+private:
+
+    // Records read at a time while opening the file
+    static const int SCAN_RECORDS = 4096;
+
+    std::mutex m_mutex;
+    std::fstream m_file;
+
+    // Slots in the file, free slots within it, and the slots held in memory
+    uint32_t m_slotCount;
+    std::vector<uint32_t> m_freeSlots;
+    std::unordered_set<uint32_t> m_resident;
+
+    std::mt19937 m_generator;
+
+    /* *********************************************************************
+    Function Name: getOffset
+    Purpose: Finds where a slot's record starts in the file.
+    Parameters:
+            slot, a 32-bit slot number.
+    Return Value: The record's offset in bytes.
+    Algorithm: Skip the header and the records before it.
+    Reference: None
+    ********************************************************************* */
+    static inline std::streamoff getOffset(uint32_t slot) {
+        return HEADER_SIZE + static_cast<std::streamoff>(slot) * RECORD_SIZE;
+    }
+};
+
+#endif
\ No newline at end of file
@@ -5,12 +5,13 @@
  * Date:  02/12/2026                                        *
  ************************************************************/
 
-#include <algorithm>
 #include <iostream>
 #include <random>
-#include <sstream>
 #include <string>
+#include <string_view>
+#include <utility>
 
+#include "DominoSet.h"
 #include "Stock.h"
 #include "Tile.h"
 
@@ -76,31 +77,39 @@ bool Stock::removeSpecificTile(const Tile& target) {
 
 /* *********************************************************************
 Function Name: shuffle
-Purpose: To randomize the order of the tiles in the boneyard using a
-        high-quality pseudo-random number generator.
-Parameters: None
+Purpose: To randomize the order of the tiles in the boneyard. The order
+        depends only on the seed, so a round can be dealt again from
+        its seed alone (for saving, logging and replay).
+Parameters:
+        seed, an unsigned integer passed by value. Seeds the generator.
 Return Value: None (void)
 Algorithm:
-        1. Instantiate a random_device to provide a seed.
-        2. Initialize a Mersenne Twister engine (mt19937) with that seed.
-        3. Call std::shuffle on the m_tiles vector from beginning to end
-            using the engine as the source of randomness.
-Reference: C++ Standard Library Documentation for std::shuffle
+        1. Initialize a Mersenne Twister engine (mt19937) with the seed.
+        2. Perform a Fisher-Yates shuffle: for each position from the
+            back of the vector to the front, swap it with a position
+            chosen by the engine from the ones not yet fixed.
+        3. The engine's output sequence is fixed by the standard, unlike
+            std::shuffle and std::uniform_int_distribution, so the same
+            seed gives the same order on every compiler.
+Reference: C++ Standard Library Documentation for std::mt19937
 ********************************************************************* */
-void Stock::shuffle() {
-    // Seed the generator with a non-deterministic random device
-    std::random_device rd;
-    std::mt19937 g(rd());
+void Stock::shuffle(unsigned int seed) {
+    std::mt19937 g(seed);
 
-    // Randomize the internal sequence of tiles
-    std::shuffle(m_tiles.begin(), m_tiles.end(), g);
+    // Randomize the internal sequence of tiles from the back to the front
+    for (int i = static_cast<int>(m_tiles.size()) - 1; i > 0; --i) {
+        int j = static_cast<int>(g() % static_cast<unsigned int>(i + 1));
+        std::swap(m_tiles[i], m_tiles[j]);
+    }
 }
 
+
 /* *********************************************************************
 Function Name: printStock
-Purpose: To display the current contents of the boneyard to the console.
+Purpose: To display the current contents of the boneyard to a stream.
         This is essential for verifying game state during a demonstration.
-Parameters: None
+Parameters:
+        out, an ostream passed by reference. Usually std::cout.
 Return Value: None (void)
 Algorithm:
         1. Check if the stock is empty; if so, print a status message.
@@ -109,19 +118,19 @@ Algorithm:
         4. Output a newline at the end.
 Reference: None
 ********************************************************************* */
-void Stock::printStock() const {
+void Stock::printStock(std::ostream& out) const {
     // Check for empty state before attempting to iterate
     if (m_tiles.empty()) {
-        std::cout << "The boneyard is empty." << std::endl;
+        out << "The boneyard is empty." << std::endl;
         return;
     }
 
     // Loop through the vector and display the tile data
     for (const auto& t : m_tiles) {
-        std::cout << t.getLeftPips() << "-" << t.getRightPips() << " ";
+        out << t.getLeftPips() << "-" << t.getRightPips() << " ";
     }
 
-    std::cout << std::endl;
+    out << std::endl;
 }
 
 /* *********************************************************************
@@ -149,35 +158,16 @@ std::string Stock::toString() const {
 Function Name: loadFromString
 Purpose: Reconstructs the boneyard from a saved string state.
 Parameters:
-        data, a const std::string reference containing tile pips.
-Return Value: None (void)
-Algorithm:
-        1. Clear the current m_tiles vector.
-        2. Use stringstream to tokenize the input by spaces.
-        3. For each token, find the dash and parse the left/right integers.
-        4. Push a new Tile object onto the vector.
+        data, a std::string_view containing tile pips.
+        errorOffset, a size_t passed by reference. Receives the offset
+            within data of the first malformed token, if any.
+Return Value: Boolean true if every token was a valid tile, false otherwise.
+Algorithm: Parse the view into the m_tiles vector with
+        Tile::listFromString, which clears it first.
 ********************************************************************* */
-void Stock::loadFromString(const std::string& data) {
-    // Empty the hand to prepare for new data from the save file
-    m_tiles.clear();
-
-    // Use stringstream to split the string into individual "6-6" tokens
-    std::stringstream ss(data);
-    std::string token;
-
-    while (ss >> token) {
-        size_t dashPos = token.find("-");
-
-        // If there exists a dashPos, execute
-        if (dashPos != std::string::npos) {
-            // Extract substrings and convert to integers
-            int left = std::stoi(token.substr(0, dashPos));
-            int right = std::stoi(token.substr(dashPos + 1));
-
-            // Create the Tile and store it to the stock
-            m_tiles.push_back(Tile(left, right));
-        }
-    }
+bool Stock::loadFromString(std::string_view data, size_t& errorOffset) {
+    // Replace the boneyard with the tiles from the save file
+    return Tile::listFromString(data, false, m_tiles, errorOffset);
 }
 
 /* *********************************************************************
@@ -200,8 +190,8 @@ Reference: None
 void Stock::initializeFullSet() {
     m_tiles.clear();
     // Double loop to generate all unique domino pairs (0-0 through 6-6)
-    for (int left = 0; left <= 6; ++left) {
-        for (int right = left; right <= 6; ++right) {
+    for (int left = 0; left <= StandardSet::MAX_PIPS; ++left) {
+        for (int right = left; right <= StandardSet::MAX_PIPS; ++right) {
             m_tiles.push_back(Tile(left, right));
         }
     }
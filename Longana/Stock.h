@@ -8,8 +8,10 @@
  * Date:  02/12/2026                                        *
  ************************************************************/
 
+#include <ostream>
 #include <vector>
 #include <string>
+#include <string_view>
 #include "Tile.h"
 
 /* *********************************************************************
@@ -73,6 +75,18 @@ public:
     ********************************************************************* */
     inline bool isEmpty() const { return m_tiles.empty(); }
 
+    /* *********************************************************************
+    Function Name: getTileAtIndex
+    Purpose: Retrieves a copy of the tile at a specific position in the
+            boneyard without drawing it. Position 0 is the next tile drawn.
+    Parameters:
+            index, an integer passed by value. The position of the tile.
+    Return Value: A Tile object (by value).
+    Algorithm: Return the element at m_tiles.at(index).
+    Reference: None
+    ********************************************************************* */
+    inline Tile getTileAtIndex(int index) const { return m_tiles.at(index); }
+
     /* --- Mutators --- */
 
     /* *********************************************************************
@@ -114,28 +128,57 @@ public:
     ********************************************************************* */
     bool removeSpecificTile(const Tile& target);
 
+    /* *********************************************************************
+    Function Name: addTile
+    Purpose: Places a tile at the bottom of the boneyard, after every tile
+            already in it. Used when restoring a saved boneyard in order.
+    Parameters:
+            tile, a Tile object passed by const reference.
+    Return Value: None (void)
+    Algorithm: Push the tile onto the back of the m_tiles vector.
+    Reference: None
+    ********************************************************************* */
+    inline void addTile(const Tile& tile) { m_tiles.push_back(tile); }
+
+    /* *********************************************************************
+    Function Name: clearStock
+    Purpose: To remove every tile from the boneyard. Used before restoring
+            a saved boneyard tile by tile.
+    Parameters: None
+    Return Value: None (void)
+    Algorithm: Call the clear() method on the m_tiles vector.
+    Reference: None
+    ********************************************************************* */
+    inline void clearStock() { m_tiles.clear(); }
+
     /* --- Utility Functions --- */
 
     /* *********************************************************************
     Function Name: shuffle
-    Purpose: To randomize the order of the tiles in the boneyard using a
-            high-quality pseudo-random number generator.
-    Parameters: None
+    Purpose: To randomize the order of the tiles in the boneyard. The order
+            depends only on the seed, so a round can be dealt again from
+            its seed alone (for saving, logging and replay).
+    Parameters:
+            seed, an unsigned integer passed by value. Seeds the generator.
     Return Value: None (void)
     Algorithm:
-            1. Instantiate a random_device to provide a seed.
-            2. Initialize a Mersenne Twister engine (mt19937) with that seed.
-            3. Call std::shuffle on the m_tiles vector from beginning to end
-                using the engine as the source of randomness.
-    Reference: C++ Standard Library Documentation for std::shuffle
+            1. Initialize a Mersenne Twister engine (mt19937) with the seed.
+            2. Perform a Fisher-Yates shuffle: for each position from the
+                back of the vector to the front, swap it with a position
+                chosen by the engine from the ones not yet fixed.
+            3. The engine's output sequence is fixed by the standard, unlike
+                std::shuffle and std::uniform_int_distribution, so the same
+                seed gives the same order on every compiler.
+    Reference: C++ Standard Library Documentation for std::mt19937
     ********************************************************************* */
-    void shuffle();
+    void shuffle(unsigned int seed);
 
     /* *********************************************************************
     Function Name: printStock
-    Purpose: To display the current contents of the boneyard to the console.
+    Purpose: To display the current contents of the boneyard to a stream.
             This is essential for verifying game state during a demonstration.
-    Parameters: None
+    Parameters:
+            out, an ostream passed by reference. Usually std::cout.
     Return Value: None (void)
     Algorithm:
             1. Check if the stock is empty; if so, print a status message.
@@ -144,7 +187,7 @@ public:
             4. Output a newline at the end.
     Reference: None
     ********************************************************************* */
-    void printStock() const;
+    void printStock(std::ostream& out) const;
 
     /* *********************************************************************
     Function Name: toString
@@ -162,15 +205,14 @@ public:
     Function Name: loadFromString
     Purpose: Reconstructs the boneyard from a saved string state.
     Parameters:
-            data, a const std::string reference containing tile pips.
-    Return Value: None (void)
-    Algorithm:
-            1. Clear the current m_tiles vector.
-            2. Use stringstream to tokenize the input by spaces.
-            3. For each token, find the dash and parse the left/right integers.
-            4. Push a new Tile object onto the vector.
+            data, a std::string_view containing tile pips.
+            errorOffset, a size_t passed by reference. Receives the offset
+                within data of the first malformed token, if any.
+    Return Value: Boolean true if every token was a valid tile, false otherwise.
+    Algorithm: Parse the view into the m_tiles vector with
+            Tile::listFromString, which clears it first.
     ********************************************************************* */
-    void loadFromString(const std::string& data);
+    bool loadFromString(std::string_view data, size_t& errorOffset);
 
     /* *********************************************************************
     Function Name: initializeFullSet
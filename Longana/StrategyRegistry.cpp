@@ -0,0 +1,239 @@
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <charconv>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include "HeuristicStrategy.h"
+#include "HeuristicTuner.h"
+#include "MonteCarloStrategy.h"
+#include "SearchStrategy.h"
+#include "StrategyRegistry.h"
+
+// The registered strategies, in the order describe() lists them
+const StrategyRegistry::Entry StrategyRegistry::ENTRIES[] = {
+    { "greedy", "", &StrategyRegistry::makeGreedy },
+    { "random", "seed", &StrategyRegistry::makeRandom },
+    { "heaviest", "", &StrategyRegistry::makeHeaviest },
+    { "weighted", "file", &StrategyRegistry::makeWeighted },
+    { "mcts", "ms", &StrategyRegistry::makeMonteCarlo },
+    { "solver", "ms,tablebase,evaluator", &StrategyRegistry::makeSolver },
+    { "tablebase", "file", &StrategyRegistry::makeTablebase },
+};
+
+const int StrategyRegistry::ENTRY_COUNT = sizeof(ENTRIES) / sizeof(ENTRIES[0]);
+
+/* *********************************************************************
+Function Name: create
+Purpose: Makes a strategy from its specification.
+Parameters:
+        spec, a string. A name and options, as described above.
+Return Value: The strategy, or nullptr, with an error message, if the
+        name or an option is not known or a file could not be opened.
+Algorithm:
+        1. Split the name from the options at the first colon, and the
+            options at commas into keys and values at "=".
+        2. Find the name in the table of registered strategies and
+            check every key against the options it accepts.
+        3. Call the entry's factory with the options.
+Reference: None
+********************************************************************* */
+std::unique_ptr<ComputerStrategy> StrategyRegistry::create(const std::string& spec) {
+    // 1. The name and options
+    std::string_view text = spec;
+    size_t colon = text.find(':');
+    std::string_view name = text.substr(0, colon);
+    Options options;
+
+    if (colon != std::string_view::npos) {
+        std::string_view rest = text.substr(colon + 1);
+        while (!rest.empty()) {
+            size_t comma = rest.find(',');
+            std::string_view option = rest.substr(0, comma);
+            size_t equals = option.find('=');
+
+            if (equals == std::string_view::npos || equals == 0) {
+                std::cerr << "Error: Strategy options are key=value: " << option << std::endl;
+                return nullptr;
+            }
+            options.emplace_back(std::string(option.substr(0, equals)), std::string(option.substr(equals + 1)));
+            rest = (comma == std::string_view::npos) ? std::string_view() : rest.substr(comma + 1);
+        }
+    }
+
+    // 2. The entry, and the options it takes
+    for (int e = 0; e < ENTRY_COUNT; ++e) {
+        if (name != ENTRIES[e].name) {
+            continue;
+        }
+
+        std::string accepted = std::string(",") + ENTRIES[e].options + ",";
+        for (const std::pair<std::string, std::string>& option : options) {
+            if (accepted.find("," + option.first + ",") == std::string::npos) {
+                std::cerr << "Error: Strategy " << ENTRIES[e].name << " has no option " << option.first << "." << std::endl;
+                return nullptr;
+            }
+        }
+
+        // 3. The strategy
+        return ENTRIES[e].make(options);
+    }
+
+    std::cerr << "Error: Unknown strategy: " << name << ". The strategies are:\n" << describe() << std::flush;
+    return nullptr;
+}
+
+/* *********************************************************************
+Function Name: describe
+Purpose: Lists the registered strategies for an error message or help.
+Parameters: None
+Return Value: One line per strategy, with the options it accepts.
+Algorithm: Format each entry of the table.
+Reference: None
+********************************************************************* */
+std::string StrategyRegistry::describe() {
+    std::string list;
+    for (int e = 0; e < ENTRY_COUNT; ++e) {
+        list += std::string("  ") + ENTRIES[e].name;
+        if (ENTRIES[e].options[0] != '\0') {
+            list += std::string(" (options: ") + ENTRIES[e].options + ")";
+        }
+        list += "\n";
+    }
+    return list;
+}
+
+/* *********************************************************************
+Function Name: getOption / getMilliseconds
+Purpose: Read one option's value.
+Parameters:
+        options, the Options passed by const reference.
+        key, a C string. The option's name.
+        fallback, the value if the option is absent.
+        outValue, an integer passed by reference. Receives the budget.
+Return Value: The value or the fallback. / Boolean true if the budget
+        is absent or a positive integer; false, with an error message,
+        otherwise.
+Algorithm: Scan the options for the key; the last one given wins.
+Reference: None
+********************************************************************* */
+std::string StrategyRegistry::getOption(const Options& options, const char* key, const std::string& fallback) {
+    std::string value = fallback;
+    for (const std::pair<std::string, std::string>& option : options) {
+        if (option.first == key) {
+            value = option.second;
+        }
+    }
+    return value;
+}
+
+bool StrategyRegistry::getMilliseconds(const Options& options, int fallback, int& outValue) {
+    std::string text = getOption(options, "ms", std::to_string(fallback));
+    const char* end = text.data() + text.size();
+    std::from_chars_result result = std::from_chars(text.data(), end, outValue);
+
+    if (result.ec != std::errc() || result.ptr != end || outValue <= 0) {
+        std::cerr << "Error: The ms option is a positive number of milliseconds: " << text << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/* *********************************************************************
+Function Name: makeGreedy / makeRandom / makeHeaviest / makeWeighted /
+        makeMonteCarlo / makeSolver / makeTablebase
+Purpose: The factories of the registered strategies.
+Parameters:
+        options, the Options passed by const reference. Already
+            checked against the entry's accepted keys.
+Return Value: The strategy, or nullptr, with an error message, if an
+        option's value is not usable.
+Algorithm: Read the options and construct the strategy, opening any
+        files it needs.
+Reference: None
+********************************************************************* */
+std::unique_ptr<ComputerStrategy> StrategyRegistry::makeGreedy(const Options&) {
+    return std::make_unique<HeuristicStrategy>();
+}
+
+std::unique_ptr<ComputerStrategy> StrategyRegistry::makeRandom(const Options& options) {
+    std::string text = getOption(options, "seed", "");
+    unsigned int seed = 0;
+    if (text.empty()) {
+        std::random_device device;
+        seed = device();
+    }
+    else {
+        const char* end = text.data() + text.size();
+        std::from_chars_result result = std::from_chars(text.data(), end, seed);
+        if (result.ec != std::errc() || result.ptr != end) {
+            std::cerr << "Error: The seed option is a number: " << text << std::endl;
+            return nullptr;
+        }
+    }
+    return std::make_unique<HeuristicStrategy>(seed);
+}
+
+std::unique_ptr<ComputerStrategy> StrategyRegistry::makeHeaviest(const Options&) {
+    return std::make_unique<HeuristicStrategy>(WeightedStrategy());
+}
+
+std::unique_ptr<ComputerStrategy> StrategyRegistry::makeWeighted(const Options& options) {
+    std::string filename = getOption(options, "file", "");
+    HeuristicTuner tuner;
+    if (filename.empty()) {
+        std::cerr << "Error: Strategy weighted needs file=<checkpoint>." << std::endl;
+        return nullptr;
+    }
+    if (!tuner.load(filename)) {
+        return nullptr;
+    }
+    return std::make_unique<HeuristicStrategy>(tuner.getStrategy());
+}
+
+std::unique_ptr<ComputerStrategy> StrategyRegistry::makeMonteCarlo(const Options& options) {
+    int milliseconds = 0;
+    if (!getMilliseconds(options, 100, milliseconds)) {
+        return nullptr;
+    }
+    return std::make_unique<MonteCarloStrategy>(milliseconds);
+}
+
+std::unique_ptr<ComputerStrategy> StrategyRegistry::makeSolver(const Options& options) {
+    int milliseconds = 0;
+    if (!getMilliseconds(options, 1000, milliseconds)) {
+        return nullptr;
+    }
+
+    std::unique_ptr<SearchStrategy> strategy = std::make_unique<SearchStrategy>(milliseconds, false);
+    std::string tablebase = getOption(options, "tablebase", "");
+    std::string evaluator = getOption(options, "evaluator", "");
+    if ((!tablebase.empty() && !strategy->openTablebase(tablebase))
+        || (!evaluator.empty() && !strategy->loadEvaluator(evaluator))) {
+        return nullptr;
+    }
+    return strategy;
+}
+
+std::unique_ptr<ComputerStrategy> StrategyRegistry::makeTablebase(const Options& options) {
+    std::string filename = getOption(options, "file", "");
+    if (filename.empty()) {
+        std::cerr << "Error: Strategy tablebase needs file=<tablebase>." << std::endl;
+        return nullptr;
+    }
+
+    // A table position is solved at once, so the shortest budget is enough
+    std::unique_ptr<SearchStrategy> strategy = std::make_unique<SearchStrategy>(1, true);
+    if (!strategy->openTablebase(filename)) {
+        return nullptr;
+    }
+    return strategy;
+}
\ No newline at end of file
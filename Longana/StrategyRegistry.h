@@ -0,0 +1,120 @@
+#ifndef STRATEGYREGISTRY_H
+#define STRATEGYREGISTRY_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ComputerStrategy.h"
+
+/* *********************************************************************
+Class Name: StrategyRegistry
+Purpose: Makes a ComputerStrategy from its specification, the form used
+        on the command line and in save files: a registered name,
+        optionally followed by a colon and comma-separated options, such
+        as "solver:ms=500,tablebase=endgames.bin". The registered
+        strategies are:
+            greedy      the Computer's first-fit rule
+            random      seed=<number, default from the system>
+            heaviest    the heaviest tile that fits
+            weighted    file=<HeuristicTuner checkpoint>
+            mcts        ms=<budget, default 100>
+            solver      ms=<budget, default 1000>, tablebase=<file>,
+                        evaluator=<file>
+            tablebase   file=<tablebase>, first-fit outside it
+********************************************************************* */
+class StrategyRegistry {
+public:
+
+    // A strategy's options, as key and value, in the order given
+    typedef std::vector<std::pair<std::string, std::string>> Options;
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: create
+    Purpose: Makes a strategy from its specification.
+    Parameters:
+            spec, a string. A name and options, as described above.
+    Return Value: The strategy, or nullptr, with an error message, if the
+            name or an option is not known or a file could not be opened.
+    Algorithm:
+            1. Split the name from the options at the first colon, and the
+                options at commas into keys and values at "=".
+            2. Find the name in the table of registered strategies and
+                check every key against the options it accepts.
+            3. Call the entry's factory with the options.
+    Reference: None
+    ********************************************************************* */
+    static std::unique_ptr<ComputerStrategy> create(const std::string& spec);
+
+    /* *********************************************************************
+    Function Name: describe
+    Purpose: Lists the registered strategies for an error message or help.
+    Parameters: None
+    Return Value: One line per strategy, with the options it accepts.
+    Algorithm: Format each entry of the table.
+    Reference: None
+    ********************************************************************* */
+    static std::string describe();
+
+private:
+
+    // A registered strategy: its name, the options it accepts and its factory
+    struct Entry {
+        const char* name;
+        const char* options;
+        std::unique_ptr<ComputerStrategy> (*make)(const Options& options);
+    };
+
+    static const Entry ENTRIES[];
+    static const int ENTRY_COUNT;
+
+    /* *********************************************************************
+    Function Name: getOption / getMilliseconds
+    Purpose: Read one option's value.
+    Parameters:
+            options, the Options passed by const reference.
+            key, a C string. The option's name.
+            fallback, the value if the option is absent.
+            outValue, an integer passed by reference. Receives the budget.
+    Return Value: The value or the fallback. / Boolean true if the budget
+            is absent or a positive integer; false, with an error message,
+            otherwise.
+    Algorithm: Scan the options for the key; the last one given wins.
+    Reference: None
+    ********************************************************************* */
+    static std::string getOption(const Options& options, const char* key, const std::string& fallback);
+    static bool getMilliseconds(const Options& options, int fallback, int& outValue);
+
+    /* *********************************************************************
+    Function Name: makeGreedy / makeRandom / makeHeaviest / makeWeighted /
+            makeMonteCarlo / makeSolver / makeTablebase
+    Purpose: The factories of the registered strategies.
+    Parameters:
+            options, the Options passed by const reference. Already
+                checked against the entry's accepted keys.
+    Return Value: The strategy, or nullptr, with an error message, if an
+            option's value is not usable.
+    Algorithm: Read the options and construct the strategy, opening any
+            files it needs.
+    Reference: None
+    ********************************************************************* */
+    static std::unique_ptr<ComputerStrategy> makeGreedy(const Options& options);
+    static std::unique_ptr<ComputerStrategy> makeRandom(const Options& options);
+    static std::unique_ptr<ComputerStrategy> makeHeaviest(const Options& options);
+    static std::unique_ptr<ComputerStrategy> makeWeighted(const Options& options);
+    static std::unique_ptr<ComputerStrategy> makeMonteCarlo(const Options& options);
+    static std::unique_ptr<ComputerStrategy> makeSolver(const Options& options);
+    static std::unique_ptr<ComputerStrategy> makeTablebase(const Options& options);
+};
+
+#endif
\ No newline at end of file
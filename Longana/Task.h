@@ -0,0 +1,224 @@
+#ifndef TASK_H
+#define TASK_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <new>
+#include <utility>
+
+#include "FramePool.h"
+
+/* *********************************************************************
+Class Name: Task
+Purpose: A coroutine that returns a value of type T, such as a turn that
+        waits for the Human's input (see TurnChannel). A task starts
+        suspended. The code that owns it calls start(), and the task runs
+        until it waits for something; whatever it waits for resumes it.
+        A task awaited by another task runs at once and resumes its
+        caller when it returns, so a round can await a turn the way it
+        would call a function.
+
+        If one of the coroutine's arguments has a getFramePool() member,
+        such as a TurnChannel, the frame comes from that FramePool;
+        otherwise it comes from the heap. Either way the frame begins
+        with the pool it came from, so it can be given back. Each
+        signature gets its own FramePromise (see the coroutine_traits
+        below), so the frame's operator new takes the arguments without
+        being a template and pairs with its operator delete. The project
+        uses no exceptions, so one that escapes a task ends the program.
+        The task owns its frame and can be moved but not copied.
+********************************************************************* */
+template <typename T>
+class Task {
+public:
+
+    // Room before each frame for the pool it came from, keeping the frame aligned
+    static const size_t HEADER_SIZE = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+    /* *********************************************************************
+    Class Name: Promise
+    Purpose: The state the compiler keeps with each task's frame: the
+            value returned and the coroutine to resume when the task is
+            done.
+    ********************************************************************* */
+    class Promise {
+    public:
+        Promise() : m_value(), m_caller() {}
+
+        inline std::suspend_always initial_suspend() noexcept { return {}; }
+        inline void return_value(T value) { m_value = std::move(value); }
+        inline void unhandled_exception() { std::terminate(); }
+
+        // Resume the awaiting task, if any, when this one returns
+        struct FinalAwaiter {
+            std::coroutine_handle<> caller;
+
+            inline bool await_ready() noexcept { return false; }
+            inline std::coroutine_handle<> await_suspend(std::coroutine_handle<>) noexcept {
+                return caller ? caller : std::noop_coroutine();
+            }
+            inline void await_resume() noexcept {}
+        };
+        inline FinalAwaiter final_suspend() noexcept { return { m_caller }; }
+
+    protected:
+
+        // The argument's pool, if it has one
+        template <typename Argument>
+        static FramePool* findPool(Argument& argument) {
+            if constexpr (requires { { argument.getFramePool() } -> std::same_as<FramePool&>; }) {
+                return &argument.getFramePool();
+            }
+            else {
+                return nullptr;
+            }
+        }
+
+    private:
+        friend class Task;
+
+        T m_value;
+        std::coroutine_handle<> m_caller;
+    };
+
+    /* *********************************************************************
+    Class Name: FramePromise
+    Purpose: The promise of a coroutine taking the given arguments, which
+            allocates its frame.
+    ********************************************************************* */
+    template <typename... Arguments>
+    class FramePromise : public Promise {
+    public:
+        inline Task get_return_object() {
+            return Task(std::coroutine_handle<FramePromise>::from_promise(*this), *this);
+        }
+
+        /* *********************************************************************
+        Function Name: operator new / operator delete
+        Purpose: Allocate a frame from the pool of the first argument that
+                has one, or from the heap, and give it back.
+        Parameters:
+                size, a size_t. The bytes the frame needs.
+                arguments, the coroutine's arguments, including the
+                    object for a member function.
+                frame, a pointer from operator new.
+        Return Value: A pointer to the frame. / None
+        Algorithm: Allocate HEADER_SIZE more bytes and store the pool, or
+                nullptr for the heap, in front of the frame; on release,
+                read it back.
+        Reference: None
+        ********************************************************************* */
+        static void* operator new(size_t size, Arguments&... arguments) {
+            FramePool* pool = nullptr;
+            ((pool = (pool != nullptr) ? pool : Promise::findPool(arguments)), ...);
+
+            void* block = (pool != nullptr) ? pool->allocate(size + HEADER_SIZE) : ::operator new(size + HEADER_SIZE);
+            *static_cast<FramePool**>(block) = pool;
+            return static_cast<unsigned char*>(block) + HEADER_SIZE;
+        }
+
+        static void operator delete(void* frame, size_t size) {
+            void* block = static_cast<unsigned char*>(frame) - HEADER_SIZE;
+            FramePool* pool = *static_cast<FramePool**>(block);
+            if (pool != nullptr) {
+                pool->release(block, size + HEADER_SIZE);
+            }
+            else {
+                ::operator delete(block);
+            }
+        }
+    };
+
+    /* --- Constructor --- */
+
+    Task(Task&& other) noexcept
+        : m_handle(std::exchange(other.m_handle, nullptr)), m_promise(std::exchange(other.m_promise, nullptr)) {}
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    /* --- Destructor --- */
+
+    /* *********************************************************************
+    Function Name: ~Task
+    Purpose: Destructor. Frees the frame, returning it to its pool.
+    Parameters: None
+    Return Value: None
+    Algorithm: Destroy the coroutine if the task still owns one.
+    Reference: None
+    ********************************************************************* */
+    ~Task() {
+        if (m_handle) {
+            m_handle.destroy();
+        }
+    }
+
+    /* --- Selectors --- */
+
+    /* *********************************************************************
+    Function Name: isDone / getResult
+    Purpose: Check whether the task has returned, and retrieve what it
+            returned.
+    Parameters: None
+    Return Value: Boolean true once it has returned. / The value, valid
+            once it has returned.
+    Algorithm: Ask the coroutine handle; read the promise.
+    Reference: None
+    ********************************************************************* */
+    inline bool isDone() const { return m_handle.done(); }
+    inline const T& getResult() const { return m_promise->m_value; }
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: start
+    Purpose: Runs the task until it first waits, or returns.
+    Parameters: None
+    Return Value: None
+    Algorithm: Resume the coroutine from its initial suspension.
+    Reference: None
+    ********************************************************************* */
+    inline void start() { m_handle.resume(); }
+
+    /* *********************************************************************
+    Function Name: await_ready / await_suspend / await_resume
+    Purpose: Let another task co_await this one as a call.
+    Parameters:
+            caller, the handle of the awaiting coroutine.
+    Return Value: False, since the task has not started. / This task's
+            handle, to run now. / The value it returned.
+    Algorithm: Remember the caller, whose resumption the final
+            suspension hands back to, and transfer control to this task.
+    Reference: Lewis Baker (2020), "C++ Coroutines: Understanding
+            Symmetric Transfer"
+    ********************************************************************* */
+    inline bool await_ready() const noexcept { return false; }
+    inline std::coroutine_handle<> await_suspend(std::coroutine_handle<> caller) noexcept {
+        m_promise->m_caller = caller;
+        return m_handle;
+    }
+    inline T await_resume() { return std::move(m_promise->m_value); }
+
+private:
+
+    std::coroutine_handle<> m_handle;
+    Promise* m_promise;
+
+    Task(std::coroutine_handle<> handle, Promise& promise) : m_handle(handle), m_promise(&promise) {}
+};
+
+// The promise of a coroutine returning a Task, chosen by its argument types
+template <typename T, typename... Arguments>
+struct std::coroutine_traits<Task<T>, Arguments...> {
+    using promise_type = typename Task<T>::template FramePromise<Arguments...>;
+};
+
+#endif
\ No newline at end of file
@@ -5,7 +5,10 @@
  * Date:  02/12/2026                                        *
  ************************************************************/
 
+#include <charconv>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "Tile.h"
 
@@ -65,6 +68,27 @@ bool Tile::operator==(const Tile& other) const {
     return standardMatch || flippedMatch;
 }
 
+/* *********************************************************************
+Function Name: getIndex
+Purpose: Maps the tile to its position in a double-six set, ignoring
+        orientation. A tile [a|b] with a <= b has the index
+        b * (b + 1) / 2 + a, so 0-0 is 0, 0-1 is 1, 1-1 is 2, 0-2 is 3,
+        and 6-6 is 27. Used wherever a whole set is stored compactly.
+Parameters: None
+Return Value: An integer between 0 and TILE_COUNT - 1.
+Algorithm:
+        1. Order the pips so that low <= high.
+        2. Return high * (high + 1) / 2 + low.
+Reference: None
+********************************************************************* */
+int Tile::getIndex() const {
+    int low = (m_left_pips < m_right_pips) ? m_left_pips : m_right_pips;
+    int high = (m_left_pips < m_right_pips) ? m_right_pips : m_left_pips;
+
+    // Each high value h starts a run of h + 1 tiles (0-h through h-h)
+    return high * (high + 1) / 2 + low;
+}
+
 /* *********************************************************************
 Function Name: setLeftPips
 Purpose: Safely updates the pip value on the left side of the tile.
@@ -138,4 +162,138 @@ Reference: None
 std::string Tile::toString() const {
     // Format the tile for serialization (e.g., "3-4")
     return std::to_string(m_left_pips) + "-" + std::to_string(m_right_pips);
+}
+
+/* *********************************************************************
+Function Name: fromString
+Purpose: Parses a single "L-R" token (e.g., "6-1") into a tile without
+        allocating. Used by every loader that reads saved game data.
+Parameters:
+        token, a std::string_view passed by value. The characters of
+            one tile, with no surrounding whitespace.
+        outTile, a Tile object passed by reference. Receives the
+            parsed tile when the token is valid.
+Return Value: Boolean true if the token is a well-formed tile with both
+        pip values in range, false otherwise.
+Algorithm:
+        1. Convert the leading digits to the left pips using std::from_chars.
+        2. Require a dash immediately after the left pips.
+        3. Convert the remaining digits to the right pips and require
+            that they consume the rest of the token.
+        4. Reject either value if it falls outside MIN_PIPS to MAX_PIPS.
+        5. Assign both values to outTile and return true.
+Reference: C++ Standard Library Documentation for std::from_chars
+********************************************************************* */
+bool Tile::fromString(std::string_view token, Tile& outTile) {
+    const char* first = token.data();
+    const char* last = token.data() + token.size();
+    int left = 0;
+    int right = 0;
+
+    // Read the left pips, which must be followed directly by the dash
+    std::from_chars_result result = std::from_chars(first, last, left);
+    if (result.ec != std::errc() || result.ptr == last || *result.ptr != '-') {
+        return false;
+    }
+
+    // Read the right pips, which must run to the end of the token
+    result = std::from_chars(result.ptr + 1, last, right);
+    if (result.ec != std::errc() || result.ptr != last) {
+        return false;
+    }
+
+    // Reject values a double-six set cannot contain instead of clamping them
+    if (left < MIN_PIPS || left > MAX_PIPS || right < MIN_PIPS || right > MAX_PIPS) {
+        return false;
+    }
+
+    outTile.m_left_pips = left;
+    outTile.m_right_pips = right;
+    return true;
+}
+
+/* *********************************************************************
+Function Name: listFromString
+Purpose: Parses a whitespace-delimited list of tiles (e.g., "6-6 1-0
+        4-2"), the form every hand, boneyard and layout takes in a save.
+Parameters:
+        data, a std::string_view passed by value. The raw characters
+            of the list.
+        hasMarkers, a boolean passed by value. True if the "L" and "R"
+            end markers of a layout may appear and should be skipped.
+        outTiles, a vector of Tiles passed by reference. Cleared, then
+            receives the tiles in order.
+        errorOffset, a size_t passed by reference. Receives the offset
+            within data of the first malformed token, if any.
+Return Value: Boolean true if every token was a valid tile or an
+        allowed marker, false otherwise.
+Algorithm:
+        1. Clear outTiles.
+        2. Walk the view, skipping whitespace between tokens.
+        3. For each token:
+            a. Skip it if markers are allowed and it is "L" or "R".
+            b. Convert it with fromString, recording its offset and
+                returning false if it is malformed.
+            c. Push the tile onto outTiles.
+        4. Return true once the whole view has been consumed.
+Reference: None
+********************************************************************* */
+bool Tile::listFromString(std::string_view data, bool hasMarkers, std::vector<Tile>& outTiles, size_t& errorOffset) {
+    outTiles.clear();
+
+    size_t pos = 0;
+    while (pos < data.size()) {
+        // Skip the whitespace that separates tiles
+        if (data[pos] == ' ' || data[pos] == '\t' || data[pos] == '\r' || data[pos] == '\n') {
+            ++pos;
+            continue;
+        }
+
+        // The token runs until the next whitespace character or the end of the view
+        size_t end = data.find_first_of(" \t\r\n", pos);
+        if (end == std::string_view::npos) { end = data.size(); }
+
+        // Skip the end markers written around the line of play
+        if (hasMarkers && end - pos == 1 && (data[pos] == 'L' || data[pos] == 'R')) {
+            pos = end;
+            continue;
+        }
+
+        Tile tile;
+        if (!fromString(data.substr(pos, end - pos), tile)) {
+            errorOffset = pos;
+            return false;
+        }
+
+        outTiles.push_back(tile);
+        pos = end;
+    }
+
+    return true;
+}
+
+/* *********************************************************************
+Function Name: fromIndex
+Purpose: Builds the tile that getIndex() maps to the given index, with
+        the lower pip value on the left.
+Parameters:
+        index, an integer passed by value. A value between 0 and
+            TILE_COUNT - 1.
+Return Value: The corresponding Tile object.
+Algorithm:
+        1. Find the largest high value whose first index,
+            high * (high + 1) / 2, does not exceed the index.
+        2. The low value is the remaining offset.
+        3. Return Tile(low, high).
+Reference: None
+********************************************************************* */
+Tile Tile::fromIndex(int index) {
+    int high = 0;
+
+    // Walk up the runs until the index falls inside the run for 'high'
+    while ((high + 1) * (high + 2) / 2 <= index) {
+        ++high;
+    }
+
+    return Tile(index - high * (high + 1) / 2, high);
 }
\ No newline at end of file
@@ -9,6 +9,10 @@
  ************************************************************/
 
 #include <string>
+#include <string_view>
+#include <vector>
+
+#include "DominoSet.h"
 
 /* *********************************************************************
 Class Name: Tile
@@ -106,6 +110,21 @@ public:
     ********************************************************************* */
     inline bool isDouble() const { return m_left_pips == m_right_pips; }
 
+    /* *********************************************************************
+    Function Name: getIndex
+    Purpose: Maps the tile to its position in a double-six set, ignoring
+            orientation. A tile [a|b] with a <= b has the index
+            b * (b + 1) / 2 + a, so 0-0 is 0, 0-1 is 1, 1-1 is 2, 0-2 is 3,
+            and 6-6 is 27. Used wherever a whole set is stored compactly.
+    Parameters: None
+    Return Value: An integer between 0 and TILE_COUNT - 1.
+    Algorithm:
+            1. Order the pips so that low <= high.
+            2. Return high * (high + 1) / 2 + low.
+    Reference: None
+    ********************************************************************* */
+    int getIndex() const;
+
     /* *********************************************************************
     Function Name: operator==
     Purpose: Determines if two tiles are identical, accounting for the fact
@@ -180,10 +199,82 @@ public:
     ********************************************************************* */
     std::string toString() const;
 
+    /* *********************************************************************
+    Function Name: fromString
+    Purpose: Parses a single "L-R" token (e.g., "6-1") into a tile without
+            allocating. Used by every loader that reads saved game data.
+    Parameters:
+            token, a std::string_view passed by value. The characters of
+                one tile, with no surrounding whitespace.
+            outTile, a Tile object passed by reference. Receives the
+                parsed tile when the token is valid.
+    Return Value: Boolean true if the token is a well-formed tile with both
+            pip values in range, false otherwise.
+    Algorithm:
+            1. Convert the leading digits to the left pips using std::from_chars.
+            2. Require a dash immediately after the left pips.
+            3. Convert the remaining digits to the right pips and require
+                that they consume the rest of the token.
+            4. Reject either value if it falls outside MIN_PIPS to MAX_PIPS.
+            5. Assign both values to outTile and return true.
+    Reference: C++ Standard Library Documentation for std::from_chars
+    ********************************************************************* */
+    static bool fromString(std::string_view token, Tile& outTile);
+
+    /* *********************************************************************
+    Function Name: listFromString
+    Purpose: Parses a whitespace-delimited list of tiles (e.g., "6-6 1-0
+            4-2"), the form every hand, boneyard and layout takes in a save.
+    Parameters:
+            data, a std::string_view passed by value. The raw characters
+                of the list.
+            hasMarkers, a boolean passed by value. True if the "L" and "R"
+                end markers of a layout may appear and should be skipped.
+            outTiles, a vector of Tiles passed by reference. Cleared, then
+                receives the tiles in order.
+            errorOffset, a size_t passed by reference. Receives the offset
+                within data of the first malformed token, if any.
+    Return Value: Boolean true if every token was a valid tile or an
+            allowed marker, false otherwise.
+    Algorithm:
+            1. Clear outTiles.
+            2. Walk the view, skipping whitespace between tokens.
+            3. For each token:
+                a. Skip it if markers are allowed and it is "L" or "R".
+                b. Convert it with fromString, recording its offset and
+                    returning false if it is malformed.
+                c. Push the tile onto outTiles.
+            4. Return true once the whole view has been consumed.
+    Reference: None
+    ********************************************************************* */
+    static bool listFromString(std::string_view data, bool hasMarkers, std::vector<Tile>& outTiles, size_t& errorOffset);
+
+    /* *********************************************************************
+    Function Name: fromIndex
+    Purpose: Builds the tile that getIndex() maps to the given index, with
+            the lower pip value on the left.
+    Parameters:
+            index, an integer passed by value. A value between 0 and
+                TILE_COUNT - 1.
+    Return Value: The corresponding Tile object.
+    Algorithm:
+            1. Find the largest high value whose first index,
+                high * (high + 1) / 2, does not exceed the index.
+            2. The low value is the remaining offset.
+            3. Return Tile(low, high).
+    Reference: None
+    ********************************************************************* */
+    static Tile fromIndex(int index);
+
+    /* --- Constants --- */
+
+    // The number of distinct tiles in a double-six set
+    static const int TILE_COUNT = StandardSet::TILE_COUNT;
+
 private:
     /* --- Constants --- */
     static const int MIN_PIPS = 0;
-    static const int MAX_PIPS = 6;
+    static const int MAX_PIPS = StandardSet::MAX_PIPS;
 
     /* --- Variables --- */
     int m_left_pips;
@@ -7,9 +7,17 @@
 
 #include <iostream>
 #include <ios>
+#include <memory>
+#include <string>
+#include <utility>
 
+#include "GameLog.h"
 #include "Round.h"
+#include "Serializer.h"
+#include "StrategyRegistry.h"
+#include "Task.h"
 #include "Tournament.h"
+#include "TurnChannel.h"
 
 /* *********************************************************************
 Function Name: playTournament
@@ -26,7 +34,9 @@ Algorithm:
             scores are below the target score.
         4. Within the loop, instantiate a Round object, passing in
             the current tournament state (scores and round number).
-        5. Call playRound() to execute the game logic for that round.
+        5. Run playRound() on a TurnChannel fed from std::cin to execute
+            the game logic for that round; stop if the Human saved or
+            quit.
         6. Retrieve the updated scores from the Round object and update
             the tournament's persistent score variables.
         7. If the tournament is not yet won, wait for user input and
@@ -59,6 +69,9 @@ void Tournament::playTournament() {
         std::cout << "Resuming Tournament. Target score: " << m_targetScore << "\n" << std::endl;
     }
 
+    // Every round reads the Human's words through one channel
+    TurnChannel channel(std::cout);
+
     // --- Step 2: Main Tournament Loop ---
     while (m_totalHumanScore < m_targetScore && m_totalComputerScore < m_targetScore) {
 
@@ -70,6 +83,9 @@ void Tournament::playTournament() {
         currentRound.setTargetScore(m_targetScore);
         currentRound.setScores(m_totalHumanScore, m_totalComputerScore);
         currentRound.setRoundNumber(m_roundNumber);
+        currentRound.setGameLog(m_gameLog);
+        currentRound.setStrategy(m_strategy.get());
+        currentRound.setOutput(channel.getOutput());
 
         // --- PREPARE STEP: Deal Cards ---
         if (!m_isResumed) {
@@ -78,23 +94,41 @@ void Tournament::playTournament() {
             // This function SHUFFLES and DEALS the cards.
             // Without this, everyone has 0 cards and the game ends instantly.
             currentRound.prepareRound(m_roundNumber);
+
+            if (m_gameLog != nullptr) {
+                m_gameLog->recordDeal(m_roundNumber, currentRound.getSeed(), m_targetScore,
+                    m_totalHumanScore, m_totalComputerScore);
+            }
         }
         else {
             std::cout << "Resuming Round " << m_roundNumber << " from saved state. . .\n";
             m_isResumed = false;
+
+            // A resumed round cannot be re-dealt from its seed, so log the whole position
+            if (m_gameLog != nullptr) {
+                unsigned char snapshot[Serializer::BINARY_SIZE];
+                Serializer::encodeBinary(*this, snapshot);
+                m_gameLog->recordSnapshot(snapshot);
+            }
         }
 
         // --- PLAY STEP: Execute Logic ---
-        currentRound.playRound(*this);
+        Task<bool> round = currentRound.playRound(*this, channel);
+        if (!channel.runConsole(round, std::cin)) {
+            return;
+        }
 
         // --- UPDATE STEP: Get Results ---
         m_totalHumanScore = currentRound.getHumanScore();
         m_totalComputerScore = currentRound.getComputerScore();
 
         if (m_totalHumanScore < m_targetScore && m_totalComputerScore < m_targetScore) {
+            // The channel has already read the last line; drop what the round left of it
             std::cout << "Press Enter to start the next round...";
-            std::cin.ignore();
-            std::cin.get();
+            channel.discardLine();
+
+            std::string line;
+            std::getline(std::cin, line);
             m_roundNumber++;
         }
     }
@@ -102,6 +136,36 @@ void Tournament::playTournament() {
     announceWinner();
 }
 
+/* *********************************************************************
+Function Name: setStrategy
+Purpose: To choose the Computer's strategy by name, from the command
+        line or a save file.
+Parameters:
+        spec, a string. A specification accepted by
+            StrategyRegistry::create(), or empty for the
+            DEFAULT_STRATEGY.
+Return Value: Boolean true if the strategy was made; false, with an
+        error message, otherwise, leaving the strategy unchanged.
+Algorithm:
+        1. Make the strategy from the specification, or the
+            DEFAULT_STRATEGY if it is empty. Stop if that fails.
+        2. Replace the owned strategy and its name.
+Reference: None
+********************************************************************* */
+bool Tournament::setStrategy(const std::string& spec) {
+    // 1. The new strategy
+    std::unique_ptr<ComputerStrategy> strategy = StrategyRegistry::create(spec.empty() ? DEFAULT_STRATEGY : spec);
+    if (strategy == nullptr) {
+        return false;
+    }
+
+    // 2. In place of the old one
+    m_strategy = std::move(strategy);
+    m_strategyName = spec;
+    m_currentRound.setStrategy(m_strategy.get());
+    return true;
+}
+
 /* *********************************************************************
 Function Name: announceWinner
 Purpose: Compares the final tournament scores and outputs the final
@@ -8,11 +8,18 @@
  * Date:  02/12/2026                                        *
  ************************************************************/
 
+#include <memory>
+#include <string>
+
+#include "ComputerStrategy.h"
 #include "Round.h"
+#include "StrategyRegistry.h"
 #include "Hand.h"
 #include "Layout.h"
 #include "Stock.h"
 
+class GameLog;
+
 /* *********************************************************************
 Class Name: Tournament
 Purpose: Acts as the high-level controller for the Longana game. It
@@ -23,6 +30,9 @@ Purpose: Acts as the high-level controller for the Longana game. It
 class Tournament {
 public:
 
+    // The strategy the Computer plays until another is chosen
+    static constexpr const char* DEFAULT_STRATEGY = "greedy";
+
     /* --- Constructor --- */
 
     /* *********************************************************************
@@ -37,12 +47,17 @@ public:
              3. Set m_roundNumber to 1.
              4. Set m_isResumed to false.
              5. Set m_currentRound to 1, 0, 0, 0.
+             6. Set m_gameLog to nullptr. Make the DEFAULT_STRATEGY
+                for the Computer, with an empty name, and give it to the
+                round.
     Reference: None
     ********************************************************************* */
     Tournament()
         : m_totalHumanScore(0), m_totalComputerScore(0), m_targetScore(0), 
-        m_roundNumber(1), m_isResumed(false), m_currentRound(1, 0, 0, 0)
+        m_roundNumber(1), m_isResumed(false), m_currentRound(1, 0, 0, 0), m_gameLog(nullptr),
+        m_strategy(StrategyRegistry::create(DEFAULT_STRATEGY))
     {
+        m_currentRound.setStrategy(m_strategy.get());
     }
 
     /* --- Destructor --- */
@@ -174,6 +189,39 @@ public:
         return m_currentRound.isHumanTurn() ? m_currentRound.getComputerPassed() : m_currentRound.getHumanPassed(); 
     }
 
+    /* *********************************************************************
+    Function Name: getHumanPassed
+    Purpose: To determine if the human player passed their last turn.
+    Parameters: None
+    Return Value: A boolean; true if the human passed, false otherwise.
+    Algorithm: Returns the result of the getHumanPassed() call from the
+            m_currentRound member object.
+    Reference: None
+    ********************************************************************* */
+    inline bool getHumanPassed() const { return m_currentRound.getHumanPassed(); }
+
+    /* *********************************************************************
+    Function Name: getComputerPassed
+    Purpose: To determine if the computer player passed its last turn.
+    Parameters: None
+    Return Value: A boolean; true if the computer passed, false otherwise.
+    Algorithm: Returns the result of the getComputerPassed() call from the
+            m_currentRound member object.
+    Reference: None
+    ********************************************************************* */
+    inline bool getComputerPassed() const { return m_currentRound.getComputerPassed(); }
+
+    /* *********************************************************************
+    Function Name: getSeed
+    Purpose: To retrieve the seed that shuffled the current round's boneyard.
+    Parameters: None
+    Return Value: An unsigned integer seed.
+    Algorithm: Returns the result of the getSeed() call from the
+            m_currentRound member object.
+    Reference: None
+    ********************************************************************* */
+    inline unsigned int getSeed() const { return m_currentRound.getSeed(); }
+
     /* *********************************************************************
     Function Name: getCurrentRound
     Purpose: To provide a non-const reference to the current round object.
@@ -185,6 +233,29 @@ public:
     ********************************************************************* */
     inline Round& getCurrentRound() { return m_currentRound; }
 
+    /* *********************************************************************
+    Function Name: getCurrentRound
+    Purpose: To provide read-only access to the current round object, for
+            analysis that must not disturb the game.
+    Parameters: None
+    Return Value: A const reference to the current Round object.
+    Algorithm: Returns the m_currentRound member variable.
+    Reference: None
+    ********************************************************************* */
+    inline const Round& getCurrentRound() const { return m_currentRound; }
+
+    /* *********************************************************************
+    Function Name: getStrategyName
+    Purpose: To retrieve the specification of the Computer's strategy, as
+            it is written to a save file.
+    Parameters: None
+    Return Value: A constant string reference; empty for the
+            DEFAULT_STRATEGY.
+    Algorithm: Returns the m_strategyName member variable.
+    Reference: None
+    ********************************************************************* */
+    inline const std::string& getStrategyName() const { return m_strategyName; }
+
     /* --- Mutators --- */
 
     /* *********************************************************************
@@ -275,6 +346,38 @@ public:
     ********************************************************************* */
     void setIsResumed(bool resumed) { m_isResumed = resumed; }
 
+    /* *********************************************************************
+    Function Name: setGameLog
+    Purpose: To record the game to a log. Each round is logged from its
+            deal (or from a snapshot if it was resumed), followed by every
+            turn played.
+    Parameters:
+            gameLog, a pointer to an open GameLog, or nullptr. The
+                tournament does not take ownership.
+    Return Value: None (void)
+    Algorithm: Assigns the gameLog parameter to the m_gameLog member variable.
+    Reference: None
+    ********************************************************************* */
+    inline void setGameLog(GameLog* gameLog) { m_gameLog = gameLog; }
+
+    /* *********************************************************************
+    Function Name: setStrategy
+    Purpose: To choose the Computer's strategy by name, from the command
+            line or a save file.
+    Parameters:
+            spec, a string. A specification accepted by
+                StrategyRegistry::create(), or empty for the
+                DEFAULT_STRATEGY.
+    Return Value: Boolean true if the strategy was made; false, with an
+            error message, otherwise, leaving the strategy unchanged.
+    Algorithm:
+            1. Make the strategy from the specification, or the
+                DEFAULT_STRATEGY if it is empty. Stop if that fails.
+            2. Replace the owned strategy and its name.
+    Reference: None
+    ********************************************************************* */
+    bool setStrategy(const std::string& spec);
+
     /* --- Utility Functions --- */
 
     /* *********************************************************************
@@ -292,7 +395,9 @@ public:
                 scores are below the target score.
             4. Within the loop, instantiate a Round object, passing in
                 the current tournament state (scores and round number).
-            5. Call playRound() to execute the game logic for that round.
+            5. Run playRound() on a TurnChannel fed from std::cin to execute
+                the game logic for that round; stop if the Human saved or
+                quit.
             6. Retrieve the updated scores from the Round object and update
                 the tournament's persistent score variables.
             7. If the tournament is not yet won, wait for user input and
@@ -312,6 +417,13 @@ private:
 
     Round m_currentRound;
 
+    // Optional log the tournament is recorded to (not owned)
+    GameLog* m_gameLog;
+
+    // The Computer's strategy and its specification, empty for the DEFAULT_STRATEGY
+    std::unique_ptr<ComputerStrategy> m_strategy;
+    std::string m_strategyName;
+
     /* *********************************************************************
     Function Name: announceWinner
     Purpose: Compares the final tournament scores and outputs the final
@@ -0,0 +1,316 @@
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <bit>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "GreedyStrategy.h"
+#include "HeuristicStrategy.h"
+#include "Playout.h"
+#include "RandomStrategy.h"
+#include "StrategyRegistry.h"
+#include "TrainingData.h"
+
+/* *********************************************************************
+Function Name: TrainingData
+Purpose: Default constructor. No file is open.
+Parameters: None
+Return Value: None
+Algorithm: Null the records and zero the count.
+Reference: None
+********************************************************************* */
+TrainingData::TrainingData()
+    : m_records(nullptr), m_count(0)
+{
+}
+
+/* *********************************************************************
+Function Name: findStrategy
+Purpose: Checks a strategy's specification and finds how to play it.
+Parameters:
+        name, a string. Any specification StrategyRegistry accepts.
+Return Value: STRATEGY_GREEDY or STRATEGY_RANDOM for those fixed
+        rules, which are played directly as policies;
+        STRATEGY_REGISTERED for any other strategy; or -1, with an
+        error message, if the registry could not make it.
+Algorithm: Make the strategy once and ask a HeuristicStrategy for
+        its rule.
+Reference: None
+********************************************************************* */
+int TrainingData::findStrategy(const std::string& name) {
+    std::unique_ptr<ComputerStrategy> strategy = StrategyRegistry::create(name);
+    if (!strategy) {
+        return -1;
+    }
+
+    const HeuristicStrategy* heuristic = dynamic_cast<const HeuristicStrategy*>(strategy.get());
+    if (heuristic != nullptr && heuristic->getRule() == HeuristicStrategy::RULE_FIRST_FIT) {
+        return STRATEGY_GREEDY;
+    }
+    if (heuristic != nullptr && heuristic->getRule() == HeuristicStrategy::RULE_RANDOM) {
+        return STRATEGY_RANDOM;
+    }
+    return STRATEGY_REGISTERED;
+}
+
+/* *********************************************************************
+Function Name: open
+Purpose: Maps a file written by generate().
+Parameters:
+        filename, a string representing the file path.
+Return Value: Boolean true if the file was mapped and holds every
+        record its header counts; false, with an error message,
+        otherwise.
+Algorithm:
+        1. Map the file.
+        2. Check the magic bytes, the version and the record size.
+        3. Read the count and check the file is long enough.
+Reference: None
+********************************************************************* */
+bool TrainingData::open(const std::string& filename) {
+    m_records = nullptr;
+    m_count = 0;
+
+    // 1. The file
+    if (!m_file.open(filename)) {
+        std::cerr << "Error: Could not open training data: " << filename << std::endl;
+        return false;
+    }
+
+    // 2. The header
+    const unsigned char* data = m_file.getData();
+    if (m_file.getSize() < static_cast<size_t>(HEADER_SIZE) || std::memcmp(data, "LGTD", 4) != 0
+        || data[4] != FILE_VERSION || data[5] != sizeof(Record)) {
+        std::cerr << "Error: Not a training data file of this version: " << filename << std::endl;
+        m_file.close();
+        return false;
+    }
+
+    // 3. The records
+    uint64_t count = 0;
+    std::memcpy(&count, data + 8, sizeof(count));
+    if (count > (m_file.getSize() - HEADER_SIZE) / sizeof(Record)) {
+        std::cerr << "Error: Training data file is cut short: " << filename << std::endl;
+        m_file.close();
+        return false;
+    }
+
+    m_records = reinterpret_cast<const Record*>(data + HEADER_SIZE);
+    m_count = static_cast<long long>(count);
+    return true;
+}
+
+/* *********************************************************************
+Function Name: generate
+Purpose: Plays self-play tournaments until a number of positions are
+        recorded, and writes them to a file.
+Parameters:
+        filename, a string representing the output path.
+        recordCount, the most records to write, more than 0.
+        humanStrategy, computerStrategy, strings. The specification of
+            each player's strategy, as accepted by findStrategy().
+        targetScore, an integer. The score that ends a tournament.
+        threadCount, an integer. The number of worker threads, or 0 for
+            one per hardware thread.
+        seed, an unsigned integer. With one thread, the same seed
+            writes the same file.
+Return Value: The number of records written, or -1, with an error
+        message, if a strategy is not known or the file could not be
+        made.
+Algorithm:
+        1. Find the strategies and make each thread its own copy of
+            a registered one, then make the file at full size and map
+            it.
+        2. Start the threads, each playing tournaments with
+            playGames() until a round no longer fits.
+        3. Write the header, unmap the file and cut it to the records
+            written.
+Reference: None
+********************************************************************* */
+long long TrainingData::generate(const std::string& filename, long long recordCount, const std::string& humanStrategy,
+    const std::string& computerStrategy, int targetScore, int threadCount, unsigned int seed) {
+    if (recordCount <= 0 || targetScore <= 0) {
+        std::cerr << "Error: Self-play needs a positive number of positions and target score." << std::endl;
+        return -1;
+    }
+
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::thread::hardware_concurrency());
+        if (threadCount <= 0) { threadCount = 1; }
+    }
+
+    // 1. The strategies, with each thread's own copy of a registered one, since a search keeps state between moves
+    std::string specs[2] = { humanStrategy, computerStrategy };
+    int strategies[2] = { findStrategy(humanStrategy), findStrategy(computerStrategy) };
+    if (strategies[0] < 0 || strategies[1] < 0) {
+        return -1;
+    }
+
+    std::vector<std::unique_ptr<ComputerStrategy>> copies(2 * static_cast<size_t>(threadCount));
+    std::vector<ComputerStrategy*> players(copies.size(), nullptr);
+    for (size_t c = 0; c < copies.size(); ++c) {
+        if (strategies[c % 2] == STRATEGY_REGISTERED) {
+            copies[c] = StrategyRegistry::create(specs[c % 2]);
+            if (!copies[c]) {
+                return -1;
+            }
+            players[c] = copies[c].get();
+        }
+    }
+
+    MappedFile file;
+    if (!file.create(filename, HEADER_SIZE + static_cast<size_t>(recordCount) * sizeof(Record))) {
+        std::cerr << "Error: Could not create training data file: " << filename << std::endl;
+        return -1;
+    }
+
+    Output output;
+    output.records = reinterpret_cast<Record*>(file.getWritableData() + HEADER_SIZE);
+    output.capacity = recordCount;
+    output.next = 0;
+    output.end = recordCount;
+    output.gameNumber = 0;
+
+    // 2. The tournaments
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threadCount; ++t) {
+        workers.emplace_back(&TrainingData::playGames, std::ref(output), strategies, players.data() + 2 * t,
+            targetScore, seed);
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    // 3. The header, then the file cut to the records
+    uint64_t count = static_cast<uint64_t>(output.end.load());
+    unsigned char header[HEADER_SIZE] = { 'L', 'G', 'T', 'D', FILE_VERSION, sizeof(Record) };
+    std::memcpy(header + 8, &count, sizeof(count));
+    std::memcpy(file.getWritableData(), header, HEADER_SIZE);
+    file.close();
+
+    std::error_code error;
+    std::filesystem::resize_file(filename, HEADER_SIZE + count * sizeof(Record), error);
+    if (error) {
+        std::cerr << "Error: Could not trim training data file: " << filename << std::endl;
+    }
+    return static_cast<long long>(count);
+}
+
+/* *********************************************************************
+Function Name: playGames
+Purpose: Plays tournaments and writes their positions until a round
+        no longer fits in the file. The body of each writing thread.
+Parameters:
+        output, an Output passed by reference. Shared by the threads.
+        strategies, an array of two integers. How each player's
+            strategy is played, as returned by findStrategy().
+        players, an array of two ComputerStrategy pointers. This
+            thread's own copy of each registered strategy, null for
+            the fixed rules.
+        targetScore, seed. As for generate().
+Return Value: None
+Algorithm:
+        1. Take the next game number and seed a generator from it.
+        2. Deal each round with Playout::dealRound and record the
+            position before every turn, then the tile placed.
+        3. When the round is over, copy the points into its records,
+            claim room for them and copy them into the file; stop if
+            the claim does not fit, after marking where the file ends.
+        4. Add the points to the scores and deal the next round until
+            a score reaches the target.
+Reference: None
+********************************************************************* */
+void TrainingData::playGames(Output& output, const int* strategies, ComputerStrategy* const* players,
+    int targetScore, unsigned int seed) {
+    std::vector<Record> round;
+    GreedyStrategy greedy;
+
+    while (true) {
+        // 1. The tournament's own generator, so its games do not depend on the thread
+        uint32_t gameNumber = output.gameNumber.fetch_add(1);
+        std::mt19937 generator(seed + gameNumber * 2654435761U);
+        RandomStrategy random(generator);
+
+        int scores[2] = { 0, 0 };
+        for (int roundNumber = 1; scores[0] < targetScore && scores[1] < targetScore; ++roundNumber) {
+            Playout position;
+            position.dealRound(roundNumber, static_cast<unsigned int>(generator()));
+            round.clear();
+
+            // 2. Every turn
+            while (!position.isOver()) {
+                Record record = {};
+                int mover = position.getMover();
+
+                for (int player = 0; player < 2; ++player) {
+                    record.hands[player] = position.getHandMask(player);
+                    record.scores[player] = static_cast<uint16_t>(scores[player]);
+                    record.armEnds[player] = static_cast<uint8_t>(position.getArmEnd(player));
+                }
+                for (int i = 0; i < position.getBoneyardSize(); ++i) {
+                    unsigned char packed = position.getBoneyardPacked(i);
+                    record.boneyard |= StandardSet::getBit(StandardSet::getIndex(packed & 0x0F, packed >> 4));
+                }
+                record.boneyardSize = static_cast<uint8_t>(position.getBoneyardSize());
+                record.mover = static_cast<uint8_t>(mover);
+                record.flags = static_cast<uint8_t>((position.hasPassed(Playout::HUMAN) ? HUMAN_PASSED : 0)
+                    | (position.hasPassed(Playout::COMPUTER) ? COMPUTER_PASSED : 0));
+                record.roundNumber = static_cast<uint8_t>(roundNumber);
+                record.gameNumber = gameNumber;
+
+                // A tile drawn and placed at once leaves the hand as it was; it was the top of the boneyard
+                unsigned char top = (position.getBoneyardSize() > 0) ? position.getBoneyardPacked(0) : 0;
+                bool isPlaced = false;
+                if (strategies[mover] == STRATEGY_GREEDY) {
+                    isPlaced = position.playTurn(greedy);
+                }
+                else if (strategies[mover] == STRATEGY_RANDOM) {
+                    isPlaced = position.playTurn(random);
+                }
+                else {
+                    isPlaced = position.playTurn(*players[mover]);
+                }
+
+                record.moveTile = NO_TILE;
+                if (isPlaced) {
+                    uint32_t left = record.hands[mover] & ~static_cast<uint32_t>(position.getHandMask(mover));
+                    record.moveTile = static_cast<uint8_t>((left != 0) ? std::countr_zero(left)
+                        : StandardSet::getIndex(top & 0x0F, top >> 4));
+                }
+                round.push_back(record);
+            }
+
+            // 3. The outcome, then room in the file
+            for (Record& record : round) {
+                record.points[0] = static_cast<uint16_t>(position.getPoints(Playout::HUMAN));
+                record.points[1] = static_cast<uint16_t>(position.getPoints(Playout::COMPUTER));
+            }
+
+            long long count = static_cast<long long>(round.size());
+            long long first = output.next.fetch_add(count);
+            if (first + count > output.capacity) {
+                long long end = output.end.load();
+                while (first < end && !output.end.compare_exchange_weak(end, first)) {
+                }
+                return;
+            }
+            std::memcpy(output.records + first, round.data(), round.size() * sizeof(Record));
+
+            // 4. The scores
+            scores[0] += position.getPoints(Playout::HUMAN);
+            scores[1] += position.getPoints(Playout::COMPUTER);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,241 @@
+#ifndef TRAININGDATA_H
+#define TRAININGDATA_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#include "ComputerStrategy.h"
+#include "DominoSet.h"
+#include "MappedFile.h"
+
+/* *********************************************************************
+Class Name: TrainingData
+Purpose: A file of positions from self-play tournaments and how their
+        rounds ended, for training evaluation functions. generate() plays
+        the tournaments on every core and writes the file; open() maps a
+        file so its records can be read in place, with no copying or
+        parsing.
+
+        The file is a HEADER_SIZE byte header followed by fixed-size
+        records, both little-endian. The header holds the bytes "LGTD",
+        the version, the size of a record and, at byte 8, the number of
+        records as an unsigned 64-bit integer. Each record is one Record:
+        the position at the start of a turn, before the mover draws or
+        plays, and the points each player won in that round. The records
+        of a round are consecutive and in turn order. Tiles are numbered
+        by DominoSet::getIndex(low, high), and a tile's bit in a mask is
+        that number. Every field's offset is fixed, and a new field can
+        only be added by raising the version.
+
+        Writers append without locking: the file is made at full size and
+        mapped, and each thread claims the records of a whole round with
+        one atomic addition, then fills them with plain stores. The claims
+        that fit form the front of the file, and the file is cut to them.
+********************************************************************* */
+class TrainingData {
+public:
+
+    static const int HEADER_SIZE = 16;
+    static const int FILE_VERSION = 1;
+
+    // How a player's strategy is played: the fixed rules directly, any other through ComputerStrategy
+    static const int STRATEGY_GREEDY = 0;
+    static const int STRATEGY_RANDOM = 1;
+    static const int STRATEGY_REGISTERED = 2;
+
+    // The bits of Record::flags
+    static const int HUMAN_PASSED = 1;
+    static const int COMPUTER_PASSED = 2;
+
+    // The target score of a self-play tournament, unless another is given
+    static const int DEFAULT_TARGET = 200;
+
+    // Record::moveTile when the mover placed no tile
+    static const int NO_TILE = 0xFF;
+
+    // One position; the comments give each field's offset in bytes
+    struct Record {
+        uint32_t hands[2];          //  0: the Human's and the Computer's hands, as tile masks
+        uint32_t boneyard;          //  8: the tiles in the boneyard, as a mask
+        uint16_t scores[2];         // 12: the tournament scores before the round
+        uint16_t points[2];         // 16: the points each player won in the round
+        uint8_t armEnds[2];         // 20: the open pips of the Human's (left) and Computer's (right) arms
+        uint8_t boneyardSize;       // 22
+        uint8_t mover;              // 23: 0 for the Human, 1 for the Computer
+        uint8_t flags;              // 24: HUMAN_PASSED and COMPUTER_PASSED, as of the last turn
+        uint8_t roundNumber;        // 25: the tournament round, starting at 1, modulo 256
+        uint8_t moveTile;           // 26: the tile the mover placed this turn, or NO_TILE
+        uint8_t reserved;           // 27: zero
+        uint32_t gameNumber;        // 28: the tournament the round belongs to
+    };
+
+    /* --- Constructor --- */
+
+    /* *********************************************************************
+    Function Name: TrainingData
+    Purpose: Default constructor. No file is open.
+    Parameters: None
+    Return Value: None
+    Algorithm: Null the records and zero the count.
+    Reference: None
+    ********************************************************************* */
+    TrainingData();
+
+    /* --- Destructor --- */
+
+    /* *********************************************************************
+    Function Name: ~TrainingData
+    Purpose: Destructor. The mapped file unmaps itself.
+    Parameters: None
+    Return Value: None
+    Algorithm: Standard object destruction.
+    Reference: None
+    ********************************************************************* */
+    ~TrainingData() = default;
+
+    /* --- Selectors --- */
+
+    /* *********************************************************************
+    Function Name: isOpen
+    Purpose: Checks whether a file is open.
+    Parameters: None
+    Return Value: Boolean true if open() succeeded.
+    Algorithm: Test the records pointer.
+    Reference: None
+    ********************************************************************* */
+    inline bool isOpen() const { return m_records != nullptr; }
+
+    /* *********************************************************************
+    Function Name: getCount / getRecords
+    Purpose: Retrieve the number of records in the open file, and the
+            records themselves, in place in the mapping.
+    Parameters: None
+    Return Value: A count of records. / A pointer to the first record, or
+            null if no file is open.
+    Algorithm: Return the stored count and pointer.
+    Reference: None
+    ********************************************************************* */
+    inline long long getCount() const { return m_count; }
+    inline const Record* getRecords() const { return m_records; }
+
+    /* *********************************************************************
+    Function Name: findStrategy
+    Purpose: Checks a strategy's specification and finds how to play it.
+    Parameters:
+            name, a string. Any specification StrategyRegistry accepts.
+    Return Value: STRATEGY_GREEDY or STRATEGY_RANDOM for those fixed
+            rules, which are played directly as policies;
+            STRATEGY_REGISTERED for any other strategy; or -1, with an
+            error message, if the registry could not make it.
+    Algorithm: Make the strategy once and ask a HeuristicStrategy for
+            its rule.
+    Reference: None
+    ********************************************************************* */
+    static int findStrategy(const std::string& name);
+
+    /* --- Mutators --- */
+
+    /* *********************************************************************
+    Function Name: open
+    Purpose: Maps a file written by generate().
+    Parameters:
+            filename, a string representing the file path.
+    Return Value: Boolean true if the file was mapped and holds every
+            record its header counts; false, with an error message,
+            otherwise.
+    Algorithm:
+            1. Map the file.
+            2. Check the magic bytes, the version and the record size.
+            3. Read the count and check the file is long enough.
+    Reference: None
+    ********************************************************************* */
+    bool open(const std::string& filename);
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: generate
+    Purpose: Plays self-play tournaments until a number of positions are
+            recorded, and writes them to a file.
+    Parameters:
+            filename, a string representing the output path.
+            recordCount, the most records to write, more than 0.
+            humanStrategy, computerStrategy, strings. The specification of
+                each player's strategy, as accepted by findStrategy().
+            targetScore, an integer. The score that ends a tournament.
+            threadCount, an integer. The number of worker threads, or 0 for
+                one per hardware thread.
+            seed, an unsigned integer. With one thread, the same seed
+                writes the same file.
+    Return Value: The number of records written, or -1, with an error
+            message, if a strategy is not known or the file could not be
+            made.
+    Algorithm:
+            1. Find the strategies and make each thread its own copy of
+                a registered one, then make the file at full size and map
+                it.
+            2. Start the threads, each playing tournaments with
+                playGames() until a round no longer fits.
+            3. Write the header, unmap the file and cut it to the records
+                written.
+    Reference: None
+    ********************************************************************* */
+    static long long generate(const std::string& filename, long long recordCount, const std::string& humanStrategy,
+        const std::string& computerStrategy, int targetScore, int threadCount, unsigned int seed);
+
+private:
+
+    // What the writing threads share
+    struct Output {
+        Record* records;
+        long long capacity;
+        std::atomic<long long> next;        // the first record not yet claimed
+        std::atomic<long long> end;         // the first record of the first round that did not fit
+        std::atomic<uint32_t> gameNumber;
+    };
+
+    MappedFile m_file;
+    const Record* m_records;
+    long long m_count;
+
+    /* *********************************************************************
+    Function Name: playGames
+    Purpose: Plays tournaments and writes their positions until a round
+            no longer fits in the file. The body of each writing thread.
+    Parameters:
+            output, an Output passed by reference. Shared by the threads.
+            strategies, an array of two integers. How each player's
+                strategy is played, as returned by findStrategy().
+            players, an array of two ComputerStrategy pointers. This
+                thread's own copy of each registered strategy, null for
+                the fixed rules.
+            targetScore, seed. As for generate().
+    Return Value: None
+    Algorithm:
+            1. Take the next game number and seed a generator from it.
+            2. Deal each round with Playout::dealRound and record the
+                position before every turn, then the tile placed.
+            3. When the round is over, copy the points into its records,
+                claim room for them and copy them into the file; stop if
+                the claim does not fit, after marking where the file ends.
+            4. Add the points to the scores and deal the next round until
+                a score reaches the target.
+    Reference: None
+    ********************************************************************* */
+    static void playGames(Output& output, const int* strategies, ComputerStrategy* const* players,
+        int targetScore, unsigned int seed);
+};
+
+static_assert(sizeof(TrainingData::Record) == 32, "A training record is 32 bytes in the file");
+static_assert(std::is_trivially_copyable_v<TrainingData::Record>, "A training record must copy as plain bytes");
+
+#endif
\ No newline at end of file
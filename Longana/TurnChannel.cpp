@@ -0,0 +1,158 @@
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <coroutine>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "TurnChannel.h"
+
+/* *********************************************************************
+Function Name: TurnChannel
+Purpose: Constructor. No input has arrived.
+Parameters:
+        output, an ostream passed by reference. Where the rounds
+            write.
+Return Value: None
+Algorithm: Store the stream, with no words, no waiting round and the
+        input open.
+Reference: None
+********************************************************************* */
+TurnChannel::TurnChannel(std::ostream& output)
+    : m_output(output), m_words(), m_isClosed(false), m_isExhausted(false), m_waiting(), m_pool()
+{
+}
+
+/* *********************************************************************
+Function Name: supply
+Purpose: Delivers a line of the Human's input.
+Parameters:
+        line, a std::string_view. The line, without its newline.
+Return Value: None
+Algorithm: Split the line into words, marking the last, and resume
+        the waiting round, if any.
+Reference: None
+********************************************************************* */
+void TurnChannel::supply(std::string_view line) {
+    size_t before = m_words.size();
+
+    size_t start = line.find_first_not_of(" \t\r");
+    while (start != std::string_view::npos) {
+        size_t end = line.find_first_of(" \t\r", start);
+        m_words.push_back(Word{ std::string(line.substr(start, end - start)), false });
+        start = (end == std::string_view::npos) ? end : line.find_first_not_of(" \t\r", end);
+    }
+
+    // A blank line gives the round nothing to read
+    if (m_words.size() > before) {
+        m_words.back().isLineEnd = true;
+        resumeWaiting();
+    }
+}
+
+/* *********************************************************************
+Function Name: close
+Purpose: Ends the input, as the end of a file or a lost connection
+        does.
+Parameters: None
+Return Value: None
+Algorithm: Set the closed flag and resume the waiting round, if any,
+        which reads an empty word.
+Reference: None
+********************************************************************* */
+void TurnChannel::close() {
+    m_isClosed = true;
+    resumeWaiting();
+}
+
+/* *********************************************************************
+Function Name: discardLine
+Purpose: Drops the words left on the current line.
+Parameters: None
+Return Value: None
+Algorithm: Pop words up to and including the one that ends a line.
+Reference: None
+********************************************************************* */
+void TurnChannel::discardLine() {
+    while (!m_words.empty()) {
+        bool isLineEnd = m_words.front().isLineEnd;
+        m_words.pop_front();
+        if (isLineEnd) {
+            return;
+        }
+    }
+}
+
+/* *********************************************************************
+Function Name: readWord
+Purpose: Reads the Human's next word, suspending until it arrives.
+Parameters: None
+Return Value: An awaitable whose co_await gives the word, or an empty
+        string once the input is closed.
+Algorithm: The awaiter is ready if a word is waiting or the input is
+        closed; otherwise it stores the round's handle for supply()
+        or close() to resume.
+Reference: None
+********************************************************************* */
+std::string TurnChannel::WordAwaiter::await_resume() {
+    if (channel.m_words.empty()) {
+        channel.m_isExhausted = true;
+        return std::string();
+    }
+
+    std::string word = std::move(channel.m_words.front().text);
+    channel.m_words.pop_front();
+    return word;
+}
+
+/* *********************************************************************
+Function Name: runConsole
+Purpose: Drives one task to its end from a stream, blocking while it
+        waits for input.
+Parameters:
+        task, a Task<bool> passed by reference. Not yet started.
+        input, an istream passed by reference. Read a line at a time.
+Return Value: The value the task returned.
+Algorithm: Start the task; while it is not done, flush the output,
+        read a line and supply() it, or close() the channel at the end
+        of the input.
+Reference: None
+********************************************************************* */
+bool TurnChannel::runConsole(Task<bool>& task, std::istream& input) {
+    task.start();
+
+    std::string line;
+    while (!task.isDone()) {
+        m_output.flush();
+        if (std::getline(input, line)) {
+            supply(line);
+        }
+        else {
+            close();
+        }
+    }
+    return task.getResult();
+}
+
+/* *********************************************************************
+Function Name: resumeWaiting
+Purpose: Resumes the round waiting for input, if there is one.
+Parameters: None
+Return Value: None
+Algorithm: Clear the stored handle before resuming it, since the
+        round may wait again.
+Reference: None
+********************************************************************* */
+void TurnChannel::resumeWaiting() {
+    std::coroutine_handle<> round = std::exchange(m_waiting, nullptr);
+    if (round) {
+        round.resume();
+    }
+}
\ No newline at end of file
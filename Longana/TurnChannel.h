@@ -0,0 +1,221 @@
+#ifndef TURNCHANNEL_H
+#define TURNCHANNEL_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <coroutine>
+#include <deque>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+#include "FramePool.h"
+#include "Task.h"
+
+/* *********************************************************************
+Class Name: TurnChannel
+Purpose: Connects one Human's rounds to whoever drives them: the words
+        the Human types come in, and the round's prompts and board go
+        out to a stream. A round reads a word with co_await readWord();
+        if none has arrived, the round suspends, and the driver's next
+        supply() resumes it on the driver's thread. One thread can so
+        drive any number of rounds, each with its own channel, feeding
+        each the input meant for it. runConsole() drives a single task
+        from a stream, for the console game.
+
+        Words are kept with the line they came on, so a round can drop
+        the rest of a line it could not use, as it would with
+        std::cin.ignore(). Once the input is closed, readWord() returns
+        an empty word, which the round takes as the Human leaving. The
+        channel also owns the FramePool the round's coroutine frames
+        come from (see Task), so it must outlive them.
+********************************************************************* */
+class TurnChannel {
+public:
+
+    /* --- Constructor --- */
+
+    /* *********************************************************************
+    Function Name: TurnChannel
+    Purpose: Constructor. No input has arrived.
+    Parameters:
+            output, an ostream passed by reference. Where the rounds
+                write.
+    Return Value: None
+    Algorithm: Store the stream, with no words, no waiting round and the
+            input open.
+    Reference: None
+    ********************************************************************* */
+    explicit TurnChannel(std::ostream& output);
+
+    TurnChannel(const TurnChannel&) = delete;
+    TurnChannel& operator=(const TurnChannel&) = delete;
+
+    /* --- Destructor --- */
+
+    /* *********************************************************************
+    Function Name: ~TurnChannel
+    Purpose: Destructor. A round still waiting is not resumed; its task
+            frees it.
+    Parameters: None
+    Return Value: None
+    Algorithm: Standard object destruction.
+    Reference: None
+    ********************************************************************* */
+    ~TurnChannel() = default;
+
+    /* --- Selectors --- */
+
+    /* *********************************************************************
+    Function Name: getOutput / getFramePool
+    Purpose: Retrieve the stream the rounds write to, and the pool their
+            frames come from.
+    Parameters: None
+    Return Value: A reference to the stream. / A reference to the pool.
+    Algorithm: Return the members.
+    Reference: None
+    ********************************************************************* */
+    inline std::ostream& getOutput() { return m_output; }
+    inline FramePool& getFramePool() { return m_pool; }
+
+    /* *********************************************************************
+    Function Name: isWaiting
+    Purpose: Checks whether a round is suspended until input arrives.
+    Parameters: None
+    Return Value: Boolean true if a round awaits a word.
+    Algorithm: Check for a stored coroutine handle.
+    Reference: None
+    ********************************************************************* */
+    inline bool isWaiting() const { return static_cast<bool>(m_waiting); }
+
+    /* *********************************************************************
+    Function Name: isClosed
+    Purpose: Checks whether the input has ended.
+    Parameters: None
+    Return Value: Boolean true after close().
+    Algorithm: Return the stored flag.
+    Reference: None
+    ********************************************************************* */
+    inline bool isClosed() const { return m_isClosed; }
+
+    /* *********************************************************************
+    Function Name: isExhausted
+    Purpose: Checks whether a round has read past the end of the input,
+            so that whatever it was doing was cut short.
+    Parameters: None
+    Return Value: Boolean true once readWord() has returned an empty word.
+    Algorithm: Return the stored flag.
+    Reference: None
+    ********************************************************************* */
+    inline bool isExhausted() const { return m_isExhausted; }
+
+    /* --- Mutators --- */
+
+    /* *********************************************************************
+    Function Name: supply
+    Purpose: Delivers a line of the Human's input.
+    Parameters:
+            line, a std::string_view. The line, without its newline.
+    Return Value: None
+    Algorithm: Split the line into words, marking the last, and resume
+            the waiting round, if any.
+    Reference: None
+    ********************************************************************* */
+    void supply(std::string_view line);
+
+    /* *********************************************************************
+    Function Name: close
+    Purpose: Ends the input, as the end of a file or a lost connection
+            does.
+    Parameters: None
+    Return Value: None
+    Algorithm: Set the closed flag and resume the waiting round, if any,
+            which reads an empty word.
+    Reference: None
+    ********************************************************************* */
+    void close();
+
+    /* *********************************************************************
+    Function Name: discardLine
+    Purpose: Drops the words left on the current line.
+    Parameters: None
+    Return Value: None
+    Algorithm: Pop words up to and including the one that ends a line.
+    Reference: None
+    ********************************************************************* */
+    void discardLine();
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: readWord
+    Purpose: Reads the Human's next word, suspending until it arrives.
+    Parameters: None
+    Return Value: An awaitable whose co_await gives the word, or an empty
+            string once the input is closed.
+    Algorithm: The awaiter is ready if a word is waiting or the input is
+            closed; otherwise it stores the round's handle for supply()
+            or close() to resume.
+    Reference: None
+    ********************************************************************* */
+    struct WordAwaiter {
+        TurnChannel& channel;
+
+        inline bool await_ready() const noexcept { return !channel.m_words.empty() || channel.m_isClosed; }
+        inline void await_suspend(std::coroutine_handle<> round) noexcept { channel.m_waiting = round; }
+        std::string await_resume();
+    };
+    inline WordAwaiter readWord() { return WordAwaiter{ *this }; }
+
+    /* *********************************************************************
+    Function Name: runConsole
+    Purpose: Drives one task to its end from a stream, blocking while it
+            waits for input.
+    Parameters:
+            task, a Task<bool> passed by reference. Not yet started.
+            input, an istream passed by reference. Read a line at a time.
+    Return Value: The value the task returned.
+    Algorithm: Start the task; while it is not done, flush the output,
+            read a line and supply() it, or close() the channel at the end
+            of the input.
+    Reference: None
+    ********************************************************************* */
+    bool runConsole(Task<bool>& task, std::istream& input);
+
+private:
+
+    // A word of input, and whether the line it came on ends with it
+    struct Word {
+        std::string text;
+        bool isLineEnd;
+    };
+
+    std::ostream& m_output;
+    std::deque<Word> m_words;
+    bool m_isClosed;
+    bool m_isExhausted;
+
+    // The round suspended in readWord(), if any
+    std::coroutine_handle<> m_waiting;
+
+    FramePool m_pool;
+
+    /* *********************************************************************
+    Function Name: resumeWaiting
+    Purpose: Resumes the round waiting for input, if there is one.
+    Parameters: None
+    Return Value: None
+    Algorithm: Clear the stored handle before resuming it, since the
+            round may wait again.
+    Reference: None
+    ********************************************************************* */
+    void resumeWaiting();
+};
+
+#endif
\ No newline at end of file
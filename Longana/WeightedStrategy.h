@@ -0,0 +1,155 @@
+#ifndef WEIGHTEDSTRATEGY_H
+#define WEIGHTEDSTRATEGY_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+template <int MaxPips>
+class BasicPlayout;
+
+/* *********************************************************************
+Class Name: WeightedStrategy
+Purpose: A playout policy that scores every legal move by a weighted sum
+        of heuristic features and plays the highest, the first listed
+        among equals. The features are the pips the tile sheds, whether it
+        is a double, how many tiles left in the hand match the end it
+        opens, whether it goes on the mover's own arm, and how many of the
+        next player's tiles match the end it leaves on their arm. The
+        weights are what HeuristicTuner adjusts. See GreedyStrategy for
+        what a policy is.
+********************************************************************* */
+class WeightedStrategy {
+public:
+
+    // The position of each feature's weight
+    static const int WEIGHT_PIPS = 0;
+    static const int WEIGHT_DOUBLE = 1;
+    static const int WEIGHT_SUIT = 2;
+    static const int WEIGHT_OWN_ARM = 3;
+    static const int WEIGHT_BLOCK = 4;
+    static const int WEIGHT_COUNT = 5;
+
+    /* --- Constructor --- */
+
+    /* *********************************************************************
+    Function Name: WeightedStrategy
+    Purpose: Default constructor. Plays the heaviest tile that fits.
+    Parameters: None
+    Return Value: None
+    Algorithm: Weigh the pips by 1 and every other feature by 0.
+    Reference: None
+    ********************************************************************* */
+    WeightedStrategy() : m_weights() { m_weights[WEIGHT_PIPS] = 1.0; }
+
+    /* *********************************************************************
+    Function Name: WeightedStrategy
+    Purpose: Constructor. Plays with the given weights.
+    Parameters:
+            weights, an array of WEIGHT_COUNT doubles, indexed by the
+                WEIGHT_ constants.
+    Return Value: None
+    Algorithm: Copy the weights.
+    Reference: None
+    ********************************************************************* */
+    explicit WeightedStrategy(const double* weights) : m_weights() {
+        for (int i = 0; i < WEIGHT_COUNT; ++i) {
+            m_weights[i] = weights[i];
+        }
+    }
+
+    /* --- Selectors --- */
+
+    /* *********************************************************************
+    Function Name: getWeight
+    Purpose: Retrieves one feature's weight.
+    Parameters:
+            feature, one of the WEIGHT_ constants.
+    Return Value: The weight.
+    Algorithm: Return the stored weight.
+    Reference: None
+    ********************************************************************* */
+    inline double getWeight(int feature) const { return m_weights[feature]; }
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: chooseMove
+    Purpose: Chooses the mover's move.
+    Parameters:
+            table, a BasicPlayout passed by const reference. The position.
+            outIndex, an integer passed by reference. Receives the position
+                of the chosen tile in the mover's hand.
+            outArm, an integer passed by reference. Receives the player
+                number of the arm to play on.
+    Return Value: Boolean true if any tile can be played.
+    Algorithm:
+            1. List the legal moves.
+            2. For each, find the end the tile leaves open on its arm and
+                total the weighted features.
+            3. Return the first move with the highest total.
+    Reference: None
+    ********************************************************************* */
+    template <int MaxPips>
+    bool chooseMove(const BasicPlayout<MaxPips>& table, int& outIndex, int& outArm) const {
+        int indices[BasicPlayout<MaxPips>::MAX_MOVES];
+        int arms[BasicPlayout<MaxPips>::MAX_MOVES];
+
+        int count = table.listMoves(indices, arms);
+        if (count == 0) {
+            return false;
+        }
+
+        int mover = table.getMover();
+        int next = (mover + 1) % table.getPlayerCount();
+        double bestScore = 0.0;
+
+        for (int m = 0; m < count; ++m) {
+            unsigned char packed = table.getHandPacked(mover, indices[m]);
+            int low = packed & 0x0F;
+            int high = packed >> 4;
+
+            // 2. The end left open: the half that does not match
+            int end = (table.getArmEnd(arms[m]) == low) ? high : low;
+            int suited = 0;
+            for (int i = 0; i < table.getHandSize(mover); ++i) {
+                unsigned char other = table.getHandPacked(mover, i);
+                if (i != indices[m] && ((other & 0x0F) == end || (other >> 4) == end)) {
+                    ++suited;
+                }
+            }
+
+            int blocked = 0;
+            if (arms[m] == next) {
+                for (int i = 0; i < table.getHandSize(next); ++i) {
+                    unsigned char other = table.getHandPacked(next, i);
+                    if ((other & 0x0F) == end || (other >> 4) == end) {
+                        ++blocked;
+                    }
+                }
+            }
+
+            double score = m_weights[WEIGHT_PIPS] * (low + high)
+                + m_weights[WEIGHT_DOUBLE] * (low == high ? 1 : 0)
+                + m_weights[WEIGHT_SUIT] * suited
+                + m_weights[WEIGHT_OWN_ARM] * (arms[m] == mover ? 1 : 0)
+                + m_weights[WEIGHT_BLOCK] * blocked;
+
+            // 3. Ties keep the first listed
+            if (m == 0 || score > bestScore) {
+                bestScore = score;
+                outIndex = indices[m];
+                outArm = arms[m];
+            }
+        }
+        return true;
+    }
+
+private:
+    double m_weights[WEIGHT_COUNT];
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,330 @@
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "LockstepPlayout.h"
+#include "Playout.h"
+#include "Tournament.h"
+#include "WinEstimator.h"
+
+/* *********************************************************************
+Function Name: WinEstimator
+Purpose: Default constructor. No simulations have been run.
+Parameters: None
+Return Value: None
+Algorithm: Zero the outcome counts, with no outcome decided.
+Reference: None
+********************************************************************* */
+WinEstimator::WinEstimator()
+    : m_outcomes(), m_decidedOutcome(-1)
+{
+}
+
+/* *********************************************************************
+Function Name: getProbability
+Purpose: Retrieves the estimated probability of an outcome.
+Parameters:
+        outcome, HUMAN_WINS, COMPUTER_WINS or DRAW.
+Return Value: A probability between 0 and 1; 0 if nothing was simulated.
+Algorithm: For a decided tournament, 1 for its outcome and 0 for the
+        others; otherwise divide the outcome's count by the number of
+        simulations.
+Reference: None
+********************************************************************* */
+double WinEstimator::getProbability(int outcome) const {
+    if (isDecided()) {
+        return (outcome == m_decidedOutcome) ? 1.0 : 0.0;
+    }
+
+    long long total = getSimulationCount();
+    return (total == 0) ? 0.0 : static_cast<double>(m_outcomes[outcome]) / static_cast<double>(total);
+}
+
+/* *********************************************************************
+Function Name: getInterval
+Purpose: Retrieves the 95% confidence interval of an outcome's
+        probability.
+Parameters:
+        outcome, HUMAN_WINS, COMPUTER_WINS or DRAW.
+        outLow, outHigh, doubles passed by reference. Receive the bounds.
+Return Value: None
+Algorithm: For a decided tournament, the probability itself, with no
+        width. Otherwise the Wilson score interval with z = 1.96,
+        which stays inside 0 and 1 even for outcomes that are rare or
+        certain.
+Reference: Wilson, E. B. (1927), "Probable inference, the law of
+        succession, and statistical inference"
+********************************************************************* */
+void WinEstimator::getInterval(int outcome, double& outLow, double& outHigh) const {
+    if (isDecided()) {
+        outLow = getProbability(outcome);
+        outHigh = outLow;
+        return;
+    }
+
+    double n = static_cast<double>(getSimulationCount());
+    if (n == 0.0) {
+        outLow = 0.0;
+        outHigh = 1.0;
+        return;
+    }
+
+    const double z = 1.96;
+    double p = getProbability(outcome);
+    double denominator = 1.0 + z * z / n;
+    double centre = (p + z * z / (2.0 * n)) / denominator;
+    double margin = z * std::sqrt(p * (1.0 - p) / n + z * z / (4.0 * n * n)) / denominator;
+
+    // Pin the bounds of outcomes never or always seen against rounding error
+    outLow = (m_outcomes[outcome] == 0) ? 0.0 : std::max(0.0, centre - margin);
+    outHigh = (m_outcomes[outcome] == getSimulationCount()) ? 1.0 : std::min(1.0, centre + margin);
+}
+
+/* *********************************************************************
+Function Name: estimate
+Purpose: Simulates the rest of the tournament from its current state.
+Parameters:
+        tournament, a Tournament passed by const reference. Its scores,
+            target, round number and current round are used; a round
+            whose layout is empty is treated as not yet dealt.
+        milliseconds, an integer time budget.
+        threadCount, an integer. The number of worker threads, or 0 for
+            one per hardware thread.
+Return Value: None
+Algorithm:
+        1. If a score has already reached the target, record the
+            outcome and simulate nothing. Otherwise copy the current
+            round into a Playout.
+        2. Start the workers. Each seeds its own generator and plays
+            sixteen simulations at once until the budget is spent.
+        3. Add up the workers' outcome counts.
+Reference: None
+********************************************************************* */
+void WinEstimator::estimate(const Tournament& tournament, int milliseconds, int threadCount) {
+    // 1. A tournament already over needs no simulation
+    int targetScore = tournament.getTargetScore();
+    std::fill(m_outcomes, m_outcomes + 3, 0);
+    m_decidedOutcome = -1;
+    if (tournament.getHumanScore() >= targetScore || tournament.getComputerScore() >= targetScore) {
+        m_decidedOutcome = getOutcome(tournament.getHumanScore(), tournament.getComputerScore(), targetScore);
+        return;
+    }
+
+    const Round& round = tournament.getCurrentRound();
+
+    Playout start;
+    bool isDealt = !round.getLayout().isEmpty();
+    if (isDealt) {
+        start.loadRound(round);
+    }
+
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::thread::hardware_concurrency());
+        if (threadCount <= 0) { threadCount = 1; }
+    }
+
+    std::chrono::steady_clock::time_point deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(milliseconds);
+    std::random_device device;
+
+    // Each worker counts into its own row, so no locking is needed
+    std::vector<std::vector<long long>> counts(threadCount, std::vector<long long>(3, 0));
+    std::vector<std::thread> workers;
+
+    for (int t = 0; t < threadCount; ++t) {
+        workers.emplace_back(&WinEstimator::work, std::cref(start), isDealt, std::cref(tournament),
+            deadline, device(), counts[t].data());
+    }
+
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    for (int outcome = HUMAN_WINS; outcome <= DRAW; ++outcome) {
+        m_outcomes[outcome] = 0;
+        for (int t = 0; t < threadCount; ++t) {
+            m_outcomes[outcome] += counts[t][outcome];
+        }
+    }
+}
+
+/* *********************************************************************
+Function Name: simulate
+Purpose: Plays the remainder of a tournament once.
+Parameters:
+        start, a Playout passed by const reference. The current round,
+            or ignored if isDealt is false.
+        isDealt, a boolean. False if the current round still has to be
+            dealt.
+        roundNumber, targetScore, humanScore, computerScore, integers.
+            The tournament state.
+        generator, a std::mt19937 passed by reference.
+Return Value: HUMAN_WINS, COMPUTER_WINS or DRAW.
+Algorithm:
+        1. Copy the round, reshuffle its boneyard and play it out.
+        2. Add the points, and while both scores are below the target,
+            deal and play the next round from a fresh seed.
+        3. Decide the winner as Tournament::announceWinner does.
+Reference: None
+********************************************************************* */
+int WinEstimator::simulate(const Playout& start, bool isDealt, int roundNumber, int targetScore,
+    int humanScore, int computerScore, std::mt19937& generator) {
+    Playout round = start;
+
+    if (isDealt) {
+        round.shuffleBoneyard(generator);
+    }
+    else {
+        round.dealRound(roundNumber, generator());
+    }
+
+    for (int rounds = 0; humanScore < targetScore && computerScore < targetScore; ++rounds) {
+        if (rounds == MAX_ROUNDS) {
+            return DRAW;
+        }
+        if (rounds > 0) {
+            round.dealRound(++roundNumber, generator());
+        }
+
+        round.playRound();
+        humanScore += round.getPoints(Playout::HUMAN);
+        computerScore += round.getPoints(Playout::COMPUTER);
+    }
+
+    return getOutcome(humanScore, computerScore, targetScore);
+}
+
+/* *********************************************************************
+Function Name: getOutcome
+Purpose: Decides a finished tournament as Tournament::announceWinner does.
+Parameters:
+        humanScore, computerScore, targetScore, integers. At least one
+            score has reached the target.
+Return Value: HUMAN_WINS, COMPUTER_WINS or DRAW.
+Algorithm: If only one score reached the target, that player wins;
+        if both did, the higher score wins and equal scores draw.
+Reference: None
+********************************************************************* */
+int WinEstimator::getOutcome(int humanScore, int computerScore, int targetScore) {
+    if (humanScore >= targetScore && computerScore >= targetScore) {
+        if (humanScore == computerScore) {
+            return DRAW;
+        }
+        return (humanScore > computerScore) ? HUMAN_WINS : COMPUTER_WINS;
+    }
+
+    return (humanScore >= targetScore) ? HUMAN_WINS : COMPUTER_WINS;
+}
+
+/* *********************************************************************
+Function Name: work
+Purpose: The body of a worker thread.
+Parameters:
+        start, isDealt. As for simulate().
+        tournament, a Tournament passed by const reference. Supplies the
+            round number, target and scores.
+        deadline, the time at which to stop.
+        seed, an unsigned integer. Seeds the worker's generator.
+        counts, a pointer to three counters, one per outcome.
+Return Value: None
+Algorithm:
+        1. Seed a generator for this worker. The tournament is not yet
+            decided; estimate() handles one that is.
+        2. Start one simulation in each lane of a LockstepPlayout: copy
+            the round and reshuffle its boneyard, or deal it.
+        3. Play every lane's round at once. For each lane, add the
+            points; count a finished simulation and start a new one in
+            the lane, or deal the lane's next round, as simulate() does.
+        4. Check the clock after every 64 finished simulations, so at
+            least one batch always completes.
+Reference: None
+********************************************************************* */
+void WinEstimator::work(const Playout& start, bool isDealt, const Tournament& tournament,
+    std::chrono::steady_clock::time_point deadline, unsigned int seed, long long* counts) {
+    // 1. The worker's generator
+    std::mt19937 generator(seed);
+    int targetScore = tournament.getTargetScore();
+
+    LockstepPlayout lanes;
+    int roundNumbers[LockstepPlayout::LANES];
+    int humanScores[LockstepPlayout::LANES];
+    int computerScores[LockstepPlayout::LANES];
+    int roundsPlayed[LockstepPlayout::LANES];
+
+    // 2. One simulation per lane
+    for (int lane = 0; lane < LockstepPlayout::LANES; ++lane) {
+        startLane(lanes, lane, start, isDealt, tournament.getRoundNumber(), generator);
+        roundNumbers[lane] = tournament.getRoundNumber();
+        humanScores[lane] = tournament.getHumanScore();
+        computerScores[lane] = tournament.getComputerScore();
+        roundsPlayed[lane] = 0;
+    }
+
+    // 3-4. A round in every lane at once, and the clock read once per batch
+    do {
+        for (int finished = 0; finished < 64; ) {
+            lanes.playRounds();
+
+            for (int lane = 0; lane < LockstepPlayout::LANES; ++lane) {
+                humanScores[lane] += lanes.getPoints(lane, LockstepPlayout::HUMAN);
+                computerScores[lane] += lanes.getPoints(lane, LockstepPlayout::COMPUTER);
+                ++roundsPlayed[lane];
+
+                bool isDecided = humanScores[lane] >= targetScore || computerScores[lane] >= targetScore;
+                if (!isDecided && roundsPlayed[lane] < MAX_ROUNDS) {
+                    Playout round;
+                    round.dealRound(++roundNumbers[lane], generator());
+                    lanes.loadLane(lane, round);
+                    continue;
+                }
+
+                ++counts[isDecided ? getOutcome(humanScores[lane], computerScores[lane], targetScore) : DRAW];
+                ++finished;
+
+                startLane(lanes, lane, start, isDealt, tournament.getRoundNumber(), generator);
+                roundNumbers[lane] = tournament.getRoundNumber();
+                humanScores[lane] = tournament.getHumanScore();
+                computerScores[lane] = tournament.getComputerScore();
+                roundsPlayed[lane] = 0;
+            }
+        }
+    } while (std::chrono::steady_clock::now() < deadline);
+}
+
+/* *********************************************************************
+Function Name: startLane
+Purpose: Loads the first round of a new simulation into a lane.
+Parameters:
+        lanes, a LockstepPlayout passed by reference.
+        lane, an integer between 0 and LockstepPlayout::LANES - 1.
+        start, isDealt, roundNumber. As for simulate().
+        generator, a std::mt19937 passed by reference.
+Return Value: None
+Algorithm: Copy the round and reshuffle its boneyard, or deal it, as
+        simulate() does, and load it into the lane.
+Reference: None
+********************************************************************* */
+void WinEstimator::startLane(LockstepPlayout& lanes, int lane, const Playout& start, bool isDealt, int roundNumber,
+    std::mt19937& generator) {
+    Playout round = start;
+
+    if (isDealt) {
+        round.shuffleBoneyard(generator);
+    }
+    else {
+        round.dealRound(roundNumber, generator());
+    }
+
+    lanes.loadLane(lane, round);
+}
\ No newline at end of file
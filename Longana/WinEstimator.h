@@ -0,0 +1,225 @@
+#ifndef WINESTIMATOR_H
+#define WINESTIMATOR_H
+
+/************************************************************
+ * Name:  Race Partin                                       *
+ * Project: Project 1 (Longana)                             *
+ * Class:  CMPS 366 - OPL                                   *
+ * Date:  02/12/2026                                        *
+ ************************************************************/
+
+#include <chrono>
+#include <random>
+
+#include "LockstepPlayout.h"
+#include "Playout.h"
+#include "Tournament.h"
+
+/* *********************************************************************
+Class Name: WinEstimator
+Purpose: Estimates each side's chance of winning the whole tournament
+        from any position. The rest of the current round is simulated with
+        the boneyard reshuffled (its order is hidden from both players),
+        then further rounds are dealt with the engine rotating as usual
+        until a player reaches the target score. Both players follow the
+        Computer's strategy. Simulations run on one thread per core until
+        the time budget is spent, and each probability is reported with a
+        95% confidence interval.
+********************************************************************* */
+class WinEstimator {
+public:
+
+    // Outcomes of a simulated tournament
+    static const int HUMAN_WINS = 0;
+    static const int COMPUTER_WINS = 1;
+    static const int DRAW = 2;
+
+    // Rounds after which a simulated tournament is called a draw
+    static const int MAX_ROUNDS = 1000;
+
+    /* --- Constructor --- */
+
+    /* *********************************************************************
+    Function Name: WinEstimator
+    Purpose: Default constructor. No simulations have been run.
+    Parameters: None
+    Return Value: None
+    Algorithm: Zero the outcome counts.
+    Reference: None
+    ********************************************************************* */
+    WinEstimator();
+
+    /* --- Destructor --- */
+
+    /* *********************************************************************
+    Function Name: ~WinEstimator
+    Purpose: Destructor. Nothing is allocated, so nothing is released.
+    Parameters: None
+    Return Value: None
+    Algorithm: Standard object destruction.
+    Reference: None
+    ********************************************************************* */
+    ~WinEstimator() = default;
+
+    /* --- Selectors --- */
+
+    /* *********************************************************************
+    Function Name: getSimulationCount
+    Purpose: Retrieves the number of tournaments simulated.
+    Parameters: None
+    Return Value: An integer count.
+    Algorithm: Sum the outcome counts.
+    Reference: None
+    ********************************************************************* */
+    inline long long getSimulationCount() const { return m_outcomes[HUMAN_WINS] + m_outcomes[COMPUTER_WINS] + m_outcomes[DRAW]; }
+
+    /* *********************************************************************
+    Function Name: isDecided
+    Purpose: Checks whether the last tournament estimated was already
+            over, so its outcome is known without simulating.
+    Parameters: None
+    Return Value: Boolean true if the outcome is certain.
+    Algorithm: Check for a stored outcome.
+    Reference: None
+    ********************************************************************* */
+    inline bool isDecided() const { return m_decidedOutcome >= 0; }
+
+    /* *********************************************************************
+    Function Name: getProbability
+    Purpose: Retrieves the estimated probability of an outcome.
+    Parameters:
+            outcome, HUMAN_WINS, COMPUTER_WINS or DRAW.
+    Return Value: A probability between 0 and 1; 0 if nothing was simulated.
+    Algorithm: For a decided tournament, 1 for its outcome and 0 for the
+            others; otherwise divide the outcome's count by the number of
+            simulations.
+    Reference: None
+    ********************************************************************* */
+    double getProbability(int outcome) const;
+
+    /* *********************************************************************
+    Function Name: getInterval
+    Purpose: Retrieves the 95% confidence interval of an outcome's
+            probability.
+    Parameters:
+            outcome, HUMAN_WINS, COMPUTER_WINS or DRAW.
+            outLow, outHigh, doubles passed by reference. Receive the bounds.
+    Return Value: None
+    Algorithm: For a decided tournament, the probability itself, with no
+            width. Otherwise the Wilson score interval with z = 1.96,
+            which stays inside 0 and 1 even for outcomes that are rare or
+            certain.
+    Reference: Wilson, E. B. (1927), "Probable inference, the law of
+            succession, and statistical inference"
+    ********************************************************************* */
+    void getInterval(int outcome, double& outLow, double& outHigh) const;
+
+    /* --- Utility Functions --- */
+
+    /* *********************************************************************
+    Function Name: estimate
+    Purpose: Simulates the rest of the tournament from its current state.
+    Parameters:
+            tournament, a Tournament passed by const reference. Its scores,
+                target, round number and current round are used; a round
+                whose layout is empty is treated as not yet dealt.
+            milliseconds, an integer time budget.
+            threadCount, an integer. The number of worker threads, or 0 for
+                one per hardware thread.
+    Return Value: None
+    Algorithm:
+            1. If a score has already reached the target, record the
+                outcome and simulate nothing. Otherwise copy the current
+                round into a Playout.
+            2. Start the workers. Each seeds its own generator and plays
+                sixteen simulations at once until the budget is spent.
+            3. Add up the workers' outcome counts.
+    Reference: None
+    ********************************************************************* */
+    void estimate(const Tournament& tournament, int milliseconds, int threadCount);
+
+    /* *********************************************************************
+    Function Name: simulate
+    Purpose: Plays the remainder of a tournament once.
+    Parameters:
+            start, a Playout passed by const reference. The current round,
+                or ignored if isDealt is false.
+            isDealt, a boolean. False if the current round still has to be
+                dealt.
+            roundNumber, targetScore, humanScore, computerScore, integers.
+                The tournament state.
+            generator, a std::mt19937 passed by reference.
+    Return Value: HUMAN_WINS, COMPUTER_WINS or DRAW.
+    Algorithm:
+            1. Copy the round, reshuffle its boneyard and play it out.
+            2. Add the points, and while both scores are below the target,
+                deal and play the next round from a fresh seed.
+            3. Decide the winner as Tournament::announceWinner does.
+    Reference: None
+    ********************************************************************* */
+    static int simulate(const Playout& start, bool isDealt, int roundNumber, int targetScore,
+        int humanScore, int computerScore, std::mt19937& generator);
+
+private:
+    long long m_outcomes[3];
+
+    // The outcome of a tournament that was already over, or -1
+    int m_decidedOutcome;
+
+    /* *********************************************************************
+    Function Name: getOutcome
+    Purpose: Decides a finished tournament as Tournament::announceWinner does.
+    Parameters:
+            humanScore, computerScore, targetScore, integers. At least one
+                score has reached the target.
+    Return Value: HUMAN_WINS, COMPUTER_WINS or DRAW.
+    Algorithm: If only one score reached the target, that player wins;
+            if both did, the higher score wins and equal scores draw.
+    Reference: None
+    ********************************************************************* */
+    static int getOutcome(int humanScore, int computerScore, int targetScore);
+
+    /* *********************************************************************
+    Function Name: work
+    Purpose: The body of a worker thread.
+    Parameters:
+            start, isDealt. As for simulate().
+            tournament, a Tournament passed by const reference. Supplies the
+                round number, target and scores.
+            deadline, the time at which to stop.
+            seed, an unsigned integer. Seeds the worker's generator.
+            counts, a pointer to three counters, one per outcome.
+    Return Value: None
+    Algorithm:
+            1. Seed a generator for this worker. The tournament is not yet
+                decided; estimate() handles one that is.
+            2. Start one simulation in each lane of a LockstepPlayout: copy
+                the round and reshuffle its boneyard, or deal it.
+            3. Play every lane's round at once. For each lane, add the
+                points; count a finished simulation and start a new one in
+                the lane, or deal the lane's next round, as simulate() does.
+            4. Check the clock after every 64 finished simulations, so at
+                least one batch always completes.
+    Reference: None
+    ********************************************************************* */
+    static void work(const Playout& start, bool isDealt, const Tournament& tournament,
+        std::chrono::steady_clock::time_point deadline, unsigned int seed, long long* counts);
+
+    /* *********************************************************************
+    Function Name: startLane
+    Purpose: Loads the first round of a new simulation into a lane.
+    Parameters:
+            lanes, a LockstepPlayout passed by reference.
+            lane, an integer between 0 and LockstepPlayout::LANES - 1.
+            start, isDealt, roundNumber. As for simulate().
+            generator, a std::mt19937 passed by reference.
+    Return Value: None
+    Algorithm: Copy the round and reshuffle its boneyard, or deal it, as
+            simulate() does, and load it into the lane.
+    Reference: None
+    ********************************************************************* */
+    static void startLane(LockstepPlayout& lanes, int lane, const Playout& start, bool isDealt, int roundNumber,
+        std::mt19937& generator);
+};
+
+#endif
\ No newline at end of file